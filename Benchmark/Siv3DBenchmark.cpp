@@ -0,0 +1,450 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <atomic>
+# include <cstdio>
+# include <cstdlib>
+# include <new>
+# include "Siv3DBenchmark.hpp"
+
+SIV3D_SET(EngineOption::Renderer::Headless) // ウィンドウや GPU を使わない
+
+//////////////////////////////////////////////////
+//
+//	メモリ確保の計測
+//
+//	グローバルな operator new / delete を置き換えて、確保の回数と量を数えます。
+//	malloc を直接呼ぶサードパーティライブラリ内の確保は数えられません。
+//
+//////////////////////////////////////////////////
+
+namespace s3dBenchmark
+{
+	namespace detail
+	{
+		static std::atomic<uint64> g_allocationCount{ 0 };
+
+		static std::atomic<uint64> g_allocatedBytes{ 0 };
+
+		[[nodiscard]]
+		static void* Allocate(const size_t size) noexcept
+		{
+			g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+			g_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+			return std::malloc(size ? size : 1);
+		}
+
+		[[nodiscard]]
+		static void* AllocateAligned(const size_t size, const std::align_val_t alignment) noexcept
+		{
+			g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+			g_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+		# if SIV3D_PLATFORM(WINDOWS)
+
+			return ::_aligned_malloc((size ? size : 1), static_cast<size_t>(alignment));
+
+		# else
+
+			void* p = nullptr;
+
+			if (::posix_memalign(&p, Max(static_cast<size_t>(alignment), sizeof(void*)), (size ? size : 1)) != 0)
+			{
+				return nullptr;
+			}
+
+			return p;
+
+		# endif
+		}
+
+		static void FreeAligned(void* const p) noexcept
+		{
+		# if SIV3D_PLATFORM(WINDOWS)
+
+			::_aligned_free(p);
+
+		# else
+
+			std::free(p);
+
+		# endif
+		}
+	}
+
+	uint64 GetAllocationCount() noexcept
+	{
+		return detail::g_allocationCount.load(std::memory_order_relaxed);
+	}
+
+	uint64 GetAllocatedBytes() noexcept
+	{
+		return detail::g_allocatedBytes.load(std::memory_order_relaxed);
+	}
+}
+
+void* operator new(const size_t size)
+{
+	if (void* p = s3dBenchmark::detail::Allocate(size))
+	{
+		return p;
+	}
+
+	throw std::bad_alloc{};
+}
+
+void* operator new[](const size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(const size_t size, const std::nothrow_t&) noexcept
+{
+	return s3dBenchmark::detail::Allocate(size);
+}
+
+void* operator new[](const size_t size, const std::nothrow_t&) noexcept
+{
+	return s3dBenchmark::detail::Allocate(size);
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment)
+{
+	if (void* p = s3dBenchmark::detail::AllocateAligned(size, alignment))
+	{
+		return p;
+	}
+
+	throw std::bad_alloc{};
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment)
+{
+	return operator new(size, alignment);
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return s3dBenchmark::detail::AllocateAligned(size, alignment);
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return s3dBenchmark::detail::AllocateAligned(size, alignment);
+}
+
+void operator delete(void* const p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete[](void* const p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* const p, size_t) noexcept
+{
+	std::free(p);
+}
+
+void operator delete[](void* const p, size_t) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* const p, const std::align_val_t) noexcept
+{
+	s3dBenchmark::detail::FreeAligned(p);
+}
+
+void operator delete[](void* const p, const std::align_val_t) noexcept
+{
+	s3dBenchmark::detail::FreeAligned(p);
+}
+
+void operator delete(void* const p, size_t, const std::align_val_t) noexcept
+{
+	s3dBenchmark::detail::FreeAligned(p);
+}
+
+void operator delete[](void* const p, size_t, const std::align_val_t) noexcept
+{
+	s3dBenchmark::detail::FreeAligned(p);
+}
+
+//////////////////////////////////////////////////
+//
+//	Runner
+//
+//////////////////////////////////////////////////
+
+namespace s3dBenchmark
+{
+	bool Runner::isEnabled(const String& fullName) const
+	{
+		return (m_config.filter.isEmpty() || fullName.includes(m_config.filter));
+	}
+
+	void Runner::addResult(Result&& result, Array<double>& sampleNs)
+	{
+		std::sort(sampleNs.begin(), sampleNs.end());
+
+		result.samples = sampleNs.size();
+		result.minNs = sampleNs.front();
+		result.medianNs = sampleNs[sampleNs.size() / 2];
+		result.p99Ns = sampleNs[(sampleNs.size() - 1) * 99 / 100];
+
+		Console << U"{:<48} | min {:>12.1f} ns | median {:>12.1f} ns | p99 {:>12.1f} ns | {:>8.1f} allocs | {:>10.0f} bytes"_fmt(
+			result.name, result.minNs, result.medianNs, result.p99Ns, result.allocations, result.allocatedBytes);
+
+		m_results << std::move(result);
+	}
+}
+
+//////////////////////////////////////////////////
+//
+//	結果の出力とベースラインとの比較
+//
+//////////////////////////////////////////////////
+
+namespace s3dBenchmark
+{
+	struct Options
+	{
+		Config config;
+
+		FilePath jsonPath = U"Siv3DBenchmark.json";
+
+		FilePath csvPath = U"Siv3DBenchmark.csv";
+
+		FilePath baselinePath;
+
+		/// @brief 中央値がベースラインからこの割合以上遅くなった場合に退行とみなす
+		double threshold = 0.10;
+	};
+
+	/// @brief プロセスの終了コードを設定します。
+	/// @remark `Main()` は戻り値を返せないため、エンジンの終了処理がすべて済んだ後の静的オブジェクトの破棄の時点で、設定した終了コードでプロセスを終了します。
+	class ExitStatus
+	{
+	public:
+
+		ExitStatus() = default;
+
+		ExitStatus(const ExitStatus&) = delete;
+
+		ExitStatus& operator =(const ExitStatus&) = delete;
+
+		~ExitStatus()
+		{
+			if (m_code != EXIT_SUCCESS)
+			{
+				std::fflush(nullptr);
+				std::_Exit(m_code);
+			}
+		}
+
+		void set(const int32 code) noexcept
+		{
+			m_code = code;
+		}
+
+	private:
+
+		int32 m_code = EXIT_SUCCESS;
+	};
+
+	static ExitStatus g_exitStatus;
+
+	[[nodiscard]]
+	static Options ParseCommandLine(const Array<String>& args)
+	{
+		Options options;
+
+		for (size_t i = 1; i < args.size(); ++i)
+		{
+			const String& arg = args[i];
+			const bool hasValue = ((i + 1) < args.size());
+
+			if ((arg == U"--filter") && hasValue)
+			{
+				options.config.filter = args[++i];
+			}
+			else if ((arg == U"--samples") && hasValue)
+			{
+				options.config.samples = Max<size_t>(ParseOr<size_t>(args[++i], options.config.samples), 1);
+			}
+			else if ((arg == U"--json") && hasValue)
+			{
+				options.jsonPath = args[++i];
+			}
+			else if ((arg == U"--csv") && hasValue)
+			{
+				options.csvPath = args[++i];
+			}
+			else if ((arg == U"--baseline") && hasValue)
+			{
+				options.baselinePath = args[++i];
+			}
+			else if ((arg == U"--threshold") && hasValue)
+			{
+				options.threshold = ParseOr<double>(args[++i], options.threshold);
+			}
+			else
+			{
+				Console << U"Unknown option: {}"_fmt(arg);
+				Console << U"Usage: Siv3DBenchmark [--filter <text>] [--samples <n>] [--json <path>] [--csv <path>] [--baseline <path>] [--threshold <ratio>]";
+			}
+		}
+
+		return options;
+	}
+
+	static bool SaveJSON(const FilePathView path, const Array<Result>& results)
+	{
+		JSON json;
+		json[U"version"] = SIV3D_VERSION_STRING;
+		json[U"results"] = Array<JSON>{};
+
+		for (const auto& result : results)
+		{
+			JSON item;
+			item[U"name"] = result.name;
+			item[U"iterations"] = result.iterations;
+			item[U"samples"] = result.samples;
+			item[U"min_ns"] = result.minNs;
+			item[U"median_ns"] = result.medianNs;
+			item[U"p99_ns"] = result.p99Ns;
+			item[U"allocations"] = result.allocations;
+			item[U"allocated_bytes"] = result.allocatedBytes;
+			json[U"results"].push_back(item);
+		}
+
+		return json.save(path);
+	}
+
+	static bool SaveCSV(const FilePathView path, const Array<Result>& results)
+	{
+		TextWriter writer{ path };
+
+		if (not writer)
+		{
+			return false;
+		}
+
+		writer << U"name,iterations,samples,min_ns,median_ns,p99_ns,allocations,allocated_bytes";
+
+		for (const auto& result : results)
+		{
+			writer << U"{},{},{},{:.1f},{:.1f},{:.1f},{:.2f},{:.0f}"_fmt(
+				result.name, result.iterations, result.samples, result.minNs, result.medianNs, result.p99Ns, result.allocations, result.allocatedBytes);
+		}
+
+		return true;
+	}
+
+	/// @brief ベースラインと比較し、退行したベンチマークの数を返します。
+	static size_t CompareWithBaseline(const FilePathView path, const Array<Result>& results, const double threshold)
+	{
+		const JSON baseline = JSON::Load(path);
+
+		if (not baseline)
+		{
+			Console << U"Failed to load the baseline `{}`"_fmt(path);
+			return 0;
+		}
+
+		HashTable<String, std::pair<double, double>> baselineResults;
+
+		for (const auto& item : baseline[U"results"].arrayView())
+		{
+			baselineResults.emplace(item[U"name"].getString(), std::pair{ item[U"median_ns"].get<double>(), item[U"allocations"].get<double>() });
+		}
+
+		Console << U"\n---- Comparison with `{}` (threshold: +{:.0f}%) ----"_fmt(path, (threshold * 100));
+
+		size_t regressions = 0;
+
+		for (const auto& result : results)
+		{
+			const auto it = baselineResults.find(result.name);
+
+			if (it == baselineResults.end())
+			{
+				Console << U"{:<48} | new"_fmt(result.name);
+				continue;
+			}
+
+			const auto [baselineMedianNs, baselineAllocations] = it->second;
+			const double ratio = (result.medianNs / baselineMedianNs);
+			const bool slower = ((1.0 + threshold) < ratio);
+			const bool moreAllocations = (baselineAllocations + 0.5 < result.allocations);
+
+			if (slower || moreAllocations)
+			{
+				++regressions;
+			}
+
+			Console << U"{:<48} | {:>6.2f}x | allocs {:>8.1f} -> {:>8.1f}{}"_fmt(
+				result.name, ratio, baselineAllocations, result.allocations, ((slower || moreAllocations) ? U" | REGRESSION" : U""));
+		}
+
+		Console << U"{} regression(s)"_fmt(regressions);
+
+		return regressions;
+	}
+}
+
+void Main()
+{
+	using namespace s3dBenchmark;
+
+	const Options options = ParseCommandLine(System::GetCommandLineArgs());
+	Runner runner{ options.config };
+
+	const std::pair<StringView, void(*)(Runner&)> groups[] =
+	{
+		{ U"Unicode", RunUnicode },
+		{ U"Image", RunImage },
+		{ U"HashTable", RunHashTable },
+		{ U"Polygon", RunPolygon },
+		{ U"JSON", RunJSON },
+		{ U"Vertex2DBuilder", RunVertex2DBuilder },
+	};
+
+	for (const auto& [name, run] : groups)
+	{
+		runner.setGroup(name);
+		run(runner);
+	}
+
+	const Array<Result>& results = runner.getResults();
+
+	if (options.jsonPath && (not SaveJSON(options.jsonPath, results)))
+	{
+		Console << U"Failed to save `{}`"_fmt(options.jsonPath);
+	}
+
+	if (options.csvPath && (not SaveCSV(options.csvPath, results)))
+	{
+		Console << U"Failed to save `{}`"_fmt(options.csvPath);
+	}
+
+	if (options.baselinePath)
+	{
+		// 退行があった場合は、CI などで検出できるよう 0 以外の終了コードを返す
+		if (CompareWithBaseline(options.baselinePath, results, options.threshold))
+		{
+			g_exitStatus.set(EXIT_FAILURE);
+		}
+	}
+}
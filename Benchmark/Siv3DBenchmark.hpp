@@ -0,0 +1,193 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D.hpp>
+
+using namespace s3d;
+using namespace std::literals;
+
+namespace s3dBenchmark
+{
+	/// @brief 計算結果がコンパイラの最適化で消されないようにします。
+	template <class Type>
+	inline void DoNotOptimize(const Type& value)
+	{
+	# if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "m"(value) : "memory");
+	# else
+		static const void* volatile sink;
+		sink = std::addressof(value);
+	# endif
+	}
+
+	/// @brief これまでのメモリ確保回数を返します。
+	[[nodiscard]]
+	uint64 GetAllocationCount() noexcept;
+
+	/// @brief これまでのメモリ確保量（バイト）を返します。
+	[[nodiscard]]
+	uint64 GetAllocatedBytes() noexcept;
+
+	/// @brief 1 つのベンチマークの計測結果
+	struct Result
+	{
+		/// @brief ベンチマーク名（`グループ/名前`）
+		String name;
+
+		/// @brief サンプルあたりの反復回数
+		size_t iterations = 0;
+
+		/// @brief サンプル数
+		size_t samples = 0;
+
+		/// @brief 1 回あたりの所要時間の最小値（ナノ秒）
+		double minNs = 0.0;
+
+		/// @brief 1 回あたりの所要時間の中央値（ナノ秒）
+		double medianNs = 0.0;
+
+		/// @brief 1 回あたりの所要時間の 99 パーセンタイル（ナノ秒）
+		double p99Ns = 0.0;
+
+		/// @brief 1 回あたりのメモリ確保回数
+		double allocations = 0.0;
+
+		/// @brief 1 回あたりのメモリ確保量（バイト）
+		double allocatedBytes = 0.0;
+	};
+
+	struct Config
+	{
+		/// @brief 名前にこの文字列を含むベンチマークだけを実行する（空の場合はすべて）
+		String filter;
+
+		/// @brief 1 つのベンチマークで取るサンプル数
+		size_t samples = 50;
+
+		/// @brief 1 サンプルの目標所要時間（ナノ秒）
+		uint64 sampleTimeNs = 2'000'000;
+
+		/// @brief 1 つのベンチマークにかける時間の上限（ナノ秒）。最低 5 サンプルは取ります。
+		uint64 maxTimeNs = 5'000'000'000;
+	};
+
+	class Runner
+	{
+	public:
+
+		explicit Runner(const Config& config)
+			: m_config{ config } {}
+
+		/// @brief 現在のグループ名を設定します。
+		/// @param group グループ名
+		void setGroup(StringView group)
+		{
+			m_group = group;
+		}
+
+		/// @brief ベンチマークを実行し、結果を記録します。
+		/// @param name ベンチマーク名
+		/// @param f 計測する処理。1 回の呼び出しが 1 反復です。
+		template <class Fty>
+		void run(StringView name, Fty f)
+		{
+			const String fullName = (m_group + U'/' + name);
+
+			if (not isEnabled(fullName))
+			{
+				return;
+			}
+
+			// ウォームアップを兼ねて、1 サンプルが目標時間以上になる反復回数を求める
+			size_t iterations = 1;
+
+			for (;;)
+			{
+				const uint64 t0 = Time::GetNanosec();
+
+				for (size_t i = 0; i < iterations; ++i)
+				{
+					f();
+				}
+
+				const uint64 elapsed = (Time::GetNanosec() - t0);
+
+				if ((m_config.sampleTimeNs <= elapsed) || ((size_t{ 1 } << 30) <= iterations))
+				{
+					break;
+				}
+
+				iterations *= 2;
+			}
+
+			Result result{ .name = fullName, .iterations = iterations };
+			Array<double> sampleNs;
+			uint64 allocations = 0, allocatedBytes = 0;
+			const uint64 startTime = Time::GetNanosec();
+
+			for (size_t s = 0; s < m_config.samples; ++s)
+			{
+				const uint64 allocationCount0 = GetAllocationCount();
+				const uint64 allocatedBytes0 = GetAllocatedBytes();
+				const uint64 t0 = Time::GetNanosec();
+
+				for (size_t i = 0; i < iterations; ++i)
+				{
+					f();
+				}
+
+				const uint64 t1 = Time::GetNanosec();
+				allocations += (GetAllocationCount() - allocationCount0);
+				allocatedBytes += (GetAllocatedBytes() - allocatedBytes0);
+				sampleNs << (static_cast<double>(t1 - t0) / iterations);
+
+				if ((5 <= sampleNs.size()) && (m_config.maxTimeNs < (t1 - startTime)))
+				{
+					break;
+				}
+			}
+
+			const double totalIterations = static_cast<double>(iterations * sampleNs.size());
+			result.allocations = (allocations / totalIterations);
+			result.allocatedBytes = (allocatedBytes / totalIterations);
+
+			addResult(std::move(result), sampleNs);
+		}
+
+		[[nodiscard]]
+		const Array<Result>& getResults() const noexcept
+		{
+			return m_results;
+		}
+
+	private:
+
+		Config m_config;
+
+		String m_group;
+
+		Array<Result> m_results;
+
+		[[nodiscard]]
+		bool isEnabled(const String& fullName) const;
+
+		void addResult(Result&& result, Array<double>& sampleNs);
+	};
+
+	// 各サブシステムのベンチマーク
+	void RunUnicode(Runner& runner);
+	void RunImage(Runner& runner);
+	void RunHashTable(Runner& runner);
+	void RunPolygon(Runner& runner);
+	void RunJSON(Runner& runner);
+	void RunVertex2DBuilder(Runner& runner);
+}
@@ -0,0 +1,119 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DBenchmark.hpp"
+
+namespace s3dBenchmark
+{
+	void RunHashTable(Runner& runner)
+	{
+		constexpr size_t N = 100'000;
+
+		SmallRNG rng{ 12345 };
+		const Array<uint64> keys = Array<uint64>::IndexedGenerate(N, [&](size_t) { return rng(); });
+		const Array<uint64> missingKeys = Array<uint64>::IndexedGenerate(N, [&](size_t) { return rng(); });
+		const Array<String> stringKeys = keys.map([](const uint64 key) { return U"key_{:016x}"_fmt(key); });
+
+		s3d::HashTable<uint64, uint64> table;
+		s3d::HashTable<String, uint64> stringTable;
+
+		for (size_t i = 0; i < N; ++i)
+		{
+			table.emplace(keys[i], i);
+			stringTable.emplace(stringKeys[i], i);
+		}
+
+		runner.run(U"insert uint64 100K", [&]()
+		{
+			s3d::HashTable<uint64, uint64> t;
+
+			for (size_t i = 0; i < N; ++i)
+			{
+				t.emplace(keys[i], i);
+			}
+
+			DoNotOptimize(t);
+		});
+
+		runner.run(U"insert uint64 100K (reserved)", [&]()
+		{
+			s3d::HashTable<uint64, uint64> t;
+			t.reserve(N);
+
+			for (size_t i = 0; i < N; ++i)
+			{
+				t.emplace(keys[i], i);
+			}
+
+			DoNotOptimize(t);
+		});
+
+		runner.run(U"find uint64 hit 100K", [&]()
+		{
+			uint64 sum = 0;
+
+			for (const auto key : keys)
+			{
+				sum += table.find(key)->second;
+			}
+
+			DoNotOptimize(sum);
+		});
+
+		runner.run(U"find uint64 miss 100K", [&]()
+		{
+			size_t count = 0;
+
+			for (const auto key : missingKeys)
+			{
+				count += table.contains(key);
+			}
+
+			DoNotOptimize(count);
+		});
+
+		runner.run(U"insert String 100K", [&]()
+		{
+			s3d::HashTable<String, uint64> t;
+
+			for (size_t i = 0; i < N; ++i)
+			{
+				t.emplace(stringKeys[i], i);
+			}
+
+			DoNotOptimize(t);
+		});
+
+		runner.run(U"find String hit 100K", [&]()
+		{
+			uint64 sum = 0;
+
+			for (const auto& key : stringKeys)
+			{
+				sum += stringTable.find(key)->second;
+			}
+
+			DoNotOptimize(sum);
+		});
+
+		runner.run(U"iterate 100K", [&]()
+		{
+			uint64 sum = 0;
+
+			for (const auto& [key, value] : table)
+			{
+				sum += (key ^ value);
+			}
+
+			DoNotOptimize(sum);
+		});
+	}
+}
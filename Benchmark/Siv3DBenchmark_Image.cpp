@@ -0,0 +1,35 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DBenchmark.hpp"
+
+namespace s3dBenchmark
+{
+	void RunImage(Runner& runner)
+	{
+		// ファイルに依存しない、決まった内容の画像
+		const s3d::Image image{ 1024, 1024, Arg::generator = [](const Point pos)
+		{
+			return Color{ static_cast<uint8>(pos.x), static_cast<uint8>(pos.y), static_cast<uint8>((pos.x ^ pos.y) * 7), 255 };
+		} };
+
+		const Blob png = image.encodePNG();
+
+		runner.run(U"Image(1024x1024, Color)", [&]() { DoNotOptimize(s3d::Image{ 1024, 1024, Palette::Orange }); });
+		runner.run(U"fill 1024x1024", [&, target = s3d::Image{ 1024, 1024 }]() mutable { target.fill(Palette::Skyblue); DoNotOptimize(target); });
+		runner.run(U"mirrored 1024x1024", [&]() { DoNotOptimize(image.mirrored()); });
+		runner.run(U"grayscaled 1024x1024", [&]() { DoNotOptimize(image.grayscaled()); });
+		runner.run(U"scaled 1024x1024 -> 512x512", [&]() { DoNotOptimize(image.scaled(512, 512)); });
+		runner.run(U"gaussianBlurred 1024x1024 (9)", [&]() { DoNotOptimize(image.gaussianBlurred(9)); });
+		runner.run(U"encodePNG 1024x1024", [&]() { DoNotOptimize(image.encodePNG()); });
+		runner.run(U"decode PNG 1024x1024", [&]() { DoNotOptimize(s3d::Image{ MemoryViewReader{ png.data(), png.size_bytes() } }); });
+	}
+}
@@ -0,0 +1,65 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DBenchmark.hpp"
+
+namespace s3dBenchmark
+{
+	namespace detail
+	{
+		/// @brief ゲームのセーブデータを模した、`count` 個のオブジェクトを持つ JSON を作ります。
+		[[nodiscard]]
+		static s3d::JSON MakeDocument(const size_t count)
+		{
+			SmallRNG rng{ 12345 };
+			Array<s3d::JSON> items;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				s3d::JSON item;
+				item[U"id"] = i;
+				item[U"name"] = U"item_{}"_fmt(i);
+				item[U"position"][U"x"] = Random(-1000.0, 1000.0, rng);
+				item[U"position"][U"y"] = Random(-1000.0, 1000.0, rng);
+				item[U"visible"] = RandomBool(0.5, rng);
+				item[U"tags"] = Array<String>{ U"enemy", U"flying", U"ボス" };
+				items << item;
+			}
+
+			s3d::JSON json;
+			json[U"items"] = items;
+			return json;
+		}
+	}
+
+	void RunJSON(Runner& runner)
+	{
+		const s3d::JSON json = detail::MakeDocument(5'000);
+		const String text = json.format();
+		const std::string textUTF8 = json.formatUTF8Minimum();
+
+		runner.run(U"Parse 5K objects", [&]() { DoNotOptimize(s3d::JSON::Parse(text)); });
+		runner.run(U"ParseUTF8 5K objects", [&]() { DoNotOptimize(s3d::JSON::ParseUTF8(textUTF8)); });
+		runner.run(U"format 5K objects", [&]() { DoNotOptimize(json.format()); });
+		runner.run(U"formatUTF8Minimum 5K objects", [&]() { DoNotOptimize(json.formatUTF8Minimum()); });
+		runner.run(U"access 5K objects", [&]()
+		{
+			double sum = 0.0;
+
+			for (const auto& item : json[U"items"].arrayView())
+			{
+				sum += item[U"position"][U"x"].get<double>();
+			}
+
+			DoNotOptimize(sum);
+		});
+	}
+}
@@ -0,0 +1,62 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DBenchmark.hpp"
+
+namespace s3dBenchmark
+{
+	namespace detail
+	{
+		/// @brief 半径を揺らした、`n` 頂点の単純多角形の外周を作ります。
+		[[nodiscard]]
+		static Array<Vec2> MakeBlob(const size_t n, const Vec2& center, const double r, SmallRNG& rng)
+		{
+			Array<Vec2> outer(n);
+
+			for (size_t i = 0; i < n; ++i)
+			{
+				const double angle = (Math::TwoPi * i / n);
+				outer[i] = (center + Circular{ (r * Random(0.8, 1.0, rng)), angle });
+			}
+
+			return outer;
+		}
+	}
+
+	void RunPolygon(Runner& runner)
+	{
+		SmallRNG rng{ 12345 };
+		const Array<Vec2> outer = detail::MakeBlob(1024, Vec2{ 0, 0 }, 300.0, rng);
+		const Array<Vec2> hole = detail::MakeBlob(256, Vec2{ 0, 0 }, 100.0, rng);
+		const s3d::Polygon polygon{ outer };
+		const s3d::Polygon other{ detail::MakeBlob(1024, Vec2{ 250, 0 }, 300.0, rng) };
+		const s3d::Polygon star = Shape2D::NStar(64, 300, 200).asPolygon();
+		const Array<Vec2> points = Array<Vec2>::IndexedGenerate(10'000, [&](size_t) { return RandomVec2(Circle{ 300 }, rng); });
+
+		runner.run(U"Polygon(1024 vertices)", [&]() { DoNotOptimize(s3d::Polygon{ outer }); });
+		runner.run(U"Polygon(1024 vertices, 1 hole)", [&]() { DoNotOptimize(s3d::Polygon{ outer, { hole } }); });
+		runner.run(U"calculateBuffer(8) star 128", [&]() { DoNotOptimize(star.calculateBuffer(8.0)); });
+		runner.run(U"simplified 1024", [&]() { DoNotOptimize(polygon.simplified(4.0)); });
+		runner.run(U"intersects 1024 x 1024", [&]() { DoNotOptimize(polygon.intersects(other)); });
+		runner.run(U"ConvexHull 10K points", [&]() { DoNotOptimize(Geometry2D::ConvexHull(points)); });
+		runner.run(U"contains 10K points", [&]()
+		{
+			size_t count = 0;
+
+			for (const auto& point : points)
+			{
+				count += polygon.contains(point);
+			}
+
+			DoNotOptimize(count);
+		});
+	}
+}
@@ -0,0 +1,51 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DBenchmark.hpp"
+
+namespace s3dBenchmark
+{
+	namespace detail
+	{
+		/// @brief `pieces` をランダムに並べた、`length` 文字以上のテキストを作ります。
+		[[nodiscard]]
+		static String MakeText(const Array<String>& pieces, const size_t length)
+		{
+			SmallRNG rng{ 12345 };
+			String text;
+			text.reserve(length + 64);
+
+			while (text.size() < length)
+			{
+				text.append(pieces[Random<size_t>(0, (pieces.size() - 1), rng)]);
+			}
+
+			return text;
+		}
+	}
+
+	void RunUnicode(Runner& runner)
+	{
+		const String asciiText = detail::MakeText({ U"Hello, Siv3D! ", U"The quick brown fox jumps over the lazy dog. ", U"0123456789\n" }, (256 * 1024));
+		const String mixedText = detail::MakeText({ U"Siv3D ", U"こんにちは、", U"世界。", U"Ünïcödé ", U"🐈🐕 ", U"\n" }, (256 * 1024));
+
+		const std::string asciiUTF8 = Unicode::ToUTF8(asciiText);
+		const std::string mixedUTF8 = Unicode::ToUTF8(mixedText);
+		const std::u16string mixedUTF16 = Unicode::ToUTF16(mixedText);
+
+		runner.run(U"UTF8ToUTF32 ASCII 256K", [&]() { DoNotOptimize(Unicode::FromUTF8(asciiUTF8)); });
+		runner.run(U"UTF8ToUTF32 mixed 256K", [&]() { DoNotOptimize(Unicode::FromUTF8(mixedUTF8)); });
+		runner.run(U"UTF32ToUTF8 ASCII 256K", [&]() { DoNotOptimize(Unicode::ToUTF8(asciiText)); });
+		runner.run(U"UTF32ToUTF8 mixed 256K", [&]() { DoNotOptimize(Unicode::ToUTF8(mixedText)); });
+		runner.run(U"UTF16ToUTF32 mixed 256K", [&]() { DoNotOptimize(Unicode::FromUTF16(mixedUTF16)); });
+		runner.run(U"UTF32ToUTF16 mixed 256K", [&]() { DoNotOptimize(Unicode::ToUTF16(mixedText)); });
+	}
+}
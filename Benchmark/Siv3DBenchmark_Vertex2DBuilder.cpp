@@ -0,0 +1,146 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DBenchmark.hpp"
+# include <Siv3D/Renderer2D/Vertex2DBuilder.hpp>
+
+namespace s3dBenchmark
+{
+	namespace detail
+	{
+		/// @brief GPU を使わずに頂点を書き込むバッファ
+		class VertexSink
+		{
+		public:
+
+			VertexSink()
+				: m_vertices(1 << 20)
+				, m_indices(1 << 21) {}
+
+			void clear() noexcept
+			{
+				m_vertexCount = 0;
+				m_indexCount = 0;
+			}
+
+			[[nodiscard]]
+			BufferCreatorFunc creator()
+			{
+				return [this](const Vertex2D::IndexType vertexSize, const Vertex2D::IndexType indexSize) -> Vertex2DBufferPointer
+				{
+					if ((m_vertices.size() < (m_vertexCount + vertexSize))
+						|| (m_indices.size() < (m_indexCount + indexSize)))
+					{
+						clear();
+					}
+
+					const Vertex2DBufferPointer p{ (m_vertices.data() + m_vertexCount), (m_indices.data() + m_indexCount), static_cast<Vertex2D::IndexType>(m_vertexCount) };
+					m_vertexCount += vertexSize;
+					m_indexCount += indexSize;
+					return p;
+				};
+			}
+
+			[[nodiscard]]
+			size_t vertexCount() const noexcept
+			{
+				return m_vertexCount;
+			}
+
+		private:
+
+			Array<Vertex2D> m_vertices;
+
+			Array<Vertex2D::IndexType> m_indices;
+
+			size_t m_vertexCount = 0;
+
+			size_t m_indexCount = 0;
+		};
+	}
+
+	void RunVertex2DBuilder(Runner& runner)
+	{
+		constexpr size_t N = 10'000;
+
+		SmallRNG rng{ 12345 };
+		const Array<Float2> positions = Array<Float2>::IndexedGenerate(N, [&](size_t) { return Float2{ RandomVec2(RectF{ 1280, 720 }, rng) }; });
+		const Float4 color = ColorF{ Palette::Orange }.toFloat4();
+		const Float4 colors[2] = { color, color };
+		const s3d::Polygon polygon = Shape2D::NStar(16, 40, 20).asPolygon();
+
+		detail::VertexSink sink;
+		const BufferCreatorFunc creator = sink.creator();
+		Array<Float2> buffer;
+
+		runner.run(U"BuildRect 10K", [&]()
+		{
+			sink.clear();
+
+			for (const auto& pos : positions)
+			{
+				DoNotOptimize(Vertex2DBuilder::BuildRect(creator, FloatRect{ pos.x, pos.y, (pos.x + 32), (pos.y + 32) }, color));
+			}
+		});
+
+		runner.run(U"BuildCircle r=16 10K", [&]()
+		{
+			sink.clear();
+
+			for (const auto& pos : positions)
+			{
+				DoNotOptimize(Vertex2DBuilder::BuildCircle(creator, pos, 16.0f, color, color, 1.0f));
+			}
+		});
+
+		runner.run(U"BuildCircle r=200 1K", [&]()
+		{
+			sink.clear();
+
+			for (size_t i = 0; i < 1'000; ++i)
+			{
+				DoNotOptimize(Vertex2DBuilder::BuildCircle(creator, positions[i], 200.0f, color, color, 1.0f));
+			}
+		});
+
+		runner.run(U"BuildLine 10K", [&]()
+		{
+			sink.clear();
+
+			for (size_t i = 1; i < positions.size(); ++i)
+			{
+				DoNotOptimize(Vertex2DBuilder::BuildLine(LineStyle::SquareCap, creator, positions[i - 1], positions[i], 2.0f, colors, 1.0f));
+			}
+		});
+
+		runner.run(U"BuildRoundRect 10K", [&]()
+		{
+			sink.clear();
+
+			for (const auto& pos : positions)
+			{
+				DoNotOptimize(Vertex2DBuilder::BuildRoundRect(creator, buffer, FloatRect{ pos.x, pos.y, (pos.x + 64), (pos.y + 32) }, 64.0f, 32.0f, 8.0f, color, 1.0f));
+			}
+		});
+
+		runner.run(U"BuildPolygon star 10K", [&]()
+		{
+			sink.clear();
+
+			for (const auto& pos : positions)
+			{
+				DoNotOptimize(Vertex2DBuilder::BuildPolygon(creator, polygon.vertices(), polygon.indices(), pos, color));
+			}
+		});
+
+		DoNotOptimize(sink.vertexCount());
+	}
+}
@@ -192,6 +192,9 @@
 // 非同期タスク | Asynchronous task
 # include <Siv3D/AsyncTask.hpp>
 
+// キャンセルトークン | Cancellation token
+# include <Siv3D/CancellationToken.hpp>
+
 // 子プロセス | Child process
 # include <Siv3D/ChildProcess.hpp>
 
@@ -483,6 +486,9 @@
 // JSON データの検証 | JSON validation
 # include <Siv3D/JSONValidator.hpp>
 
+// JSON データのストリーム読み込み | JSON streaming reader
+# include <Siv3D/JSONReader.hpp>
+
 // XML ファイルの読み込み | XML parser
 # include <Siv3D/XMLReader.hpp>
 
@@ -903,6 +909,9 @@
 // TCP 通信のエラー | TCP connection errors
 # include <Siv3D/TCPError.hpp>
 
+// TCP セッションの統計 | TCP session statistics
+# include <Siv3D/TCPSessionStats.hpp>
+
 // TCP サーバ | TCP server
 # include <Siv3D/TCPServer.hpp>
 
@@ -1445,6 +1454,9 @@
 
 # include <Siv3D/NavMeshConfig.hpp>
 
+// ナビメッシュ上の経路の再利用 | Navigation mesh corridor
+# include <Siv3D/NavMeshCorridor.hpp>
+
 // ナビメッシュ | Navigation mesh
 # include <Siv3D/NavMesh.hpp>
 
@@ -1585,6 +1597,9 @@
 
 # include <Siv3D/TextureDesc.hpp>
 
+// ブロック圧縮画像 | Block-compressed image
+# include <Siv3D/BlockCompressedImage.hpp>
+
 // テクスチャ | Texture
 # include <Siv3D/Texture.hpp>
 
@@ -1605,6 +1620,9 @@
 // ビデオ・テクスチャ | Video texture
 # include <Siv3D/VideoTexture.hpp>
 
+// GIF アニメーション・テクスチャ | Animated GIF texture
+# include <Siv3D/AnimatedGIFTexture.hpp>
+
 // レンダーテクスチャ | Render texture
 # include <Siv3D/RenderTexture.hpp>
 
@@ -1639,7 +1657,11 @@
 // フォント | Font
 # include <Siv3D/Font.hpp>
 
+// フォントのグリフキャッシュの統計 | Font glyph cache statistics
+# include <Siv3D/FontCacheStat.hpp>
+
 # include <Siv3D/TextStyle.hpp>
+# include <Siv3D/ShapedText.hpp>
 # include <Siv3D/DrawableText.hpp>
 # include <Siv3D/Print.hpp>
 # include <Siv3D/PutText.hpp>
@@ -1772,6 +1794,7 @@
 # include <Siv3D/Physics2D/P2ContactPair.hpp>
 # include <Siv3D/Physics2D/P2Contact.hpp>
 # include <Siv3D/Physics2D/P2Collision.hpp>
+# include <Siv3D/Physics2D/P2RaycastHit.hpp>
 # include <Siv3D/Physics2D/P2World.hpp>
 # include <Siv3D/Physics2D/P2Body.hpp>
 # include <Siv3D/Physics2D/P2Shape.hpp>
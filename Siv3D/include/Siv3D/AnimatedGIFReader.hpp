@@ -19,10 +19,15 @@
 namespace s3d
 {
 	/// @brief GIF アニメーションの読み込み
+	/// @remark `read()` は全フレームを一度にデコードします。
+	/// @remark `readFrame()` は 1 フレームずつデコードするため、フレーム数の多い GIF アニメーションでもメモリ使用量を抑えられます。
 	class AnimatedGIFReader
 	{
 	public:
 
+		/// @brief ランダムアクセス用に、キーフレームとしてキャッシュするフレームの間隔のデフォルト値
+		static constexpr size_t DefaultKeyframeInterval = 16;
+
 		/// @brief デフォルトコンストラクタ
 		SIV3D_NODISCARD_CXX20
 		AnimatedGIFReader();
@@ -80,6 +85,59 @@ namespace s3d
 		/// @return デコードに成功した場合 true, それ以外の場合は false
 		bool read(Array<Image>& images, Array<int32>& delaysMillisec, int32& durationMillisec) const;
 
+		/// @brief GIF アニメーションの幅と高さ（ピクセル）を返します。
+		/// @return GIF アニメーションの幅と高さ（ピクセル）
+		[[nodiscard]]
+		Size getSize() const noexcept;
+
+		/// @brief GIF アニメーションのフレーム数を返します。
+		/// @return GIF アニメーションのフレーム数
+		[[nodiscard]]
+		size_t getFrameCount() const noexcept;
+
+		/// @brief 各フレームのフレーム時間（ミリ秒）を返します。
+		/// @return 各フレームのフレーム時間（ミリ秒）
+		[[nodiscard]]
+		const Array<int32>& getDelaysMillisec() const noexcept;
+
+		/// @brief フレームの合計時間（ミリ秒）を返します。
+		/// @return フレームの合計時間（ミリ秒）
+		[[nodiscard]]
+		int32 getDurationMillisec() const noexcept;
+
+		/// @brief 次に `readFrame()` で読み込まれるフレームのインデックスを返します。
+		/// @return 次に読み込まれるフレームのインデックス
+		[[nodiscard]]
+		size_t getCurrentFrameIndex() const noexcept;
+
+		/// @brief 次に `readFrame()` で読み込むフレームを設定します。
+		/// @param index フレームのインデックス
+		/// @remark 直前のキーフレームから目的のフレームまでをデコードし直します。
+		/// @return 設定に成功した場合 true, インデックスが範囲外の場合は false
+		bool setCurrentFrameIndex(size_t index);
+
+		/// @brief 現在のフレームをデコードして、次のフレームに進めます。
+		/// @param image 結果のフレームを格納する画像。同じ大きさの画像を渡すとメモリの再確保を避けられます
+		/// @return デコードに成功した場合 true, 最後のフレームを読み終えている場合は false
+		bool readFrame(Image& image);
+
+		/// @brief 現在のフレームをデコードして、次のフレームに進めます。
+		/// @param image 結果のフレームを格納する画像。同じ大きさの画像を渡すとメモリの再確保を避けられます
+		/// @param delayMillisec フレーム時間（ミリ秒）を格納する変数
+		/// @return デコードに成功した場合 true, 最後のフレームを読み終えている場合は false
+		bool readFrame(Image& image, int32& delayMillisec);
+
+		/// @brief キーフレームとしてキャッシュするフレームの間隔を設定します。
+		/// @param interval キーフレームの間隔。0 の場合はキャッシュせず、シーク時は常に先頭からデコードします
+		/// @remark キャッシュは `getFrameCount() / interval` 枚の画像（それぞれ `getSize()` の大きさ）を上限に、デコードの途中で作られます。
+		/// @remark 設定を変更すると、既存のキャッシュは破棄されます。
+		void setKeyframeInterval(size_t interval);
+
+		/// @brief キーフレームとしてキャッシュするフレームの間隔を返します。
+		/// @return キーフレームの間隔
+		[[nodiscard]]
+		size_t getKeyframeInterval() const noexcept;
+
 		/// @brief 時間を GIF アニメーションのフレームインデックスに変換します。
 		/// @param timeMillisec 時間（ミリ秒）
 		/// @param delaysMillisec GIF アニメーションのフレーム時間（ミリ秒）を格納した配列
@@ -16,6 +16,7 @@
 # endif
 # include <vector>
 # ifndef SIV3D_NO_CONCURRENT_API
+	# include <atomic>
 	# include <future>
 	# if SIV3D_PLATFORM(WINDOWS)
 	#	include <execution>
@@ -13,11 +13,112 @@
 # ifndef SIV3D_NO_CONCURRENT_API
 
 # include <future>
+# include <memory>
+# include <mutex>
+# include <vector>
+# include <functional>
 # include <type_traits>
 # include "Platform.hpp"
+# include "Array.hpp"
+# include "Threading.hpp"
+# include "CancellationToken.hpp"
 
 namespace s3d
 {
+	/// @brief 非同期処理のタスクを実行するスレッド
+	enum class AsyncLaunch : uint8
+	{
+		/// @brief 共有スレッドプールで実行します。
+		ThreadPool,
+
+		/// @brief 専用のスレッドを作成して実行します。
+		/// @remark 通信の待ち受けなど、長時間スレッドを占有する処理に使います。
+		DedicatedThread,
+	};
+
+	/// @brief 継続処理を実行するスレッド
+	enum class ContinuationContext : uint8
+	{
+		/// @brief 共有スレッドプールで実行します。
+		ThreadPool,
+
+		/// @brief `System::Update()` の中でメインスレッドで実行します。
+		MainThread,
+	};
+
+	template <class Type>
+	class AsyncTask;
+
+	namespace detail
+	{
+		/// @brief 非同期処理の完了時に実行する処理のリスト
+		class AsyncTaskContinuations
+		{
+		public:
+
+			/// @brief 非同期処理の完了を通知し、登録されている処理を実行します。
+			void complete();
+
+			/// @brief 非同期処理の完了時に実行する処理を登録します。
+			/// @param f 実行する処理
+			/// @remark 既に完了している場合は、直ちに実行します。
+			void add(std::function<void()> f);
+
+		private:
+
+			std::mutex m_mutex;
+
+			std::vector<std::function<void()>> m_functions;
+
+			bool m_completed = false;
+		};
+
+		/// @brief 次回の `System::Update()` でメインスレッドで実行する処理を登録します。
+		/// @param f 実行する処理
+		void AsyncTaskPostToMainThread(std::function<void()> f);
+
+		void AsyncTaskLaunchDedicatedThread(std::function<void()> f);
+
+		struct AsyncTaskAccess
+		{
+			template <class Type>
+			[[nodiscard]]
+			static AsyncTask<Type> Make(std::future<Type>&& future, std::shared_ptr<AsyncTaskContinuations> continuations, bool waitOnDestruction);
+
+			template <class Type>
+			[[nodiscard]]
+			static const std::shared_ptr<AsyncTaskContinuations>& GetContinuations(const AsyncTask<Type>& task) noexcept;
+
+			template <class Type>
+			[[nodiscard]]
+			static std::future<Type> Release(AsyncTask<Type>& task) noexcept;
+
+			template <class Type>
+			static void EnsureContinuations(AsyncTask<Type>& task);
+		};
+
+		template <class Type, class Fty>
+		struct AsyncTaskContinuationResult
+		{
+			using type = std::invoke_result_t<Fty, Type>;
+		};
+
+		template <class Fty>
+		struct AsyncTaskContinuationResult<void, Fty>
+		{
+			using type = std::invoke_result_t<Fty>;
+		};
+
+		template <class Type, class Fty>
+		using AsyncTaskContinuationResult_t = typename AsyncTaskContinuationResult<Type, std::decay_t<Fty>>::type;
+
+		template <class Type, class Fty>
+		struct IsAsyncTaskContinuation : std::is_invocable<Fty, Type> {};
+
+		template <class Fty>
+		struct IsAsyncTaskContinuation<void, Fty> : std::is_invocable<Fty> {};
+	}
+
 	/// @brief 非同期処理クラス
 	/// @tparam Type 非同期処理のタスクで実行する関数の戻り値の型
 	template <class Type>
@@ -43,24 +144,37 @@ namespace s3d
 		/// @tparam ...Args 非同期処理のタスクで実行する関数の引数の型
 		/// @param f 非同期処理のタスクで実行する関数
 		/// @param ...args 非同期処理のタスクで実行する関数の引数
-		/// @remark 作成と同時にタスクが非同期で実行されます。
+		/// @remark 作成と同時に、タスクが共有スレッドプールで非同期に実行されます。
 		/// @remark 参照を渡す場合は `std::ref()` を使ってください。
 		template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<Fty, Args...>>* = nullptr>
 		SIV3D_NODISCARD_CXX20
 		explicit AsyncTask(Fty&& f, Args&&... args);
 
-		~AsyncTask() = default;
+		/// @brief 非同期処理のタスクを作成します。
+		/// @tparam Fty 非同期処理のタスクで実行する関数の型
+		/// @tparam ...Args 非同期処理のタスクで実行する関数の引数の型
+		/// @param launch タスクを実行するスレッド
+		/// @param f 非同期処理のタスクで実行する関数
+		/// @param ...args 非同期処理のタスクで実行する関数の引数
+		/// @remark 参照を渡す場合は `std::ref()` を使ってください。
+		template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<Fty, Args...>>* = nullptr>
+		SIV3D_NODISCARD_CXX20
+		AsyncTask(AsyncLaunch launch, Fty&& f, Args&&... args);
+
+		/// @brief デストラクタ
+		/// @remark 関数から作成したタスクが完了していない場合、完了まで待機します。
+		~AsyncTask();
 
 		AsyncTask(const base_type&) = delete;
-		
+
 		AsyncTask(const AsyncTask&) = delete;
-		
+
 		AsyncTask& operator =(const base_type&) = delete;
-		
+
 		AsyncTask& operator =(const AsyncTask&) = delete;
 
 		AsyncTask& operator =(base_type&& other) noexcept;
-		
+
 		AsyncTask& operator =(AsyncTask&& other) noexcept;
 
 		/// @brief 非同期処理を持っているかを返します。
@@ -77,10 +191,12 @@ namespace s3d
 
 		/// @brief タスクが完了した非同期処理の結果を返します。
 		/// @remark タスクが完了していない場合は、完了まで待機します。
+		/// @remark スレッドプールのタスクの中から呼び出した場合は、待機中にスレッドプールのキューにある別のタスクを実行します。
 		/// @return タスクが完了した非同期処理の結果
 		Type get();
 
 		/// @brief 非同期処理のタスク完了を待ちます。
+		/// @remark スレッドプールのタスクの中から呼び出した場合は、待機中にスレッドプールのキューにある別のタスクを実行します。
 		void wait() const;
 
 		template <class Rep, class Period>
@@ -92,25 +208,104 @@ namespace s3d
 		[[nodiscard]]
 		std::shared_future<Type> share() noexcept;
 
+		/// @brief タスクの完了後に実行する継続処理を登録し、その結果を返すタスクを作成します。
+		/// @tparam Fty 継続処理の関数の型。タスクの結果を引数に取ります（`Type` が void の場合は引数なし）
+		/// @param f 継続処理の関数
+		/// @param context 継続処理を実行するスレッド
+		/// @remark このタスクは非同期処理を持たない状態になり、結果は継続処理に渡されます。
+		/// @remark このタスクが例外を投げた場合、継続処理は実行されず、返されるタスクの `get()` がその例外を再送出します。
+		/// @remark `ContinuationContext::MainThread` を指定した場合、継続処理は `System::Update()` の中で実行されます。
+		/// @return 継続処理の結果を返すタスク
+		template <class Fty, std::enable_if_t<detail::IsAsyncTaskContinuation<Type, Fty>::value>* = nullptr>
+		[[nodiscard]]
+		auto then(Fty f, ContinuationContext context = ContinuationContext::ThreadPool);
+
+		/// @brief タスクの完了後に実行する継続処理を登録し、その結果を返すタスクを作成します。
+		/// @tparam Fty 継続処理の関数の型。タスクの結果を引数に取ります（`Type` が void の場合は引数なし）
+		/// @param f 継続処理の関数
+		/// @param cancellationToken 継続処理の開始前にキャンセルが要求されていた場合、継続処理を実行しません。
+		/// @param context 継続処理を実行するスレッド
+		/// @remark 継続処理がキャンセルされた場合、返されるタスクの `get()` は `OperationCanceledError` 例外を投げます。
+		/// @return 継続処理の結果を返すタスク
+		template <class Fty, std::enable_if_t<detail::IsAsyncTaskContinuation<Type, Fty>::value>* = nullptr>
+		[[nodiscard]]
+		auto then(Fty f, const CancellationToken& cancellationToken, ContinuationContext context = ContinuationContext::ThreadPool);
+
 	private:
 
+		friend struct detail::AsyncTaskAccess;
+
 		base_type m_data;
+
+		std::shared_ptr<detail::AsyncTaskContinuations> m_continuations;
+
+		bool m_waitOnDestruction = false;
+
+		void waitIfRequired() const;
+
+		void waitWhileRunningPendingTasks() const;
 	};
 
 	template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<Fty, Args...>>* = nullptr>
 	AsyncTask(Fty, Args...)->AsyncTask<std::invoke_result_t<std::decay_t<Fty>, std::decay_t<Args>...>>;
 
+	template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<Fty, Args...>>* = nullptr>
+	AsyncTask(AsyncLaunch, Fty, Args...)->AsyncTask<std::invoke_result_t<std::decay_t<Fty>, std::decay_t<Args>...>>;
+
 	/// @brief 非同期処理のタスクを作成します。
 	/// @tparam Fty 非同期処理のタスクで実行する関数の型
 	/// @tparam ...Args 非同期処理のタスクで実行する関数の引数の型
 	/// @param f 非同期処理のタスクで実行する関数
 	/// @param ...args 非同期処理のタスクで実行する関数の引数
-	/// @remark 作成と同時にタスクが非同期で実行されます。
+	/// @remark 作成と同時に、タスクが共有スレッドプールで非同期に実行されます。
 	/// @remark 参照を渡す場合は `std::ref()` を使ってください。
 	/// @return 作成された非同期処理のタスク
 	template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<Fty, Args...>>* = nullptr>
 	[[nodiscard]]
 	inline auto Async(Fty&& f, Args&&... args);
+
+	/// @brief 非同期処理のタスクを作成します。
+	/// @tparam Fty 非同期処理のタスクで実行する関数の型
+	/// @tparam ...Args 非同期処理のタスクで実行する関数の引数の型
+	/// @param launch タスクを実行するスレッド
+	/// @param f 非同期処理のタスクで実行する関数
+	/// @param ...args 非同期処理のタスクで実行する関数の引数
+	/// @remark 参照を渡す場合は `std::ref()` を使ってください。
+	/// @return 作成された非同期処理のタスク
+	template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<Fty, Args...>>* = nullptr>
+	[[nodiscard]]
+	inline auto Async(AsyncLaunch launch, Fty&& f, Args&&... args);
+
+	/// @brief すべてのタスクが完了したときに完了するタスクを作成します。
+	/// @tparam Type タスクの結果の型
+	/// @param tasks タスクの一覧。各タスクは非同期処理を持たない状態になります。
+	/// @remark 返されるタスクの結果は、各タスクの結果を同じ順に並べた配列です（`Type` が void の場合は結果なし）
+	/// @remark いずれかのタスクが例外を投げた場合、返されるタスクの `get()` がその例外を再送出します。
+	/// @return すべてのタスクが完了したときに完了するタスク
+	template <class Type>
+	[[nodiscard]]
+	auto WhenAll(Array<AsyncTask<Type>> tasks);
+
+	/// @brief `WhenAny()` の結果
+	/// @tparam Type タスクの結果の型
+	template <class Type>
+	struct WhenAnyResult
+	{
+		/// @brief 最初に完了したタスクのインデックス
+		size_t index = 0;
+
+		/// @brief `WhenAny()` に渡したタスクの一覧。各タスクは引き続き `get()` で結果を取得できます。
+		Array<AsyncTask<Type>> tasks;
+	};
+
+	/// @brief いずれかのタスクが完了したときに完了するタスクを作成します。
+	/// @tparam Type タスクの結果の型
+	/// @param tasks タスクの一覧
+	/// @remark 返されるタスクの結果は、最初に完了したタスクのインデックスと、渡したタスクの一覧です。
+	/// @return いずれかのタスクが完了したときに完了するタスク。`tasks` が空の場合は非同期処理を持たないタスク
+	template <class Type>
+	[[nodiscard]]
+	AsyncTask<WhenAnyResult<Type>> WhenAny(Array<AsyncTask<Type>> tasks);
 }
 
 # include "detail/AsyncTask.ipp"
@@ -0,0 +1,139 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "Array.hpp"
+# include "Blob.hpp"
+# include "Image.hpp"
+# include "PointVector.hpp"
+# include "StringView.hpp"
+# include "TextureFormat.hpp"
+# include "PredefinedYesNo.hpp"
+
+namespace s3d
+{
+	/// @brief ブロック圧縮 (BC) された画像とミップマップ
+	/// @remark 4x4 ピクセル単位で圧縮された、GPU にそのまま転送できる画像です。BC1 / BC3 / BC4 / BC5 / BC7 に対応します。
+	/// @remark DDS / KTX2 形式で保存・読み込みでき、ファイルに含まれるミップマップはそのまま使われます。
+	struct BlockCompressedImage
+	{
+		/// @brief ブロック圧縮フォーマット
+		TextureFormat format = TextureFormat::Unknown;
+
+		/// @brief 画像の幅と高さ（ピクセル）
+		Size size{ 0, 0 };
+
+		/// @brief 各ミップレベルの圧縮データ。`mipmaps[0]` が元の大きさの画像です。
+		Array<Blob> mipmaps;
+
+		SIV3D_NODISCARD_CXX20
+		BlockCompressedImage() = default;
+
+		/// @brief 画像をブロック圧縮します。
+		/// @param image 画像
+		/// @param format ブロック圧縮フォーマット
+		/// @param hasMipMap ミップマップも作成する場合 `HasMipMap::Yes`, それ以外の場合は `HasMipMap::No`
+		/// @remark 圧縮は複数のスレッドで行われます。BC4 は画像の R, BC5 は R と G を使います。
+		SIV3D_NODISCARD_CXX20
+		BlockCompressedImage(const Image& image, TextureFormat format, HasMipMap hasMipMap = HasMipMap::Yes);
+
+		/// @brief DDS または KTX2 ファイルを読み込みます。
+		/// @param path ファイルパス
+		SIV3D_NODISCARD_CXX20
+		explicit BlockCompressedImage(FilePathView path);
+
+		/// @brief DDS または KTX2 形式のデータを読み込みます。
+		/// @param reader `IReader` インタフェース
+		SIV3D_NODISCARD_CXX20
+		explicit BlockCompressedImage(IReader&& reader);
+
+		/// @brief 画像が空であるかを返します。
+		/// @return 画像が空である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief 画像が空でないかを返します。
+		/// @return 画像が空でない場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief 画像の幅（ピクセル）を返します。
+		/// @return 画像の幅（ピクセル）
+		[[nodiscard]]
+		int32 width() const noexcept;
+
+		/// @brief 画像の高さ（ピクセル）を返します。
+		/// @return 画像の高さ（ピクセル）
+		[[nodiscard]]
+		int32 height() const noexcept;
+
+		/// @brief ミップレベルの数（元の大きさの画像を含む）を返します。
+		/// @return ミップレベルの数
+		[[nodiscard]]
+		size_t mipLevels() const noexcept;
+
+		/// @brief 指定したミップレベルの画像の幅と高さ（ピクセル）を返します。
+		/// @param level ミップレベル
+		/// @return 画像の幅と高さ（ピクセル）
+		[[nodiscard]]
+		Size mipSize(size_t level) const noexcept;
+
+		/// @brief すべてのミップレベルの圧縮データの合計サイズ（バイト）を返します。
+		/// @return 圧縮データの合計サイズ（バイト）
+		[[nodiscard]]
+		size_t size_bytes() const noexcept;
+
+		/// @brief 指定したミップレベルの画像をデコードします。
+		/// @param level ミップレベル
+		/// @return デコードした画像
+		/// @remark BC4 は (R, 0, 0, 255), BC5 は (R, G, 0, 255) の画像になります。
+		[[nodiscard]]
+		Image decode(size_t level = 0) const;
+
+		/// @brief DDS 形式にエンコードします。
+		/// @return エンコードしたデータ
+		[[nodiscard]]
+		Blob encodeDDS() const;
+
+		/// @brief DDS 形式で保存します。
+		/// @param path ファイルパス
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		bool saveDDS(FilePathView path) const;
+
+		/// @brief KTX2 形式にエンコードします。
+		/// @return エンコードしたデータ
+		[[nodiscard]]
+		Blob encodeKTX2() const;
+
+		/// @brief KTX2 形式で保存します。
+		/// @param path ファイルパス
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		bool saveKTX2(FilePathView path) const;
+
+		/// @brief ブロック圧縮されたデータのサイズ（バイト）を返します。
+		/// @param size 画像の幅と高さ（ピクセル）
+		/// @param format ブロック圧縮フォーマット
+		/// @return データのサイズ（バイト）
+		[[nodiscard]]
+		static size_t CalculateDataSize(const Size& size, TextureFormat format) noexcept;
+
+		/// @brief 画像ファイルを読み込んでブロック圧縮します。結果はキャッシュされ、次回以降はキャッシュから読み込みます。
+		/// @param path 画像ファイルのパス
+		/// @param format ブロック圧縮フォーマット
+		/// @param hasMipMap ミップマップも作成する場合 `HasMipMap::Yes`, それ以外の場合は `HasMipMap::No`
+		/// @param cacheDirectory キャッシュを保存するディレクトリ
+		/// @return ブロック圧縮された画像
+		/// @remark キャッシュは、画像ファイルの内容・フォーマット・ミップマップの有無から決まる名前の KTX2 ファイルです。画像ファイルの内容が変わると作り直されます。
+		[[nodiscard]]
+		static BlockCompressedImage LoadCached(FilePathView path, TextureFormat format, HasMipMap hasMipMap = HasMipMap::Yes, FilePathView cacheDirectory = U"texture_cache/");
+	};
+}
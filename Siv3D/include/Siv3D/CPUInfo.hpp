@@ -85,12 +85,37 @@ namespace s3d
         int ss : 1;
 	};
 
+	/// @brief 実行時ディスパッチで使う SIMD 命令セット
+	enum class SIMDLevel : uint8
+	{
+		/// @brief SIMD を使わない
+		None,
+
+		/// @brief SSE2 (x86-64)
+		SSE2,
+
+		/// @brief SSE4.1 (x86-64)
+		SSE4_1,
+
+		/// @brief AVX2 (x86-64)
+		AVX2,
+
+		/// @brief AVX-512 F / BW / DQ / VL (x86-64)
+		AVX512,
+
+		/// @brief NEON (ARM64)
+		NEON,
+	};
+
     /// @brief CPU 情報
     struct CPUInfo
     {
         /// @brief 対応命令セット
         X86Features features;
 
+        /// @brief CPU が対応する最も高い SIMD 命令セット
+        SIMDLevel simdLevel;
+
         /// @brief 
         int32 family;
         
@@ -111,4 +136,15 @@ namespace s3d
     /// @return ユーザの CPU の情報
 	[[nodiscard]]
 	const CPUInfo& GetCPUInfo() noexcept;
+
+	/// @brief 画像処理や文字コード変換などの実行時ディスパッチで、現在使われている SIMD 命令セットを返します。
+	/// @return 現在使われている SIMD 命令セット
+	/// @remark 既定では CPU が対応する最も高い命令セット (`GetCPUInfo().simdLevel`) です。
+	[[nodiscard]]
+	SIMDLevel GetSIMDLevel() noexcept;
+
+	/// @brief 実行時ディスパッチで使う SIMD 命令セットの上限を設定します。
+	/// @param level 上限。CPU が対応していない命令セットを指定した場合は、CPU が対応する最も高い命令セットになります。
+	/// @remark 各命令セット向けの実装のテストや、性能の比較に使います。
+	void SetMaxSIMDLevel(SIMDLevel level) noexcept;
 }
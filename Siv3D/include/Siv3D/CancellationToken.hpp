@@ -0,0 +1,80 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <memory>
+# include "Common.hpp"
+# include "Error.hpp"
+
+namespace s3d
+{
+	/// @brief 処理のキャンセルが要求されたかを調べるためのトークン
+	/// @remark `CancellationTokenSource::getToken()` で作成します。デフォルト構築したトークンはキャンセルされることがありません。
+	/// @remark キャンセルは協調的です。非同期処理の関数は `isCancellationRequested()` を定期的に調べて、自ら処理を中断する必要があります。
+	class CancellationToken
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		CancellationToken() = default;
+
+		/// @brief キャンセルが要求されたかを返します。
+		/// @return キャンセルが要求された場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isCancellationRequested() const noexcept;
+
+		/// @brief キャンセルが要求されている場合、`OperationCanceledError` 例外を投げます。
+		void throwIfCancellationRequested() const;
+
+		/// @brief キャンセルされる可能性があるトークンであるかを返します。
+		/// @return `CancellationTokenSource` から作成されたトークンである場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool canBeCanceled() const noexcept;
+
+	private:
+
+		friend class CancellationTokenSource;
+
+		std::shared_ptr<std::atomic<bool>> m_canceled;
+
+		SIV3D_NODISCARD_CXX20
+		explicit CancellationToken(std::shared_ptr<std::atomic<bool>> canceled) noexcept;
+	};
+
+	/// @brief キャンセルを要求する側が持つ、`CancellationToken` の作成元
+	class CancellationTokenSource
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		CancellationTokenSource();
+
+		/// @brief このソースから作成されたすべてのトークンにキャンセルを要求します。
+		void cancel() noexcept;
+
+		/// @brief キャンセルが要求されたかを返します。
+		/// @return キャンセルが要求された場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isCancellationRequested() const noexcept;
+
+		/// @brief キャンセルの要求を受け取るトークンを返します。
+		/// @return トークン
+		[[nodiscard]]
+		CancellationToken getToken() const noexcept;
+
+	private:
+
+		std::shared_ptr<std::atomic<bool>> m_canceled;
+	};
+}
+
+# include "detail/CancellationToken.ipp"
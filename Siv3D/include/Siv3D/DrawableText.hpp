@@ -18,13 +18,17 @@
 
 namespace s3d
 {
+	class ShapedText;
+
 	struct DrawableText
 	{
 		Font font;
 
 		String text;
 
-		Array<GlyphCluster> clusters;
+		/// @brief シェーピング結果のグリフクラスター
+		/// @remark フォントのシェーピングキャッシュと共有されるため、描画のたびにコピーされません。
+		std::shared_ptr<const Array<GlyphCluster>> clusters;
 
 		SIV3D_NODISCARD_CXX20
 		DrawableText() = default;
@@ -35,6 +39,17 @@ namespace s3d
 		SIV3D_NODISCARD_CXX20
 		DrawableText(const Font& _font, String&& _text);
 
+		/// @brief シェーピング済みのテキストから、シェーピングをやり直さずに描画用のテキストを作成します。
+		/// @param shapedText シェーピング済みのテキスト
+		/// @remark グリフクラスターは共有されますが、テキストはコピーされます。毎フレーム描画する場合は `shapedText.drawable()` を使ってください。
+		SIV3D_NODISCARD_CXX20
+		explicit DrawableText(const ShapedText& shapedText);
+
+		/// @brief シェーピング結果のグリフクラスターを返します。
+		/// @return グリフクラスター。シェーピングされていない場合は空の配列
+		[[nodiscard]]
+		const Array<GlyphCluster>& getClusters() const noexcept;
+
 		[[nodiscard]]
 		Array<double> getXAdvances() const;
 
@@ -78,6 +78,30 @@ namespace s3d
 			/// @brief リファレンスドライバーを使用
 			Reference
 		};
+
+		/// @brief 2D 描画で GPU に送信する頂点色の形式
+		/// @remark 対応: OpenGL 4.1 / 非グラフィックスモード
+		enum class Vertex2DColor : uint8
+		{
+			/// @brief float4 (1 頂点あたり 32 バイト)
+			Float4,
+
+			/// @brief UNORM8 x 4 (1 頂点あたり 20 バイト)
+			/// @remark 頂点色は [0.0, 1.0] の範囲に飽和され、256 段階に量子化されます。
+			UNorm8,
+		};
+
+		/// @brief 2D 描画で GPU に送信するインデックスの形式
+		/// @remark 対応: OpenGL 4.1 / 非グラフィックスモード
+		enum class Vertex2DIndex : uint8
+		{
+			/// @brief 16-bit (1 バッチあたり最大 65,535 頂点)
+			UInt16,
+
+			/// @brief 32-bit (1 バッチあたり最大 262,144 頂点)
+			/// @remark 大量の頂点を描く場合にバッチ数を減らせますが、インデックスのデータ量は 2 倍になります。
+			UInt32,
+		};
 	};
 
 	struct EngineOptions
@@ -87,6 +111,10 @@ namespace s3d
 		EngineOption::Renderer renderer			= EngineOption::Renderer::PlatformDefault;
 
 		EngineOption::D3D11Driver d3d11Driver	= EngineOption::D3D11Driver::Hardware;
+
+		EngineOption::Vertex2DColor vertex2DColor	= EngineOption::Vertex2DColor::Float4;
+
+		EngineOption::Vertex2DIndex vertex2DIndex	= EngineOption::Vertex2DIndex::UInt16;
 	};
 
 	namespace detail
@@ -94,6 +122,8 @@ namespace s3d
 		int SetEngineOption(EngineOption::DebugHeap) noexcept;
 		int SetEngineOption(EngineOption::Renderer) noexcept;
 		int SetEngineOption(EngineOption::D3D11Driver) noexcept;
+		int SetEngineOption(EngineOption::Vertex2DColor) noexcept;
+		int SetEngineOption(EngineOption::Vertex2DIndex) noexcept;
 	}
 
 	extern EngineOptions g_engineOptions;
@@ -100,6 +100,17 @@ namespace s3d
 		[[nodiscard]]
 		StringView type() const noexcept override;
 	};
+
+	/// @brief キャンセルされた処理の結果を取得しようとしたことによるエラーを表現する型
+	class OperationCanceledError final : public Error
+	{
+	public:
+
+		using Error::Error;
+
+		[[nodiscard]]
+		StringView type() const noexcept override;
+	};
 }
 
 # include "detail/Error.ipp"
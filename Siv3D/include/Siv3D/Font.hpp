@@ -19,6 +19,7 @@
 # include "Typeface.hpp"
 # include "TextStyle.hpp"
 # include "Glyph.hpp"
+# include "FontCacheStat.hpp"
 # include "PredefinedYesNo.hpp"
 
 namespace s3d
@@ -212,6 +213,8 @@ namespace s3d
 		/// @param s 文字列
 		/// @param useFallback フォールバックフォントを使用するか
 		/// @param ligature リガチャ（合字）を有効にするか
+		/// @remark 結果はフォントごとにキャッシュされ、同じ文字列とオプションではシェーピングを省略します。
+		/// @remark 戻り値はキャッシュのコピーです。描画には、キャッシュを共有する `DrawableText` や `ShapedText` を使ってください。
 		/// @return 文字列に対応するグリフクラスター
 		[[nodiscard]]
 		Array<GlyphCluster> getGlyphClusters(StringView s, UseFallback useFallback = UseFallback::Yes, Ligature ligature = Ligature::Yes) const;
@@ -405,11 +408,28 @@ namespace s3d
 		/// @return 事前生成に成功した場合 true, それ以外の場合は false
 		bool preload(StringView chars) const;
 
+		/// @brief 指定した文字列のためのグリフを、バックグラウンドで事前生成します。
+		/// @param chars 文字列
+		/// @remark グリフのラスタライズはワーカースレッドで行われ、完了したグリフは次回の描画時か `isPreloadReady()` の呼び出し時にメインスレッドでテクスチャに追加されます。
+		/// @remark 事前生成が完了する前に描画された文字は、従来どおりその場で生成されます。
+		void preloadAsync(StringView chars) const;
+
+		/// @brief `preloadAsync()` で要求したすべてのグリフの事前生成が完了したかを返します。
+		/// @return すべてのグリフの事前生成が完了した場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isPreloadReady() const;
+
 		/// @brief フォントの内部でキャッシュされているテクスチャを返します。
+		/// @remark キャッシュが複数のページに分かれている場合は、最初のページを返します。
 		/// @return フォントの内部でキャッシュされているテクスチャ
 		[[nodiscard]]
 		const Texture& getTexture() const;
 
+		/// @brief フォントのグリフキャッシュとシェーピング結果のキャッシュの統計情報を返します。
+		/// @return キャッシュの統計情報
+		[[nodiscard]]
+		FontCacheStat getCacheStat() const;
+
 		/// @brief 指定した文字の描画用のグリフを返します。
 		/// @param ch 文字
 		/// @return 描画用グリフ
@@ -0,0 +1,47 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+
+namespace s3d
+{
+	/// @brief フォントのグリフキャッシュとシェーピング結果のキャッシュの統計情報
+	struct FontCacheStat
+	{
+		/// @brief キャッシュされているグリフの数
+		size_t glyphCount = 0;
+
+		/// @brief アトラステクスチャのページ数
+		size_t pageCount = 0;
+
+		/// @brief アトラステクスチャのページ数の上限
+		size_t maxPageCount = 0;
+
+		/// @brief 確保済みのページの面積に対する、グリフが占める面積の割合 [0.0, 1.0]
+		double occupancy = 0.0;
+
+		/// @brief これまでに追い出されたグリフの数
+		uint64 evictedGlyphCount = 0;
+
+		/// @brief これまでに追い出されたページの数
+		uint64 evictedPageCount = 0;
+
+		/// @brief キャッシュされているシェーピング結果の数
+		size_t shapingCacheSize = 0;
+
+		/// @brief シェーピング結果のキャッシュにヒットした回数
+		uint64 shapingCacheHitCount = 0;
+
+		/// @brief シェーピング結果のキャッシュにヒットしなかった回数
+		uint64 shapingCacheMissCount = 0;
+	};
+}
@@ -60,6 +60,19 @@ namespace s3d
 		void Inpaint(const Image& image, const Image& maskImage, const Color& maskColor, Image& result, int32 radius = 2);
 
 		void Inpaint(const Image& image, const Grid<uint8>& maskImage, Image& result, int32 radius = 2);
+
+		/// @brief 画像処理のマルチスレッド実行を有効にするかを設定します。
+		/// @param enabled マルチスレッド実行を有効にする場合 true, それ以外の場合は false
+		/// @remark 有効にすると、`Image` の `blur`, `gaussianBlur`, `medianBlur`, `bilateralFilter` は画像を行単位の帯に分割して複数のスレッドで処理します。
+		/// @remark `scale`, `warpAffine`, `warpPerspective` は OpenCV 内部で並列に処理されます。帯ごとの処理の中では OpenCV の処理は並列化されず、CPU のコア数を超えるスレッドは動きません。
+		/// @remark この関数は OpenCV の並列処理のスレッド数（`cv::setNumThreads()`）を変更します。これはプロセス全体の設定であるため、`VideoReader` などほかのスレッドで行われる OpenCV の処理にも適用されます。無効にすると元のスレッド数に戻ります。
+		/// @remark いずれの場合も、結果はシングルスレッドで処理した場合と一致します。デフォルトでは無効です。
+		void SetMultiThreadingEnabled(bool enabled);
+
+		/// @brief 画像処理のマルチスレッド実行が有効であるかを返します。
+		/// @return マルチスレッド実行が有効である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool IsMultiThreadingEnabled() noexcept;
 	}
 }
 
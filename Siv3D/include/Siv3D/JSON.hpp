@@ -229,6 +229,265 @@ namespace s3d
 		JSONIterationProxy m_end;
 	};
 
+	/// @brief JSONView が指す配列またはオブジェクトの要素を走査するためのイテレータ
+	/// @remark ヒープ割り当てを行いません。
+	class JSONViewIterator
+	{
+	public:
+
+		using value_type = JSONView;
+
+		using difference_type = ptrdiff_t;
+
+		using iterator_concept = std::forward_iterator_tag;
+
+		SIV3D_NODISCARD_CXX20
+		JSONViewIterator() = default;
+
+		JSONViewIterator& operator ++();
+
+		JSONViewIterator operator ++(int);
+
+		/// @brief 現在の要素の値を返します。
+		/// @return 現在の要素の値
+		[[nodiscard]]
+		JSONView operator *() const;
+
+		/// @brief 現在の要素のキーを UTF-8 文字列で返します。
+		/// @return 現在の要素のキー。配列の要素の場合は空の文字列
+		/// @remark 返される文字列は JSON オブジェクトが保持するキーを参照します。
+		[[nodiscard]]
+		std::string_view key() const;
+
+		/// @brief 現在の要素の値を返します。
+		/// @return 現在の要素の値
+		[[nodiscard]]
+		JSONView value() const;
+
+		[[nodiscard]]
+		bool operator ==(const JSONViewIterator& other) const noexcept;
+
+		[[nodiscard]]
+		bool operator !=(const JSONViewIterator& other) const noexcept;
+
+	private:
+
+		friend JSONView;
+
+		enum class Kind : uint8
+		{
+			None,
+
+			Array,
+
+			Object,
+		};
+
+		// Kind::Array の場合は現在の要素へのポインタ
+		// Kind::Object の場合は現在のキーと値のペアへのポインタ（終端では nullptr）
+		const void* m_element = nullptr;
+
+		// Kind::Object の場合は走査しているオブジェクトへのポインタ
+		const void* m_object = nullptr;
+
+		Kind m_kind = Kind::None;
+	};
+
+	/// @brief JSON の値を読み取り専用で参照する軽量なビュー
+	/// @remark 要素へのアクセスや走査でヒープ割り当てを行いません。大きな JSON データを読み取る場合に使います。
+	/// @remark 参照先の JSON オブジェクトの値が変更または破棄されると、ビューは無効になります。
+	class JSONView
+	{
+	public:
+
+		using iterator = JSONViewIterator;
+
+		using const_iterator = JSONViewIterator;
+
+		/// @brief 何も参照しないビューを作成します。
+		SIV3D_NODISCARD_CXX20
+		JSONView() = default;
+
+		/// @brief JSON オブジェクトを参照するビューを作成します。
+		/// @param json 参照する JSON オブジェクト
+		SIV3D_NODISCARD_CXX20
+		JSONView(const JSON& json);
+
+		/// @brief 値を参照していないかを返します。
+		/// @remark 存在しないキーやインデックスでアクセスした結果や、無効な JSON オブジェクトのビューは値を参照しません。
+		/// @return 値を参照していない場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief 値を参照しているかを返します。
+		/// @return 値を参照している場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief 参照している値が null であるかを返します。
+		[[nodiscard]]
+		bool isNull() const noexcept;
+
+		/// @brief 参照している値が bool であるかを返します。
+		[[nodiscard]]
+		bool isBool() const noexcept;
+
+		/// @brief 参照している値が数値であるかを返します。
+		[[nodiscard]]
+		bool isNumber() const noexcept;
+
+		/// @brief 参照している値が整数であるかを返します。
+		[[nodiscard]]
+		bool isInteger() const noexcept;
+
+		/// @brief 参照している値が非負整数であるかを返します。
+		[[nodiscard]]
+		bool isUnsigned() const noexcept;
+
+		/// @brief 参照している値が小数であるかを返します。
+		[[nodiscard]]
+		bool isFloat() const noexcept;
+
+		/// @brief 参照している値が文字列であるかを返します。
+		[[nodiscard]]
+		bool isString() const noexcept;
+
+		/// @brief 参照している値が配列であるかを返します。
+		[[nodiscard]]
+		bool isArray() const noexcept;
+
+		/// @brief 参照している値がオブジェクトであるかを返します。
+		[[nodiscard]]
+		bool isObject() const noexcept;
+
+		/// @brief 参照している値の種類を返します。
+		/// @return 参照している値の種類。値を参照していない場合は `JSONValueType::Empty`
+		[[nodiscard]]
+		JSONValueType getType() const noexcept;
+
+		/// @brief 参照している配列またはオブジェクトの要素数を返します。
+		/// @return 要素数。null の場合は 0, それ以外の値の場合は 1
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		/// @brief 渡されたキーが指す要素が存在しているかを返します。
+		/// @param key UTF-8 のキー
+		/// @return 要素が存在する場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool contains(std::string_view key) const noexcept;
+
+		/// @brief 渡されたキーが指す要素が存在しているかを返します。
+		/// @param key キー
+		/// @return 要素が存在する場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool contains(StringView key) const;
+
+		/// @brief 渡されたインデックスが指す要素が存在しているかを返します。
+		/// @param index インデックス
+		/// @return 要素が存在する場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool contains(size_t index) const noexcept;
+
+		/// @brief 渡されたキーが指す要素を返します。
+		/// @param key UTF-8 のキー
+		/// @return キーが指す要素。存在しない場合は値を参照しないビュー
+		[[nodiscard]]
+		JSONView operator [](std::string_view key) const noexcept;
+
+		/// @brief 渡されたキーが指す要素を返します。
+		/// @param key キー
+		/// @return キーが指す要素。存在しない場合は値を参照しないビュー
+		/// @remark 256 バイト以下のキーは、ヒープ割り当てを行わずに UTF-8 に変換されます。
+		[[nodiscard]]
+		JSONView operator [](StringView key) const;
+
+		/// @brief 渡されたインデックスが指す要素を返します。
+		/// @param index インデックス
+		/// @return インデックスが指す要素。存在しない場合は値を参照しないビュー
+		[[nodiscard]]
+		JSONView operator [](size_t index) const noexcept;
+
+		/// @brief 参照している値が文字列の場合に、その値を String として取得します。
+		/// @return 取得した値
+		[[nodiscard]]
+		String getString() const;
+
+		/// @brief 参照している値が文字列の場合に、その値を UTF-8 文字列として取得します。
+		/// @return 取得した値。文字列でない場合は空の文字列
+		/// @remark 返される文字列は JSON オブジェクトが保持する文字列を参照します。
+		[[nodiscard]]
+		std::string_view getUTF8String() const noexcept;
+
+		/// @brief 参照している値を Type の値として取得しようとし、失敗した場合は例外を投げます。
+		/// @tparam Type 取得したい型
+		/// @return 取得した値
+		/// @exception Type の値として取得するのに失敗した場合
+		template <class Type>
+		[[nodiscard]]
+		Type get() const;
+
+		/// @brief 参照している値を Type の値として取得しようとし、失敗した場合はデフォルト値を返します。
+		/// @tparam Type 取得したい型
+		/// @param [in] defaultValue 失敗した場合に返す値
+		/// @return 成功した場合は取得したその値、失敗した場合はデフォルト値を返します。
+		template <class Type, class U>
+		[[nodiscard]]
+		Type getOr(U&& defaultValue) const;
+
+		/// @brief 参照している値を Type の値として取得しようとし、Optional で結果を返します。
+		/// @tparam Type 取得したい型
+		/// @return 成功した場合は取得したその値、失敗した場合は無効値を持つ Optional
+		template <class Type>
+		[[nodiscard]]
+		Optional<Type> getOpt() const;
+
+		/// @brief 最初の要素を指すイテレータを返します。
+		/// @return 最初の要素を指すイテレータ。配列とオブジェクト以外の場合は `end()` と同じ
+		[[nodiscard]]
+		iterator begin() const;
+
+		/// @brief 最後の要素の次を指すイテレータを返します。
+		/// @return 最後の要素の次を指すイテレータ
+		[[nodiscard]]
+		iterator end() const;
+
+		/// @brief 参照している値をコピーした JSON オブジェクトを返します。
+		/// @return 参照している値をコピーした JSON オブジェクト。値を参照していない場合は無効な JSON オブジェクト
+		[[nodiscard]]
+		JSON toJSON() const;
+
+		friend void Formatter(FormatData& formatData, const JSONView& value);
+
+	private:
+
+		friend JSON;
+
+		friend JSONViewIterator;
+
+		// 参照している nlohmann::json
+		const void* m_value = nullptr;
+
+		SIV3D_NODISCARD_CXX20
+		explicit JSONView(const void* value) noexcept;
+
+		SIV3D_CONCEPT_INTEGRAL
+		Optional<Int> getOpt_() const;
+
+		SIV3D_CONCEPT_FLOATING_POINT
+		Optional<Float> getOpt_() const;
+
+		template <class Type, std::enable_if_t<!std::is_arithmetic_v<Type>>* = nullptr>
+		Optional<Type> getOpt_() const;
+
+		Optional<String> getOptString() const;
+
+		Optional<int64> getOptInt64() const;
+
+		Optional<double> getOptDouble() const;
+
+		Optional<bool> getOptBool() const;
+	};
+
 	/// @brief JSON 形式のデータの読み書き
 	class JSON
 	{
@@ -597,6 +856,12 @@ namespace s3d
 		[[nodiscard]]
 		size_t size() const;
 
+		/// @brief 要素へのアクセスでヒープ割り当てを行わない、読み取り専用の軽量なビューを返します。
+		/// @return この JSON オブジェクトの値を参照するビュー
+		/// @remark ビューは、この JSON オブジェクトの値が変更または破棄されるまで有効です。
+		[[nodiscard]]
+		JSONView view() const;
+
 		/// @brief JSON データを文字列にフォーマットした結果を返します。
 		/// @param [in] space インデントの文字
 		/// @param [in] spaceCount インデントの文字数
@@ -668,6 +933,7 @@ namespace s3d
 		/// @param [in] path ファイルパス
 		/// @param [in] allowExceptions 例外を発生させるか
 		/// @return JSON オブジェクト
+		/// @remark UTF-8 のファイルはメモリマップし、文字列に変換せずに直接パースします。
 		[[nodiscard]]
 		static JSON Load(FilePathView path, AllowExceptions allowExceptions = AllowExceptions::No);
 
@@ -685,6 +951,13 @@ namespace s3d
 		[[nodiscard]]
 		static JSON Parse(StringView str, AllowExceptions allowExceptions = AllowExceptions::No);
 
+		/// @brief UTF-8 の JSON 文字列をパースして JSON オブジェクトを返します。
+		/// @param [in] str UTF-8 文字列
+		/// @param [in] allowExceptions 例外を発生させるか
+		/// @return JSON オブジェクト
+		[[nodiscard]]
+		static JSON ParseUTF8(std::string_view str, AllowExceptions allowExceptions = AllowExceptions::No);
+
 		/// @brief BSON 形式のデータから JSON オブジェクトをデシリアライズします。
 		/// @param [in] bson BSON データ
 		/// @param [in] allowExceptions 例外を発生させるか
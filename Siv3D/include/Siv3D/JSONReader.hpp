@@ -0,0 +1,204 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "String.hpp"
+# include "IReader.hpp"
+# include "JSON.hpp"
+
+namespace s3d
+{
+	/// @brief JSONReader の読み込み結果
+	enum class JSONReaderResult : uint8
+	{
+		/// @brief 値を 1 つ読み込みました。
+		Completed,
+
+		/// @brief ストリームの終端に達したため、読み込む値がありません。
+		EndOfStream,
+
+		/// @brief ハンドラが false を返したため、読み込みを中断しました。
+		Aborted,
+
+		/// @brief 構文エラーが発生しました。
+		ParseError,
+
+		/// @brief 配列やオブジェクトのネストが上限を超えました。
+		DepthLimitExceeded,
+
+		/// @brief ファイルが開かれていません。
+		NotOpen,
+	};
+
+	/// @brief JSONReader が発生させるイベントを受け取るハンドラ
+	/// @remark 各関数が false を返すと、その時点で読み込みを中断します。
+	/// @remark 文字列は UTF-8 で渡され、関数から戻った後は無効になります。
+	class IJSONReaderHandler
+	{
+	public:
+
+		virtual ~IJSONReaderHandler() = default;
+
+		/// @brief null を読み込んだときに呼ばれます。
+		virtual bool onNull() { return true; }
+
+		/// @brief bool 値を読み込んだときに呼ばれます。
+		virtual bool onBool([[maybe_unused]] bool value) { return true; }
+
+		/// @brief 負の整数を読み込んだときに呼ばれます。
+		virtual bool onInteger([[maybe_unused]] int64 value) { return true; }
+
+		/// @brief 0 以上の整数を読み込んだときに呼ばれます。
+		virtual bool onUnsigned([[maybe_unused]] uint64 value) { return true; }
+
+		/// @brief 小数を読み込んだときに呼ばれます。
+		virtual bool onFloat([[maybe_unused]] double value) { return true; }
+
+		/// @brief 文字列を読み込んだときに呼ばれます。
+		virtual bool onString([[maybe_unused]] std::string_view value) { return true; }
+
+		/// @brief オブジェクトのキーを読み込んだときに呼ばれます。
+		virtual bool onKey([[maybe_unused]] std::string_view key) { return true; }
+
+		/// @brief オブジェクトの開始時に呼ばれます。
+		virtual bool onBeginObject() { return true; }
+
+		/// @brief オブジェクトの終了時に呼ばれます。
+		virtual bool onEndObject() { return true; }
+
+		/// @brief 配列の開始時に呼ばれます。
+		virtual bool onBeginArray() { return true; }
+
+		/// @brief 配列の終了時に呼ばれます。
+		virtual bool onEndArray() { return true; }
+	};
+
+	/// @brief DOM を構築せずに JSON を先頭から順に読み込むクラス
+	/// @remark 固定サイズのバッファでストリームを読み進めるため、巨大なファイルも一定のメモリで処理できます。
+	/// @remark 1 行に 1 つの JSON 値を書いた NDJSON (JSON Lines) 形式は `readLine()` で 1 行ずつ読み込めます。
+	class JSONReader
+	{
+	public:
+
+		/// @brief デフォルトのバッファサイズ（バイト）
+		static constexpr size_t DefaultBufferSize = (64 * 1024);
+
+		/// @brief デフォルトのネストの上限
+		static constexpr size_t DefaultMaxDepth = 512;
+
+		SIV3D_NODISCARD_CXX20
+		JSONReader();
+
+		/// @brief JSON ファイルを開きます。
+		/// @param path ファイルパス
+		/// @param bufferSize 読み込みバッファのサイズ（バイト）
+		SIV3D_NODISCARD_CXX20
+		explicit JSONReader(FilePathView path, size_t bufferSize = DefaultBufferSize);
+
+		/// @brief JSON データを読み込む IReader を開きます。
+		/// @param reader IReader
+		/// @param bufferSize 読み込みバッファのサイズ（バイト）
+		template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>* = nullptr>
+		SIV3D_NODISCARD_CXX20
+		explicit JSONReader(Reader&& reader, size_t bufferSize = DefaultBufferSize);
+
+		/// @brief JSON データを読み込む IReader を開きます。
+		/// @param reader IReader
+		/// @param bufferSize 読み込みバッファのサイズ（バイト）
+		SIV3D_NODISCARD_CXX20
+		explicit JSONReader(std::unique_ptr<IReader>&& reader, size_t bufferSize = DefaultBufferSize);
+
+		/// @brief JSON ファイルを開きます。
+		/// @param path ファイルパス
+		/// @param bufferSize 読み込みバッファのサイズ（バイト）
+		/// @return ファイルのオープンに成功した場合 true, それ以外の場合は false
+		bool open(FilePathView path, size_t bufferSize = DefaultBufferSize);
+
+		/// @brief JSON データを読み込む IReader を開きます。
+		/// @param reader IReader
+		/// @param bufferSize 読み込みバッファのサイズ（バイト）
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>* = nullptr>
+		bool open(Reader&& reader, size_t bufferSize = DefaultBufferSize);
+
+		/// @brief JSON データを読み込む IReader を開きます。
+		/// @param reader IReader
+		/// @param bufferSize 読み込みバッファのサイズ（バイト）
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(std::unique_ptr<IReader>&& reader, size_t bufferSize = DefaultBufferSize);
+
+		/// @brief ファイルを閉じます。
+		void close();
+
+		/// @brief ファイルが開かれているかを返します。
+		/// @return ファイルが開かれている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		/// @brief ファイルが開かれているかを返します。
+		/// @return ファイルが開かれている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief 配列やオブジェクトのネストの上限を設定します。
+		/// @param maxDepth ネストの上限
+		/// @remark 上限を超えると `JSONReaderResult::DepthLimitExceeded` で読み込みを中断します。
+		void setMaxDepth(size_t maxDepth) noexcept;
+
+		/// @brief 配列やオブジェクトのネストの上限を返します。
+		/// @return ネストの上限
+		[[nodiscard]]
+		size_t getMaxDepth() const noexcept;
+
+		/// @brief ストリームの残り全体を 1 つの JSON 値として読み込み、イベントをハンドラに送ります。
+		/// @param handler ハンドラ
+		/// @return 読み込みの結果
+		JSONReaderResult read(IJSONReaderHandler& handler);
+
+		/// @brief NDJSON の次の行を読み込み、イベントをハンドラに送ります。
+		/// @param handler ハンドラ
+		/// @return 読み込みの結果
+		/// @remark 空行は読み飛ばします。構文エラーや中断が起きた場合も、次の呼び出しは次の行から読み込みます。
+		/// @remark 行全体をメモリに保持しないため、行の長さに関わらず一定のメモリで読み込めます。
+		JSONReaderResult readLine(IJSONReaderHandler& handler);
+
+		/// @brief NDJSON の次の行を読み込み、JSON オブジェクトを作成します。
+		/// @param json 作成した JSON オブジェクトの格納先
+		/// @return 読み込みの結果
+		/// @remark 空行は読み飛ばします。構文エラーが起きた場合も、次の呼び出しは次の行から読み込みます。
+		JSONReaderResult readLine(JSON& json);
+
+		/// @brief 直前に `readLine()` で読み込んだ行の行番号を返します。
+		/// @return 行番号（1 始まり）。まだ読み込んでいない場合は 0
+		[[nodiscard]]
+		uint64 lineNumber() const noexcept;
+
+		/// @brief これまでに読み進めたバイト数を返します。
+		/// @return 読み進めたバイト数
+		[[nodiscard]]
+		int64 position() const noexcept;
+
+		/// @brief 開いているファイルのパスを返します。
+		/// @return 開いているファイルのパス。IReader から開いた場合は空の文字列
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+	private:
+
+		class JSONReaderDetail;
+
+		std::shared_ptr<JSONReaderDetail> pImpl;
+	};
+}
+
+# include "detail/JSONReader.ipp"
@@ -17,6 +17,40 @@
 
 namespace s3d
 {
+	/// @brief 非同期モードでログのバッファがいっぱいになったときの動作
+	enum class LogOverflowPolicy : uint8
+	{
+		/// @brief バッファに空きができるまで待機します。
+		Block,
+
+		/// @brief 新しいログを破棄します。破棄したログの数は後で出力されます。
+		Discard,
+	};
+
+	/// @brief 非同期モードのログ出力の設定
+	struct LoggerAsyncConfig
+	{
+		/// @brief バッファに格納できるログの数。2 のべき乗に切り上げられます。
+		/// @remark 最初に非同期モードにしたときの値のみ反映されます。
+		size_t capacity = 8192;
+
+		/// @brief バッファがいっぱいになったときの動作
+		LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Block;
+	};
+
+	/// @brief ログのファイル出力の設定
+	struct LoggerFileConfig
+	{
+		/// @brief ファイルパス
+		FilePath path;
+
+		/// @brief ファイルサイズがこの値（バイト）を超えたらローテーションします。0 の場合はローテーションしません。
+		int64 maxFileSize = (8 * 1024 * 1024);
+
+		/// @brief ローテーションで残す過去のファイルの数。`path.1` が最も新しいファイルです。
+		size_t maxBackupFiles = 3;
+	};
+
 	namespace detail
 	{
 		struct LoggerBuffer
@@ -105,6 +139,32 @@ namespace s3d
 
 			/// @brief ログ出力を有効化します
 			void enable() const;
+
+			/// @brief ログを専用のスレッドでまとめて出力する非同期モードに切り替えます。
+			/// @param config 非同期モードの設定
+			/// @remark 呼び出し元のスレッドはログをロックフリーのリングバッファに積むだけになり、書式化と出力は専用のスレッドで行われます。
+			/// @remark pthread を使わない Web 版では何もせず、同期モードのままです。
+			void setAsync(const LoggerAsyncConfig& config = {}) const;
+
+			/// @brief ログを呼び出し元のスレッドで出力する同期モード（デフォルト）に切り替えます。
+			/// @remark 出力待ちのログはすべて書き出されます。
+			void setSync() const;
+
+			/// @brief 非同期モードであるかを返します。
+			/// @return 非同期モードである場合 true, それ以外の場合は false
+			[[nodiscard]]
+			bool isAsync() const;
+
+			/// @brief 出力待ちのログをすべて書き出すまで待機します。
+			void flush() const;
+
+			/// @brief ログをファイルにも出力します。
+			/// @param config ファイル出力の設定
+			/// @return ファイルのオープンに成功した場合 true, それ以外の場合は false
+			bool openFile(const LoggerFileConfig& config) const;
+
+			/// @brief ログのファイル出力を終了します。
+			void closeFile() const;
 		};
 	}
 
@@ -12,11 +12,18 @@
 # pragma once
 # include "Common.hpp"
 # include "NavMeshConfig.hpp"
+# include "NavMeshCorridor.hpp"
 # include "TriangleIndex.hpp"
 # include "Polygon.hpp"
+# include "Optional.hpp"
+# include "AsyncTask.hpp"
 
 namespace s3d
 {
+	/// @brief タイルに分割したナビメッシュに登録した地形データの ID
+	/// @remark `NavMesh::build()` で指定した地形データの ID は 0 です。
+	using NavMeshGeometryID = uint32;
+
 	/// @brief ナビメッシュ
 	class NavMesh
 	{
@@ -126,6 +133,92 @@ namespace s3d
 		/// @return ナビメッシュの構築に成功した場合 true, それ以外の場合は false
 		bool build(const Array<Float3>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs, const NavMeshConfig& config = {});
 
+		/// @brief ナビメッシュがタイルに分割されているかを返します。
+		/// @return `NavMeshConfig::tileSize` に 0 より大きい値を指定して構築した場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isTiled() const noexcept;
+
+		/// @brief タイルに分割したナビメッシュに、歩行可能な地形データを追加します。
+		/// @param polygon 追加する地形データ
+		/// @param areaIDs 各三角形のエリア ID, 空の場合は 1
+		/// @return 追加した地形データの ID, 失敗した場合は none
+		/// @remark 変更は `rebuildTiles()` または `rebuildTilesAsync()` を呼ぶまで経路に反映されません。
+		Optional<NavMeshGeometryID> addGeometry(const Polygon& polygon, const Array<uint8>& areaIDs = {});
+
+		/// @brief タイルに分割したナビメッシュに、歩行可能な地形データを追加します。
+		/// @param vertices 追加する地形データの頂点配列
+		/// @param indices 追加する地形データのインデックス配列
+		/// @param areaIDs 各三角形のエリア ID, 空の場合は 1
+		/// @return 追加した地形データの ID, 失敗した場合は none
+		/// @remark 変更は `rebuildTiles()` または `rebuildTilesAsync()` を呼ぶまで経路に反映されません。
+		Optional<NavMeshGeometryID> addGeometry(const Array<Float2>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs = {});
+
+		/// @brief タイルに分割したナビメッシュに、歩行可能な地形データを追加します。
+		/// @param vertices 追加する地形データの頂点配列
+		/// @param indices 追加する地形データのインデックス配列
+		/// @param areaIDs 各三角形のエリア ID, 空の場合は 1
+		/// @return 追加した地形データの ID, 失敗した場合は none
+		/// @remark 変更は `rebuildTiles()` または `rebuildTilesAsync()` を呼ぶまで経路に反映されません。
+		Optional<NavMeshGeometryID> addGeometry(const Array<Float3>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs = {});
+
+		/// @brief タイルに分割したナビメッシュに障害物を追加します。
+		/// @param shape 障害物の形状（3D の場合は XZ 平面上の形状で、すべての高さに作用します）
+		/// @param areaID 障害物の範囲に設定するエリア ID, 0 の場合は通行不可
+		/// @return 追加した障害物の ID, 失敗した場合は none
+		/// @remark 変更は `rebuildTiles()` または `rebuildTilesAsync()` を呼ぶまで経路に反映されません。
+		Optional<NavMeshGeometryID> addObstacle(const Polygon& shape, uint8 areaID = 0);
+
+		/// @brief 追加した地形データを置き換えます。
+		/// @param id 地形データの ID
+		/// @param polygon 新しい地形データ
+		/// @param areaIDs 各三角形のエリア ID, 空の場合は 1
+		/// @return 置き換えに成功した場合 true, それ以外の場合は false
+		bool updateGeometry(NavMeshGeometryID id, const Polygon& polygon, const Array<uint8>& areaIDs = {});
+
+		/// @brief 追加した地形データを置き換えます。
+		/// @param id 地形データの ID
+		/// @param vertices 新しい地形データの頂点配列
+		/// @param indices 新しい地形データのインデックス配列
+		/// @param areaIDs 各三角形のエリア ID, 空の場合は 1
+		/// @return 置き換えに成功した場合 true, それ以外の場合は false
+		bool updateGeometry(NavMeshGeometryID id, const Array<Float2>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs = {});
+
+		/// @brief 追加した地形データを置き換えます。
+		/// @param id 地形データの ID
+		/// @param vertices 新しい地形データの頂点配列
+		/// @param indices 新しい地形データのインデックス配列
+		/// @param areaIDs 各三角形のエリア ID, 空の場合は 1
+		/// @return 置き換えに成功した場合 true, それ以外の場合は false
+		bool updateGeometry(NavMeshGeometryID id, const Array<Float3>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs = {});
+
+		/// @brief 追加した障害物を置き換えます。
+		/// @param id 障害物の ID
+		/// @param shape 新しい障害物の形状
+		/// @param areaID 障害物の範囲に設定するエリア ID, 0 の場合は通行不可
+		/// @return 置き換えに成功した場合 true, それ以外の場合は false
+		bool updateObstacle(NavMeshGeometryID id, const Polygon& shape, uint8 areaID = 0);
+
+		/// @brief 追加した地形データまたは障害物を削除します。
+		/// @param id 地形データまたは障害物の ID
+		/// @return 削除に成功した場合 true, それ以外の場合は false
+		bool removeGeometry(NavMeshGeometryID id);
+
+		/// @brief 地形データの変更によって再構築が必要になったタイルの数を返します。
+		/// @return 再構築が必要なタイルの数
+		[[nodiscard]]
+		size_t num_dirtyTiles() const;
+
+		/// @brief 地形データの変更の影響を受けるタイルだけを再構築し、経路探索に使うナビメッシュを差し替えます。
+		/// @return 再構築に成功した場合 true, それ以外の場合は false
+		/// @remark タイルは並列に構築されます。
+		bool rebuildTiles();
+
+		/// @brief 地形データの変更の影響を受けるタイルだけを非同期に再構築し、完了後に経路探索に使うナビメッシュを差し替えます。
+		/// @return 再構築の非同期タスク。再構築に成功した場合 true を返します。
+		/// @remark 呼び出した時点までの変更が対象です。差し替えが完了するまでは、以前のナビメッシュで経路探索を行えます。
+		[[nodiscard]]
+		AsyncTask<bool> rebuildTilesAsync();
+
 		/// @brief 目的地もしくは目的地の近くまで到達できるナビメッシュ上の経路を計算します。
 		/// @param start 出発地点の座標
 		/// @param end 目的地の座標
@@ -156,6 +249,66 @@ namespace s3d
 		/// @param areaCosts エリアのコスト
 		void query(const Vec3& start, const Vec3& end, Array<Vec3>& dst, const Array<std::pair<int32, double>>& areaCosts = {}) const;
 
+		/// @brief 前回の経路を再利用して、目的地もしくは目的地の近くまで到達できるナビメッシュ上の経路を計算します。
+		/// @param start 出発地点の座標
+		/// @param end 目的地の座標
+		/// @param corridor 前回の経路。計算した経路で更新されます。
+		/// @param dst 経路の格納先
+		/// @param areaCosts エリアのコスト
+		/// @remark 出発地点と目的地が前回から少し移動しただけの場合は、経路探索を行わずに前回の経路を延長・短縮します。
+		void query(const Vec2& start, const Vec2& end, NavMeshCorridor& corridor, Array<Vec2>& dst, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
+		/// @brief 前回の経路を再利用して、目的地もしくは目的地の近くまで到達できるナビメッシュ上の経路を計算します。
+		/// @param start 出発地点の座標
+		/// @param end 目的地の座標
+		/// @param corridor 前回の経路。計算した経路で更新されます。
+		/// @param dst 経路の格納先
+		/// @param areaCosts エリアのコスト
+		/// @remark 出発地点と目的地が前回から少し移動しただけの場合は、経路探索を行わずに前回の経路を延長・短縮します。
+		void query(const Vec3& start, const Vec3& end, NavMeshCorridor& corridor, Array<Vec3>& dst, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
+		/// @brief 複数の出発地点と目的地の組について、ナビメッシュ上の経路をスレッドプールで並列に計算します。
+		/// @param requests 出発地点と目的地の座標の組の一覧
+		/// @param areaCosts エリアのコスト
+		/// @return 各組に対応するナビメッシュ上の経路
+		[[nodiscard]]
+		Array<Array<Vec2>> queryBatch(const Array<std::pair<Vec2, Vec2>>& requests, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
+		/// @brief 複数の出発地点と目的地の組について、ナビメッシュ上の経路をスレッドプールで並列に計算します。
+		/// @param requests 出発地点と目的地の座標の組の一覧
+		/// @param dst 経路の格納先。`requests` と同じ要素数になります。
+		/// @param areaCosts エリアのコスト
+		/// @remark 各スレッドは専用の探索用オブジェクトを使うため、`query()` と同時に呼び出すこともできます。
+		void queryBatch(const Array<std::pair<Vec2, Vec2>>& requests, Array<Array<Vec2>>& dst, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
+		/// @brief 複数の出発地点と目的地の組について、前回の経路を再利用しながらナビメッシュ上の経路をスレッドプールで並列に計算します。
+		/// @param requests 出発地点と目的地の座標の組の一覧
+		/// @param corridors 各組の前回の経路。要素数が `requests` と異なる場合はリサイズされます。
+		/// @param dst 経路の格納先。`requests` と同じ要素数になります。
+		/// @param areaCosts エリアのコスト
+		void queryBatch(const Array<std::pair<Vec2, Vec2>>& requests, Array<NavMeshCorridor>& corridors, Array<Array<Vec2>>& dst, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
+		/// @brief 複数の出発地点と目的地の組について、ナビメッシュ上の経路をスレッドプールで並列に計算します。
+		/// @param requests 出発地点と目的地の座標の組の一覧
+		/// @param areaCosts エリアのコスト
+		/// @return 各組に対応するナビメッシュ上の経路
+		[[nodiscard]]
+		Array<Array<Vec3>> queryBatch(const Array<std::pair<Vec3, Vec3>>& requests, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
+		/// @brief 複数の出発地点と目的地の組について、ナビメッシュ上の経路をスレッドプールで並列に計算します。
+		/// @param requests 出発地点と目的地の座標の組の一覧
+		/// @param dst 経路の格納先。`requests` と同じ要素数になります。
+		/// @param areaCosts エリアのコスト
+		/// @remark 各スレッドは専用の探索用オブジェクトを使うため、`query()` と同時に呼び出すこともできます。
+		void queryBatch(const Array<std::pair<Vec3, Vec3>>& requests, Array<Array<Vec3>>& dst, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
+		/// @brief 複数の出発地点と目的地の組について、前回の経路を再利用しながらナビメッシュ上の経路をスレッドプールで並列に計算します。
+		/// @param requests 出発地点と目的地の座標の組の一覧
+		/// @param corridors 各組の前回の経路。要素数が `requests` と異なる場合はリサイズされます。
+		/// @param dst 経路の格納先。`requests` と同じ要素数になります。
+		/// @param areaCosts エリアのコスト
+		void queryBatch(const Array<std::pair<Vec3, Vec3>>& requests, Array<NavMeshCorridor>& corridors, Array<Array<Vec3>>& dst, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
 	private:
 
 		class NavMeshDetail;
@@ -31,5 +31,9 @@ namespace s3d
 		/// @brief エージェントの半径
 		/// @remark これより狭い経路を通過できません
 		double agentRadius = 0.25;
+
+		/// @brief タイルの一辺のセル数
+		/// @remark 0 より大きい場合はナビメッシュをタイルに分割して構築し、地形データの追加・更新・削除の後に、影響を受けるタイルだけを再構築できます。
+		int32 tileSize = 0;
 	};
 }
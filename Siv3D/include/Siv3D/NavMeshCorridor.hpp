@@ -0,0 +1,75 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "PointVector.hpp"
+# include "Array.hpp"
+
+namespace s3d
+{
+	class NavMesh;
+
+	namespace detail
+	{
+		struct NavMeshCorridorState
+		{
+			/// @brief 経路が通過するポリゴンの一覧 (dtPolyRef)
+			Array<uint32> polygons;
+
+			/// @brief 前回の出発地点（ナビメッシュ上の点）
+			Float3 start{ 0, 0, 0 };
+
+			/// @brief 前回の目的地（ナビメッシュ上の点）
+			Float3 end{ 0, 0, 0 };
+
+			/// @brief 経路を計算したナビメッシュの識別子
+			uint64 navMeshID = 0;
+
+			/// @brief 経路探索を最初から行った回数
+			uint32 searchCount = 0;
+		};
+	}
+
+	/// @brief 前回計算した経路を保持し、出発地点や目的地が少し移動したときに経路探索を省略するためのオブジェクト
+	/// @remark エージェントごとに 1 つ用意し、`NavMesh::query()` に渡します。
+	class NavMeshCorridor
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		NavMeshCorridor() = default;
+
+		/// @brief 保持している経路を消去します。次の経路計算では経路探索を最初から行います。
+		void clear() noexcept;
+
+		/// @brief 経路を保持していないかを返します。
+		/// @return 経路を保持していない場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief 保持している経路が通過するポリゴンの数を返します。
+		/// @return 経路が通過するポリゴンの数
+		[[nodiscard]]
+		size_t num_polygons() const noexcept;
+
+		/// @brief 前回の経路を再利用できず、経路探索を最初から行った回数を返します。
+		/// @return 経路探索を最初から行った回数
+		[[nodiscard]]
+		uint32 searchCount() const noexcept;
+
+	private:
+
+		friend class NavMesh;
+
+		detail::NavMeshCorridorState m_state;
+	};
+}
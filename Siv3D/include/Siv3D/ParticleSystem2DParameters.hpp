@@ -47,6 +47,14 @@ namespace s3d
 		SizeOverLifeTimeFunc sizeOverLifeTimeFunc;
 
 		ColorOverLifeTimeFunc colorOverLifeTimeFunc;
+
+		/// @brief パーティクルをメンバごとの配列 (SoA) で保持し、SIMD 命令で更新するか
+		/// @remark true の場合、消滅したパーティクルの位置に末尾のパーティクルを移動するため、描画順は放出順になりません。
+		/// また、パーティクル数が `maxParticles` に達している間は、古いパーティクルを消す代わりに新しいパーティクルを放出しません。
+		bool structureOfArrays = false;
+
+		/// @brief `structureOfArrays` が true のとき、多数のパーティクルの更新をスレッドプールで並列に行うか
+		bool parallelUpdate = false;
 	};
 }
 
@@ -31,6 +31,7 @@ namespace s3d
 	enum class P2ShapeType : uint8;
 	struct P2ContactPair;
 	struct P2Contact;
+	struct P2RaycastHit;
 	class P2Collision;
 	class P2World;
 	class P2Body;
@@ -0,0 +1,34 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "../Common.hpp"
+# include "../PointVector.hpp"
+# include "P2Fwd.hpp"
+
+namespace s3d
+{
+	/// @brief レイキャストが物体と交差した点に関する情報
+	struct P2RaycastHit
+	{
+		/// @brief 交差した物体の ID
+		P2BodyID id = 0;
+
+		/// @brief 交差した点の座標 (cm)
+		Vec2 point = { 0.0, 0.0 };
+
+		/// @brief 交差した点における物体表面の法線ベクトル
+		Vec2 normal = { 0.0, 0.0 };
+
+		/// @brief レイの始点から交差した点までの距離の、レイ全体の長さに対する割合 [0.0, 1.0]
+		double fraction = 0.0;
+	};
+}
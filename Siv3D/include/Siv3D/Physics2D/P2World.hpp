@@ -14,11 +14,14 @@
 # include "../Common.hpp"
 # include "../PointVector.hpp"
 # include "../HashTable.hpp"
+# include "../Array.hpp"
+# include "../Optional.hpp"
 # include "../Scene.hpp"
 # include "P2Fwd.hpp"
 # include "P2BodyType.hpp"
 # include "P2Material.hpp"
 # include "P2Filter.hpp"
+# include "P2RaycastHit.hpp"
 # include "P2Body.hpp"
 # include "P2PivotJoint.hpp"
 # include "P2DistanceJoint.hpp"
@@ -285,6 +288,61 @@ namespace s3d
 		[[nodiscard]]
 		const HashTable<P2ContactPair, P2Collision>& getCollisions() const noexcept;
 
+		/// @brief 長方形と AABB (軸平行境界ボックス) が重なる物体の一覧を返します。
+		/// @param rect 長方形のワールド座標 (cm)
+		/// @return 物体の ID の一覧（昇順）
+		/// @remark 形状そのものではなく、形状を囲む AABB との重なりで判定します。
+		[[nodiscard]]
+		Array<P2BodyID> queryAABB(const RectF& rect) const;
+
+		/// @brief 長方形と AABB (軸平行境界ボックス) が重なる物体の一覧を取得します。
+		/// @param rect 長方形のワールド座標 (cm)
+		/// @param results 物体の ID の一覧（昇順）を格納する配列。既存の要素は消去されます。
+		/// @remark 形状そのものではなく、形状を囲む AABB との重なりで判定します。
+		void queryAABB(const RectF& rect, Array<P2BodyID>& results) const;
+
+		/// @brief 線分と最初に交差する物体を返します。
+		/// @param start 線分の始点のワールド座標 (cm)
+		/// @param end 線分の終点のワールド座標 (cm)
+		/// @return 始点に最も近い交差点の情報。交差する物体が無い場合は none
+		[[nodiscard]]
+		Optional<P2RaycastHit> raycast(const Vec2& start, const Vec2& end) const;
+
+		/// @brief 線分と交差するすべての形状の交差点を返します。
+		/// @param start 線分の始点のワールド座標 (cm)
+		/// @param end 線分の終点のワールド座標 (cm)
+		/// @return 交差点の情報の一覧（始点に近い順）
+		[[nodiscard]]
+		Array<P2RaycastHit> raycastAll(const Vec2& start, const Vec2& end) const;
+
+		/// @brief 線分と交差するすべての形状の交差点を取得します。
+		/// @param start 線分の始点のワールド座標 (cm)
+		/// @param end 線分の終点のワールド座標 (cm)
+		/// @param results 交差点の情報の一覧（始点に近い順）を格納する配列。既存の要素は消去されます。
+		void raycastAll(const Vec2& start, const Vec2& end, Array<P2RaycastHit>& results) const;
+
+		/// @brief 円と重なる物体の一覧を返します。
+		/// @param circle 円のワールド座標 (cm)
+		/// @return 物体の ID の一覧（昇順）
+		[[nodiscard]]
+		Array<P2BodyID> overlapCircle(const Circle& circle) const;
+
+		/// @brief 円と重なる物体の一覧を取得します。
+		/// @param circle 円のワールド座標 (cm)
+		/// @param results 物体の ID の一覧（昇順）を格納する配列。既存の要素は消去されます。
+		void overlapCircle(const Circle& circle, Array<P2BodyID>& results) const;
+
+		/// @brief 多角形と重なる物体の一覧を返します。
+		/// @param polygon 多角形のワールド座標 (cm)
+		/// @return 物体の ID の一覧（昇順）
+		[[nodiscard]]
+		Array<P2BodyID> overlapPolygon(const Polygon& polygon) const;
+
+		/// @brief 多角形と重なる物体の一覧を取得します。
+		/// @param polygon 多角形のワールド座標 (cm)
+		/// @param results 物体の ID の一覧（昇順）を格納する配列。既存の要素は消去されます。
+		void overlapPolygon(const Polygon& polygon, Array<P2BodyID>& results) const;
+
 	private:
 
 		std::shared_ptr<detail::P2WorldDetail> pImpl;
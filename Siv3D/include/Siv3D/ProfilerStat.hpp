@@ -20,6 +20,16 @@ namespace s3d
 
 		uint32 triangleCount = 0;
 
+		uint32 batchCount = 0;
+
+		uint64 vertexUploadBytes = 0;
+
+		uint64 indexUploadBytes = 0;
+
+		uint32 fenceWaitCount = 0;
+
+		uint32 bufferOrphanCount = 0;
+
 		uint32 textureCount = 0;
 
 		uint32 fontCount = 0;
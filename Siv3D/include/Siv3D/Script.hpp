@@ -94,6 +94,23 @@ namespace s3d
 		[[nodiscard]]
 		static AngelScript::asIScriptEngine* GetEngine();
 
+		/// @brief バイトコードキャッシュを保存するディレクトリを設定します。
+		/// @param directory ディレクトリ。デフォルトは `U"script_cache/"` です。
+		static void SetBytecodeCacheDirectory(FilePathView directory);
+
+		/// @brief バイトコードキャッシュを保存するディレクトリを返します。
+		/// @return バイトコードキャッシュを保存するディレクトリ
+		[[nodiscard]]
+		static const FilePath& GetBytecodeCacheDirectory();
+
+		/// @brief ディレクトリ内のスクリプトファイル (.as) をコンパイルし、バイトコードキャッシュを作成します。
+		/// @param directory ディレクトリ
+		/// @param compileOption コンパイルオプション。`ScriptCompileOption::UseBytecodeCache` は常に有効になります。
+		/// @param recursive サブディレクトリ内のファイルも対象にする場合 `Recursive::Yes`, それ以外の場合は `Recursive::No`
+		/// @return コンパイルに成功した（または有効なキャッシュが既にあった）スクリプトの数
+		/// @remark 実行時に同じコンパイルオプションと `ScriptCompileOption::UseBytecodeCache` を指定してロードすると、作成したキャッシュが使われます。
+		static size_t Precompile(FilePathView directory, ScriptCompileOption compileOption = ScriptCompileOption::Default, Recursive recursive = Recursive::Yes);
+
 	protected:
 
 		const std::shared_ptr<ScriptModule>& _getModule() const;
@@ -21,6 +21,10 @@ namespace s3d
 		Default = 0b00,
 
 		BuildWithLineCues = 0b01,
+
+		/// @brief ファイルからロードするスクリプトで、バイトコードキャッシュを使います。
+		/// @remark 有効なキャッシュがある場合はコンパイルを省略し、無い場合はコンパイル後にキャッシュを作成します。
+		UseBytecodeCache = 0b10,
 	};
 	DEFINE_BITMASK_OPERATORS(ScriptCompileOption);
 }
@@ -0,0 +1,71 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+# include "GlyphCluster.hpp"
+# include "PredefinedYesNo.hpp"
+# include "Font.hpp"
+# include "DrawableText.hpp"
+
+namespace s3d
+{
+	/// @brief シェーピング済みのテキスト
+	/// @remark 静的なラベルなどでフレームをまたいで保持すると、描画のたびに行われるシェーピングを省略できます。
+	/// @remark `drawable()` で描画用のテキストを取得できます。
+	class ShapedText
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		ShapedText() = default;
+
+		/// @brief テキストをシェーピングします。
+		/// @param font フォント
+		/// @param text テキスト
+		/// @param useFallback フォールバックフォントを使用するか
+		/// @param ligature リガチャ（合字）を有効にするか
+		SIV3D_NODISCARD_CXX20
+		ShapedText(const Font& font, String text, UseFallback useFallback = UseFallback::Yes, Ligature ligature = Ligature::Yes);
+
+		/// @brief シェーピングに使用したフォントを返します。
+		/// @return シェーピングに使用したフォント
+		[[nodiscard]]
+		const Font& font() const noexcept;
+
+		/// @brief テキストを返します。
+		/// @return テキスト
+		[[nodiscard]]
+		const String& text() const noexcept;
+
+		/// @brief シェーピング結果のグリフクラスターを返します。
+		/// @return グリフクラスター
+		[[nodiscard]]
+		const Array<GlyphCluster>& clusters() const noexcept;
+
+		/// @brief テキストが空であるかを返します。
+		/// @return テキストが空である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief 描画用のテキストを返します。
+		/// @remark テキストもグリフクラスターもコピーせずに描画できます。
+		/// @return 描画用のテキスト
+		[[nodiscard]]
+		const DrawableText& drawable() const noexcept;
+
+	private:
+
+		DrawableText m_drawableText;
+	};
+}
@@ -13,7 +13,9 @@
 # include <memory>
 # include "Common.hpp"
 # include "Concepts.hpp"
+# include "Array.hpp"
 # include "TCPError.hpp"
+# include "TCPSessionStats.hpp"
 
 namespace s3d
 {
@@ -67,6 +69,30 @@ namespace s3d
 		SIV3D_CONCEPT_TRIVIALLY_COPYABLE
 		bool send(const TriviallyCopyable& from);
 
+		/// @brief 受信済みのデータを、コピーせずに参照します。
+		/// @return 受信済みのデータ。読み終えた分は `skip()` で取り除きます。
+		/// @remark 返したビューは、次に受信 API を呼ぶまで有効です。
+		[[nodiscard]]
+		TCPReceivedSpans peek();
+
+		/// @brief 受信が完了しているメッセージを 1 つ取り出します。
+		/// @param message メッセージの格納先
+		/// @return メッセージを取り出した場合 true, それ以外の場合は false
+		/// @remark メッセージは、4 バイト（リトルエンディアン）のサイズと、それに続くデータで構成されます。`sendMessage()` で送信したものを受信できます。
+		/// @remark `read()` などのバイト単位の受信 API と併用することはできません。
+		bool readMessage(Array<Byte>& message);
+
+		/// @brief データにサイズを付けて、1 つのメッセージとして送信します。
+		/// @param data データ
+		/// @param size データのサイズ（バイト）。`TCPMaxMessageSize` 以下である必要があります。
+		/// @return 送信キューに追加した場合 true, それ以外の場合は false
+		bool sendMessage(const void* data, size_t size);
+
+		/// @brief 送受信の統計を返します。
+		/// @return 送受信の統計。接続していない場合はすべて 0
+		[[nodiscard]]
+		TCPSessionStats getStats() const;
+
 	private:
 
 		class TCPClientDetail;
@@ -15,6 +15,7 @@
 # include "Array.hpp"
 # include "Optional.hpp"
 # include "Unspecified.hpp"
+# include "TCPSessionStats.hpp"
 
 namespace s3d
 {
@@ -28,6 +29,11 @@ namespace s3d
 		SIV3D_NODISCARD_CXX20
 		TCPServer();
 
+		/// @brief TCP サーバを作成します。
+		/// @param numIOThreads 送受信の処理を行うスレッドの数。多数のセッションを扱う場合に増やします。
+		SIV3D_NODISCARD_CXX20
+		explicit TCPServer(size_t numIOThreads);
+
 		~TCPServer();
 
 		void startAccept(uint16 port);
@@ -56,6 +62,11 @@ namespace s3d
 		[[nodiscard]]
 		uint16 port() const;
 
+		/// @brief 送受信の処理を行うスレッドの数を返します。
+		/// @return 送受信の処理を行うスレッドの数
+		[[nodiscard]]
+		size_t num_IOThreads() const noexcept;
+
 		[[nodiscard]]
 		size_t available(const Optional<TCPSessionID>& id = unspecified);
 
@@ -76,6 +87,41 @@ namespace s3d
 		SIV3D_CONCEPT_TRIVIALLY_COPYABLE
 		bool send(const TriviallyCopyable& to, const Optional<TCPSessionID>& id = unspecified);
 
+		/// @brief 受信済みのデータを、コピーせずに参照します。
+		/// @param id セッション ID。省略した場合は最初のセッション
+		/// @return 受信済みのデータ。読み終えた分は `skip()` で取り除きます。
+		/// @remark 返したビューは、同じセッションに対して次に受信 API を呼ぶまで有効です。
+		[[nodiscard]]
+		TCPReceivedSpans peek(const Optional<TCPSessionID>& id = unspecified);
+
+		/// @brief 受信が完了しているメッセージを 1 つ取り出します。
+		/// @param message メッセージの格納先
+		/// @param id セッション ID。省略した場合は最初のセッション
+		/// @return メッセージを取り出した場合 true, それ以外の場合は false
+		/// @remark メッセージは、4 バイト（リトルエンディアン）のサイズと、それに続くデータで構成されます。`sendMessage()` で送信したものを受信できます。
+		/// @remark 同じセッションで `read()` などのバイト単位の受信 API と併用することはできません。
+		bool readMessage(Array<Byte>& message, const Optional<TCPSessionID>& id = unspecified);
+
+		/// @brief いずれかのセッションで受信が完了しているメッセージを 1 つ取り出します。
+		/// @param id メッセージを受信したセッション ID の格納先
+		/// @param message メッセージの格納先
+		/// @return メッセージを取り出した場合 true, それ以外の場合は false
+		/// @remark 特定のセッションのメッセージばかりが取り出されないよう、セッションを順番に調べます。
+		bool readAnyMessage(TCPSessionID& id, Array<Byte>& message);
+
+		/// @brief データにサイズを付けて、1 つのメッセージとして送信します。
+		/// @param data データ
+		/// @param size データのサイズ（バイト）。`TCPMaxMessageSize` 以下である必要があります。
+		/// @param id セッション ID。省略した場合は最初のセッション
+		/// @return 送信キューに追加した場合 true, それ以外の場合は false
+		bool sendMessage(const void* data, size_t size, const Optional<TCPSessionID>& id = unspecified);
+
+		/// @brief セッションの送受信の統計を返します。
+		/// @param id セッション ID。省略した場合は最初のセッション
+		/// @return セッションの送受信の統計。セッションが無い場合はすべて 0
+		[[nodiscard]]
+		TCPSessionStats getStats(const Optional<TCPSessionID>& id = unspecified) const;
+
 	private:
 
 		class TCPServerDetail;
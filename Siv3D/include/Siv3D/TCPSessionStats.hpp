@@ -0,0 +1,88 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <span>
+# include "Common.hpp"
+# include "Byte.hpp"
+
+namespace s3d
+{
+	/// @brief `TCPServer::sendMessage()`, `TCPClient::sendMessage()` で送信できるメッセージの最大サイズ（バイト）
+	inline constexpr size_t TCPMaxMessageSize = ((32 * 1024 * 1024) - 4);
+
+	/// @brief TCP セッションの受信済みデータを、コピーせずに参照するビュー
+	/// @remark 受信バッファはリングバッファであるため、データが末尾で折り返している場合は `first`, `second` の 2 つの領域に分かれます。
+	/// @remark ビューは、同じセッションに対して次に受信 API（`available()`, `skip()`, `read()`, `peek()` など）を呼ぶまで有効です。
+	struct TCPReceivedSpans
+	{
+		/// @brief 先頭の領域
+		std::span<const Byte> first;
+
+		/// @brief 折り返した後の領域
+		std::span<const Byte> second;
+
+		/// @brief 受信済みデータのバイト数を返します。
+		/// @return 受信済みデータのバイト数
+		[[nodiscard]]
+		constexpr size_t size() const noexcept
+		{
+			return (first.size() + second.size());
+		}
+
+		/// @brief 受信済みデータが無いかを返します。
+		/// @return 受信済みデータが無い場合 true, それ以外の場合は false
+		[[nodiscard]]
+		constexpr bool isEmpty() const noexcept
+		{
+			return ((first.size() == 0) && (second.size() == 0));
+		}
+
+		/// @brief 受信済みデータがあるかを返します。
+		/// @return 受信済みデータがある場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit constexpr operator bool() const noexcept
+		{
+			return (not isEmpty());
+		}
+	};
+
+	/// @brief TCP セッションの送受信の統計
+	struct TCPSessionStats
+	{
+		/// @brief 受信した累計バイト数
+		uint64 bytesReceived = 0;
+
+		/// @brief 送信した累計バイト数
+		uint64 bytesSent = 0;
+
+		/// @brief 受信バッファにある未読のバイト数
+		size_t receiveQueueBytes = 0;
+
+		/// @brief 受信バッファの容量（バイト）
+		size_t receiveBufferCapacity = 0;
+
+		/// @brief 受信バッファが満杯のため、受信を一時停止した回数
+		uint64 numReceiveStalls = 0;
+
+		/// @brief 送信待ちのバイト数（送信中のものを含む）
+		size_t sendQueueBytes = 0;
+
+		/// @brief 送信が完了していない `send()` の数
+		size_t sendQueueDepth = 0;
+
+		/// @brief `sendQueueDepth` の最大値
+		size_t maxSendQueueDepth = 0;
+
+		/// @brief 発行した書き込み（複数の `send()` をまとめたもの）の回数
+		uint64 numSendBatches = 0;
+	};
+}
@@ -12,6 +12,7 @@
 # pragma once
 # include "Common.hpp"
 # include "Image.hpp"
+# include "BlockCompressedImage.hpp"
 # include "TextureDesc.hpp"
 # include "TextureFormat.hpp"
 # include "AssetHandle.hpp"
@@ -40,6 +41,12 @@ namespace s3d
 		SIV3D_NODISCARD_CXX20
 		Texture(const Image& image, const Array<Image>& mipmaps, TextureDesc desc = TextureDesc::Mipped);
 
+		/// @brief ブロック圧縮された画像からテクスチャを作成します。
+		/// @param image ブロック圧縮された画像
+		/// @remark 圧縮データとミップマップはそのまま GPU に転送されます。ブロック圧縮テクスチャに対応しない環境では、デコードした画像からテクスチャを作成します。
+		SIV3D_NODISCARD_CXX20
+		explicit Texture(const BlockCompressedImage& image);
+
 		/// @brief 画像ファイルからテクスチャを作成します。
 		/// @param path ファイルパス
 		/// @param desc テクスチャの設定
@@ -54,10 +54,20 @@ namespace s3d
 		int32 WGPUFormat() const noexcept;
 
 		/// @brief 1 ピクセル当たりのサイズ（バイト）を返します。
-		/// @return 1 ピクセル当たりのサイズ（バイト）
+		/// @return 1 ピクセル当たりのサイズ（バイト）。ブロック圧縮フォーマットの場合は 0
 		[[nodiscard]]
 		uint32 pixelSize() const noexcept;
 
+		/// @brief 4x4 ピクセルのブロック 1 つ当たりのサイズ（バイト）を返します。
+		/// @return 4x4 ピクセルのブロック 1 つ当たりのサイズ（バイト）。ブロック圧縮フォーマットでない場合は 0
+		[[nodiscard]]
+		uint32 blockSize() const noexcept;
+
+		/// @brief ブロック圧縮 (BC) フォーマットであるかを返します。
+		/// @return ブロック圧縮フォーマットである場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isBlockCompressed() const noexcept;
+
 		/// @brief チャンネル数を返します。
 		/// @return チャンネル数
 		[[nodiscard]]
@@ -142,6 +152,22 @@ namespace s3d
 
 		static constexpr TexturePixelFormat R32G32B32A32_Float = TexturePixelFormat::R32G32B32A32_Float;
 
+		static constexpr TexturePixelFormat BC1_RGBA_Unorm = TexturePixelFormat::BC1_RGBA_Unorm;
+
+		static constexpr TexturePixelFormat BC1_RGBA_Unorm_SRGB = TexturePixelFormat::BC1_RGBA_Unorm_SRGB;
+
+		static constexpr TexturePixelFormat BC3_RGBA_Unorm = TexturePixelFormat::BC3_RGBA_Unorm;
+
+		static constexpr TexturePixelFormat BC3_RGBA_Unorm_SRGB = TexturePixelFormat::BC3_RGBA_Unorm_SRGB;
+
+		static constexpr TexturePixelFormat BC4_R_Unorm = TexturePixelFormat::BC4_R_Unorm;
+
+		static constexpr TexturePixelFormat BC5_RG_Unorm = TexturePixelFormat::BC5_RG_Unorm;
+
+		static constexpr TexturePixelFormat BC7_RGBA_Unorm = TexturePixelFormat::BC7_RGBA_Unorm;
+
+		static constexpr TexturePixelFormat BC7_RGBA_Unorm_SRGB = TexturePixelFormat::BC7_RGBA_Unorm_SRGB;
+
 	private:
 
 		TexturePixelFormat m_value = TexturePixelFormat::Unknown;
@@ -47,5 +47,29 @@ namespace s3d
 
 		// 128-bit
 		R32G32B32A32_Float,
+
+		// 4-bit (8 bytes / 4x4 block)
+		BC1_RGBA_Unorm,
+
+		// 4-bit (8 bytes / 4x4 block)
+		BC1_RGBA_Unorm_SRGB,
+
+		// 8-bit (16 bytes / 4x4 block)
+		BC3_RGBA_Unorm,
+
+		// 8-bit (16 bytes / 4x4 block)
+		BC3_RGBA_Unorm_SRGB,
+
+		// 4-bit (8 bytes / 4x4 block)
+		BC4_R_Unorm,
+
+		// 8-bit (16 bytes / 4x4 block)
+		BC5_RG_Unorm,
+
+		// 8-bit (16 bytes / 4x4 block)
+		BC7_RGBA_Unorm,
+
+		// 8-bit (16 bytes / 4x4 block)
+		BC7_RGBA_Unorm_SRGB,
 	};
 }
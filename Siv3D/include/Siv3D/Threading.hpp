@@ -10,14 +10,67 @@
 //-----------------------------------------------
 
 # pragma once
+# include <functional>
+# include <future>
+# include <type_traits>
+# include "Common.hpp"
 
 namespace s3d
 {
+	namespace detail
+	{
+		void ThreadPoolSubmit(std::function<void()> task);
+
+		void ThreadPoolParallelFor(size_t count, size_t grainSize, void(*f)(void*, size_t, size_t), void* data);
+
+		/// @brief 現在のスレッドが共有スレッドプールのワーカーであるかを返します。
+		[[nodiscard]]
+		bool ThreadPoolIsWorkerThread() noexcept;
+
+		/// @brief 現在のスレッドが共有スレッドプールのワーカーである場合、キューに積まれているタスクを 1 つ実行します。
+		/// @return タスクを実行した場合 true, それ以外の場合は false
+		bool ThreadPoolRunPendingTask();
+	}
+
 	namespace Threading
 	{
 		/// @brief サポートされるスレッド数を返します。 | Returns the number of concurrent threads supported by the implementation.
 		/// @return サポートされるスレッド数 | Number of concurrent threads supported
 		[[nodiscard]]
 		size_t GetConcurrency() noexcept;
+
+		/// @brief スレッドプールのワーカースレッド数を設定します。 | Sets the number of worker threads in the thread pool.
+		/// @param numWorkers ワーカースレッド数。0 の場合はデフォルト値（`GetConcurrency() - 1`, 最小 1） | Number of worker threads. If 0, the default value (`GetConcurrency() - 1`, at least 1) is used
+		/// @remark スレッドプールが起動済みの場合、投入済みのタスクの完了を待ってから、次回の使用時に新しいワーカー数で再起動します。 | If the thread pool has already started, it waits for the submitted tasks to complete and restarts with the new number of workers on next use.
+		/// @remark スレッドプールのタスクの中から呼び出した場合は何もしません。 | Does nothing if called from a task running on the thread pool.
+		void SetWorkerCount(size_t numWorkers);
+
+		/// @brief スレッドプールのワーカースレッド数を返します。 | Returns the number of worker threads in the thread pool.
+		/// @return ワーカースレッド数 | Number of worker threads
+		[[nodiscard]]
+		size_t GetWorkerCount() noexcept;
+
+		/// @brief スレッドプールでタスクを非同期に実行します。 | Runs a task asynchronously on the thread pool.
+		/// @tparam Fty タスクで実行する関数の型 | Type of the function to run
+		/// @tparam ...Args タスクで実行する関数の引数の型 | Types of the arguments
+		/// @param f タスクで実行する関数 | Function to run
+		/// @param ...args タスクで実行する関数の引数 | Arguments
+		/// @remark スレッドプールは最初の使用時に起動します。 | The thread pool is started on first use.
+		/// @return タスクの結果を受け取る `std::future` | `std::future` that receives the result of the task
+		template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<Fty, Args...>>* = nullptr>
+		[[nodiscard]]
+		auto Submit(Fty&& f, Args&&... args);
+
+		/// @brief [0, count) の範囲を分割し、スレッドプールで並列に処理します。 | Splits the range [0, count) into chunks and processes them in parallel on the thread pool.
+		/// @tparam Fty 範囲 [begin, end) を受け取る関数、または 1 つのインデックスを受け取る関数の型 | Type of the function that takes a range [begin, end) or a single index
+		/// @param count 要素数 | Number of elements
+		/// @param f 各範囲または各インデックスに対して実行する関数 | Function to run for each chunk or each index
+		/// @param grainSize 1 回の呼び出しで処理する最小の要素数。0 の場合は自動で決定 | Minimum number of elements per chunk. If 0, it is determined automatically
+		/// @remark 呼び出し元のスレッドも処理に参加し、すべての処理が完了するまで戻りません。 | The calling thread also participates, and the function does not return until all chunks are processed.
+		/// @remark 関数が例外を投げた場合、すべての処理の完了後に最初の例外が再送出されます。 | If the function throws, the first exception is rethrown after all chunks are processed.
+		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, size_t, size_t> || std::is_invocable_v<Fty, size_t>>* = nullptr>
+		void ParallelFor(size_t count, Fty f, size_t grainSize = 0);
 	}
 }
+
+# include "detail/Threading.ipp"
@@ -17,27 +17,55 @@
 
 namespace s3d
 {
+	/// @brief VideoReader のデコードの統計情報
+	struct VideoReaderStat
+	{
+		/// @brief デコードしたフレーム数
+		uint64 decodedFrames = 0;
+
+		/// @brief `readFrame()` / `tryReadFrame()` で読み込まれたフレーム数
+		uint64 presentedFrames = 0;
+
+		/// @brief 読み込み位置が先に進んだため、読み込まれずに捨てられたフレーム数
+		uint64 droppedFrames = 0;
+
+		/// @brief 読み込むフレームのデコードが終わっていなかった回数
+		uint64 stalls = 0;
+
+		/// @brief 動画ファイル内でシークした回数
+		uint64 seeks = 0;
+	};
+
 	/// @brief 動画ファイルの読み込み
-	/// @remark バックグラウンドで次のフレームを先読みしているため、`setCurrentFrameIndex()` を使わず順番にフレームを読み込むのが効率的です。
+	/// @remark バックグラウンドで数フレーム先までデコードしているため、`setCurrentFrameIndex()` を使わず順番にフレームを読み込むのが効率的です。
 	class VideoReader
 	{
 	public:
 
+		/// @brief 先読みするフレーム数のデフォルト値
+		static constexpr size_t DefaultLookaheadFrames = 4;
+
+		/// @brief `tryReadFrame()` が読み込み位置の代わりに返すことのある、遅れたフレームの最大のフレーム数
+		static constexpr size_t MaxLateFrames = 30;
+
 		/// @brief デフォルトコンストラクタ
 		SIV3D_NODISCARD_CXX20
 		VideoReader();
 
 		/// @brief 動画ファイルをオープンします。
 		/// @param path 動画ファイルのパス
+		/// @param lookaheadFrames 先読みするフレーム数（1 以上）
 		/// @remark プラットフォームによって対応している動画ファイル形式が異なります。
 		SIV3D_NODISCARD_CXX20
-		explicit VideoReader(FilePathView path);
+		explicit VideoReader(FilePathView path, size_t lookaheadFrames = DefaultLookaheadFrames);
 
 		/// @brief 動画ファイルをオープンします。
 		/// @param path 動画ファイルのパス
+		/// @param lookaheadFrames 先読みするフレーム数（1 以上）
 		/// @remark すでに動画ファイルをオープンしている場合、それが先にクローズされます。
+		/// @remark 先読みするフレーム数を増やすと、デコードの時間のばらつきを吸収できますが、`lookaheadFrames` 枚分の画像のメモリを使います。
 		/// @return 対応している動画ファイル形式で、ファイルのオープンに成功した場合 true, それ以外の場合は false
-		bool open(FilePathView path);
+		bool open(FilePathView path, size_t lookaheadFrames = DefaultLookaheadFrames);
 
 		/// @brief 動画ファイルをクローズします。
 		void close();
@@ -62,6 +90,22 @@ namespace s3d
 		/// @return 新しいフレームの読み込みに成功した場合 true, それ以外の場合は false
 		bool readFrame(Image& image);
 
+		/// @brief デコードを待たずに 1 フレーム読み込み、成功した場合は読み込み位置を 1 フレーム進めます。
+		/// @param image 読み込んだ画像の格納先
+		/// @remark 読み込み位置のフレームのデコードが終わっていない場合、読み込み位置より最大 `MaxLateFrames` フレーム前の、デコード済みの最新のフレームを代わりに読み込みます。
+		/// @remark その場合も読み込み位置は 1 フレーム進むため、デコードが再生に間に合わない場合でもシークせずに再生を続けられます。
+		/// @remark 読み込めるフレームが無い場合は false を返し、読み込み位置は変わりません。
+		/// @remark 実際に読み込んだフレームの位置が必要な場合は `tryReadFrame(Image&, size_t&)` を使ってください。
+		/// @return フレームの読み込みに成功した場合 true, それ以外の場合は false
+		bool tryReadFrame(Image& image);
+
+		/// @brief デコードを待たずに 1 フレーム読み込み、成功した場合は読み込み位置を 1 フレーム進めます。
+		/// @param image 読み込んだ画像の格納先
+		/// @param frameIndex 実際に読み込んだフレームの位置の格納先。読み込み位置より最大 `MaxLateFrames` フレーム前になることがあります。
+		/// @remark `tryReadFrame(Image&)` と同じです。
+		/// @return フレームの読み込みに成功した場合 true, それ以外の場合は false
+		bool tryReadFrame(Image& image, size_t& frameIndex);
+
 		/// @brief 動画の解像度を返します。
 		/// @return 動画の解像度
 		[[nodiscard]]
@@ -118,6 +162,19 @@ namespace s3d
 		[[nodiscard]]
 		const FilePath& path() const noexcept;
 
+		/// @brief 先読みするフレーム数を返します。
+		/// @return 先読みするフレーム数
+		[[nodiscard]]
+		size_t getLookaheadFrames() const noexcept;
+
+		/// @brief デコードの統計情報を返します。
+		/// @return デコードの統計情報
+		[[nodiscard]]
+		VideoReaderStat getStat() const;
+
+		/// @brief デコードの統計情報をリセットします。
+		void resetStat();
+
 	private:
 
 		class VideoReaderDetail;
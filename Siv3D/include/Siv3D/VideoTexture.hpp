@@ -47,7 +47,8 @@ namespace s3d
 
 		/// @brief 動画の時間を進めます。
 		/// @param deltaTimeSec 進める時間（秒）
-		/// @remark 1 フレーム先までバッファリングするため、この関数を毎フレーム呼び出すのが最も効率的です。
+		/// @remark 数フレーム先までバッファリングするため、この関数を毎フレーム呼び出すのが最も効率的です。
+		/// @remark 次のフレームのデコードが間に合っていない場合は待たずに、今のフレームを表示し続けます。
 		void advance(double deltaTimeSec = Scene::DeltaTime()) const;
 
 		/// @brief 動画の再生時間を先頭に戻します。
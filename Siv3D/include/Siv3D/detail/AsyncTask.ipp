@@ -13,27 +13,135 @@
 
 namespace s3d
 {
+	namespace detail
+	{
+		template <class Type>
+		inline AsyncTask<Type> AsyncTaskAccess::Make(std::future<Type>&& future, std::shared_ptr<AsyncTaskContinuations> continuations, const bool waitOnDestruction)
+		{
+			AsyncTask<Type> task{ std::move(future) };
+			task.m_continuations = std::move(continuations);
+			task.m_waitOnDestruction = waitOnDestruction;
+			return task;
+		}
+
+		template <class Type>
+		inline const std::shared_ptr<AsyncTaskContinuations>& AsyncTaskAccess::GetContinuations(const AsyncTask<Type>& task) noexcept
+		{
+			return task.m_continuations;
+		}
+
+		template <class Type>
+		inline std::future<Type> AsyncTaskAccess::Release(AsyncTask<Type>& task) noexcept
+		{
+			task.m_continuations.reset();
+			task.m_waitOnDestruction = false;
+			return std::move(task.m_data);
+		}
+
+		template <class Type>
+		inline void AsyncTaskAccess::EnsureContinuations(AsyncTask<Type>& task)
+		{
+			if (task.m_continuations || (not task.m_data.valid()))
+			{
+				return;
+			}
+
+			// 完了通知を持たない `std::future` から作成されたタスクは、専用のスレッドで完了を待つ
+			// （スレッドプールのワーカーを待機で占有すると、プールが枯渇してデッドロックすることがある）
+			auto previous = std::make_shared<std::future<Type>>(std::move(task.m_data));
+			auto packaged = std::make_shared<std::packaged_task<Type()>>([previous]() -> Type { return previous->get(); });
+
+			task.m_data = packaged->get_future();
+			task.m_continuations = std::make_shared<AsyncTaskContinuations>();
+
+			std::function<void()> run = [packaged, continuations = task.m_continuations]()
+			{
+				(*packaged)();
+				continuations->complete();
+			};
+
+		# if !SIV3D_PLATFORM(WEB) || defined(__EMSCRIPTEN_PTHREADS__)
+
+			AsyncTaskLaunchDedicatedThread(std::move(run));
+
+		# else
+
+			// スレッドを作成できないため、その場で完了を待つ
+			run();
+
+		# endif
+		}
+	}
+
 	template <class Type>
 	inline AsyncTask<Type>::AsyncTask(base_type&& other) noexcept
 		: m_data{ std::move(other) } {}
 
 	template <class Type>
 	inline AsyncTask<Type>::AsyncTask(AsyncTask&& other) noexcept
-		: m_data{ std::move(other.m_data) } {}
+		: m_data{ std::move(other.m_data) }
+		, m_continuations{ std::move(other.m_continuations) }
+		, m_waitOnDestruction{ std::exchange(other.m_waitOnDestruction, false) } {}
 
 	template <class Type>
 	template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<Fty, Args...>>*>
 	inline AsyncTask<Type>::AsyncTask(Fty&& f, Args&&... args)
+		: AsyncTask{ AsyncLaunch::ThreadPool, std::forward<Fty>(f), std::forward<Args>(args)... } {}
+
+	template <class Type>
+	template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<Fty, Args...>>*>
+	inline AsyncTask<Type>::AsyncTask(const AsyncLaunch launch, Fty&& f, Args&&... args)
+	{
 	# if !SIV3D_PLATFORM(WEB) || defined(__EMSCRIPTEN_PTHREADS__)
-		: m_data{ std::async(std::launch::async, std::forward<Fty>(f), std::forward<Args>(args)...) } {}
+
+		auto task = std::make_shared<std::packaged_task<Type()>>(
+			[f = std::forward<Fty>(f), ...args = std::forward<Args>(args)]() mutable -> Type
+			{
+				return std::invoke(std::move(f), std::move(args)...);
+			});
+
+		m_data = task->get_future();
+		m_continuations = std::make_shared<detail::AsyncTaskContinuations>();
+		m_waitOnDestruction = true;
+
+		std::function<void()> run = [task, continuations = m_continuations]()
+		{
+			(*task)();
+			continuations->complete();
+		};
+
+		if (launch == AsyncLaunch::DedicatedThread)
+		{
+			detail::AsyncTaskLaunchDedicatedThread(std::move(run));
+		}
+		else
+		{
+			detail::ThreadPoolSubmit(std::move(run));
+		}
+
 	# else
-		: m_data{} {}
+
+		(void)launch;
+		(void)f;
+		((void)args, ...);
+
 	# endif
+	}
+
+	template <class Type>
+	inline AsyncTask<Type>::~AsyncTask()
+	{
+		waitIfRequired();
+	}
 
 	template <class Type>
 	inline AsyncTask<Type>& AsyncTask<Type>::operator =(base_type&& other) noexcept
 	{
+		waitIfRequired();
+
 		m_data = std::move(other);
+		m_continuations.reset();
+		m_waitOnDestruction = false;
 
 		return *this;
 	}
@@ -41,7 +149,14 @@ namespace s3d
 	template <class Type>
 	inline AsyncTask<Type>& AsyncTask<Type>::operator =(AsyncTask&& other) noexcept
 	{
-		m_data = std::move(other.m_data);
+		if (this != &other)
+		{
+			waitIfRequired();
+
+			m_data = std::move(other.m_data);
+			m_continuations = std::move(other.m_continuations);
+			m_waitOnDestruction = std::exchange(other.m_waitOnDestruction, false);
+		}
 
 		return *this;
 	}
@@ -62,13 +177,15 @@ namespace s3d
 	template <class Type>
 	inline Type AsyncTask<Type>::get()
 	{
+		waitWhileRunningPendingTasks();
+
 		return m_data.get();
 	}
 
 	template <class Type>
 	inline void AsyncTask<Type>::wait() const
 	{
-		m_data.wait();
+		waitWhileRunningPendingTasks();
 	}
 
 	template <class Type>
@@ -88,12 +205,271 @@ namespace s3d
 	template <class Type>
 	inline std::shared_future<Type> AsyncTask<Type>::share() noexcept
 	{
+		m_waitOnDestruction = false;
+
 		return m_data.share();
 	}
 
+	template <class Type>
+	template <class Fty, std::enable_if_t<detail::IsAsyncTaskContinuation<Type, Fty>::value>*>
+	inline auto AsyncTask<Type>::then(Fty f, const ContinuationContext context)
+	{
+		return then(std::move(f), CancellationToken{}, context);
+	}
+
+	template <class Type>
+	template <class Fty, std::enable_if_t<detail::IsAsyncTaskContinuation<Type, Fty>::value>*>
+	inline auto AsyncTask<Type>::then(Fty f, const CancellationToken& cancellationToken, const ContinuationContext context)
+	{
+		using Result = detail::AsyncTaskContinuationResult_t<Type, Fty>;
+
+		if (not m_data.valid())
+		{
+			return AsyncTask<Result>{};
+		}
+
+		detail::AsyncTaskAccess::EnsureContinuations(*this);
+
+		const std::shared_ptr<detail::AsyncTaskContinuations> previousContinuations = std::move(m_continuations);
+		auto previous = std::make_shared<base_type>(std::move(m_data));
+		m_waitOnDestruction = false;
+
+		auto task = std::make_shared<std::packaged_task<Result()>>(
+			[f = std::move(f), previous, cancellationToken]() mutable -> Result
+			{
+				if constexpr (std::is_void_v<Type>)
+				{
+					previous->get();
+
+					cancellationToken.throwIfCancellationRequested();
+
+					return std::invoke(f);
+				}
+				else
+				{
+					auto value = previous->get();
+
+					cancellationToken.throwIfCancellationRequested();
+
+					return std::invoke(f, std::move(value));
+				}
+			});
+
+		auto next = std::make_shared<detail::AsyncTaskContinuations>();
+
+		std::function<void()> run = [task, next]()
+		{
+			(*task)();
+			next->complete();
+		};
+
+		if (context == ContinuationContext::MainThread)
+		{
+			previousContinuations->add([run]() { detail::AsyncTaskPostToMainThread(run); });
+		}
+		else
+		{
+			previousContinuations->add([run]() { detail::ThreadPoolSubmit(run); });
+		}
+
+		// メインスレッドで実行する継続処理は、メインスレッドで破棄されたときに完了を待つとデッドロックするため、待機しない
+		return detail::AsyncTaskAccess::Make<Result>(task->get_future(), std::move(next), (context == ContinuationContext::ThreadPool));
+	}
+
+	template <class Type>
+	inline void AsyncTask<Type>::waitIfRequired() const
+	{
+		if (m_waitOnDestruction && m_data.valid())
+		{
+			waitWhileRunningPendingTasks();
+		}
+	}
+
+	template <class Type>
+	inline void AsyncTask<Type>::waitWhileRunningPendingTasks() const
+	{
+		if ((not m_data.valid())
+			|| (not detail::ThreadPoolIsWorkerThread()))
+		{
+			m_data.wait();
+			return;
+		}
+
+		// ワーカーがただ待機すると、待っているタスクがキューに残ったまま全ワーカーが塞がってデッドロックすることがあるため、
+		// 完了するまでキューのタスクを代わりに実行する
+		while (m_data.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		{
+			if (not detail::ThreadPoolRunPendingTask())
+			{
+				m_data.wait_for(std::chrono::milliseconds(1));
+			}
+		}
+	}
+
 	template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<Fty, Args...>>*>
 	inline auto Async(Fty&& f, Args&&... args)
 	{
 		return AsyncTask<std::invoke_result_t<std::decay_t<Fty>, std::decay_t<Args>...>>{ std::forward<Fty>(f), std::forward<Args>(args)... };
 	}
+
+	template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<Fty, Args...>>*>
+	inline auto Async(const AsyncLaunch launch, Fty&& f, Args&&... args)
+	{
+		return AsyncTask<std::invoke_result_t<std::decay_t<Fty>, std::decay_t<Args>...>>{ launch, std::forward<Fty>(f), std::forward<Args>(args)... };
+	}
+
+	template <class Type>
+	inline auto WhenAll(Array<AsyncTask<Type>> tasks)
+	{
+		using Result = std::conditional_t<std::is_void_v<Type>, void, Array<Type>>;
+
+		struct State
+		{
+			Array<std::future<Type>> futures;
+
+			std::atomic<size_t> remaining{ 0 };
+		};
+
+		auto state = std::make_shared<State>();
+		state->futures.reserve(tasks.size());
+
+		Array<std::shared_ptr<detail::AsyncTaskContinuations>> continuations(Arg::reserve = tasks.size());
+
+		for (auto& task : tasks)
+		{
+			detail::AsyncTaskAccess::EnsureContinuations(task);
+			continuations << detail::AsyncTaskAccess::GetContinuations(task);
+			state->futures << detail::AsyncTaskAccess::Release(task);
+		}
+
+		auto task = std::make_shared<std::packaged_task<Result()>>([state]() -> Result
+			{
+				if constexpr (std::is_void_v<Type>)
+				{
+					for (auto& future : state->futures)
+					{
+						future.get();
+					}
+				}
+				else
+				{
+					Array<Type> results(Arg::reserve = state->futures.size());
+
+					for (auto& future : state->futures)
+					{
+						results << future.get();
+					}
+
+					return results;
+				}
+			});
+
+		auto next = std::make_shared<detail::AsyncTaskContinuations>();
+
+		AsyncTask<Result> result = detail::AsyncTaskAccess::Make<Result>(task->get_future(), next, true);
+
+		std::function<void()> run = [task, next]()
+		{
+			(*task)();
+			next->complete();
+		};
+
+		if (state->futures.isEmpty())
+		{
+			detail::ThreadPoolSubmit(std::move(run));
+			return result;
+		}
+
+		state->remaining = state->futures.size();
+
+		const std::function<void()> onComplete = [state, run]()
+		{
+			if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				detail::ThreadPoolSubmit(run);
+			}
+		};
+
+		for (const auto& continuation : continuations)
+		{
+			if (continuation)
+			{
+				continuation->add(onComplete);
+			}
+			else
+			{
+				// 非同期処理を持たないタスク（`get()` で例外になる）
+				onComplete();
+			}
+		}
+
+		return result;
+	}
+
+	template <class Type>
+	inline AsyncTask<WhenAnyResult<Type>> WhenAny(Array<AsyncTask<Type>> tasks)
+	{
+		if (tasks.isEmpty())
+		{
+			return{};
+		}
+
+		struct State
+		{
+			std::promise<WhenAnyResult<Type>> promise;
+
+			Array<AsyncTask<Type>> tasks;
+
+			std::atomic<bool> completed{ false };
+
+			size_t index = 0;
+
+			// 完了処理の登録と、最初のタスクの完了の両方が済んだときに 0 になる
+			std::atomic<int32> remaining{ 2 };
+		};
+
+		auto state = std::make_shared<State>();
+		state->tasks = std::move(tasks);
+
+		auto next = std::make_shared<detail::AsyncTaskContinuations>();
+
+		AsyncTask<WhenAnyResult<Type>> result = detail::AsyncTaskAccess::Make<WhenAnyResult<Type>>(state->promise.get_future(), next, false);
+
+		// 登録の途中で state->tasks を結果に移動しないよう、両方が済んでから結果を設定する
+		const auto finish = [state, next]()
+		{
+			if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				state->promise.set_value(WhenAnyResult<Type>{ state->index, std::move(state->tasks) });
+				next->complete();
+			}
+		};
+
+		for (size_t i = 0; i < state->tasks.size(); ++i)
+		{
+			detail::AsyncTaskAccess::EnsureContinuations(state->tasks[i]);
+
+			std::function<void()> onComplete = [state, finish, i]()
+			{
+				if (not state->completed.exchange(true, std::memory_order_acq_rel))
+				{
+					state->index = i;
+					finish();
+				}
+			};
+
+			if (const auto& continuation = detail::AsyncTaskAccess::GetContinuations(state->tasks[i]))
+			{
+				continuation->add(std::move(onComplete));
+			}
+			else
+			{
+				onComplete();
+			}
+		}
+
+		finish();
+
+		return result;
+	}
 }
@@ -0,0 +1,54 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	inline CancellationToken::CancellationToken(std::shared_ptr<std::atomic<bool>> canceled) noexcept
+		: m_canceled{ std::move(canceled) } {}
+
+	inline bool CancellationToken::isCancellationRequested() const noexcept
+	{
+		return (m_canceled && m_canceled->load(std::memory_order_acquire));
+	}
+
+	inline void CancellationToken::throwIfCancellationRequested() const
+	{
+		if (isCancellationRequested())
+		{
+			throw OperationCanceledError{ U"The operation was canceled" };
+		}
+	}
+
+	inline bool CancellationToken::canBeCanceled() const noexcept
+	{
+		return static_cast<bool>(m_canceled);
+	}
+
+	inline CancellationTokenSource::CancellationTokenSource()
+		: m_canceled{ std::make_shared<std::atomic<bool>>(false) } {}
+
+	inline void CancellationTokenSource::cancel() noexcept
+	{
+		m_canceled->store(true, std::memory_order_release);
+	}
+
+	inline bool CancellationTokenSource::isCancellationRequested() const noexcept
+	{
+		return m_canceled->load(std::memory_order_acquire);
+	}
+
+	inline CancellationToken CancellationTokenSource::getToken() const noexcept
+	{
+		return CancellationToken{ m_canceled };
+	}
+}
@@ -169,6 +169,83 @@ namespace s3d
 		return none;
 	}
 
+	template <class Type>
+	inline Type JSONView::get() const
+	{
+		if (const auto opt = getOpt<Type>())
+		{
+			return opt.value();
+		}
+		else
+		{
+			throw Error{ U"JSONView::get(): Invalid JSON type. value: " + Format(*this) };
+		}
+	}
+
+	template <class Type, class U>
+	inline Type JSONView::getOr(U&& defaultValue) const
+	{
+		return getOpt<Type>().value_or(std::forward<U>(defaultValue));
+	}
+
+	template <class Type>
+	inline Optional<Type> JSONView::getOpt() const
+	{
+		if constexpr (std::is_same_v<Type, String>)
+		{
+			return getOptString();
+		}
+		else if constexpr (std::is_same_v<Type, int64>)
+		{
+			return getOptInt64();
+		}
+		else if constexpr (std::is_same_v<Type, double>)
+		{
+			return getOptDouble();
+		}
+		else if constexpr (std::is_same_v<Type, bool>)
+		{
+			return getOptBool();
+		}
+		else
+		{
+			return getOpt_<Type>();
+		}
+	}
+
+	SIV3D_CONCEPT_INTEGRAL_
+	inline Optional<Int> JSONView::getOpt_() const
+	{
+		if (const auto opt = getOptInt64())
+		{
+			return static_cast<Int>(*opt);
+		}
+
+		return none;
+	}
+
+	SIV3D_CONCEPT_FLOATING_POINT_
+	inline Optional<Float> JSONView::getOpt_() const
+	{
+		if (const auto opt = getOptDouble())
+		{
+			return static_cast<Float>(*opt);
+		}
+
+		return none;
+	}
+
+	template <class Type, std::enable_if_t<!std::is_arithmetic_v<Type>>*>
+	inline Optional<Type> JSONView::getOpt_() const
+	{
+		if (const auto opt = getOptString())
+		{
+			return ParseOpt<Type>(*opt);
+		}
+
+		return none;
+	}
+
 	inline namespace Literals
 	{
 		inline namespace JSONLiterals
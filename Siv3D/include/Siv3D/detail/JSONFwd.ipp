@@ -27,6 +27,8 @@ namespace s3d
 	class JSONConstIterator;
 	class JSONIterationProxy;
 	class JSONArrayView;
+	class JSONViewIterator;
+	class JSONView;
 	class JSON;
 	struct JSONItem;
 	struct JSONPointer;
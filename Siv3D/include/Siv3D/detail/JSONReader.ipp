@@ -0,0 +1,28 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>*>
+	inline JSONReader::JSONReader(Reader&& reader, const size_t bufferSize)
+		: JSONReader{}
+	{
+		open(std::forward<Reader>(reader), bufferSize);
+	}
+
+	template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>*>
+	inline bool JSONReader::open(Reader&& reader, const size_t bufferSize)
+	{
+		return open(std::make_unique<Reader>(std::forward<Reader>(reader)), bufferSize);
+	}
+}
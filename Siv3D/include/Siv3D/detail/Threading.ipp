@@ -0,0 +1,65 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	namespace Threading
+	{
+		template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<Fty, Args...>>*>
+		inline auto Submit(Fty&& f, Args&&... args)
+		{
+			using Result = std::invoke_result_t<std::decay_t<Fty>, std::decay_t<Args>...>;
+
+			auto task = std::make_shared<std::packaged_task<Result()>>(
+				[f = std::forward<Fty>(f), ...args = std::forward<Args>(args)]() mutable -> Result
+				{
+					return std::invoke(std::move(f), std::move(args)...);
+				});
+
+			std::future<Result> future = task->get_future();
+
+			detail::ThreadPoolSubmit([task = std::move(task)]() { (*task)(); });
+
+			return future;
+		}
+
+		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, size_t, size_t> || std::is_invocable_v<Fty, size_t>>*>
+		inline void ParallelFor(const size_t count, Fty f, const size_t grainSize)
+		{
+			if (count == 0)
+			{
+				return;
+			}
+
+			if constexpr (std::is_invocable_v<Fty, size_t, size_t>)
+			{
+				detail::ThreadPoolParallelFor(count, grainSize, [](void* data, size_t begin, size_t end)
+					{
+						(*static_cast<Fty*>(data))(begin, end);
+					}, std::addressof(f));
+			}
+			else
+			{
+				detail::ThreadPoolParallelFor(count, grainSize, [](void* data, size_t begin, size_t end)
+					{
+						Fty& func = *static_cast<Fty*>(data);
+
+						for (size_t i = begin; i < end; ++i)
+						{
+							func(i);
+						}
+					}, std::addressof(f));
+			}
+		}
+	}
+}
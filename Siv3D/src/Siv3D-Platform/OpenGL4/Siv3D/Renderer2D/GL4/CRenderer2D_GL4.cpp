@@ -90,7 +90,7 @@ namespace s3d
 
 		// Batch 管理を初期化
 		{
-			if (not m_batches.init())
+			if (not m_batches.init(Vertex2DBatchFormat::FromEngineOptions()))
 			{
 				throw EngineError(U"GL4Vertex2DBatch::init() failed");
 			}
@@ -823,6 +823,27 @@ namespace s3d
 		}
 	}
 
+	void CRenderer2D_GL4::addTexturedParticles(const Texture& texture, const Particle2DSoAView& particles,
+		ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
+		ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedParticles(m_bufferCreator, particles, sizeOverLifeTimeFunc, colorOverLifeTimeFunc))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->textureID);
+			}
+
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
 	Float4 CRenderer2D_GL4::getColorMul() const
 	{
 		return m_commandManager.getCurrentColorMul();
@@ -1111,7 +1132,7 @@ namespace s3d
 				}
 			case GL4Renderer2DCommandType::UpdateBuffers:
 				{
-					batchInfo = m_batches.updateBuffers(command.index);
+					batchInfo = m_batches.updateBuffers(command.index, m_stat);
 
 					LOG_COMMAND(U"UpdateBuffers[{}] BatchInfo(indexCount = {}, startIndexLocation = {}, baseVertexLocation = {})"_fmt(
 						command.index, batchInfo.indexCount, batchInfo.startIndexLocation, batchInfo.baseVertexLocation));
@@ -1126,9 +1147,9 @@ namespace s3d
 					const uint32 indexCount = draw.indexCount;
 					const uint32 startIndexLocation = batchInfo.startIndexLocation;
 					const uint32 baseVertexLocation = batchInfo.baseVertexLocation;
-					constexpr Vertex2D::IndexType* pBase = 0;
+					const size_t indexByteOffset = (static_cast<size_t>(m_batches.getIndexStride()) * startIndexLocation);
 
-					::glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, GL_UNSIGNED_SHORT, (pBase + startIndexLocation), baseVertexLocation);
+					::glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, m_batches.getIndexType(), reinterpret_cast<const void*>(indexByteOffset), baseVertexLocation);
 					batchInfo.startIndexLocation += indexCount;
 
 					++m_stat.drawCalls;
@@ -0,0 +1,118 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/EngineLog.hpp>
+# include "GL4PersistentRingBuffer.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// 1 秒
+		static constexpr GLuint64 FenceTimeoutNanosec = 1'000'000'000;
+	}
+
+	GL4PersistentRingBuffer::~GL4PersistentRingBuffer()
+	{
+		release();
+	}
+
+	bool GL4PersistentRingBuffer::IsSupported() noexcept
+	{
+		return (GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage);
+	}
+
+	bool GL4PersistentRingBuffer::init(const GLenum target, const GLuint buffer, const uint32 elementSize, const uint32 sectionElementCount)
+	{
+		release();
+
+		const GLsizeiptr bufferSize = (static_cast<GLsizeiptr>(elementSize) * sectionElementCount * SectionCount);
+		constexpr GLbitfield Flags = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+
+		::glBindBuffer(target, buffer);
+		::glBufferStorage(target, bufferSize, nullptr, Flags);
+
+		void* const pMapped = ::glMapBufferRange(target, 0, bufferSize, Flags);
+
+		if (not pMapped)
+		{
+			LOG_FAIL(U"❌ GL4PersistentRingBuffer::init(): glMapBufferRange() failed");
+			return false;
+		}
+
+		m_pMapped				= static_cast<uint8*>(pMapped);
+		m_elementSize			= elementSize;
+		m_sectionElementCount	= sectionElementCount;
+		m_section				= 0;
+		m_sectionWritePos		= 0;
+
+		return true;
+	}
+
+	GL4PersistentRingBuffer::Allocation GL4PersistentRingBuffer::allocate(const uint32 count, Renderer2DStat& stat)
+	{
+		assert(count <= m_sectionElementCount);
+
+		if (m_sectionElementCount < (m_sectionWritePos + count))
+		{
+			// 現在のセクションを使う描画コマンドはすべて発行済み
+			m_fences[m_section] = ::glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+			m_section = ((m_section + 1) % SectionCount);
+			m_sectionWritePos = 0;
+
+			waitFence(m_section, stat);
+		}
+
+		const uint32 firstElement = (m_section * m_sectionElementCount + m_sectionWritePos);
+		m_sectionWritePos += count;
+
+		return{ (m_pMapped + static_cast<size_t>(m_elementSize) * firstElement), firstElement };
+	}
+
+	void GL4PersistentRingBuffer::release()
+	{
+		for (auto& fence : m_fences)
+		{
+			if (fence)
+			{
+				::glDeleteSync(fence);
+				fence = nullptr;
+			}
+		}
+
+		// マップはバッファの所有者が glDeleteBuffers() したときに解除される
+		m_pMapped = nullptr;
+	}
+
+	void GL4PersistentRingBuffer::waitFence(const uint32 section, Renderer2DStat& stat)
+	{
+		GLsync& fence = m_fences[section];
+
+		if (not fence)
+		{
+			return;
+		}
+
+		if (::glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+		{
+			++stat.fenceWaitCount;
+
+			while (::glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, detail::FenceTimeoutNanosec) == GL_TIMEOUT_EXPIRED)
+			{
+				LOG_WARNING(U"⚠️ GL4PersistentRingBuffer: waiting for the GPU to release a ring section");
+			}
+		}
+
+		::glDeleteSync(fence);
+		fence = nullptr;
+	}
+}
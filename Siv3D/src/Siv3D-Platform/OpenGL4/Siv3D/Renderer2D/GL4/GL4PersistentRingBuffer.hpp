@@ -0,0 +1,83 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <array>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Common/OpenGL.hpp>
+# include <Siv3D/Renderer2D/IRenderer2D.hpp>
+
+namespace s3d
+{
+	/// @brief `glBufferStorage` で確保し、永続的にマップした GPU バッファを 3 つのセクションに分けて循環利用するリングバッファ
+	/// @remark セクションを離れるときにフェンスを挿入し、再利用する前に GPU の読み出し完了を待ちます。
+	class GL4PersistentRingBuffer
+	{
+	public:
+
+		static constexpr uint32 SectionCount = 3;
+
+		struct Allocation
+		{
+			void* pData = nullptr;
+
+			/// @brief バッファ先頭からの要素位置
+			uint32 firstElement = 0;
+		};
+
+		GL4PersistentRingBuffer() = default;
+
+		GL4PersistentRingBuffer(const GL4PersistentRingBuffer&) = delete;
+
+		GL4PersistentRingBuffer& operator =(const GL4PersistentRingBuffer&) = delete;
+
+		~GL4PersistentRingBuffer();
+
+		/// @brief 現在の OpenGL コンテキストで `glBufferStorage` が使えるかを返します。
+		[[nodiscard]]
+		static bool IsSupported() noexcept;
+
+		/// @brief バッファのストレージを確保して永続的にマップします。
+		/// @param target `buffer` がバインドされているターゲット
+		/// @param buffer バッファ
+		/// @param elementSize 要素 1 つあたりのバイト数
+		/// @param sectionElementCount 1 セクションあたりの要素数
+		/// @return 成功した場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool init(GLenum target, GLuint buffer, uint32 elementSize, uint32 sectionElementCount);
+
+		/// @brief 要素を書き込む領域を確保します。
+		/// @param count 要素数。`sectionElementCount` 以下である必要があります。
+		/// @param stat フェンスの待機回数を記録する統計
+		/// @return 確保した領域
+		[[nodiscard]]
+		Allocation allocate(uint32 count, Renderer2DStat& stat);
+
+		/// @brief フェンスを破棄します。バッファ自体は所有者が削除します。
+		void release();
+
+	private:
+
+		uint8* m_pMapped = nullptr;
+
+		uint32 m_elementSize = 0;
+
+		uint32 m_sectionElementCount = 0;
+
+		uint32 m_section = 0;
+
+		uint32 m_sectionWritePos = 0;
+
+		std::array<GLsync, SectionCount> m_fences{};
+
+		void waitFence(uint32 section, Renderer2DStat& stat);
+	};
+}
@@ -15,31 +15,21 @@
 
 namespace s3d
 {
-	namespace detail
+	GL4Vertex2DBatch::GL4Vertex2DBatch()
 	{
-		static size_t CalculateNewArraySize(const size_t current, const size_t target) noexcept
-		{
-			size_t newArraySize = current * 2;
-
-			while (newArraySize < target)
-			{
-				newArraySize *= 2;
-			}
 
-			return newArraySize;
-		}
 	}
 
-	GL4Vertex2DBatch::GL4Vertex2DBatch()
-		: m_vertexArray(InitialVertexArraySize)
-		, m_indexArray(InitialIndexArraySize)
-		, m_batches(1)
+	GL4Vertex2DBatch::~GL4Vertex2DBatch()
 	{
-
+		release();
 	}
 
-	GL4Vertex2DBatch::~GL4Vertex2DBatch()
+	void GL4Vertex2DBatch::release()
 	{
+		m_indexRing.release();
+		m_vertexRing.release();
+
 		if (m_indexBuffer)
 		{
 			::glDeleteBuffers(1, &m_indexBuffer);
@@ -59,32 +49,85 @@ namespace s3d
 		}
 	}
 
-	bool GL4Vertex2DBatch::init()
+	void GL4Vertex2DBatch::createObjects()
 	{
 		::glGenVertexArrays(1, &m_vao);
 		::glGenBuffers(1, &m_vertexBuffer);
 		::glGenBuffers(1, &m_indexBuffer);
+	}
+
+	bool GL4Vertex2DBatch::initPersistentRings(const Vertex2DBatchFormat& format)
+	{
+		return (m_vertexRing.init(GL_ARRAY_BUFFER, m_vertexBuffer, format.vertexStride(), m_vertexBufferSize)
+			&& m_indexRing.init(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer, format.indexStride(), m_indexBufferSize));
+	}
+
+	bool GL4Vertex2DBatch::init(const Vertex2DBatchFormat& format)
+	{
+		m_batchBuffer.setFormat(format);
+		m_vertexBufferSize	= m_batchBuffer.maxVertexCountPerBatch();
+		m_indexBufferSize	= m_batchBuffer.maxIndexCountPerBatch();
+
+		m_persistentMapping = GL4PersistentRingBuffer::IsSupported();
+
+		LOG_INFO(U"ℹ️ GL4Vertex2DBatch: vertex stride = {} bytes, index stride = {} bytes, persistent mapping = {}"_fmt(
+			format.vertexStride(), format.indexStride(), m_persistentMapping));
+
+		createObjects();
 
 		::glBindVertexArray(m_vao);
 		{
+			if (m_persistentMapping && (not initPersistentRings(format)))
+			{
+				::glBindVertexArray(0);
+
+				// glBufferStorage で確保したバッファはサイズや用途を変更できないため、頂点配列とバッファを作り直して、
+				// glBufferData による従来の方法で続行する
+				release();
+
+				LOG_WARNING(U"⚠️ GL4Vertex2DBatch: Failed to map the persistent ring buffers. Falling back to glBufferData");
+
+				m_persistentMapping = false;
+
+				createObjects();
+
+				::glBindVertexArray(m_vao);
+			}
+
+			if (m_persistentMapping)
 			{
+				// 頂点属性の設定のために頂点バッファをバインドし直す
 				::glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
-				::glBufferData(GL_ARRAY_BUFFER, (sizeof(Vertex2D) * VertexBufferSize), nullptr, GL_DYNAMIC_DRAW);
+			}
+			else
+			{
+				::glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+				::glBufferData(GL_ARRAY_BUFFER, (format.vertexStride() * m_vertexBufferSize), nullptr, GL_DYNAMIC_DRAW);
 			}
 
+			if (format.packedVertex)
+			{
+				::glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 20, (const GLubyte*)0);	// Vertex2DPacked::pos
+				::glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 20, (const GLubyte*)8);	// Vertex2DPacked::tex
+				::glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, 20, (const GLubyte*)16);	// Vertex2DPacked::color
+			}
+			else
 			{
 				::glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 32, (const GLubyte*)0);	// Vertex2D::pos
 				::glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 32, (const GLubyte*)8);	// Vertex2D::tex
 				::glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, 32, (const GLubyte*)16);	// Vertex2D::color
+			}
 
+			{
 				::glEnableVertexAttribArray(0);
 				::glEnableVertexAttribArray(1);
 				::glEnableVertexAttribArray(2);
 			}
 
+			if (not m_persistentMapping)
 			{
 				::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
-				::glBufferData(GL_ELEMENT_ARRAY_BUFFER, (sizeof(Vertex2D::IndexType) * IndexBufferSize), nullptr, GL_DYNAMIC_DRAW);
+				::glBufferData(GL_ELEMENT_ARRAY_BUFFER, (format.indexStride() * m_indexBufferSize), nullptr, GL_DYNAMIC_DRAW);
 			}
 		}
 		::glBindVertexArray(0);
@@ -94,64 +137,36 @@ namespace s3d
 
 	Vertex2DBufferPointer GL4Vertex2DBatch::requestBuffer(const uint16 vertexSize, const uint32 indexSize, GL4Renderer2DCommandManager& commandManager)
 	{
-		// VB
-		if (const uint32 vertexArrayWritePosTarget = m_vertexArrayWritePos + vertexSize;
-			m_vertexArray.size() < vertexArrayWritePosTarget) SIV3D_UNLIKELY
-		{
-			if (MaxVertexArraySize < vertexArrayWritePosTarget) SIV3D_UNLIKELY
-			{
-				return{ nullptr, 0, 0 };
-			}
+		const size_t previousNumBatches = m_batchBuffer.num_batches();
 
-			const size_t newVertexArraySize = detail::CalculateNewArraySize(m_vertexArray.size(), vertexArrayWritePosTarget);
-			LOG_TRACE(U"ℹ️ Resized GL4Vertex2DBatch::m_vertexArray (size: {} -> {})"_fmt(m_vertexArray.size(), newVertexArraySize));
-			m_vertexArray.resize(newVertexArraySize);
-		}
-
-		// IB
-		if (const uint32 indexArrayWritePosTarget = m_indexArrayWritePos + indexSize;
-			m_indexArray.size() < indexArrayWritePosTarget) SIV3D_UNLIKELY
-		{
-			if (MaxIndexArraySize < indexArrayWritePosTarget) SIV3D_UNLIKELY
-			{
-				return{ nullptr, 0, 0 };
-			}
-
-			const size_t newIndexArraySize = detail::CalculateNewArraySize(m_indexArray.size(), indexArrayWritePosTarget);
-			LOG_TRACE(U"ℹ️ Resized GL4Vertex2DBatch::m_indexArray (size: {} -> {})"_fmt(m_indexArray.size(), newIndexArraySize));
-			m_indexArray.resize(newIndexArraySize);
-		}
+		const Vertex2DBufferPointer pointer = m_batchBuffer.requestBuffer(vertexSize, indexSize);
 
-		if (const auto& lastbatch = m_batches.back();
-			(VertexBufferSize < (lastbatch.vertexPos + vertexSize) || IndexBufferSize < (lastbatch.indexPos + indexSize)))
+		if (previousNumBatches != m_batchBuffer.num_batches())
 		{
-			commandManager.pushUpdateBuffers(static_cast<uint32>(m_batches.size()));
-			m_batches.emplace_back();
+			commandManager.pushUpdateBuffers(static_cast<uint32>(previousNumBatches));
 		}
 
-		auto& lastbatch = m_batches.back();
-		Vertex2D* const pVertex = (m_vertexArray.data() + m_vertexArrayWritePos);
-		Vertex2D::IndexType* const pIndex = (m_indexArray.data() + m_indexArrayWritePos);
-		const auto indexOffset = lastbatch.vertexPos;
+		return pointer;
+	}
 
-		advanceArrayWritePos(vertexSize, indexSize);
-		lastbatch.advance(vertexSize, indexSize);
+	size_t GL4Vertex2DBatch::num_batches() const noexcept
+	{
+		return m_batchBuffer.num_batches();
+	}
 
-		return{ pVertex, pIndex, indexOffset };
+	GLenum GL4Vertex2DBatch::getIndexType() const noexcept
+	{
+		return (m_batchBuffer.getFormat().index32 ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT);
 	}
 
-	size_t GL4Vertex2DBatch::num_batches() const noexcept
+	uint32 GL4Vertex2DBatch::getIndexStride() const noexcept
 	{
-		return m_batches.size();
+		return m_batchBuffer.getFormat().indexStride();
 	}
 
 	void GL4Vertex2DBatch::reset()
 	{
-		m_batches.clear();
-		m_batches.emplace_back();
-
-		m_vertexArrayWritePos = 0;
-		m_indexArrayWritePos = 0;
+		m_batchBuffer.reset();
 	}
 
 	void GL4Vertex2DBatch::setBuffers()
@@ -160,76 +175,99 @@ namespace s3d
 		::glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
 	}
 
-	BatchInfo2D GL4Vertex2DBatch::updateBuffers(const size_t batchIndex)
+	BatchInfo2D GL4Vertex2DBatch::updateBuffers(const size_t batchIndex, Renderer2DStat& stat)
 	{
-		assert(batchIndex < m_batches.size());
-
-		size_t vertexArrayReadPos = 0;
-		size_t indexArrayReadPos = 0;
-
-		for (size_t i = 0; i < batchIndex; ++i)
-		{
-			vertexArrayReadPos += m_batches[i].vertexPos;
-			indexArrayReadPos += m_batches[i].indexPos;
-		}
-
 		::glBindVertexArray(m_vao);
 		::glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
 
 		BatchInfo2D batchInfo;
-		const auto& currentBatch = m_batches[batchIndex];
-
-		// VB
-		if (const uint16 vertexSize = currentBatch.vertexPos)
+		const Vertex2DBatchSize batchSize = m_batchBuffer.getBatchSize(batchIndex);
+		const Vertex2DBatchFormat& format = m_batchBuffer.getFormat();
+		const uint32 vertexStride = format.vertexStride();
+		const uint32 indexStride = format.indexStride();
+		void* pVertexDst = nullptr;
+		void* pIndexDst = nullptr;
+
+		if (m_persistentMapping)
 		{
-			const Vertex2D* pSrc = &m_vertexArray[vertexArrayReadPos];
-
-			if (VertexBufferSize < (m_vertexBufferWritePos + vertexSize))
+			// VB
+			if (const uint32 vertexSize = batchSize.vertexCount)
 			{
-				m_vertexBufferWritePos = 0;
-				::glBufferData(GL_ARRAY_BUFFER, (sizeof(Vertex2D) * VertexBufferSize), nullptr, GL_DYNAMIC_DRAW);
+				const auto allocation = m_vertexRing.allocate(vertexSize, stat);
+				pVertexDst = allocation.pData;
+				batchInfo.baseVertexLocation = allocation.firstElement;
 			}
 
-			void* const pDst = ::glMapBufferRange(GL_ARRAY_BUFFER, sizeof(Vertex2D) * m_vertexBufferWritePos, sizeof(Vertex2D) * vertexSize,
-				GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+			// IB
+			if (const uint32 indexSize = batchSize.indexCount)
 			{
-				std::memcpy(pDst, pSrc, sizeof(Vertex2D) * vertexSize);
+				const auto allocation = m_indexRing.allocate(indexSize, stat);
+				pIndexDst = allocation.pData;
+				batchInfo.indexCount = indexSize;
+				batchInfo.startIndexLocation = allocation.firstElement;
 			}
-			::glUnmapBuffer(GL_ARRAY_BUFFER);
 
-			batchInfo.baseVertexLocation = m_vertexBufferWritePos;
-			m_vertexBufferWritePos += vertexSize;
+			// マップ済みの GPU バッファに直接書き込む (GL_MAP_COHERENT_BIT のため明示的なフラッシュは不要)
+			m_batchBuffer.writeBatch(batchIndex, pVertexDst, pIndexDst);
 		}
-
-		// IB
-		if (const uint32 indexSize = currentBatch.indexPos)
+		else
 		{
-			const Vertex2D::IndexType* pSrc = &m_indexArray[indexArrayReadPos];
+			// VB
+			if (const uint32 vertexSize = batchSize.vertexCount)
+			{
+				if (m_vertexBufferSize < (m_vertexBufferWritePos + vertexSize))
+				{
+					m_vertexBufferWritePos = 0;
+					::glBufferData(GL_ARRAY_BUFFER, (vertexStride * m_vertexBufferSize), nullptr, GL_DYNAMIC_DRAW);
+					++stat.bufferOrphanCount;
+				}
+
+				pVertexDst = ::glMapBufferRange(GL_ARRAY_BUFFER, vertexStride * m_vertexBufferWritePos, vertexStride * vertexSize,
+					GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+
+				batchInfo.baseVertexLocation = m_vertexBufferWritePos;
+				m_vertexBufferWritePos += vertexSize;
+			}
+
+			// IB
+			if (const uint32 indexSize = batchSize.indexCount)
+			{
+				if (m_indexBufferSize < (m_indexBufferWritePos + indexSize))
+				{
+					m_indexBufferWritePos = 0;
+					::glBufferData(GL_ELEMENT_ARRAY_BUFFER, (indexStride * m_indexBufferSize), nullptr, GL_DYNAMIC_DRAW);
+					++stat.bufferOrphanCount;
+				}
+
+				pIndexDst = ::glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, indexStride * m_indexBufferWritePos, indexStride * indexSize,
+					GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+
+				batchInfo.indexCount = indexSize;
+				batchInfo.startIndexLocation = m_indexBufferWritePos;
+				m_indexBufferWritePos += indexSize;
+			}
+
+			m_batchBuffer.writeBatch(batchIndex, pVertexDst, pIndexDst);
 
-			if (IndexBufferSize < (m_indexBufferWritePos + indexSize))
+			if (pVertexDst)
 			{
-				m_indexBufferWritePos = 0;
-				::glBufferData(GL_ELEMENT_ARRAY_BUFFER, (sizeof(Vertex2D::IndexType) * IndexBufferSize), nullptr, GL_DYNAMIC_DRAW);
+				::glUnmapBuffer(GL_ARRAY_BUFFER);
 			}
 
-			void* const pDst = ::glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, sizeof(Vertex2D::IndexType) * m_indexBufferWritePos, sizeof(Vertex2D::IndexType) * indexSize,
-				GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+			if (pIndexDst)
 			{
-				std::memcpy(pDst, pSrc, (sizeof(Vertex2D::IndexType) * indexSize));
+				::glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
 			}
-			::glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+		}
 
-			batchInfo.indexCount = indexSize;
-			batchInfo.startIndexLocation = m_indexBufferWritePos;
-			m_indexBufferWritePos += indexSize;
+		if (batchSize.vertexCount)
+		{
+			++stat.batchCount;
 		}
 
-		return batchInfo;
-	}
+		stat.vertexUploadBytes += (static_cast<uint64>(vertexStride) * batchSize.vertexCount);
+		stat.indexUploadBytes += (static_cast<uint64>(indexStride) * batchSize.indexCount);
 
-	void GL4Vertex2DBatch::advanceArrayWritePos(const uint16 vertexSize, const uint32 indexSize) noexcept
-	{
-		m_vertexArrayWritePos	+= vertexSize;
-		m_indexArrayWritePos	+= indexSize;
+		return batchInfo;
 	}
 }
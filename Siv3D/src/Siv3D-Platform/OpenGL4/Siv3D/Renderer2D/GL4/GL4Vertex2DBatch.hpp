@@ -13,10 +13,12 @@
 # include <Siv3D/Common.hpp>
 # include <Siv3D/Common/OpenGL.hpp>
 # include <Siv3D/Vertex2D.hpp>
-# include <Siv3D/Array.hpp>
 # include <Siv3D/Renderer2D/Vertex2DBufferPointer.hpp>
+# include <Siv3D/Renderer2D/Vertex2DBatchBuffer.hpp>
+# include <Siv3D/Renderer2D/IRenderer2D.hpp>
 # include <Siv3D/Renderer2D/Renderer2DCommon.hpp>
 # include "GL4Renderer2DCommand.hpp"
+# include "GL4PersistentRingBuffer.hpp"
 
 namespace s3d
 {
@@ -24,19 +26,6 @@ namespace s3d
 	{
 	private:
 
-		struct BatchBufferPos
-		{
-			uint16 vertexPos = 0;
-
-			uint32 indexPos = 0;
-
-			void advance(uint16 vertexSize, uint32 indexSize) noexcept
-			{
-				vertexPos += vertexSize;
-				indexPos += indexSize;
-			}
-		};
-
 		GLuint m_vao = 0;
 
 		GLuint m_vertexBuffer = 0;
@@ -45,24 +34,25 @@ namespace s3d
 		GLuint m_indexBuffer = 0;
 		uint32 m_indexBufferWritePos = 0;
 
-		Array<Vertex2D> m_vertexArray;
-		uint32 m_vertexArrayWritePos = 0;
+		Vertex2DBatchBuffer m_batchBuffer;
+
+		uint32 m_vertexBufferSize = 0;
+
+		uint32 m_indexBufferSize = 0;
 
-		Array<Vertex2D::IndexType> m_indexArray;
-		uint32 m_indexArrayWritePos = 0;
+		// glBufferStorage が使える場合、永続マップしたリングバッファに直接書き込む
+		bool m_persistentMapping = false;
 
-		Array<BatchBufferPos> m_batches;
+		GL4PersistentRingBuffer m_vertexRing;
 
-		static constexpr uint32 InitialVertexArraySize	= 4096;
-		static constexpr uint32 InitialIndexArraySize	= (4096 * 8); // 32,768
+		GL4PersistentRingBuffer m_indexRing;
 
-		static constexpr uint32 MaxVertexArraySize		= (65536 * 64); // 4,194,304
-		static constexpr uint32 MaxIndexArraySize		= (65536 * 64); // 4,194,304
+		void createObjects();
 
-		static constexpr uint32 VertexBufferSize		= 65535;// 65,535;
-		static constexpr uint32 IndexBufferSize			= ((VertexBufferSize + 1) * 4); // 524,288
+		[[nodiscard]]
+		bool initPersistentRings(const Vertex2DBatchFormat& format);
 
-		void advanceArrayWritePos(uint16 vertexSize, uint32 indexSize) noexcept;
+		void release();
 
 	public:
 
@@ -71,7 +61,7 @@ namespace s3d
 		~GL4Vertex2DBatch();
 
 		[[nodiscard]]
-		bool init();
+		bool init(const Vertex2DBatchFormat& format);
 
 		[[nodiscard]]
 		Vertex2DBufferPointer requestBuffer(uint16 vertexSize, uint32 indexSize, GL4Renderer2DCommandManager& commandManager);
@@ -79,11 +69,17 @@ namespace s3d
 		[[nodiscard]]
 		size_t num_batches() const noexcept;
 
+		[[nodiscard]]
+		GLenum getIndexType() const noexcept;
+
+		[[nodiscard]]
+		uint32 getIndexStride() const noexcept;
+
 		void reset();
 
 		void setBuffers();
 
 		[[nodiscard]]
-		BatchInfo2D updateBuffers(size_t batchIndex);
+		BatchInfo2D updateBuffers(size_t batchIndex, Renderer2DStat& stat);
 	};
 }
@@ -83,7 +83,11 @@ namespace s3d
 		{
 			auto& request = m_requests[i];
 
-			if (*request.pMipmaps)
+			if (request.pCompressed)
+			{
+				request.idResult.get() = create(*request.pCompressed);
+			}
+			else if (*request.pMipmaps)
 			{
 				request.idResult.get() = create(*request.pImage, *request.pMipmaps, *request.pDesc);
 			}
@@ -151,6 +155,36 @@ namespace s3d
 		return m_textures.add(std::move(texture), info);
 	}
 
+	Texture::IDType CTexture_GL4::create(const BlockCompressedImage& image)
+	{
+		if (not image)
+		{
+			return Texture::IDType::NullAsset();
+		}
+
+		// OpenGL は異なるスレッドで Texture を作成できないので、実際の作成は updateAsyncTextureLoad() にさせる 
+		if (not isMainThread())
+		{
+			return pushRequest(image);
+		}
+
+		// GPU が対応していない場合はデコードして作成する
+		if (not GL4Texture::IsSupported(image.format))
+		{
+			return CreateDecodedTexture(*this, image);
+		}
+
+		auto texture = std::make_unique<GL4Texture>(image);
+
+		if (not texture->isInitialized())
+		{
+			return Texture::IDType::NullAsset();
+		}
+
+		const String info = U"(type: Default, size: {0}x{1}, format: {2})"_fmt(image.width(), image.height(), texture->getFormat().name());
+		return m_textures.add(std::move(texture), info);
+	}
+
 	Texture::IDType CTexture_GL4::createDynamic(const Size& size, const void* pData, uint32 stride, const TextureFormat& format, const TextureDesc desc)
 	{
 		if ((size.x <= 0) || (size.y <= 0))
@@ -413,4 +447,24 @@ namespace s3d
 
 		return result;
 	}
+
+	Texture::IDType CTexture_GL4::pushRequest(const BlockCompressedImage& image)
+	{
+		std::atomic<bool> waiting = true;
+
+		Texture::IDType result = Texture::IDType::NullAsset();
+		{
+			std::lock_guard lock{ m_requestsMutex };
+
+			m_requests.push_back(Request{ nullptr, nullptr, nullptr, std::ref(result), std::ref(waiting), &image });
+		}
+
+		// [Siv3D ToDo] conditional_variable を使う
+		while (waiting)
+		{
+			System::Sleep(3);
+		}
+
+		return result;
+	}
 }
@@ -35,6 +35,8 @@ namespace s3d
 
 		Texture::IDType create(const Image& image, const Array<Image>& mips, TextureDesc desc) override;
 
+		Texture::IDType create(const BlockCompressedImage& image) override;
+
 		Texture::IDType createDynamic(const Size& size, const void* pData, uint32 stride, const TextureFormat& format, TextureDesc desc) override;
 
 		Texture::IDType createDynamic(const Size& size, const ColorF& color, const TextureFormat& format, TextureDesc desc) override;
@@ -113,6 +115,8 @@ namespace s3d
 			std::reference_wrapper<Texture::IDType> idResult;
 
 			std::reference_wrapper<std::atomic<bool>> waiting;
+
+			const BlockCompressedImage* pCompressed = nullptr;
 		};
 
 		Array<Request> m_requests;
@@ -123,5 +127,7 @@ namespace s3d
 		bool isMainThread() const noexcept;
 
 		Texture::IDType pushRequest(const Image& image, const Array<Image>& mipmaps, TextureDesc desc);
+
+		Texture::IDType pushRequest(const BlockCompressedImage& image);
 	};
 }
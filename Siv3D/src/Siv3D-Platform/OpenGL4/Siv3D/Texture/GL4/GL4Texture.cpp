@@ -80,6 +80,36 @@ namespace s3d
 		m_initialized	= true;
 	}
 
+	GL4Texture::GL4Texture(const BlockCompressedImage& image)
+		: m_hasMipMap{ (1 < image.mipLevels()) }
+	{
+		const TextureFormat format = image.format;
+		const GLint maxLevel = static_cast<GLint>(image.mipLevels() - 1);
+
+		// [メインテクスチャ] を作成
+		{
+			::glGenTextures(1, &m_texture);
+			::glBindTexture(GL_TEXTURE_2D, m_texture);
+
+			for (GLint level = 0; level <= maxLevel; ++level)
+			{
+				const Size mipSize = image.mipSize(level);
+				const Blob& data = image.mipmaps[level];
+
+				::glCompressedTexImage2D(GL_TEXTURE_2D, level, format.GLInternalFormat(), mipSize.x, mipSize.y, 0,
+					static_cast<GLsizei>(data.size()), data.data());
+			}
+
+			::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, maxLevel);
+		}
+
+		m_size			= image.size;
+		m_format		= format;
+		m_textureDesc	= detail::MakeTextureDesc(m_hasMipMap, format.isSRGB());
+		m_type			= TextureType::Default;
+		m_initialized	= true;
+	}
+
 	GL4Texture::GL4Texture(Dynamic, const Size& size, const void* pData, const uint32, const TextureFormat& format, const TextureDesc desc)
 		: m_size{ size }
 		, m_format{ format }
@@ -87,6 +117,12 @@ namespace s3d
 		, m_type{ TextureType::Dynamic }
 		, m_hasMipMap{ detail::HasMipMap(desc) }
 	{
+		if (format.isBlockCompressed())
+		{
+			LOG_FAIL(U"TextureFormat `{}` is not supported in DynamicTexture"_fmt(format.name()));
+			return;
+		}
+
 		// [メインテクスチャ] を作成
 		{
 			::glGenTextures(1, &m_texture);
@@ -116,7 +152,7 @@ namespace s3d
 		, m_type{ TextureType::Render }
 		, m_hasMipMap{ detail::HasMipMap(desc) }
 	{
-		if (format == TextureFormat::Unknown)
+		if ((format == TextureFormat::Unknown) || format.isBlockCompressed())
 		{
 			LOG_FAIL(U"TextureFormat `{}` is not supported in RenderTexture"_fmt(format.name()));
 			return;
@@ -395,7 +431,7 @@ namespace s3d
 		, m_type{ TextureType::MSRender }
 		, m_hasMipMap{ detail::HasMipMap(desc) }
 	{
-		if (format == TextureFormat::Unknown)
+		if ((format == TextureFormat::Unknown) || format.isBlockCompressed())
 		{
 			LOG_FAIL(U"TextureFormat `{}` is not supported in MSRenderTexture"_fmt(format.name()));
 			return;
@@ -502,6 +538,27 @@ namespace s3d
 		}
 	}
 
+	bool GL4Texture::IsSupported(const TextureFormat& format) noexcept
+	{
+		switch (format.value())
+		{
+		case TexturePixelFormat::BC1_RGBA_Unorm:
+		case TexturePixelFormat::BC3_RGBA_Unorm:
+			return GLEW_EXT_texture_compression_s3tc;
+		case TexturePixelFormat::BC1_RGBA_Unorm_SRGB:
+		case TexturePixelFormat::BC3_RGBA_Unorm_SRGB:
+			return (GLEW_EXT_texture_compression_s3tc && (GLEW_EXT_texture_sRGB || GLEW_EXT_texture_compression_s3tc_srgb));
+		case TexturePixelFormat::BC4_R_Unorm:
+		case TexturePixelFormat::BC5_RG_Unorm:
+			return (GLEW_VERSION_3_0 || GLEW_ARB_texture_compression_rgtc);
+		case TexturePixelFormat::BC7_RGBA_Unorm:
+		case TexturePixelFormat::BC7_RGBA_Unorm_SRGB:
+			return (GLEW_VERSION_4_2 || GLEW_ARB_texture_compression_bptc);
+		default:
+			return false;
+		}
+	}
+
 	bool GL4Texture::isInitialized() const noexcept
 	{
 		return m_initialized;
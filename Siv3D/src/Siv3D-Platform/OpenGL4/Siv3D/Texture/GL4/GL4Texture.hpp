@@ -15,6 +15,7 @@
 # include <Siv3D/TextureFormat.hpp>
 # include <Siv3D/TextureDesc.hpp>
 # include <Siv3D/Image.hpp>
+# include <Siv3D/BlockCompressedImage.hpp>
 
 namespace s3d
 {
@@ -32,6 +33,9 @@ namespace s3d
 		SIV3D_NODISCARD_CXX20
 		GL4Texture(const Image& image, const Array<Image>& mips, TextureDesc desc);
 
+		SIV3D_NODISCARD_CXX20
+		explicit GL4Texture(const BlockCompressedImage& image);
+
 		SIV3D_NODISCARD_CXX20
 		GL4Texture(Dynamic, const Size& size, const void* pData, uint32 stride, const TextureFormat& format, TextureDesc desc);
 
@@ -49,6 +53,10 @@ namespace s3d
 
 		~GL4Texture();
 
+		// ブロック圧縮フォーマットを GPU に直接転送できるかを返す
+		[[nodiscard]]
+		static bool IsSupported(const TextureFormat& format) noexcept;
+
 		[[nodiscard]]
 		bool isInitialized() const noexcept;
 
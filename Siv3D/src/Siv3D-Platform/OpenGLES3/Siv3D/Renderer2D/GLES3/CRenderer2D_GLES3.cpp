@@ -849,6 +849,27 @@ namespace s3d
 		}
 	}
 
+	void CRenderer2D_GLES3::addTexturedParticles(const Texture& texture, const Particle2DSoAView& particles,
+		ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
+		ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedParticles(m_bufferCreator, particles, sizeOverLifeTimeFunc, colorOverLifeTimeFunc))
+		{
+			if (not m_currentCustomVS)
+			{
+				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+			}
+
+			if (not m_currentCustomPS)
+			{
+				m_commandManager.pushStandardPS(m_standardPS->textureID);
+			}
+
+			m_commandManager.pushPSTexture(0, texture);
+			m_commandManager.pushDraw(indexCount);
+		}
+	}
+
 	Float4 CRenderer2D_GLES3::getColorMul() const
 	{
 		return m_commandManager.getCurrentColorMul();
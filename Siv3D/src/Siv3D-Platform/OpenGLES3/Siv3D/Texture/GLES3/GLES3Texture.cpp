@@ -73,6 +73,12 @@ namespace s3d
 		, m_textureDesc{ desc }
 		, m_type{ TextureType::Dynamic }
 	{
+		if (format.isBlockCompressed())
+		{
+			LOG_FAIL(U"TextureFormat `{}` is not supported in DynamicTexture"_fmt(format.name()));
+			return;
+		}
+
 		// [メインテクスチャ] を作成
 		{
 			::glGenTextures(1, &m_texture);
@@ -91,7 +97,7 @@ namespace s3d
 		, m_textureDesc{ desc }
 		, m_type{ TextureType::Render }
 	{
-		if (format == TextureFormat::Unknown)
+		if ((format == TextureFormat::Unknown) || format.isBlockCompressed())
 		{
 			LOG_FAIL(U"TextureFormat `{}` is not supported in RenderTexture"_fmt(format.name()));
 			return;
@@ -315,7 +321,7 @@ namespace s3d
 		, m_textureDesc{ desc }
 		, m_type{ TextureType::MSRender }
 	{
-		if (format == TextureFormat::Unknown)
+		if ((format == TextureFormat::Unknown) || format.isBlockCompressed())
 		{
 			LOG_FAIL(U"TextureFormat `{}` is not supported in MSRenderTexture"_fmt(format.name()));
 			return;
@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # include <cstring>
+# include <atomic>
 # include <Siv3D/CPUInfo.hpp>
 # include <Siv3D/Unicode.hpp>
 
@@ -17,16 +18,21 @@ namespace s3d
 {
 	namespace detail
 	{
+		constexpr bool SSEEnabled
+	# if defined(__SSE4_2__)
+			= true;
+	# else
+			= false;
+	# endif
+
+		// Web 版の SSE は WebAssembly SIMD に変換されるため、使える命令セットはビルド時の設定で決まる
+		constexpr SIMDLevel SupportedSIMDLevel = (SSEEnabled ? SIMDLevel::SSE4_1 : SIMDLevel::None);
+
+		constinit static std::atomic<SIMDLevel> g_SIMDLevel{ SupportedSIMDLevel };
+
 		[[nodiscard]]
 		static CPUInfo InitCPUInfo() noexcept
 		{
-			constexpr bool SSEEnabled
-		# if defined(__SSE4_2__)
-				= true;
-		# else
-				= false;
-		# endif
-
 			CPUInfo result
 			{
 				.features = 
@@ -39,6 +45,8 @@ namespace s3d
 					.sse4_2 = SSEEnabled,
 				},
 
+				.simdLevel = SupportedSIMDLevel,
+
 				.family	= 0,
 				.model	= 0,
 				.stepping = 0,
@@ -57,4 +65,15 @@ namespace s3d
 	{
 		return g_CPUInfo;
 	}
+
+	SIMDLevel GetSIMDLevel() noexcept
+	{
+		return detail::g_SIMDLevel.load(std::memory_order_relaxed);
+	}
+
+	void SetMaxSIMDLevel(const SIMDLevel level) noexcept
+	{
+		const SIMDLevel supported = detail::SupportedSIMDLevel;
+		detail::g_SIMDLevel.store((((level == SIMDLevel::NEON) || (supported < level)) ? supported : level), std::memory_order_relaxed);
+	}
 }
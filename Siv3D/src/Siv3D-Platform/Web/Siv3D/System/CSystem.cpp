@@ -48,6 +48,7 @@
 # include <Siv3D/Print/IPrint.hpp>
 # include <Siv3D/PrimitiveMesh/IPrimitiveMesh.hpp>
 # include <Siv3D/Asset/IAsset.hpp>
+# include <Siv3D/AsyncTask/AsyncTaskMainThreadQueue.hpp>
 # include <Siv3D/Effect/IEffect.hpp>
 # include <Siv3D/Addon/IAddon.hpp>
 # include <Siv3D/Script/IScript.hpp>
@@ -172,6 +173,7 @@ namespace s3d
 		SIV3D_ENGINE(Window)->update();
 		SIV3D_ENGINE(Renderer)->clear();
 		SIV3D_ENGINE(Asset)->update();
+		detail::AsyncTaskRunMainThreadContinuations();
 		SIV3D_ENGINE(Cursor)->update();
 		SIV3D_ENGINE(Keyboard)->update();
 		SIV3D_ENGINE(Mouse)->update();
@@ -78,4 +78,24 @@ namespace s3d
 	{
 		return pImpl->send(data, size);
 	}
+
+	TCPReceivedSpans TCPClient::peek()
+	{
+		return pImpl->peek();
+	}
+
+	bool TCPClient::readMessage(Array<Byte>& message)
+	{
+		return pImpl->readMessage(message);
+	}
+
+	bool TCPClient::sendMessage(const void* data, const size_t size)
+	{
+		return pImpl->sendMessage(data, size);
+	}
+
+	TCPSessionStats TCPClient::getStats() const
+	{
+		return pImpl->getStats();
+	}
 }
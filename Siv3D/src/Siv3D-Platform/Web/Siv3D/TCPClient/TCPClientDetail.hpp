@@ -16,70 +16,53 @@
 # include <Siv3D/Unicode.hpp>
 # include <Siv3D/EngineLog.hpp>
 # include <Siv3D/PseudoThread/PseudoThread.hpp>
-
-# define _WINSOCK_DEPRECATED_NO_WARNINGS
-# ifndef _WIN32_WINNT
-#	define	_WIN32_WINNT _WIN32_WINNT_WIN8
-# endif
-# ifndef NTDDI_VERSION
-#	define	NTDDI_VERSION NTDDI_WIN8
-# endif
-# define  ASIO_STANDALONE
-# include <asio/asio.hpp>
+# include <Siv3D/TCPServer/TCPSession.hpp>
 
 namespace s3d
 {
 	namespace detail
 	{
-		class ClientSession : public std::enable_shared_from_this<ClientSession>
+		class ClientSession : public TCPSession
 		{
 		private:
 
-			asio::ip::tcp::socket m_socket;
-
 			TCPError m_error = TCPError::OK;
 
-			bool m_isActive = false;
-
-			asio::streambuf m_streamBuffer;
-
-			// 受信	
-			static constexpr size_t maxBufferSize = 32 * 1024 * 1024;
-
-			std::mutex m_mutexReceivedBuffer;
-
-			Array<Byte> m_receivedBuffer;
-
-
-			// 送信
-			std::mutex m_mutexSendingBuffer;
+			void onReceiveError(const asio::error_code& error) override
+			{
+				if (error != asio::error::eof)
+				{
+					LOG_FAIL(U"TCPClient: onReceive failed: {}"_fmt(Unicode::Widen(error.message())));
 
-			Array<Array<Byte>> m_sendingBuffer;
+					m_error = TCPError::Error;
+				}
+				else
+				{
+					LOG_INFO(U"TCPClient: EOF");
 
-			bool m_isSending = false;
+					m_error = TCPError::EoF;
+				}
 
+				close();
+			}
 
-			void send_internal()
+			void onSendError(const asio::error_code& error) override
 			{
-				m_isSending = true;
+				LOG_FAIL(U"TCPClient: send failed: {}"_fmt(Unicode::Widen(error.message())));
 
-				asio::async_write(m_socket, asio::buffer(m_sendingBuffer.front().data(), m_sendingBuffer.front().size()),
-					std::bind(&ClientSession::onSend, this, std::placeholders::_1, std::placeholders::_2, shared_from_this()));
+				m_error = TCPError::Error;
+
+				close();
 			}
 
 		public:
 
 			ClientSession(asio::io_service& io_service)
-				: m_socket(io_service)
+				: TCPSession{ io_service }
 			{
 
 			}
 
-			asio::ip::tcp::socket& socket()
-			{
-				return m_socket;
-			}
-
 			void init()
 			{
 				m_isActive = true;
@@ -99,245 +82,15 @@ namespace s3d
 					m_socket.shutdown(asio::socket_base::shutdown_type::shutdown_both);
 				}
 
-				m_socket.close();
+				closeIO();
 
-				if (!m_isSending)
-				{
-					std::lock_guard lock{ m_mutexSendingBuffer };
-					m_sendingBuffer.clear();
-				}
-
-				{
-					std::lock_guard lock{ m_mutexReceivedBuffer };
-					m_receivedBuffer.clear();
-					m_streamBuffer.consume(m_streamBuffer.size());
-				}
-
-				if (m_isActive)
-				{
-					LOG_TRACE(U"Session closed");
-				}
-
-				m_isSending = false;
-				m_isActive = false;
-			}
-
-			bool isActive() const
-			{
-				return m_isActive;
+				LOG_TRACE(U"Session closed");
 			}
 
 			TCPError getError() const
 			{
 				return m_error;
 			}
-
-			size_t available()
-			{
-				std::lock_guard lock{ m_mutexReceivedBuffer };
-
-				return m_receivedBuffer.size();
-			}
-
-			void startReceive()
-			{
-				asio::async_read(m_socket, m_streamBuffer, asio::transfer_at_least(1),
-					std::bind(&ClientSession::onReceive, this, std::placeholders::_1, std::placeholders::_2, shared_from_this()));
-			}
-
-			void onReceive(const asio::error_code& error, size_t, const std::shared_ptr<ClientSession>&)
-			{
-				if (error)
-				{
-					if (error != asio::error::eof)
-					{
-						LOG_FAIL(U"TCPClient: onReceive failed: {}"_fmt(Unicode::Widen(error.message())));
-
-						m_error = TCPError::Error;
-					}
-					else
-					{
-						LOG_INFO(U"TCPClient: EOF");
-
-						m_error = TCPError::EoF;
-					}
-
-					m_streamBuffer.consume(m_streamBuffer.size());
-
-					close();
-
-					return;
-				}
-
-				const Byte* data = asio::buffer_cast<const Byte*>(m_streamBuffer.data());
-				const size_t size = m_streamBuffer.size();
-
-				{
-					std::lock_guard lock{ m_mutexReceivedBuffer };
-
-					if (m_receivedBuffer.size() + size > maxBufferSize)
-					{
-						LOG_FAIL(U"TCPClient: onReceive exceeded the maximum buffer size");
-
-						m_error = TCPError::NoBufferSpaceAvailable;
-
-						m_streamBuffer.consume(m_streamBuffer.size());
-
-						close();
-
-						return;
-					}
-
-					m_receivedBuffer.insert(m_receivedBuffer.end(), data, data + size);
-				}
-
-				m_streamBuffer.consume(m_streamBuffer.size());
-
-				startReceive();
-			}
-
-			void onSend(const asio::error_code& error, size_t, const std::shared_ptr<ClientSession>&)
-			{
-				m_isSending = false;
-
-				if (!m_isActive)
-				{
-					std::lock_guard lock{ m_mutexSendingBuffer };
-					m_sendingBuffer.clear();
-					return;
-				}
-
-				if (error)
-				{
-					LOG_FAIL(U"TCPClient: send failed: {}"_fmt(Unicode::Widen(error.message())));
-
-					m_error = TCPError::Error;
-
-					close();
-
-					return;
-				}
-
-				{
-					std::lock_guard lock{ m_mutexSendingBuffer };
-
-					if (!m_sendingBuffer.empty())
-					{
-						m_sendingBuffer.erase(m_sendingBuffer.begin());
-					}
-
-					if (!m_sendingBuffer.empty())
-					{
-						send_internal();
-					}
-				}
-			}
-
-			bool skip(const size_t size)
-			{
-				if (!m_isActive)
-				{
-					return false;
-				}
-
-				if (size == 0)
-				{
-					return true;
-				}
-
-				{
-					std::lock_guard lock{ m_mutexReceivedBuffer };
-
-					if (size > m_receivedBuffer.size())
-					{
-						return false;
-					}
-
-					m_receivedBuffer.pop_front_N(size);
-				}
-
-				return true;
-			}
-
-			bool lookahead(void* dst, const size_t size)
-			{
-				if (!m_isActive)
-				{
-					return false;
-				}
-
-				if (size == 0)
-				{
-					return true;
-				}
-
-				{
-					std::lock_guard lock{ m_mutexReceivedBuffer };
-
-					if (m_receivedBuffer.size() < size)
-					{
-						return false;
-					}
-
-					std::memcpy(dst, m_receivedBuffer.data(), size);
-				}
-
-				return true;
-			}
-
-			bool read(void* dst, const size_t size)
-			{
-				if (!m_isActive)
-				{
-					return false;
-				}
-
-				if (size == 0)
-				{
-					return true;
-				}
-
-				{
-					std::lock_guard lock{ m_mutexReceivedBuffer };
-
-					if (m_receivedBuffer.size() < size)
-					{
-						return false;
-					}
-
-					std::memcpy(dst, m_receivedBuffer.data(), size);
-
-					m_receivedBuffer.pop_front_N(size);
-				}
-
-				return true;
-			}
-
-			bool send(const void* data, const size_t size)
-			{
-				if (!m_isActive)
-				{
-					return false;
-				}
-
-				if (size == 0)
-				{
-					return true;
-				}
-
-				{
-					std::lock_guard lock{ m_mutexSendingBuffer };
-
-					m_sendingBuffer.emplace_back(static_cast<const Byte*>(data), static_cast<const Byte*>(data) + size);
-
-					if (!m_isSending)
-					{
-						send_internal();
-					}
-				}
-
-				return true;
-			}
 		};
 	}
 
@@ -394,5 +147,13 @@ namespace s3d
 		bool read(void* dst, size_t size);
 
 		bool send(const void* data, size_t size);
+
+		TCPReceivedSpans peek();
+
+		bool readMessage(Array<Byte>& message);
+
+		bool sendMessage(const void* data, size_t size);
+
+		TCPSessionStats getStats() const;
 	};
 }
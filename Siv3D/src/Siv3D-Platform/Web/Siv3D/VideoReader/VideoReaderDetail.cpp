@@ -74,7 +74,7 @@ namespace s3d
 		close();
 	}
 
-	bool VideoReader::VideoReaderDetail::open(const FilePathView path)
+	bool VideoReader::VideoReaderDetail::open(const FilePathView path, const size_t lookaheadFrames)
 	{
 		LOG_SCOPED_TRACE(U"VideoReaderDetail::open()");
 
@@ -97,9 +97,10 @@ namespace s3d
 			.isOpen		= true,
 		};
 
-		m_shared.frame.resize(Shared::bufferedFramesNum);
+		m_shared.bufferedFramesNum = static_cast<uint32>(Max<size_t>(lookaheadFrames, 1));
+		m_shared.frame.resize(m_shared.bufferedFramesNum);
 
-		for (uint32 i = 0; i < Shared::bufferedFramesNum; ++i)
+		for (uint32 i = 0; i < m_shared.bufferedFramesNum; ++i)
 		{
 			m_shared.frame[i].ready = false;
 		}
@@ -154,7 +155,7 @@ namespace s3d
 
 		if (not m_shared.reachedEnd)
 		{
-			auto& frame = m_shared.frame[m_shared.readPos % Shared::bufferedFramesNum];
+			auto& frame = m_shared.frame[m_shared.readPos % m_shared.bufferedFramesNum];
 
 			if (!frame.ready)
 			{
@@ -164,6 +165,7 @@ namespace s3d
 				// frame.index = static_cast<int32>(m_shared.capture.tell() * m_info.fps);
 				frame.index = m_shared.readPos++;
 				frame.ready = true;
+				++m_shared.stat.decodedFrames;
 			}
 			
 			//LOG_TEST(U"## info ## m_shared.reachedEnd = true;");
@@ -190,7 +192,7 @@ namespace s3d
 			return false;
 		}
 
-		auto& frameToRead = m_shared.frame[m_ReadFrames % Shared::bufferedFramesNum];
+		auto& frameToRead = m_shared.frame[m_ReadFrames % m_shared.bufferedFramesNum];
 
 		{
 			// std::unique_lock ul(m_mutex);
@@ -200,11 +202,13 @@ namespace s3d
 				//LOG_TEST(U"## info ## getFrmae(): targetBufferIndex {} found in buffer"_fmt(m_info.readPos));
 				if (!frameToRead.ready || !frameToRead.unpacker.hasFinishedUnpack())
 				{
+					++m_shared.stat.stalls;
 					return false;
 				}
 
 				frameToRead.unpacker.readPixels(image);
 				frameToRead.ready = false;
+				++m_shared.stat.presentedFrames;
 
 				++m_info.readPos;
 				++m_ReadFrames;
@@ -226,10 +230,13 @@ namespace s3d
 				m_shared.capture.seek(m_info.readPos / m_info.fps);
 				m_shared.capture.play();
 
-				for (uint32 i = 0; i < Shared::bufferedFramesNum; ++i)
+				for (uint32 i = 0; i < m_shared.bufferedFramesNum; ++i)
 				{
+					m_shared.stat.droppedFrames += m_shared.frame[i].ready;
 					m_shared.frame[i].ready = false;
 				}
+
+				++m_shared.stat.seeks;
 				
 				m_shared.readPos = m_info.readPos;
 				m_shared.reachedEnd = false;
@@ -246,6 +253,14 @@ namespace s3d
 		}
 	}
 
+	bool VideoReader::VideoReaderDetail::tryReadFrame(Image& image, size_t& frameIndex)
+	{
+		// Web 版の readFrame() はデコードを待たず、読み込み位置のフレームのみを返す
+		frameIndex = static_cast<size_t>(m_info.readPos);
+
+		return readFrame(image);
+	}
+
 	const Size& VideoReader::VideoReaderDetail::getSize() const noexcept
 	{
 		return m_info.resolution;
@@ -300,4 +315,19 @@ namespace s3d
 	{
 		return m_info.fullPath;
 	}
+
+	size_t VideoReader::VideoReaderDetail::getLookaheadFrames() const noexcept
+	{
+		return m_shared.bufferedFramesNum;
+	}
+
+	VideoReaderStat VideoReader::VideoReaderDetail::getStat()
+	{
+		return m_shared.stat;
+	}
+
+	void VideoReader::VideoReaderDetail::resetStat()
+	{
+		m_shared.stat = {};
+	}
 }
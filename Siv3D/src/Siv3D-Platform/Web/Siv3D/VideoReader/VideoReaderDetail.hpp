@@ -53,7 +53,9 @@ namespace s3d
 
 			Array<MatFrame> frame;
 
-			static constexpr uint32 bufferedFramesNum = 3;
+			uint32 bufferedFramesNum = 3;
+
+			VideoReaderStat stat;
 
 		} m_shared;
 		//
@@ -87,7 +89,7 @@ namespace s3d
 
 		~VideoReaderDetail();
 
-		bool open(FilePathView path);
+		bool open(FilePathView path, size_t lookaheadFrames);
 
 		void close();
 
@@ -97,6 +99,9 @@ namespace s3d
 		[[nodiscard]]
 		bool readFrame(Image& image);
 
+		[[nodiscard]]
+		bool tryReadFrame(Image& image, size_t& frameIndex);
+
 		[[nodiscard]]
 		const Size& getSize() const noexcept;
 
@@ -128,5 +133,13 @@ namespace s3d
 
 		[[nodiscard]]
 		const FilePath& path() const noexcept;
+
+		[[nodiscard]]
+		size_t getLookaheadFrames() const noexcept;
+
+		[[nodiscard]]
+		VideoReaderStat getStat();
+
+		void resetStat();
 	};
 }
@@ -160,6 +160,12 @@ namespace s3d
 		return m_textures.add(std::move(texture), info);
 	}
 
+	Texture::IDType CTexture_WebGPU::create(const BlockCompressedImage& image)
+	{
+		// ブロック圧縮テクスチャには未対応なので、デコードして作成する
+		return CreateDecodedTexture(*this, image);
+	}
+
 	Texture::IDType CTexture_WebGPU::createDynamic(const Size& size, const void* pData, uint32 stride, const TextureFormat& format, const TextureDesc desc)
 	{
 		if ((size.x <= 0) || (size.y <= 0))
@@ -129,6 +129,12 @@ namespace s3d
 		, m_textureDesc{ desc }
 		, m_type{ TextureType::Dynamic }
 	{
+		if (format.isBlockCompressed())
+		{
+			LOG_FAIL(U"TextureFormat `{}` is not supported in DynamicTexture"_fmt(format.name()));
+			return;
+		}
+
 		// [メインテクスチャ] を作成
 		{
 			wgpu::TextureDescriptor desc 
@@ -172,7 +178,7 @@ namespace s3d
 		, m_textureDesc{ desc }
 		, m_type{ TextureType::Render }
 	{
-		if (format == TextureFormat::Unknown)
+		if ((format == TextureFormat::Unknown) || format.isBlockCompressed())
 		{
 			LOG_FAIL(U"TextureFormat `{}` is not supported in RenderTexture"_fmt(format.name()));
 			return;
@@ -432,7 +438,7 @@ namespace s3d
 		, m_textureDesc{ desc }
 		, m_type{ TextureType::MSRender }
 	{
-		if (format == TextureFormat::Unknown)
+		if ((format == TextureFormat::Unknown) || format.isBlockCompressed())
 		{
 			LOG_FAIL(U"TextureFormat `{}` is not supported in MSRenderTexture"_fmt(format.name()));
 			return;
@@ -9,31 +9,26 @@
 //
 //-----------------------------------------------
 
-# include <array>
 # include <Siv3D/Windows/Windows.hpp>
 # include <Siv3D/String.hpp>
-# include <Siv3D/FormatLiteral.hpp>
-# include <Siv3D/Utility.hpp>
-# include <Siv3D/Time.hpp>
+# include <Siv3D/Unicode.hpp>
 # include "CLogger.hpp"
 
 namespace s3d
 {
 	namespace detail
 	{
-		constexpr std::array<StringView, 7> LogTypeNames =
+		static void WriteDebugString(const std::string_view text)
 		{
-			U"[error]   "_sv,
-			U"[fail]    "_sv,
-			U"[warning] "_sv,
-			U""_sv,
-			U"[info]    "_sv,
-			U"[trace]   "_sv,
-			U"[verbose] "_sv,
-		};
+			// UTF-32 の String を経由せず、UTF-8 から UTF-16 に直接変換する（Windows の wchar_t は UTF-16）
+			const std::u16string output = Unicode::UTF8ToUTF16(text);
+
+			::OutputDebugStringW(reinterpret_cast<const wchar_t*>(output.c_str()));
+		}
 	}
 
-	CLogger::CLogger() = default;
+	CLogger::CLogger()
+		: m_backend{ detail::WriteDebugString } {}
 
 	CLogger::~CLogger() = default;
 
@@ -44,19 +39,41 @@ namespace s3d
 			return;
 		}
 
-		const int64 timeStamp = Time::GetMillisec();
-		const StringView logTypeName = detail::LogTypeNames[FromEnum(type)];
-		const String text = U"{}: {}"_fmt(timeStamp, logTypeName) + s + U'\n';
-		const std::wstring output = text.toWstr();
-
-		std::lock_guard lock{ m_mutex };
-		{
-			::OutputDebugStringW(output.c_str());
-		}
+		m_backend.write(type, s);
 	}
 
 	void CLogger::setEnabled(const bool enabled)
 	{
 		m_enabled = enabled;
 	}
+
+	void CLogger::setAsync(const LoggerAsyncConfig& config)
+	{
+		m_backend.setAsync(config);
+	}
+
+	void CLogger::setSync()
+	{
+		m_backend.setSync();
+	}
+
+	bool CLogger::isAsync() const
+	{
+		return m_backend.isAsync();
+	}
+
+	void CLogger::flush()
+	{
+		m_backend.flush();
+	}
+
+	bool CLogger::openFile(const LoggerFileConfig& config)
+	{
+		return m_backend.openFile(config);
+	}
+
+	void CLogger::closeFile()
+	{
+		m_backend.closeFile();
+	}
 }
@@ -53,7 +53,7 @@ namespace s3d
 
 			const int32 flag = (MessageBoxStyleFlags[static_cast<int32>(style)] | buttons);
 
-			const int32 result = Async([=]()
+			const int32 result = Async(AsyncLaunch::DedicatedThread, [=]()
 				{
 					const HWND hWnd = static_cast<HWND>(SIV3D_ENGINE(Window)->getHandle());
 					return ::MessageBoxW(hWnd, text.toWstr().c_str(), title.toWstr().c_str(), flag);
@@ -50,6 +50,7 @@
 # include <Siv3D/Print/IPrint.hpp>
 # include <Siv3D/PrimitiveMesh/IPrimitiveMesh.hpp>
 # include <Siv3D/Asset/IAsset.hpp>
+# include <Siv3D/AsyncTask/AsyncTaskMainThreadQueue.hpp>
 # include <Siv3D/Effect/IEffect.hpp>
 # include <Siv3D/Addon/IAddon.hpp>
 # include <Siv3D/System/SystemLog.hpp>
@@ -94,7 +95,7 @@ namespace s3d
 		if (d3d11)
 		{
 			SIV3D_ENGINE(Renderer)->init();
-			threadRenderer = Async([]()
+			threadRenderer = Async(AsyncLaunch::DedicatedThread, []()
 				{
 					try { static_cast<CRenderer_D3D11*>(SIV3D_ENGINE(Renderer))->init2(); }
 					catch (const EngineError&) { return false; }
@@ -197,6 +198,7 @@ namespace s3d
 		SIV3D_ENGINE(Window)->update();
 		SIV3D_ENGINE(Renderer)->clear();
 		SIV3D_ENGINE(Asset)->update();
+		detail::AsyncTaskRunMainThreadContinuations();
 		SIV3D_ENGINE(Cursor)->update();
 		SIV3D_ENGINE(Keyboard)->update();
 		SIV3D_ENGINE(Mouse)->update();
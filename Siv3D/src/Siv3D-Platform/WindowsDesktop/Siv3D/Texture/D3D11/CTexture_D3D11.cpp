@@ -151,6 +151,30 @@ namespace s3d
 		return m_textures.add(std::move(texture), info);
 	}
 
+	Texture::IDType CTexture_D3D11::create(const BlockCompressedImage& image)
+	{
+		if (not image)
+		{
+			return Texture::IDType::NullAsset();
+		}
+
+		// D3D11 のブロック圧縮テクスチャは、幅と高さが 4 の倍数である必要がある
+		if ((image.width() % 4) || (image.height() % 4))
+		{
+			return CreateDecodedTexture(*this, image);
+		}
+
+		auto texture = std::make_unique<D3D11Texture>(m_device, image);
+
+		if (not texture->isInitialized())
+		{
+			return Texture::IDType::NullAsset();
+		}
+
+		const String info = U"(type: Default, size: {0}x{1}, format: {2})"_fmt(image.width(), image.height(), texture->getDesc().format.name());
+		return m_textures.add(std::move(texture), info);
+	}
+
 	Texture::IDType CTexture_D3D11::createDynamic(const Size& size, const void* pData, uint32 stride, const TextureFormat& format, const TextureDesc desc)
 	{
 		if ((size.x <= 0) || (size.y <= 0))
@@ -302,6 +326,12 @@ namespace s3d
 
 	Texture::IDType CTexture_D3D11::createMSRT(const Size& size, const TextureFormat& format, const HasDepth hasDepth, const HasMipMap hasMipMap)
 	{
+		if (format.isBlockCompressed())
+		{
+			LOG_FAIL(U"TextureFormat `{}` is not supported in MSRenderTexture"_fmt(format.name()));
+			return Texture::IDType::NullAsset();
+		}
+
 		if (not m_multiSampleAvailable[FromEnum(format.value())]) // もし 4x MSAA がサポートされていなければ
 		{
 			LOG_FAIL(U"TextureFormat {} does not support 4x MSAA on this hardware");
@@ -53,6 +53,8 @@ namespace s3d
 
 		Texture::IDType create(const Image& image, const Array<Image>& mips, TextureDesc desc) override;
 
+		Texture::IDType create(const BlockCompressedImage& image) override;
+
 		Texture::IDType createDynamic(const Size& size, const void* pData, uint32 stride, const TextureFormat& format, TextureDesc desc) override;
 
 		Texture::IDType createDynamic(const Size& size, const ColorF& color, const TextureFormat& format, TextureDesc desc) override;
@@ -121,6 +121,53 @@ namespace s3d
 		m_initialized = true;
 	}
 
+	D3D11Texture::D3D11Texture(ID3D11Device* const device, const BlockCompressedImage& image)
+		: m_desc{ image.size,
+			image.format,
+			detail::MakeTextureDesc((1 < image.mipLevels()), image.format.isSRGB()),
+			static_cast<uint32>(image.mipLevels()),
+			1, 0,
+			D3D11_USAGE_IMMUTABLE,
+			D3D11_BIND_SHADER_RESOURCE,
+			0, 0 }
+		, m_type{ TextureType::Default }
+		, m_hasMipMap{ (1 < image.mipLevels()) }
+	{
+		Array<D3D11_SUBRESOURCE_DATA> initData(m_desc.mipLevels);
+		{
+			for (uint32 i = 0; i < m_desc.mipLevels; ++i)
+			{
+				// 1 行は 4x4 ピクセルのブロックの並び
+				const uint32 blocksPerRow = static_cast<uint32>((image.mipSize(i).x + 3) / 4);
+				initData[i] = { image.mipmaps[i].data(), (blocksPerRow * image.format.blockSize()), 0 };
+			}
+		}
+
+		// [メインテクスチャ] を作成
+		{
+			const D3D11_TEXTURE2D_DESC d3d11Desc = m_desc.makeTEXTURE2D_DESC();
+			if (HRESULT hr = device->CreateTexture2D(&d3d11Desc, initData.data(), &m_texture);
+				FAILED(hr))
+			{
+				LOG_FAIL(U"❌ D3D11Texture::D3D11Texture() : Failed to create Texture2D. Error code: {:#X}"_fmt(static_cast<uint32>(hr)));
+				return;
+			}
+		}
+
+		// [シェーダ・リソース・ビュー] を作成
+		{
+			const D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = m_desc.makeSHADER_RESOURCE_VIEW_DESC();
+			if (HRESULT hr = device->CreateShaderResourceView(m_texture.Get(), &srvDesc, &m_shaderResourceView);
+				FAILED(hr))
+			{
+				LOG_FAIL(U"❌ D3D11Texture::D3D11Texture() : Failed to create ShaderResourceView. Error code: {:#X}"_fmt(static_cast<uint32>(hr)));
+				return;
+			}
+		}
+
+		m_initialized = true;
+	}
+
 	D3D11Texture::D3D11Texture(Dynamic, ID3D11Device* const device, const Size& size, const void* pData, const uint32 stride, const TextureFormat& format, const TextureDesc desc)
 		: m_desc{ size,
 			format,
@@ -133,6 +180,12 @@ namespace s3d
 		, m_type{ TextureType::Dynamic }
 		, m_hasMipMap{ detail::HasMipMap(desc) }
 	{
+		if (format.isBlockCompressed())
+		{
+			LOG_FAIL(U"TextureFormat `{}` is not supported in DynamicTexture"_fmt(format.name()));
+			return;
+		}
+
 		{
 			const Array<D3D11_SUBRESOURCE_DATA> initData = detail::MakeSubresourceData(pData, size.x, (stride / size.x), m_desc.mipLevels);
 
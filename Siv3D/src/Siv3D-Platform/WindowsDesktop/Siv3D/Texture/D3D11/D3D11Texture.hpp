@@ -14,6 +14,7 @@
 # include <Siv3D/Grid.hpp>
 # include <Siv3D/ColorHSV.hpp>
 # include <Siv3D/2DShapes.hpp>
+# include <Siv3D/BlockCompressedImage.hpp>
 # include <Siv3D/Common/D3D11.hpp>
 # include "D3D11Texture2DDesc.hpp"
 
@@ -33,6 +34,9 @@ namespace s3d
 		SIV3D_NODISCARD_CXX20
 		D3D11Texture(ID3D11Device* device, const Image& image, const Array<Image>& mips, TextureDesc desc);
 
+		SIV3D_NODISCARD_CXX20
+		D3D11Texture(ID3D11Device* device, const BlockCompressedImage& image);
+
 		SIV3D_NODISCARD_CXX20
 		D3D11Texture(Dynamic, ID3D11Device* device, const Size& size, const void* pData, uint32 stride, const TextureFormat& format, TextureDesc desc);
 
@@ -688,6 +688,13 @@ namespace s3d
 
 	}
 
+	void CRenderer2D_Metal::addTexturedParticles(const Texture& texture, const Particle2DSoAView& particles,
+		ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
+		ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc)
+	{
+
+	}
+
 
 	Float4 CRenderer2D_Metal::getColorMul() const
 	{
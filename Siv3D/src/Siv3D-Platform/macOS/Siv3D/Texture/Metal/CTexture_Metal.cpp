@@ -51,6 +51,11 @@ namespace s3d
 		return(Texture::IDType::NullAsset());
 	}
 
+	Texture::IDType CTexture_Metal::create(const BlockCompressedImage&)
+	{
+		return(Texture::IDType::NullAsset());
+	}
+
 	Texture::IDType CTexture_Metal::createDynamic(const Size&, const void*, uint32, const TextureFormat&, const TextureDesc)
 	{
 		return Texture::IDType::NullAsset();
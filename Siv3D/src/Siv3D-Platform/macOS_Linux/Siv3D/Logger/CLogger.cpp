@@ -9,29 +9,28 @@
 //
 //-----------------------------------------------
 
-# include <array>
+# include <iostream>
 # include <Siv3D/String.hpp>
-# include <Siv3D/FormatLiteral.hpp>
-# include <Siv3D/Time.hpp>
 # include "CLogger.hpp"
 
 namespace s3d
 {
 	namespace detail
 	{
-		constexpr std::array<StringView, 7> LogTypeNames =
+		static void WriteConsole(const std::string_view text)
 		{
-			U"[error]   "_sv,
-			U"[fail]    "_sv,
-			U"[warning] "_sv,
-			U""_sv,
-			U"[info]    "_sv,
-			U"[trace]   "_sv,
-			U"[verbose] "_sv,
-		};
+		# if SIV3D_PLATFORM(WEB)
+			std::cout.write(text.data(), static_cast<std::streamsize>(text.size()));
+			std::cout.flush();
+		# else
+			std::clog.write(text.data(), static_cast<std::streamsize>(text.size()));
+			std::clog.flush();
+		# endif
+		}
 	}
 
 	CLogger::CLogger()
+		: m_backend{ detail::WriteConsole }
 	{
 
 	}
@@ -48,23 +47,41 @@ namespace s3d
 			return;
 		}
 
-		const int64 timeStamp = Time::GetMillisec();
-		const StringView logTypeName = detail::LogTypeNames[FromEnum(type)];
-		const String text = U"{}: {}"_fmt(timeStamp, logTypeName) + s;
-		const std::string output = text.narrow();
-
-		std::lock_guard lock{ m_mutex };
-		{
-		# if SIV3D_PLATFORM(WEB)
-			std::cout << output << std::endl;
-		# else
-			std::clog << output << std::endl;
-		# endif
-		}
+		m_backend.write(type, s);
 	}
 
 	void CLogger::setEnabled(const bool enabled)
 	{
 		m_enabled = enabled;
-	}	
+	}
+
+	void CLogger::setAsync(const LoggerAsyncConfig& config)
+	{
+		m_backend.setAsync(config);
+	}
+
+	void CLogger::setSync()
+	{
+		m_backend.setSync();
+	}
+
+	bool CLogger::isAsync() const
+	{
+		return m_backend.isAsync();
+	}
+
+	void CLogger::flush()
+	{
+		m_backend.flush();
+	}
+
+	bool CLogger::openFile(const LoggerFileConfig& config)
+	{
+		return m_backend.openFile(config);
+	}
+
+	void CLogger::closeFile()
+	{
+		m_backend.closeFile();
+	}
 }
@@ -11,8 +11,8 @@
 
 # pragma once
 # include <atomic>
-# include <mutex>
 # include <Siv3D/Logger/ILogger.hpp>
+# include <Siv3D/Logger/LoggerBackend.hpp>
 
 namespace s3d
 {
@@ -20,7 +20,7 @@ namespace s3d
 	{
 	private:
 
-		std::mutex m_mutex;
+		LoggerBackend m_backend;
 
 		std::atomic<bool> m_enabled{ true };
 
@@ -33,5 +33,17 @@ namespace s3d
 		void write(LogType type, StringView s) override;
 
 		void setEnabled(bool enabled) override;
+
+		void setAsync(const LoggerAsyncConfig& config) override;
+
+		void setSync() override;
+
+		bool isAsync() const override;
+
+		void flush() override;
+
+		bool openFile(const LoggerFileConfig& config) override;
+
+		void closeFile() override;
 	};
 }
@@ -9,6 +9,8 @@
 //
 //-----------------------------------------------
 
+# include <array>
+# include <cstring>
 # include <Siv3D/Image.hpp>
 # include "AnimatedGIFReaderDetail.hpp"
 # include <gif_load/gif_load.h>
@@ -144,6 +146,219 @@ namespace s3d
 
 namespace s3d
 {
+	namespace detail
+	{
+		[[nodiscard]]
+		static uint16 ReadUint16(const uint8* p) noexcept
+		{
+			return static_cast<uint16>(p[0] | (p[1] << 8));
+		}
+
+		/// @brief サブブロックの並びを読み飛ばします。
+		/// @return 終端ブロックの次の位置。データが途中で終わっている場合は size
+		[[nodiscard]]
+		static size_t SkipSubBlocks(const uint8* data, const size_t size, size_t pos) noexcept
+		{
+			while (pos < size)
+			{
+				const size_t blockSize = data[pos++];
+
+				if (blockSize == 0)
+				{
+					return pos;
+				}
+
+				pos += blockSize;
+			}
+
+			return size;
+		}
+
+		/// @brief LZW で圧縮されたフレームのピクセルを展開します。
+		/// @param data GIF データ
+		/// @param size GIF データのサイズ（バイト）
+		/// @param pos LZW 最小コードサイズのバイトの位置
+		/// @param out 展開したパレットインデックスの格納先
+		/// @param pixelCount 展開するピクセル数
+		/// @return 展開できたピクセル数。データが壊れている場合はそこまでの数
+		[[nodiscard]]
+		static size_t DecodeLZW(const uint8* data, const size_t size, size_t pos, uint8* out, const size_t pixelCount)
+		{
+			constexpr uint32 MaxCodes = 4096;
+
+			if (size <= pos)
+			{
+				return 0;
+			}
+
+			const uint32 minCodeSize = data[pos++];
+
+			if ((minCodeSize < 1) || (11 < minCodeSize))
+			{
+				return 0;
+			}
+
+			const uint32 clearCode = (1u << minCodeSize);
+			const uint32 endCode = (clearCode + 1);
+
+			uint16 prefixes[MaxCodes];
+			uint8 suffixes[MaxCodes];
+			uint8 stack[MaxCodes];
+
+			for (uint32 i = 0; i < clearCode; ++i)
+			{
+				suffixes[i] = static_cast<uint8>(i);
+			}
+
+			uint32 codeSize = (minCodeSize + 1);
+			uint32 nextCode = (clearCode + 2);
+			uint32 previousCode = MaxCodes;
+			uint8 firstByte = 0;
+
+			uint32 bits = 0;
+			uint32 bitCount = 0;
+			size_t blockRemaining = 0;
+			size_t written = 0;
+
+			while (written < pixelCount)
+			{
+				while (bitCount < codeSize)
+				{
+					if (blockRemaining == 0)
+					{
+						if ((size <= pos) || (data[pos] == 0))
+						{
+							return written;
+						}
+
+						blockRemaining = data[pos++];
+					}
+
+					if (size <= pos)
+					{
+						return written;
+					}
+
+					bits |= (static_cast<uint32>(data[pos++]) << bitCount);
+					bitCount += 8;
+					--blockRemaining;
+				}
+
+				const uint32 code = (bits & ((1u << codeSize) - 1));
+				bits >>= codeSize;
+				bitCount -= codeSize;
+
+				if (code == clearCode)
+				{
+					codeSize = (minCodeSize + 1);
+					nextCode = (clearCode + 2);
+					previousCode = MaxCodes;
+					continue;
+				}
+				else if (code == endCode)
+				{
+					break;
+				}
+
+				if (previousCode == MaxCodes)
+				{
+					if (clearCode <= code)
+					{
+						break;
+					}
+
+					out[written++] = firstByte = static_cast<uint8>(code);
+					previousCode = code;
+					continue;
+				}
+
+				size_t stackSize = 0;
+				uint32 current = code;
+
+				if (nextCode < code)
+				{
+					break;
+				}
+				else if (code == nextCode)
+				{
+					// 直前の列 + 直前の列の先頭
+					stack[stackSize++] = firstByte;
+					current = previousCode;
+				}
+
+				while (clearCode <= current)
+				{
+					stack[stackSize++] = suffixes[current];
+					current = prefixes[current];
+				}
+
+				stack[stackSize++] = firstByte = static_cast<uint8>(current);
+
+				const size_t count = Min(stackSize, (pixelCount - written));
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					out[written++] = stack[stackSize - 1 - i];
+				}
+
+				if (nextCode < MaxCodes)
+				{
+					prefixes[nextCode] = static_cast<uint16>(previousCode);
+					suffixes[nextCode] = firstByte;
+
+					if ((++nextCode == (1u << codeSize)) && (codeSize < 12))
+					{
+						++codeSize;
+					}
+				}
+
+				previousCode = code;
+			}
+
+			return written;
+		}
+
+		/// @brief インタレースされたフレームの、デコード順 row 番目の行が何行目にあたるかを返します。
+		[[nodiscard]]
+		static int32 InterlacedRow(int32 row, const int32 height) noexcept
+		{
+			constexpr int32 Starts[4] = { 0, 4, 2, 1 };
+			constexpr int32 Steps[4] = { 8, 8, 4, 2 };
+
+			for (int32 pass = 0; pass < 4; ++pass)
+			{
+				const int32 rows = ((height - Starts[pass] + Steps[pass] - 1) / Steps[pass]);
+
+				if (row < rows)
+				{
+					return (Starts[pass] + row * Steps[pass]);
+				}
+
+				row -= Max(rows, 0);
+			}
+
+			return height;
+		}
+
+		static void FillRegion(Image& image, const Rect& rect, const Color& color) noexcept
+		{
+			for (int32 y = rect.y; y < (rect.y + rect.h); ++y)
+			{
+				Color* pDst = (image[y] + rect.x);
+				std::fill(pDst, (pDst + rect.w), color);
+			}
+		}
+
+		static void CopyRegion(const Image& src, const Point& srcPos, Image& dst, const Point& dstPos, const Size& size) noexcept
+		{
+			for (int32 y = 0; y < size.y; ++y)
+			{
+				const Color* pSrc = (src[srcPos.y + y] + srcPos.x);
+				std::copy(pSrc, (pSrc + size.x), (dst[dstPos.y + y] + dstPos.x));
+			}
+		}
+	}
+
 	AnimatedGIFReader::AnimatedGIFReaderDetail::AnimatedGIFReaderDetail() {}
 
 	AnimatedGIFReader::AnimatedGIFReaderDetail::~AnimatedGIFReaderDetail()
@@ -153,24 +368,41 @@ namespace s3d
 
 	bool AnimatedGIFReader::AnimatedGIFReaderDetail::open(const FilePathView path)
 	{
+		close();
+
 		m_blob.createFromFile(path);
 
+		buildIndex();
+
 		return isOpen();
 	}
 
 	bool AnimatedGIFReader::AnimatedGIFReaderDetail::open(IReader&& reader)
 	{
+		close();
+
 		const size_t size_bytes = reader.size();
 
 		m_blob.resize(size_bytes);
 		reader.read(m_blob.data(), m_blob.size());
 
+		buildIndex();
+
 		return isOpen();
 	}
 
 	void AnimatedGIFReader::AnimatedGIFReaderDetail::close()
 	{
 		m_blob.release();
+		m_size = Size{ 0, 0 };
+		m_frames.clear();
+		m_delaysMillisec.clear();
+		m_durationMillisec = 0;
+		m_nextFrameIndex = 0;
+		m_canvas.release();
+		m_restoreRegion.release();
+		m_keyframes.clear();
+		m_indices.clear();
 	}
 
 	bool AnimatedGIFReader::AnimatedGIFReaderDetail::isOpen() const noexcept
@@ -202,4 +434,338 @@ namespace s3d
 
 		return true;
 	}
+
+	Size AnimatedGIFReader::AnimatedGIFReaderDetail::getSize() const noexcept
+	{
+		return m_size;
+	}
+
+	size_t AnimatedGIFReader::AnimatedGIFReaderDetail::getFrameCount() const noexcept
+	{
+		return m_frames.size();
+	}
+
+	const Array<int32>& AnimatedGIFReader::AnimatedGIFReaderDetail::getDelaysMillisec() const noexcept
+	{
+		return m_delaysMillisec;
+	}
+
+	int32 AnimatedGIFReader::AnimatedGIFReaderDetail::getDurationMillisec() const noexcept
+	{
+		return m_durationMillisec;
+	}
+
+	size_t AnimatedGIFReader::AnimatedGIFReaderDetail::getCurrentFrameIndex() const noexcept
+	{
+		return m_nextFrameIndex;
+	}
+
+	bool AnimatedGIFReader::AnimatedGIFReaderDetail::setCurrentFrameIndex(const size_t index)
+	{
+		if (m_frames.size() <= index)
+		{
+			return false;
+		}
+
+		if (index == m_nextFrameIndex)
+		{
+			return true;
+		}
+
+		// index 以前で最も近い、キャッシュ済みのキーフレーム
+		size_t keyframeIndex = 0;
+
+		if (m_keyframeInterval)
+		{
+			for (size_t i = (index / m_keyframeInterval); 0 < i; --i)
+			{
+				if (m_keyframes[i - 1])
+				{
+					keyframeIndex = (i * m_keyframeInterval);
+					break;
+				}
+			}
+		}
+
+		// 今の位置から進めたほうが近い場合は、キャンバスをそのまま使う
+		if ((index < m_nextFrameIndex) || (m_nextFrameIndex < keyframeIndex))
+		{
+			if (keyframeIndex == 0)
+			{
+				resetCanvas();
+			}
+			else
+			{
+				m_canvas = m_keyframes[(keyframeIndex / m_keyframeInterval) - 1];
+				m_nextFrameIndex = keyframeIndex;
+			}
+		}
+
+		while (m_nextFrameIndex < index)
+		{
+			decodeFrame(nullptr);
+		}
+
+		return true;
+	}
+
+	bool AnimatedGIFReader::AnimatedGIFReaderDetail::readFrame(Image& image, int32& delayMillisec)
+	{
+		if (m_frames.size() <= m_nextFrameIndex)
+		{
+			return false;
+		}
+
+		delayMillisec = m_delaysMillisec[m_nextFrameIndex];
+
+		decodeFrame(&image);
+
+		return true;
+	}
+
+	void AnimatedGIFReader::AnimatedGIFReaderDetail::setKeyframeInterval(const size_t interval)
+	{
+		m_keyframeInterval = interval;
+		m_keyframes.clear();
+
+		if (m_keyframeInterval && m_frames)
+		{
+			m_keyframes.resize((m_frames.size() - 1) / m_keyframeInterval);
+		}
+	}
+
+	size_t AnimatedGIFReader::AnimatedGIFReaderDetail::getKeyframeInterval() const noexcept
+	{
+		return m_keyframeInterval;
+	}
+
+	bool AnimatedGIFReader::AnimatedGIFReaderDetail::buildIndex()
+	{
+		const uint8* data = static_cast<const uint8*>(static_cast<const void*>(m_blob.data()));
+		const size_t size = m_blob.size();
+
+		if ((size < 13)
+			|| (std::memcmp(data, "GIF8", 4) != 0)
+			|| ((data[4] != '7') && (data[4] != '9'))
+			|| (data[5] != 'a'))
+		{
+			return false;
+		}
+
+		const Size canvasSize{ detail::ReadUint16(data + 6), detail::ReadUint16(data + 8) };
+
+		if ((canvasSize.x == 0) || (canvasSize.y == 0))
+		{
+			return false;
+		}
+
+		const uint8 screenFlags = data[10];
+		size_t pos = 13;
+
+		const size_t globalPaletteOffset = pos;
+		const uint16 globalPaletteSize = ((screenFlags & 0x80) ? static_cast<uint16>(2 << (screenFlags & 0x07)) : 0);
+		pos += (globalPaletteSize * 3);
+
+		// 直前の Graphic Control Extension の内容
+		FrameInfo control;
+		int32 delayMillisec = 0;
+
+		while (pos < size)
+		{
+			const uint8 blockType = data[pos++];
+
+			if (blockType == 0x21) // Extension
+			{
+				if (size <= pos)
+				{
+					break;
+				}
+
+				const uint8 label = data[pos++];
+
+				// Graphic Control Extension
+				if ((label == 0xF9) && ((pos + 5) <= size) && (data[pos] == 4))
+				{
+					const uint8 flags = data[pos + 1];
+					control.disposal = static_cast<uint8>((flags >> 2) & 0x07);
+					control.transparentIndex = ((flags & 0x01) ? data[pos + 4] : -1);
+					delayMillisec = (detail::ReadUint16(data + pos + 2) * 10);
+				}
+
+				pos = detail::SkipSubBlocks(data, size, pos);
+			}
+			else if (blockType == 0x2C) // Image Descriptor
+			{
+				if (size < (pos + 9))
+				{
+					break;
+				}
+
+				FrameInfo frame;
+				frame.rect = Rect{ detail::ReadUint16(data + pos), detail::ReadUint16(data + pos + 2),
+					detail::ReadUint16(data + pos + 4), detail::ReadUint16(data + pos + 6) };
+				frame.transparentIndex = control.transparentIndex;
+				frame.disposal = control.disposal;
+
+				const uint8 imageFlags = data[pos + 8];
+				frame.interlaced = ((imageFlags & 0x40) != 0);
+				pos += 9;
+
+				if (imageFlags & 0x80)
+				{
+					frame.paletteOffset = pos;
+					frame.paletteSize = static_cast<uint16>(2 << (imageFlags & 0x07));
+					pos += (frame.paletteSize * 3);
+				}
+				else
+				{
+					frame.paletteOffset = globalPaletteOffset;
+					frame.paletteSize = globalPaletteSize;
+				}
+
+				if (size <= pos)
+				{
+					break;
+				}
+
+				frame.dataOffset = pos;
+				pos = detail::SkipSubBlocks(data, size, (pos + 1));
+
+				m_frames << frame;
+				m_delaysMillisec << delayMillisec;
+				control = FrameInfo{};
+				delayMillisec = 0;
+			}
+			else // Trailer またはデータの破損
+			{
+				break;
+			}
+		}
+
+		if (not m_frames)
+		{
+			return false;
+		}
+
+		m_size = canvasSize;
+		m_durationMillisec = m_delaysMillisec.sum();
+		setKeyframeInterval(m_keyframeInterval);
+		resetCanvas();
+
+		return true;
+	}
+
+	void AnimatedGIFReader::AnimatedGIFReaderDetail::resetCanvas()
+	{
+		if (m_canvas.size() == m_size)
+		{
+			m_canvas.fill(Color{ 0, 0 });
+		}
+		else
+		{
+			m_canvas = Image{ m_size, Color{ 0, 0 } };
+		}
+
+		m_nextFrameIndex = 0;
+	}
+
+	void AnimatedGIFReader::AnimatedGIFReaderDetail::decodeFrame(Image* image)
+	{
+		const size_t frameIndex = m_nextFrameIndex++;
+		const FrameInfo& frame = m_frames[frameIndex];
+
+		// 描く直前の状態をキーフレームとして残す
+		if (m_keyframeInterval
+			&& (0 < frameIndex)
+			&& ((frameIndex % m_keyframeInterval) == 0))
+		{
+			if (Image& keyframe = m_keyframes[(frameIndex / m_keyframeInterval) - 1];
+				not keyframe)
+			{
+				keyframe = m_canvas;
+			}
+		}
+
+		const Rect clipped = frame.rect.getOverlap(Rect{ m_size });
+		const bool hasRegion = ((0 < clipped.w) && (0 < clipped.h));
+
+		if (hasRegion && (frame.disposal == 3))
+		{
+			m_restoreRegion.resize(clipped.size);
+			detail::CopyRegion(m_canvas, clipped.pos, m_restoreRegion, Point{ 0, 0 }, clipped.size);
+		}
+
+		if (hasRegion && frame.paletteSize)
+		{
+			const uint8* data = static_cast<const uint8*>(static_cast<const void*>(m_blob.data()));
+			const size_t pixelCount = (static_cast<size_t>(frame.rect.w) * frame.rect.h);
+
+			m_indices.resize(pixelCount);
+			const size_t decoded = detail::DecodeLZW(data, m_blob.size(), frame.dataOffset, m_indices.data(), pixelCount);
+
+			// パレット外のインデックスと透過色は描かない
+			std::array<Color, 256> palette;
+			palette.fill(Color{ 0, 0 });
+
+			for (size_t i = 0; i < frame.paletteSize; ++i)
+			{
+				const uint8* rgb = (data + frame.paletteOffset + i * 3);
+				palette[i] = Color{ rgb[0], rgb[1], rgb[2] };
+			}
+
+			if (0 <= frame.transparentIndex)
+			{
+				palette[frame.transparentIndex] = Color{ 0, 0 };
+			}
+
+			const int32 decodedRows = static_cast<int32>((decoded + frame.rect.w - 1) / frame.rect.w);
+
+			for (int32 row = 0; row < decodedRows; ++row)
+			{
+				const int32 y = (frame.rect.y + (frame.interlaced ? detail::InterlacedRow(row, frame.rect.h) : row));
+
+				if ((y < clipped.y) || ((clipped.y + clipped.h) <= y))
+				{
+					continue;
+				}
+
+				const size_t srcBegin = (static_cast<size_t>(row) * frame.rect.w + (clipped.x - frame.rect.x));
+
+				if (decoded <= srcBegin)
+				{
+					continue;
+				}
+
+				const uint8* pSrc = (m_indices.data() + srcBegin);
+				const int32 width = static_cast<int32>(Min<size_t>(clipped.w, (decoded - srcBegin)));
+				Color* pDst = (m_canvas[y] + clipped.x);
+
+				for (int32 x = 0; x < width; ++x)
+				{
+					if (const Color color = palette[pSrc[x]];
+						color.a)
+					{
+						pDst[x] = color;
+					}
+				}
+			}
+		}
+
+		if (image)
+		{
+			*image = m_canvas;
+		}
+
+		if (hasRegion)
+		{
+			if (frame.disposal == 2)
+			{
+				detail::FillRegion(m_canvas, clipped, Color{ 0, 0 });
+			}
+			else if (frame.disposal == 3)
+			{
+				detail::CopyRegion(m_restoreRegion, Point{ 0, 0 }, m_canvas, clipped.pos, clipped.size);
+			}
+		}
+	}
 }
@@ -12,6 +12,7 @@
 # pragma once
 # include <Siv3D/AnimatedGIFReader.hpp>
 # include <Siv3D/Blob.hpp>
+# include <Siv3D/2DShapes.hpp>
 
 namespace s3d
 {
@@ -33,8 +34,86 @@ namespace s3d
 
 		bool read(Array<Image>& images, Array<int32>& delaysMillisec) const;
 
+		[[nodiscard]]
+		Size getSize() const noexcept;
+
+		[[nodiscard]]
+		size_t getFrameCount() const noexcept;
+
+		[[nodiscard]]
+		const Array<int32>& getDelaysMillisec() const noexcept;
+
+		[[nodiscard]]
+		int32 getDurationMillisec() const noexcept;
+
+		[[nodiscard]]
+		size_t getCurrentFrameIndex() const noexcept;
+
+		bool setCurrentFrameIndex(size_t index);
+
+		bool readFrame(Image& image, int32& delayMillisec);
+
+		void setKeyframeInterval(size_t interval);
+
+		[[nodiscard]]
+		size_t getKeyframeInterval() const noexcept;
+
 	private:
 
+		/// @brief フレームを 1 枚デコードするのに必要な情報
+		struct FrameInfo
+		{
+			/// @brief フレームの領域（キャンバスからはみ出すことがある）
+			Rect rect{ 0, 0, 0, 0 };
+
+			/// @brief LZW 最小コードサイズのバイトの位置
+			size_t dataOffset = 0;
+
+			/// @brief パレットの位置
+			size_t paletteOffset = 0;
+
+			/// @brief パレットの色数（0 の場合はパレット無し）
+			uint16 paletteSize = 0;
+
+			/// @brief 透過色のインデックス（-1 の場合は透過色無し）
+			int16 transparentIndex = -1;
+
+			/// @brief 表示後の処理 (2: 背景で消去, 3: 直前の状態に戻す, それ以外: そのまま)
+			uint8 disposal = 0;
+
+			bool interlaced = false;
+		};
+
 		Blob m_blob;
+
+		Size m_size{ 0, 0 };
+
+		Array<FrameInfo> m_frames;
+
+		Array<int32> m_delaysMillisec;
+
+		int32 m_durationMillisec = 0;
+
+		/// @brief 次にデコードするフレーム
+		size_t m_nextFrameIndex = 0;
+
+		/// @brief m_nextFrameIndex のフレームを描く直前の状態
+		Image m_canvas;
+
+		/// @brief disposal 3 のフレームで上書きされる前の領域
+		Image m_restoreRegion;
+
+		/// @brief インデックス i が (i + 1) * m_keyframeInterval 番目のフレームを描く直前の m_canvas
+		Array<Image> m_keyframes;
+
+		size_t m_keyframeInterval = DefaultKeyframeInterval;
+
+		Array<uint8> m_indices;
+
+		bool buildIndex();
+
+		void resetCanvas();
+
+		void decodeFrame(Image* image);
 	};
 }
@@ -78,6 +78,58 @@ namespace s3d
 		}
 	}
 
+	Size AnimatedGIFReader::getSize() const noexcept
+	{
+		return pImpl->getSize();
+	}
+
+	size_t AnimatedGIFReader::getFrameCount() const noexcept
+	{
+		return pImpl->getFrameCount();
+	}
+
+	const Array<int32>& AnimatedGIFReader::getDelaysMillisec() const noexcept
+	{
+		return pImpl->getDelaysMillisec();
+	}
+
+	int32 AnimatedGIFReader::getDurationMillisec() const noexcept
+	{
+		return pImpl->getDurationMillisec();
+	}
+
+	size_t AnimatedGIFReader::getCurrentFrameIndex() const noexcept
+	{
+		return pImpl->getCurrentFrameIndex();
+	}
+
+	bool AnimatedGIFReader::setCurrentFrameIndex(const size_t index)
+	{
+		return pImpl->setCurrentFrameIndex(index);
+	}
+
+	bool AnimatedGIFReader::readFrame(Image& image)
+	{
+		int32 delayMillisec;
+
+		return pImpl->readFrame(image, delayMillisec);
+	}
+
+	bool AnimatedGIFReader::readFrame(Image& image, int32& delayMillisec)
+	{
+		return pImpl->readFrame(image, delayMillisec);
+	}
+
+	void AnimatedGIFReader::setKeyframeInterval(const size_t interval)
+	{
+		pImpl->setKeyframeInterval(interval);
+	}
+
+	size_t AnimatedGIFReader::getKeyframeInterval() const noexcept
+	{
+		return pImpl->getKeyframeInterval();
+	}
+
 	size_t AnimatedGIFReader::MillisecToIndex(const int64 timeMillisec, const Array<int32>& delaysMillisec) noexcept
 	{
 		return MillisecToIndex(timeMillisec, delaysMillisec, delaysMillisec.sum());
@@ -0,0 +1,156 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "AnimatedGIFTextureDetail.hpp"
+
+namespace s3d
+{
+	AnimatedGIFTexture::AnimatedGIFTextureDetail::AnimatedGIFTextureDetail() {}
+
+	AnimatedGIFTexture::AnimatedGIFTextureDetail::~AnimatedGIFTextureDetail() {}
+
+	bool AnimatedGIFTexture::AnimatedGIFTextureDetail::load(const FilePathView path, const Loop loop, const TextureDesc desc)
+	{
+		if (not m_reader.open(path))
+		{
+			return false;
+		}
+
+		return init(loop, desc);
+	}
+
+	bool AnimatedGIFTexture::AnimatedGIFTextureDetail::load(IReader&& reader, const Loop loop, const TextureDesc desc)
+	{
+		if (not m_reader.open(std::move(reader)))
+		{
+			return false;
+		}
+
+		return init(loop, desc);
+	}
+
+	void AnimatedGIFTexture::AnimatedGIFTextureDetail::advance(const double deltaTimeSec)
+	{
+		if (not m_texture)
+		{
+			return;
+		}
+
+		m_playTimeSec += deltaTimeSec;
+
+		if (const double lengthSec = (m_reader.getDurationMillisec() / 1000.0);
+			lengthSec <= m_playTimeSec)
+		{
+			if (m_loop && (0.0 < lengthSec))
+			{
+				m_playTimeSec = std::fmod(m_playTimeSec, lengthSec);
+			}
+			else
+			{
+				m_playTimeSec = lengthSec;
+			}
+		}
+
+		update();
+	}
+
+	void AnimatedGIFTexture::AnimatedGIFTextureDetail::reset()
+	{
+		if (not m_texture)
+		{
+			return;
+		}
+
+		m_playTimeSec = 0.0;
+
+		update();
+	}
+
+	bool AnimatedGIFTexture::AnimatedGIFTextureDetail::isLoop() const noexcept
+	{
+		return m_loop;
+	}
+
+	double AnimatedGIFTexture::AnimatedGIFTextureDetail::posSec() const noexcept
+	{
+		return m_playTimeSec;
+	}
+
+	void AnimatedGIFTexture::AnimatedGIFTextureDetail::setPosSec(const double posSec)
+	{
+		if (not m_texture)
+		{
+			return;
+		}
+
+		m_playTimeSec = Clamp(posSec, 0.0, (m_reader.getDurationMillisec() / 1000.0));
+
+		update();
+	}
+
+	size_t AnimatedGIFTexture::AnimatedGIFTextureDetail::frameIndex() const noexcept
+	{
+		return m_frameIndex;
+	}
+
+	const Texture& AnimatedGIFTexture::AnimatedGIFTextureDetail::getTexture() const noexcept
+	{
+		return m_texture;
+	}
+
+	const AnimatedGIFReader& AnimatedGIFTexture::AnimatedGIFTextureDetail::getAnimatedGIFReader() const noexcept
+	{
+		return m_reader;
+	}
+
+	bool AnimatedGIFTexture::AnimatedGIFTextureDetail::init(const Loop loop, const TextureDesc desc)
+	{
+		if (not m_reader.readFrame(m_frameImage))
+		{
+			m_reader.close();
+			return false;
+		}
+
+		m_loop = loop.getBool();
+		m_frameIndex = 0;
+		m_texture = DynamicTexture{ m_frameImage, (detail::IsSRGB(desc) ? TextureFormat::R8G8B8A8_Unorm_SRGB : TextureFormat::R8G8B8A8_Unorm) };
+
+		return true;
+	}
+
+	void AnimatedGIFTexture::AnimatedGIFTextureDetail::update()
+	{
+		const int32 durationMillisec = m_reader.getDurationMillisec();
+		const int64 timeMillisec = static_cast<int64>(m_playTimeSec * 1000.0);
+
+		// ループしない場合、最後まで再生したら最後のフレームを表示し続ける
+		const size_t targetFrameIndex = (((not m_loop) && (durationMillisec <= timeMillisec))
+			? (m_reader.getFrameCount() - 1)
+			: AnimatedGIFReader::MillisecToIndex(timeMillisec, m_reader.getDelaysMillisec(), durationMillisec));
+
+		if (targetFrameIndex == m_frameIndex)
+		{
+			return;
+		}
+
+		// 次のフレームであればシークは不要。飛んだ場合は直前のキーフレームからデコードし直す
+		if (targetFrameIndex != m_reader.getCurrentFrameIndex())
+		{
+			m_reader.setCurrentFrameIndex(targetFrameIndex);
+		}
+
+		if (m_reader.readFrame(m_frameImage))
+		{
+			m_texture.fill(m_frameImage);
+			m_frameIndex = targetFrameIndex;
+		}
+	}
+}
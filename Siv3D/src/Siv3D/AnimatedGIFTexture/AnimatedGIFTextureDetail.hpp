@@ -0,0 +1,71 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/AnimatedGIFTexture.hpp>
+# include <Siv3D/AnimatedGIFReader.hpp>
+# include <Siv3D/DynamicTexture.hpp>
+
+namespace s3d
+{
+	class AnimatedGIFTexture::AnimatedGIFTextureDetail
+	{
+	public:
+
+		AnimatedGIFTextureDetail();
+
+		~AnimatedGIFTextureDetail();
+
+		bool load(FilePathView path, Loop loop, TextureDesc desc);
+
+		bool load(IReader&& reader, Loop loop, TextureDesc desc);
+
+		void advance(double deltaTimeSec = Scene::DeltaTime());
+
+		void reset();
+
+		[[nodiscard]]
+		bool isLoop() const noexcept;
+
+		[[nodiscard]]
+		double posSec() const noexcept;
+
+		void setPosSec(double posSec);
+
+		[[nodiscard]]
+		size_t frameIndex() const noexcept;
+
+		[[nodiscard]]
+		const Texture& getTexture() const noexcept;
+
+		[[nodiscard]]
+		const AnimatedGIFReader& getAnimatedGIFReader() const noexcept;
+
+	private:
+
+		AnimatedGIFReader m_reader;
+
+		bool m_loop = false;
+
+		double m_playTimeSec = 0.0;
+
+		/// @brief m_texture に書き込まれているフレーム
+		size_t m_frameIndex = 0;
+
+		Image m_frameImage;
+
+		DynamicTexture m_texture;
+
+		bool init(Loop loop, TextureDesc desc);
+
+		void update();
+	};
+}
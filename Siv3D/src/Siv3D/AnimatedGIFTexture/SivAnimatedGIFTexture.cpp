@@ -0,0 +1,456 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/AnimatedGIFTexture.hpp>
+# include <Siv3D/AnimatedGIFTexture/AnimatedGIFTextureDetail.hpp>
+
+namespace s3d
+{
+	AnimatedGIFTexture::AnimatedGIFTexture()
+		: pImpl{ std::make_shared<AnimatedGIFTextureDetail>() } {}
+
+	AnimatedGIFTexture::AnimatedGIFTexture(const FilePathView path, const Loop loop, const TextureDesc desc)
+		: AnimatedGIFTexture{}
+	{
+		pImpl->load(path, loop, desc);
+	}
+
+	AnimatedGIFTexture::AnimatedGIFTexture(IReader&& reader, const Loop loop, const TextureDesc desc)
+		: AnimatedGIFTexture{}
+	{
+		pImpl->load(std::move(reader), loop, desc);
+	}
+
+	bool AnimatedGIFTexture::isEmpty() const noexcept
+	{
+		return pImpl->getTexture().isEmpty();
+	}
+
+	AnimatedGIFTexture::operator bool() const noexcept
+	{
+		return (not isEmpty());
+	}
+
+	void AnimatedGIFTexture::release()
+	{
+		*this = AnimatedGIFTexture{};
+	}
+
+	void AnimatedGIFTexture::advance(const double deltaTimeSec) const
+	{
+		pImpl->advance(deltaTimeSec);
+	}
+
+	void AnimatedGIFTexture::reset() const
+	{
+		pImpl->reset();
+	}
+
+	bool AnimatedGIFTexture::isLoop() const noexcept
+	{
+		return pImpl->isLoop();
+	}
+
+	double AnimatedGIFTexture::posSec() const noexcept
+	{
+		return pImpl->posSec();
+	}
+
+	double AnimatedGIFTexture::lengthSec() const
+	{
+		return (getAnimatedGIFReader().getDurationMillisec() / 1000.0);
+	}
+
+	void AnimatedGIFTexture::setPosSec(const double posSec) const
+	{
+		pImpl->setPosSec(posSec);
+	}
+
+	const Texture& AnimatedGIFTexture::getTexture() const noexcept
+	{
+		return pImpl->getTexture();
+	}
+
+	AnimatedGIFTexture::operator const Texture& () const noexcept
+	{
+		return pImpl->getTexture();
+	}
+
+	size_t AnimatedGIFTexture::frameIndex() const noexcept
+	{
+		return pImpl->frameIndex();
+	}
+
+	const AnimatedGIFReader& AnimatedGIFTexture::getAnimatedGIFReader() const noexcept
+	{
+		return pImpl->getAnimatedGIFReader();
+	}
+
+	int32 AnimatedGIFTexture::width() const
+	{
+		return getTexture().width();
+	}
+
+	int32 AnimatedGIFTexture::height() const
+	{
+		return getTexture().height();
+	}
+
+	Size AnimatedGIFTexture::size() const
+	{
+		return getTexture().size();
+	}
+
+	TextureDesc AnimatedGIFTexture::getDesc() const
+	{
+		return getTexture().getDesc();
+	}
+
+	TextureFormat AnimatedGIFTexture::getFormat() const
+	{
+		return getTexture().getFormat();
+	}
+
+	bool AnimatedGIFTexture::hasMipMap() const
+	{
+		return getTexture().hasMipMap();
+	}
+
+	bool AnimatedGIFTexture::isSDF() const
+	{
+		return getTexture().isSDF();
+	}
+
+	Rect AnimatedGIFTexture::region(const int32 x, const int32 y) const
+	{
+		return getTexture().region(x, y);
+	}
+
+	Rect AnimatedGIFTexture::region(const Point pos) const
+	{
+		return getTexture().region(pos);
+	}
+
+	RectF AnimatedGIFTexture::region(const double x, const double y) const
+	{
+		return getTexture().region(x, y);
+	}
+
+	RectF AnimatedGIFTexture::region(const Vec2 pos) const
+	{
+		return getTexture().region(pos);
+	}
+
+	RectF AnimatedGIFTexture::regionAt(const double x, const double y) const
+	{
+		return getTexture().regionAt(x, y);
+	}
+
+	RectF AnimatedGIFTexture::regionAt(const Vec2 pos) const
+	{
+		return getTexture().regionAt(pos);
+	}
+
+	RectF AnimatedGIFTexture::draw(const ColorF& diffuse) const
+	{
+		return getTexture().draw(diffuse);
+	}
+
+	RectF AnimatedGIFTexture::draw(const ColorF& color0, const ColorF& color1, const ColorF& color2, const ColorF& color3) const
+	{
+		return getTexture().draw(color0, color1, color2, color3);
+	}
+
+	RectF AnimatedGIFTexture::draw(const Arg::top_<ColorF> topColor, const Arg::bottom_<ColorF> bottomColor) const
+	{
+		return getTexture().draw(topColor, bottomColor);
+	}
+
+	RectF AnimatedGIFTexture::draw(const Arg::left_<ColorF> leftColor, const Arg::right_<ColorF> rightColor) const
+	{
+		return getTexture().draw(leftColor, rightColor);
+	}
+
+	RectF AnimatedGIFTexture::draw(const double x, const double y, const ColorF& diffuse) const
+	{
+		return getTexture().draw(x, y, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::draw(const double x, const double y, const ColorF& color0, const ColorF& color1, const ColorF& color2, const ColorF& color3) const
+	{
+		return getTexture().draw(x, y, color0, color1, color2, color3);
+	}
+
+	RectF AnimatedGIFTexture::draw(const double x, const double y, const Arg::top_<ColorF> topColor, const Arg::bottom_<ColorF> bottomColor) const
+	{
+		return getTexture().draw(x, y, topColor, bottomColor);
+	}
+
+	RectF AnimatedGIFTexture::draw(const double x, const double y, const Arg::left_<ColorF> leftColor, const Arg::right_<ColorF> rightColor) const
+	{
+		return getTexture().draw(x, y, leftColor, rightColor);
+	}
+
+	RectF AnimatedGIFTexture::draw(const Vec2& pos, const ColorF& diffuse) const
+	{
+		return getTexture().draw(pos, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::draw(const Vec2& pos, const ColorF& color0, const ColorF& color1, const ColorF& color2, const ColorF& color3) const
+	{
+		return getTexture().draw(pos, color0, color1, color2, color3);
+	}
+
+	RectF AnimatedGIFTexture::draw(const Vec2& pos, const Arg::top_<ColorF> topColor, const Arg::bottom_<ColorF> bottomColor) const
+	{
+		return getTexture().draw(pos, topColor, bottomColor);
+	}
+
+	RectF AnimatedGIFTexture::draw(const Vec2& pos, const Arg::left_<ColorF> leftColor, const Arg::right_<ColorF> rightColor) const
+	{
+		return getTexture().draw(pos, leftColor, rightColor);
+	}
+
+	RectF AnimatedGIFTexture::draw(const Arg::topLeft_<Vec2> topLeft, const ColorF& diffuse) const
+	{
+		return getTexture().draw(topLeft, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::draw(const Arg::topRight_<Vec2> topRight, const ColorF& diffuse) const
+	{
+		return getTexture().draw(topRight, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::draw(const Arg::bottomLeft_<Vec2> bottomLeft, const ColorF& diffuse) const
+	{
+		return getTexture().draw(bottomLeft, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::draw(const Arg::bottomRight_<Vec2> bottomRight, const ColorF& diffuse) const
+	{
+		return getTexture().draw(bottomRight, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::draw(const Arg::topCenter_<Vec2> topCenter, const ColorF& diffuse) const
+	{
+		return getTexture().draw(topCenter, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::draw(const Arg::bottomCenter_<Vec2> bottomCenter, const ColorF& diffuse) const
+	{
+		return getTexture().draw(bottomCenter, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::draw(const Arg::leftCenter_<Vec2> leftCenter, const ColorF& diffuse) const
+	{
+		return getTexture().draw(leftCenter, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::draw(const Arg::rightCenter_<Vec2>rightCenter, const ColorF& diffuse) const
+	{
+		return getTexture().draw(rightCenter, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::draw(const Arg::center_<Vec2> center, const ColorF& diffuse) const
+	{
+		return getTexture().draw(center, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::drawAt(const double x, const double y, const ColorF& diffuse) const
+	{
+		return getTexture().drawAt(x, y, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::drawAt(const double x, const double y, const ColorF& color0, const ColorF& color1, const ColorF& color2, const ColorF& color3) const
+	{
+		return getTexture().drawAt(x, y, color0, color1, color2, color3);
+	}
+
+	RectF AnimatedGIFTexture::drawAt(const Vec2& pos, const ColorF& diffuse) const
+	{
+		return getTexture().drawAt(pos, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::drawAt(const Vec2& pos, const ColorF& color0, const ColorF& color1, const ColorF& color2, const ColorF& color3) const
+	{
+		return getTexture().drawAt(pos, color0, color1, color2, color3);
+	}
+
+	RectF AnimatedGIFTexture::drawClipped(const double x, const double y, const RectF& clipRect, const ColorF& diffuse) const
+	{
+		return getTexture().drawClipped(x, y, clipRect, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::drawClipped(const Vec2& pos, const RectF& clipRect, const ColorF& diffuse) const
+	{
+		return getTexture().drawClipped(pos, clipRect, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::drawAtClipped(const double x, const double y, const RectF& clipRect, const ColorF& diffuse) const
+	{
+		return getTexture().drawAtClipped(x, y, clipRect, diffuse);
+	}
+
+	RectF AnimatedGIFTexture::drawAtClipped(const Vec2& pos, const RectF& clipRect, const ColorF& diffuse) const
+	{
+		return getTexture().drawAtClipped(pos, clipRect, diffuse);
+	}
+
+	TextureRegion AnimatedGIFTexture::operator ()(const double x, const double y, const double w, const double h) const
+	{
+		return getTexture()(x, y, w, h);
+	}
+
+	TextureRegion AnimatedGIFTexture::operator ()(const Vec2& xy, const double w, const double h) const
+	{
+		return getTexture()(xy, w, h);
+	}
+
+	TextureRegion AnimatedGIFTexture::operator ()(const double x, const double y, const double size) const
+	{
+		return getTexture()(x, y, size);
+	}
+
+	TextureRegion AnimatedGIFTexture::operator ()(const double x, const double y, const Vec2& size) const
+	{
+		return getTexture()(x, y, size);
+	}
+
+	TextureRegion AnimatedGIFTexture::operator ()(const Vec2& xy, const Vec2& size) const
+	{
+		return getTexture()(xy, size);
+	}
+
+	TextureRegion AnimatedGIFTexture::operator ()(const RectF& rect) const
+	{
+		return getTexture()(rect);
+	}
+
+	TextureRegion AnimatedGIFTexture::uv(const double u, const double v, const double w, const double h) const
+	{
+		return getTexture().uv(u, v, w, h);
+	}
+
+	TextureRegion AnimatedGIFTexture::uv(const RectF& rect) const
+	{
+		return getTexture().uv(rect);
+	}
+
+	TextureRegion AnimatedGIFTexture::mirrored() const
+	{
+		return getTexture().mirrored();
+	}
+
+	TextureRegion AnimatedGIFTexture::mirrored(const bool doMirror) const
+	{
+		return getTexture().mirrored(doMirror);
+	}
+
+	TextureRegion AnimatedGIFTexture::flipped() const
+	{
+		return getTexture().flipped();
+	}
+
+	TextureRegion AnimatedGIFTexture::flipped(const bool doFlip) const
+	{
+		return getTexture().flipped(doFlip);
+	}
+
+	TextureRegion AnimatedGIFTexture::scaled(const double s) const
+	{
+		return getTexture().scaled(s);
+	}
+
+	TextureRegion AnimatedGIFTexture::scaled(const double sx, const double sy) const
+	{
+		return getTexture().scaled(sx, sy);
+	}
+
+	TextureRegion AnimatedGIFTexture::scaled(const Vec2 s) const
+	{
+		return getTexture().scaled(s);
+	}
+
+	TextureRegion AnimatedGIFTexture::resized(const double size) const
+	{
+		return getTexture().resized(size);
+	}
+
+	TextureRegion AnimatedGIFTexture::resized(const double width, const double height) const
+	{
+		return getTexture().resized(width, height);
+	}
+
+	TextureRegion AnimatedGIFTexture::resized(const Vec2 size) const
+	{
+		return getTexture().resized(size);
+	}
+
+	TextureRegion AnimatedGIFTexture::repeated(const double xRepeat, const double yRepeat) const
+	{
+		return getTexture().repeated(xRepeat, yRepeat);
+	}
+
+	TextureRegion AnimatedGIFTexture::repeated(const Vec2 _repeat) const
+	{
+		return getTexture().repeated(_repeat);
+	}
+
+	TextureRegion AnimatedGIFTexture::mapped(const double width, const double height) const
+	{
+		return getTexture().mapped(width, height);
+	}
+
+	TextureRegion AnimatedGIFTexture::mapped(const Vec2 size) const
+	{
+		return getTexture().mapped(size);
+	}
+
+	TextureRegion AnimatedGIFTexture::fitted(const double width, const double height, const AllowScaleUp allowScaleUp) const
+	{
+		return getTexture().fitted(width, height, allowScaleUp);
+	}
+
+	TextureRegion AnimatedGIFTexture::fitted(const Vec2& size, const AllowScaleUp allowScaleUp) const
+	{
+		return getTexture().fitted(size, allowScaleUp);
+	}
+
+	TexturedQuad AnimatedGIFTexture::rotated(const double angle) const
+	{
+		return getTexture().rotated(angle);
+	}
+
+	TexturedQuad AnimatedGIFTexture::rotatedAt(const double x, const double y, const double angle) const
+	{
+		return getTexture().rotatedAt(x, y, angle);
+	}
+
+	TexturedQuad AnimatedGIFTexture::rotatedAt(const Vec2& pos, const double angle) const
+	{
+		return getTexture().rotatedAt(pos, angle);
+	}
+
+	TexturedRoundRect AnimatedGIFTexture::rounded(const double r) const
+	{
+		return getTexture().rounded(r);
+	}
+
+	TexturedRoundRect AnimatedGIFTexture::rounded(const double x, const double y, const double w, const double h, const double r) const
+	{
+		return getTexture().rounded(x, y, w, h, r);
+	}
+
+	void AnimatedGIFTexture::swap(AnimatedGIFTexture& other) noexcept
+	{
+		pImpl.swap(other.pImpl);
+	}
+}
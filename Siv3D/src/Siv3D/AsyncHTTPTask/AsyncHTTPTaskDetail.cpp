@@ -65,7 +65,8 @@ namespace s3d
 	{
 		m_writer.path = m_writer.file.path();
 
-		m_task = Async(&AsyncHTTPTaskDetail::runGet, this);
+		// 通信の完了までスレッドを占有するため、専用のスレッドで実行する
+		m_task = Async(AsyncLaunch::DedicatedThread, &AsyncHTTPTaskDetail::runGet, this);
 	}
 
 	AsyncHTTPTaskDetail::AsyncHTTPTaskDetail(const URLView url, const HashTable<String, String>& headers)
@@ -73,7 +74,7 @@ namespace s3d
 		, m_writer{ {}, {}, {}, false }
 		, m_headers{ headers }
 	{
-		m_task = Async(&AsyncHTTPTaskDetail::runGet, this);
+		m_task = Async(AsyncLaunch::DedicatedThread, &AsyncHTTPTaskDetail::runGet, this);
 	}
 
 	AsyncHTTPTaskDetail::AsyncHTTPTaskDetail(const URLView url, const HashTable<String, String>& headers, const void* src, const size_t size, const FilePathView path)
@@ -84,7 +85,7 @@ namespace s3d
 	{
 		m_writer.path = m_writer.file.path();
 
-		m_task = Async(&AsyncHTTPTaskDetail::runPost, this);
+		m_task = Async(AsyncLaunch::DedicatedThread, &AsyncHTTPTaskDetail::runPost, this);
 	}
 
 	AsyncHTTPTaskDetail::AsyncHTTPTaskDetail(const URLView url, const HashTable<String, String>& headers, const void* src, const size_t size)
@@ -93,7 +94,7 @@ namespace s3d
 		, m_headers{ headers }
 		, m_blob{ src, size }
 	{
-		m_task = Async(&AsyncHTTPTaskDetail::runPost, this);
+		m_task = Async(AsyncLaunch::DedicatedThread, &AsyncHTTPTaskDetail::runPost, this);
 	}
 
 	AsyncHTTPTaskDetail::~AsyncHTTPTaskDetail()
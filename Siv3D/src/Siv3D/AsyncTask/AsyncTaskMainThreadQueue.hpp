@@ -0,0 +1,22 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	namespace detail
+	{
+		/// @brief `ContinuationContext::MainThread` で登録された継続処理を実行します。
+		/// @remark `System::Update()` からメインスレッドで呼ばれます。
+		void AsyncTaskRunMainThreadContinuations();
+	}
+}
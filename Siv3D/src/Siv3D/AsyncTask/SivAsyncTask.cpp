@@ -0,0 +1,114 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <thread>
+# include <Siv3D/AsyncTask.hpp>
+# include "AsyncTaskMainThreadQueue.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		namespace
+		{
+			struct MainThreadQueue
+			{
+				std::mutex mutex;
+
+				Array<std::function<void()>> functions;
+			};
+
+			[[nodiscard]]
+			MainThreadQueue& GetMainThreadQueue()
+			{
+				static MainThreadQueue queue;
+				return queue;
+			}
+		}
+
+		void AsyncTaskContinuations::complete()
+		{
+			std::vector<std::function<void()>> functions;
+
+			{
+				std::lock_guard lock{ m_mutex };
+
+				m_completed = true;
+
+				functions.swap(m_functions);
+			}
+
+			// 登録された処理はロックの外で実行する
+			for (auto& function : functions)
+			{
+				function();
+			}
+		}
+
+		void AsyncTaskContinuations::add(std::function<void()> f)
+		{
+			{
+				std::lock_guard lock{ m_mutex };
+
+				if (not m_completed)
+				{
+					m_functions.push_back(std::move(f));
+					return;
+				}
+			}
+
+			f();
+		}
+
+		void AsyncTaskPostToMainThread(std::function<void()> f)
+		{
+			MainThreadQueue& queue = GetMainThreadQueue();
+
+			std::lock_guard lock{ queue.mutex };
+
+			queue.functions.push_back(std::move(f));
+		}
+
+		void AsyncTaskLaunchDedicatedThread(std::function<void()> f)
+		{
+		# if !SIV3D_PLATFORM(WEB) || defined(__EMSCRIPTEN_PTHREADS__)
+
+			// 完了は AsyncTask が持つ std::future で待機するため、スレッドは切り離す
+			std::thread{ std::move(f) }.detach();
+
+		# else
+
+			// スレッドを作成できないため、その場で実行する（スレッドプールも同様にその場で実行する）
+			f();
+
+		# endif
+		}
+
+		void AsyncTaskRunMainThreadContinuations()
+		{
+			MainThreadQueue& queue = GetMainThreadQueue();
+
+			Array<std::function<void()>> functions;
+
+			{
+				std::lock_guard lock{ queue.mutex };
+
+				functions.swap(queue.functions);
+			}
+
+			// 継続処理の中で新たに登録された継続処理は、次のフレームで実行する
+			for (auto& function : functions)
+			{
+				function();
+			}
+		}
+	}
+}
@@ -0,0 +1,1298 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <array>
+# include <cmath>
+# include <cstring>
+# include <Siv3D/Image.hpp>
+# include <Siv3D/Threading.hpp>
+# include "BlockCompression.hpp"
+
+namespace s3d
+{
+	namespace BlockCompression
+	{
+		namespace
+		{
+			////////////////////////////////////////////////
+			//
+			//	共通
+			//
+			////////////////////////////////////////////////
+
+			/// @brief 128-bit 以下のブロックを LSB から順に書き込む
+			class BitWriter
+			{
+			public:
+
+				BitWriter(uint8* dst, const size_t sizeBytes) noexcept
+					: m_dst{ dst }
+				{
+					std::memset(dst, 0, sizeBytes);
+				}
+
+				void write(const uint32 value, const uint32 bits) noexcept
+				{
+					for (uint32 i = 0; i < bits; ++i, ++m_pos)
+					{
+						if ((value >> i) & 1u)
+						{
+							m_dst[m_pos >> 3] |= static_cast<uint8>(1u << (m_pos & 7));
+						}
+					}
+				}
+
+			private:
+
+				uint8* m_dst = nullptr;
+
+				uint32 m_pos = 0;
+			};
+
+			/// @brief 128-bit 以下のブロックを LSB から順に読み込む
+			class BitReader
+			{
+			public:
+
+				explicit BitReader(const uint8* src) noexcept
+					: m_src{ src } {}
+
+				[[nodiscard]]
+				uint32 read(const uint32 bits) noexcept
+				{
+					uint32 value = 0;
+
+					for (uint32 i = 0; i < bits; ++i, ++m_pos)
+					{
+						value |= (((m_src[m_pos >> 3] >> (m_pos & 7)) & 1u) << i);
+					}
+
+					return value;
+				}
+
+			private:
+
+				const uint8* m_src = nullptr;
+
+				uint32 m_pos = 0;
+			};
+
+			template <size_t N>
+			using Point = std::array<float, N>;
+
+			template <size_t N>
+			[[nodiscard]]
+			static float Dot(const Point<N>& a, const Point<N>& b) noexcept
+			{
+				float result = 0.0f;
+
+				for (size_t i = 0; i < N; ++i)
+				{
+					result += (a[i] * b[i]);
+				}
+
+				return result;
+			}
+
+			/// @brief 点群の平均と、主成分の方向（累乗法）を求めます。
+			template <size_t N>
+			static void ComputePrincipalAxis(const Point<N>* points, const size_t count, Point<N>& mean, Point<N>& axis) noexcept
+			{
+				mean = {};
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					for (size_t k = 0; k < N; ++k)
+					{
+						mean[k] += points[i][k];
+					}
+				}
+
+				for (auto& m : mean)
+				{
+					m /= static_cast<float>(count);
+				}
+
+				float covariance[N][N] = {};
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					for (size_t a = 0; a < N; ++a)
+					{
+						const float da = (points[i][a] - mean[a]);
+
+						for (size_t b = 0; b < N; ++b)
+						{
+							covariance[a][b] += (da * (points[i][b] - mean[b]));
+						}
+					}
+				}
+
+				// 分散が最も大きい軸の列から始める
+				size_t largest = 0;
+
+				for (size_t k = 1; k < N; ++k)
+				{
+					if (covariance[largest][largest] < covariance[k][k])
+					{
+						largest = k;
+					}
+				}
+
+				for (size_t k = 0; k < N; ++k)
+				{
+					axis[k] = covariance[largest][k];
+				}
+
+				for (int32 iteration = 0; iteration < 8; ++iteration)
+				{
+					const float length = std::sqrt(Dot(axis, axis));
+
+					if (length < 1e-6f)
+					{
+						axis = {};
+						return;
+					}
+
+					Point<N> next{};
+
+					for (size_t a = 0; a < N; ++a)
+					{
+						for (size_t b = 0; b < N; ++b)
+						{
+							next[a] += (covariance[a][b] * axis[b]);
+						}
+					}
+
+					for (size_t k = 0; k < N; ++k)
+					{
+						axis[k] = (next[k] / length);
+					}
+				}
+
+				const float length = std::sqrt(Dot(axis, axis));
+
+				if (length < 1e-6f)
+				{
+					axis = {};
+					return;
+				}
+
+				for (auto& a : axis)
+				{
+					a /= length;
+				}
+			}
+
+			/// @brief 点群を主成分の方向に射影し、両端を端点の初期値にします。
+			template <size_t N>
+			static void ComputeInitialEndpoints(const Point<N>* points, const size_t count, Point<N>& e0, Point<N>& e1) noexcept
+			{
+				Point<N> mean, axis;
+				ComputePrincipalAxis(points, count, mean, axis);
+
+				float tMin = 0.0f, tMax = 0.0f;
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					Point<N> d;
+
+					for (size_t k = 0; k < N; ++k)
+					{
+						d[k] = (points[i][k] - mean[k]);
+					}
+
+					const float t = Dot(d, axis);
+					tMin = Min(tMin, t);
+					tMax = Max(tMax, t);
+				}
+
+				for (size_t k = 0; k < N; ++k)
+				{
+					e0[k] = Clamp((mean[k] + axis[k] * tMin), 0.0f, 255.0f);
+					e1[k] = Clamp((mean[k] + axis[k] * tMax), 0.0f, 255.0f);
+				}
+			}
+
+			/// @brief 各点の補間の重み（0 が e0, 1 が e1）から、二乗誤差が最小になる端点を求めます。
+			/// @return 端点を求められた場合 true, 重みがすべて同じで求められない場合は false
+			template <size_t N>
+			[[nodiscard]]
+			static bool RefineEndpoints(const Point<N>* points, const float* weights, const size_t count, Point<N>& e0, Point<N>& e1) noexcept
+			{
+				float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+				Point<N> ax{}, bx{};
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					const float b = weights[i];
+					const float a = (1.0f - b);
+					aa += (a * a);
+					ab += (a * b);
+					bb += (b * b);
+
+					for (size_t k = 0; k < N; ++k)
+					{
+						ax[k] += (a * points[i][k]);
+						bx[k] += (b * points[i][k]);
+					}
+				}
+
+				const float det = ((aa * bb) - (ab * ab));
+
+				if (std::abs(det) < 1e-6f)
+				{
+					return false;
+				}
+
+				for (size_t k = 0; k < N; ++k)
+				{
+					e0[k] = Clamp(((ax[k] * bb - bx[k] * ab) / det), 0.0f, 255.0f);
+					e1[k] = Clamp(((bx[k] * aa - ax[k] * ab) / det), 0.0f, 255.0f);
+				}
+
+				return true;
+			}
+
+			[[nodiscard]]
+			static int32 Square(const int32 x) noexcept
+			{
+				return (x * x);
+			}
+
+			////////////////////////////////////////////////
+			//
+			//	BC1 / BC3 のカラーブロック
+			//
+			////////////////////////////////////////////////
+
+			[[nodiscard]]
+			static uint16 Pack565(const Point<3>& color) noexcept
+			{
+				const uint32 r = static_cast<uint32>(std::lround(color[0] * (31.0f / 255.0f)));
+				const uint32 g = static_cast<uint32>(std::lround(color[1] * (63.0f / 255.0f)));
+				const uint32 b = static_cast<uint32>(std::lround(color[2] * (31.0f / 255.0f)));
+				return static_cast<uint16>((r << 11) | (g << 5) | b);
+			}
+
+			static void Unpack565(const uint32 color, int32 (&rgb)[3]) noexcept
+			{
+				const uint32 r = ((color >> 11) & 0x1F);
+				const uint32 g = ((color >> 5) & 0x3F);
+				const uint32 b = (color & 0x1F);
+				rgb[0] = static_cast<int32>((r << 3) | (r >> 2));
+				rgb[1] = static_cast<int32>((g << 2) | (g >> 4));
+				rgb[2] = static_cast<int32>((b << 3) | (b >> 2));
+			}
+
+			/// @brief カラーブロックの 4 色を作ります。
+			/// @param fourColors 4 色モードの場合 true, 3 色 + 透明モードの場合 false（4 色目は黒）
+			static void MakeColorPalette(const uint32 c0, const uint32 c1, const bool fourColors, int32 (&palette)[4][3]) noexcept
+			{
+				Unpack565(c0, palette[0]);
+				Unpack565(c1, palette[1]);
+
+				for (size_t k = 0; k < 3; ++k)
+				{
+					const int32 a = palette[0][k];
+					const int32 b = palette[1][k];
+
+					if (fourColors)
+					{
+						palette[2][k] = ((2 * a + b + 1) / 3);
+						palette[3][k] = ((a + 2 * b + 1) / 3);
+					}
+					else
+					{
+						palette[2][k] = ((a + b + 1) / 2);
+						palette[3][k] = 0;
+					}
+				}
+			}
+
+			static void WriteColorBlock(uint8* dst, const uint16 c0, const uint16 c1, const uint32 indices) noexcept
+			{
+				dst[0] = static_cast<uint8>(c0 & 0xFF);
+				dst[1] = static_cast<uint8>(c0 >> 8);
+				dst[2] = static_cast<uint8>(c1 & 0xFF);
+				dst[3] = static_cast<uint8>(c1 >> 8);
+
+				for (size_t i = 0; i < 4; ++i)
+				{
+					dst[4 + i] = static_cast<uint8>(indices >> (i * 8));
+				}
+			}
+
+			/// @brief カラーブロックをエンコードします。
+			/// @param punchThroughAlpha アルファ値が 128 未満のピクセルを透明にする場合 true (BC1)
+			/// @param alwaysFourColors 端点の大小にかかわらず 4 色モードとしてデコードされる場合 true (BC3)
+			static void EncodeColorBlock(const Color* pixels, uint8* dst, const bool punchThroughAlpha, const bool alwaysFourColors) noexcept
+			{
+				Point<3> points[16];
+				bool transparent[16] = {};
+				size_t count = 0;
+
+				for (size_t i = 0; i < 16; ++i)
+				{
+					if (punchThroughAlpha && (pixels[i].a < 128))
+					{
+						transparent[i] = true;
+					}
+					else
+					{
+						points[count++] = { static_cast<float>(pixels[i].r), static_cast<float>(pixels[i].g), static_cast<float>(pixels[i].b) };
+					}
+				}
+
+				if (count == 0)
+				{
+					// すべて透明
+					WriteColorBlock(dst, 0, 0, 0xFFFFFFFFu);
+					return;
+				}
+
+				const bool hasTransparent = (count < 16);
+
+				Point<3> e0, e1;
+				ComputeInitialEndpoints(points, count, e0, e1);
+
+				int32 bestError = INT32_MAX;
+				uint16 bestC0 = 0, bestC1 = 0;
+				uint32 bestIndices = 0;
+
+				for (int32 iteration = 0; iteration < 3; ++iteration)
+				{
+					uint16 c0 = Pack565(e0);
+					uint16 c1 = Pack565(e1);
+
+					// 4 色モードは c0 > c1, 3 色 + 透明モードは c0 <= c1
+					if (hasTransparent ? (c1 < c0) : (c0 < c1))
+					{
+						std::swap(c0, c1);
+						std::swap(e0, e1);
+					}
+
+					const bool fourColors = (alwaysFourColors || (c1 < c0));
+					int32 palette[4][3];
+					MakeColorPalette(c0, c1, fourColors, palette);
+
+					// 3 色モードでは 4 番目（黒または透明）を不透明なピクセルに使わない
+					const uint32 numCandidates = (fourColors ? 4 : 3);
+					constexpr float FourColorWeights[4] = { 0.0f, 1.0f, (1.0f / 3.0f), (2.0f / 3.0f) };
+					constexpr float ThreeColorWeights[4] = { 0.0f, 1.0f, 0.5f, 0.0f };
+
+					uint32 indices = 0;
+					int32 error = 0;
+					float weights[16];
+					size_t k = 0;
+
+					for (size_t i = 0; i < 16; ++i)
+					{
+						if (transparent[i])
+						{
+							indices |= (3u << (i * 2));
+							continue;
+						}
+
+						const Color& pixel = pixels[i];
+						uint32 bestIndex = 0;
+						int32 bestPixelError = INT32_MAX;
+
+						for (uint32 n = 0; n < numCandidates; ++n)
+						{
+							const int32 e = (Square(pixel.r - palette[n][0]) + Square(pixel.g - palette[n][1]) + Square(pixel.b - palette[n][2]));
+
+							if (e < bestPixelError)
+							{
+								bestPixelError = e;
+								bestIndex = n;
+							}
+						}
+
+						indices |= (bestIndex << (i * 2));
+						error += bestPixelError;
+						weights[k++] = (fourColors ? FourColorWeights[bestIndex] : ThreeColorWeights[bestIndex]);
+					}
+
+					if (error < bestError)
+					{
+						bestError = error;
+						bestC0 = c0;
+						bestC1 = c1;
+						bestIndices = indices;
+					}
+
+					if ((error == 0)
+						|| (not RefineEndpoints(points, weights, count, e0, e1)))
+					{
+						break;
+					}
+				}
+
+				WriteColorBlock(dst, bestC0, bestC1, bestIndices);
+			}
+
+			/// @brief カラーブロックをデコードします。アルファ値は 255 または 0 (BC1 の透明) になります。
+			static void DecodeColorBlock(const uint8* src, Color* pixels, const bool alwaysFourColors) noexcept
+			{
+				const uint32 c0 = (src[0] | (src[1] << 8));
+				const uint32 c1 = (src[2] | (src[3] << 8));
+				const uint32 indices = (src[4] | (src[5] << 8) | (src[6] << 16) | (static_cast<uint32>(src[7]) << 24));
+				const bool fourColors = (alwaysFourColors || (c1 < c0));
+
+				int32 palette[4][3];
+				MakeColorPalette(c0, c1, fourColors, palette);
+
+				for (size_t i = 0; i < 16; ++i)
+				{
+					const uint32 index = ((indices >> (i * 2)) & 0x3);
+					const int32 (&rgb)[3] = palette[index];
+					const uint8 a = (((not fourColors) && (index == 3)) ? 0 : 255);
+					pixels[i] = Color{ static_cast<uint8>(rgb[0]), static_cast<uint8>(rgb[1]), static_cast<uint8>(rgb[2]), a };
+				}
+			}
+
+			////////////////////////////////////////////////
+			//
+			//	BC4 (BC3 のアルファ, BC5 の各チャンネル)
+			//
+			////////////////////////////////////////////////
+
+			/// @brief 8 段階の値を作ります。r0 > r1 の場合は 8 値の補間、それ以外の場合は 6 値の補間と 0, 255
+			static void MakeSingleChannelPalette(const uint32 r0, const uint32 r1, uint32 (&palette)[8]) noexcept
+			{
+				palette[0] = r0;
+				palette[1] = r1;
+
+				if (r1 < r0)
+				{
+					for (uint32 i = 1; i <= 6; ++i)
+					{
+						palette[i + 1] = (((7 - i) * r0 + i * r1 + 3) / 7);
+					}
+				}
+				else
+				{
+					for (uint32 i = 1; i <= 4; ++i)
+					{
+						palette[i + 1] = (((5 - i) * r0 + i * r1 + 2) / 5);
+					}
+
+					palette[6] = 0;
+					palette[7] = 255;
+				}
+			}
+
+			[[nodiscard]]
+			static int32 FitSingleChannelBlock(const uint8* values, const uint32 r0, const uint32 r1, uint64& indices) noexcept
+			{
+				uint32 palette[8];
+				MakeSingleChannelPalette(r0, r1, palette);
+
+				indices = 0;
+				int32 error = 0;
+
+				for (size_t i = 0; i < 16; ++i)
+				{
+					uint32 bestIndex = 0;
+					int32 bestPixelError = INT32_MAX;
+
+					for (uint32 n = 0; n < 8; ++n)
+					{
+						const int32 e = Square(static_cast<int32>(values[i]) - static_cast<int32>(palette[n]));
+
+						if (e < bestPixelError)
+						{
+							bestPixelError = e;
+							bestIndex = n;
+						}
+					}
+
+					indices |= (static_cast<uint64>(bestIndex) << (i * 3));
+					error += bestPixelError;
+				}
+
+				return error;
+			}
+
+			static void WriteSingleChannelBlock(uint8* dst, const uint32 r0, const uint32 r1, const uint64 indices) noexcept
+			{
+				dst[0] = static_cast<uint8>(r0);
+				dst[1] = static_cast<uint8>(r1);
+
+				for (size_t i = 0; i < 6; ++i)
+				{
+					dst[2 + i] = static_cast<uint8>(indices >> (i * 8));
+				}
+			}
+
+			static void EncodeSingleChannelBlock(const uint8* values, uint8* dst) noexcept
+			{
+				uint32 minValue = 255, maxValue = 0;
+				uint32 minInner = 255, maxInner = 0;
+
+				for (size_t i = 0; i < 16; ++i)
+				{
+					const uint32 value = values[i];
+					minValue = Min(minValue, value);
+					maxValue = Max(maxValue, value);
+
+					if ((value != 0) && (value != 255))
+					{
+						minInner = Min(minInner, value);
+						maxInner = Max(maxInner, value);
+					}
+				}
+
+				if (minValue == maxValue)
+				{
+					WriteSingleChannelBlock(dst, minValue, minValue, 0);
+					return;
+				}
+
+				// 8 値モード
+				uint64 indices8 = 0;
+				const int32 error8 = FitSingleChannelBlock(values, maxValue, minValue, indices8);
+
+				// 6 値モード（0 と 255 を別に持つ）
+				if (maxInner < minInner)
+				{
+					minInner = maxInner = 0;
+				}
+
+				uint64 indices6 = 0;
+				const int32 error6 = FitSingleChannelBlock(values, minInner, maxInner, indices6);
+
+				if (error8 <= error6)
+				{
+					WriteSingleChannelBlock(dst, maxValue, minValue, indices8);
+				}
+				else
+				{
+					WriteSingleChannelBlock(dst, minInner, maxInner, indices6);
+				}
+			}
+
+			static void DecodeSingleChannelBlock(const uint8* src, uint8* values) noexcept
+			{
+				uint32 palette[8];
+				MakeSingleChannelPalette(src[0], src[1], palette);
+
+				uint64 indices = 0;
+
+				for (size_t i = 0; i < 6; ++i)
+				{
+					indices |= (static_cast<uint64>(src[2 + i]) << (i * 8));
+				}
+
+				for (size_t i = 0; i < 16; ++i)
+				{
+					values[i] = static_cast<uint8>(palette[(indices >> (i * 3)) & 0x7]);
+				}
+			}
+
+			////////////////////////////////////////////////
+			//
+			//	BC7
+			//
+			////////////////////////////////////////////////
+
+			constexpr uint8 Weights2[4] = { 0, 21, 43, 64 };
+
+			constexpr uint8 Weights3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+
+			constexpr uint8 Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+			[[nodiscard]]
+			constexpr const uint8* GetWeights(const uint32 indexBits) noexcept
+			{
+				return ((indexBits == 2) ? Weights2 : (indexBits == 3) ? Weights3 : Weights4);
+			}
+
+			[[nodiscard]]
+			constexpr uint32 Interpolate(const uint32 e0, const uint32 e1, const uint32 weight) noexcept
+			{
+				return ((((64 - weight) * e0) + (weight * e1) + 32) >> 6);
+			}
+
+			struct BC7ModeInfo
+			{
+				uint8 numSubsets;
+
+				uint8 partitionBits;
+
+				uint8 rotationBits;
+
+				uint8 indexSelectionBits;
+
+				uint8 colorBits;
+
+				uint8 alphaBits;
+
+				// 端点ごとの P-bit
+				uint8 endpointPBits;
+
+				// サブセットごとの（2 つの端点で共有する）P-bit
+				uint8 sharedPBits;
+
+				uint8 indexBits;
+
+				uint8 secondaryIndexBits;
+			};
+
+			constexpr BC7ModeInfo BC7Modes[8] =
+			{
+				{ 3, 4, 0, 0, 4, 0, 1, 0, 3, 0 },
+				{ 2, 6, 0, 0, 6, 0, 0, 1, 3, 0 },
+				{ 3, 6, 0, 0, 5, 0, 0, 0, 2, 0 },
+				{ 2, 6, 0, 0, 7, 0, 1, 0, 2, 0 },
+				{ 1, 0, 2, 1, 5, 6, 0, 0, 2, 3 },
+				{ 1, 0, 2, 0, 7, 8, 0, 0, 2, 2 },
+				{ 1, 0, 0, 0, 7, 7, 1, 0, 4, 0 },
+				{ 2, 6, 0, 0, 5, 5, 1, 0, 2, 0 },
+			};
+
+			// 2 サブセットの分割（ビットが 1 のピクセルがサブセット 1）
+			constexpr uint16 BC7Partitions2[64] =
+			{
+				0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+				0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+				0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+				0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+				0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+				0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+				0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+				0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22,
+			};
+
+			// 3 サブセットの分割（2 ビットずつ、ピクセル 0 が下位）
+			constexpr uint32 BC7Partitions3[64] =
+			{
+				0xAA685050, 0x6A5A5040, 0x5A5A4200, 0x5450A0A8,
+				0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050,
+				0xAA550000, 0xAA555500, 0xAAAA5500, 0x90909090,
+				0x94949494, 0xA4A4A4A4, 0xA9A59450, 0x2A0A4250,
+				0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0,
+				0xA8A85454, 0x6A6A4040, 0xA4A45000, 0x1A1A0500,
+				0x0050A4A4, 0xAAA59090, 0x14696914, 0x69691400,
+				0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200,
+				0xA9A58000, 0x5090A0A8, 0xA8A09050, 0x24242424,
+				0x00AA5500, 0x24924924, 0x24499224, 0x50A50A50,
+				0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0,
+				0x50A050A0, 0x69286928, 0x44AAAA44, 0x66666600,
+				0xAA444444, 0x54A854A8, 0x95809580, 0x96969600,
+				0xA85454A8, 0x80959580, 0xAA141414, 0x96960000,
+				0xAAAA1414, 0xA05050A0, 0xA0A5A5A0, 0x96000000,
+				0x40804080, 0xA9A8A9A8, 0xAAAAAA44, 0x2A4A5254,
+			};
+
+			// 2 サブセットの分割における、サブセット 1 のアンカーピクセル
+			constexpr uint8 BC7Anchors2[64] =
+			{
+				15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+				15,  2,  8,  2,  2,  8,  8, 15,  2,  8,  2,  2,  8,  8,  2,  2,
+				15, 15,  6,  8,  2,  8, 15, 15,  2,  8,  2,  2,  2, 15, 15,  6,
+				 6,  2,  6,  8, 15, 15,  2,  2, 15, 15, 15, 15, 15,  2,  2, 15,
+			};
+
+			// 3 サブセットの分割における、サブセット 1 のアンカーピクセル
+			constexpr uint8 BC7Anchors3Second[64] =
+			{
+				 3,  3, 15, 15,  8,  3, 15, 15,  8,  8,  6,  6,  6,  5,  3,  3,
+				 3,  3,  8, 15,  3,  3,  6, 10,  5,  8,  8,  6,  8,  5, 15, 15,
+				 8, 15,  3,  5,  6, 10,  8, 15, 15,  3, 15,  5, 15, 15, 15, 15,
+				 3, 15,  5,  5,  5,  8,  5, 10,  5, 10,  8, 13, 15, 12,  3,  3,
+			};
+
+			// 3 サブセットの分割における、サブセット 2 のアンカーピクセル
+			constexpr uint8 BC7Anchors3Third[64] =
+			{
+				15,  8,  8,  3, 15, 15,  3,  8, 15, 15, 15, 15, 15, 15, 15,  8,
+				15,  8, 15,  3, 15,  8, 15,  8,  3, 15,  6, 10, 15, 15, 10,  8,
+				15,  3, 15, 10, 10,  8,  9, 10,  6, 15,  8, 15,  3,  6,  6,  8,
+				15,  3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  3, 15, 15,  8,
+			};
+
+			[[nodiscard]]
+			static uint32 GetSubset(const uint32 numSubsets, const uint32 partition, const uint32 pixel) noexcept
+			{
+				if (numSubsets == 2)
+				{
+					return ((BC7Partitions2[partition] >> pixel) & 0x1);
+				}
+				else if (numSubsets == 3)
+				{
+					return ((BC7Partitions3[partition] >> (pixel * 2)) & 0x3);
+				}
+
+				return 0;
+			}
+
+			[[nodiscard]]
+			static bool IsAnchor(const uint32 numSubsets, const uint32 partition, const uint32 pixel) noexcept
+			{
+				if (pixel == 0)
+				{
+					return true;
+				}
+				else if (numSubsets == 2)
+				{
+					return (pixel == BC7Anchors2[partition]);
+				}
+				else if (numSubsets == 3)
+				{
+					return ((pixel == BC7Anchors3Second[partition]) || (pixel == BC7Anchors3Third[partition]));
+				}
+
+				return false;
+			}
+
+			/// @brief BC7 ブロックをモード 6（1 サブセット、RGBA 7-bit + P-bit の端点、4-bit インデックス）でエンコードします。
+			static void EncodeBC7Block(const Color* pixels, uint8* dst) noexcept
+			{
+				Point<4> points[16];
+
+				for (size_t i = 0; i < 16; ++i)
+				{
+					points[i] = { static_cast<float>(pixels[i].r), static_cast<float>(pixels[i].g), static_cast<float>(pixels[i].b), static_cast<float>(pixels[i].a) };
+				}
+
+				Point<4> e0, e1;
+				ComputeInitialEndpoints(points, 16, e0, e1);
+
+				int32 bestError = INT32_MAX;
+				uint32 bestQ0[4] = {}, bestQ1[4] = {};
+				uint32 bestP0 = 0, bestP1 = 0;
+				uint8 bestIndices[16] = {};
+
+				for (int32 iteration = 0; iteration < 3; ++iteration)
+				{
+					int32 iterationError = INT32_MAX;
+					uint8 iterationIndices[16] = {};
+
+					for (uint32 pBits = 0; pBits < 4; ++pBits)
+					{
+						const uint32 p0 = (pBits & 1);
+						const uint32 p1 = (pBits >> 1);
+						uint32 q0[4], q1[4];
+						int32 r0[4], r1[4];
+
+						for (size_t k = 0; k < 4; ++k)
+						{
+							q0[k] = static_cast<uint32>(Clamp<long>(std::lround((e0[k] - p0) * 0.5f), 0, 127));
+							q1[k] = static_cast<uint32>(Clamp<long>(std::lround((e1[k] - p1) * 0.5f), 0, 127));
+							r0[k] = static_cast<int32>((q0[k] << 1) | p0);
+							r1[k] = static_cast<int32>((q1[k] << 1) | p1);
+						}
+
+						int32 palette[16][4];
+
+						for (uint32 n = 0; n < 16; ++n)
+						{
+							for (size_t k = 0; k < 4; ++k)
+							{
+								palette[n][k] = static_cast<int32>(Interpolate(r0[k], r1[k], Weights4[n]));
+							}
+						}
+
+						const int32 direction[4] = { (r1[0] - r0[0]), (r1[1] - r0[1]), (r1[2] - r0[2]), (r1[3] - r0[3]) };
+						const int32 length2 = (Square(direction[0]) + Square(direction[1]) + Square(direction[2]) + Square(direction[3]));
+
+						int32 error = 0;
+						uint8 indices[16];
+
+						for (size_t i = 0; i < 16; ++i)
+						{
+							const Color& pixel = pixels[i];
+							const int32 values[4] = { pixel.r, pixel.g, pixel.b, pixel.a };
+
+							// 端点を結ぶ直線に射影して、近い 2 つのインデックスから選ぶ
+							uint32 candidate = 0;
+
+							if (length2 != 0)
+							{
+								const int32 t = ((values[0] - r0[0]) * direction[0] + (values[1] - r0[1]) * direction[1]
+									+ (values[2] - r0[2]) * direction[2] + (values[3] - r0[3]) * direction[3]);
+								const int32 weight = Clamp((t * 64 + (length2 / 2)) / length2, 0, 64);
+
+								while ((candidate < 15) && (Weights4[candidate + 1] <= weight))
+								{
+									++candidate;
+								}
+							}
+
+							uint32 bestIndex = candidate;
+							int32 bestPixelError = INT32_MAX;
+
+							for (uint32 n = candidate; n <= Min<uint32>((candidate + 1), 15); ++n)
+							{
+								const int32 e = (Square(values[0] - palette[n][0]) + Square(values[1] - palette[n][1])
+									+ Square(values[2] - palette[n][2]) + Square(values[3] - palette[n][3]));
+
+								if (e < bestPixelError)
+								{
+									bestPixelError = e;
+									bestIndex = n;
+								}
+							}
+
+							indices[i] = static_cast<uint8>(bestIndex);
+							error += bestPixelError;
+						}
+
+						if (error < iterationError)
+						{
+							iterationError = error;
+							std::memcpy(iterationIndices, indices, sizeof(indices));
+						}
+
+						if (error < bestError)
+						{
+							bestError = error;
+							std::memcpy(bestQ0, q0, sizeof(q0));
+							std::memcpy(bestQ1, q1, sizeof(q1));
+							bestP0 = p0;
+							bestP1 = p1;
+							std::memcpy(bestIndices, indices, sizeof(indices));
+						}
+					}
+
+					if (bestError == 0)
+					{
+						break;
+					}
+
+					float weights[16];
+
+					for (size_t i = 0; i < 16; ++i)
+					{
+						weights[i] = (Weights4[iterationIndices[i]] / 64.0f);
+					}
+
+					if (not RefineEndpoints(points, weights, 16, e0, e1))
+					{
+						break;
+					}
+				}
+
+				// アンカー（ピクセル 0）のインデックスの最上位ビットは 0 でなければならない
+				if (bestIndices[0] & 0x8)
+				{
+					std::swap(bestQ0, bestQ1);
+					std::swap(bestP0, bestP1);
+
+					for (auto& index : bestIndices)
+					{
+						index = static_cast<uint8>(15 - index);
+					}
+				}
+
+				BitWriter writer{ dst, 16 };
+				writer.write((1u << 6), 7);
+
+				for (size_t k = 0; k < 4; ++k)
+				{
+					writer.write(bestQ0[k], 7);
+					writer.write(bestQ1[k], 7);
+				}
+
+				writer.write(bestP0, 1);
+				writer.write(bestP1, 1);
+				writer.write(bestIndices[0], 3);
+
+				for (size_t i = 1; i < 16; ++i)
+				{
+					writer.write(bestIndices[i], 4);
+				}
+			}
+
+			static void DecodeBC7Block(const uint8* src, Color* pixels) noexcept
+			{
+				uint32 mode = 0;
+
+				while ((mode < 8) && (((src[0] >> mode) & 1) == 0))
+				{
+					++mode;
+				}
+
+				if (mode == 8)
+				{
+					// 予約されたモードは透明な黒
+					for (size_t i = 0; i < 16; ++i)
+					{
+						pixels[i] = Color{ 0, 0, 0, 0 };
+					}
+
+					return;
+				}
+
+				const BC7ModeInfo& info = BC7Modes[mode];
+				BitReader reader{ src };
+				(void)reader.read(mode + 1);
+
+				const uint32 partition = reader.read(info.partitionBits);
+				const uint32 rotation = reader.read(info.rotationBits);
+				const uint32 indexSelection = reader.read(info.indexSelectionBits);
+				const uint32 numEndpoints = (info.numSubsets * 2u);
+
+				uint32 endpoints[6][4] = {};
+
+				for (size_t k = 0; k < 3; ++k)
+				{
+					for (uint32 e = 0; e < numEndpoints; ++e)
+					{
+						endpoints[e][k] = reader.read(info.colorBits);
+					}
+				}
+
+				if (info.alphaBits)
+				{
+					for (uint32 e = 0; e < numEndpoints; ++e)
+					{
+						endpoints[e][3] = reader.read(info.alphaBits);
+					}
+				}
+
+				uint32 colorPrecision = info.colorBits;
+				uint32 alphaPrecision = info.alphaBits;
+
+				if (info.endpointPBits || info.sharedPBits)
+				{
+					uint32 pBits[6] = {};
+
+					if (info.endpointPBits)
+					{
+						for (uint32 e = 0; e < numEndpoints; ++e)
+						{
+							pBits[e] = reader.read(1);
+						}
+					}
+					else
+					{
+						for (uint32 s = 0; s < info.numSubsets; ++s)
+						{
+							pBits[s * 2] = pBits[s * 2 + 1] = reader.read(1);
+						}
+					}
+
+					for (uint32 e = 0; e < numEndpoints; ++e)
+					{
+						for (size_t k = 0; k < 4; ++k)
+						{
+							endpoints[e][k] = ((endpoints[e][k] << 1) | pBits[e]);
+						}
+					}
+
+					++colorPrecision;
+
+					if (alphaPrecision)
+					{
+						++alphaPrecision;
+					}
+				}
+
+				for (uint32 e = 0; e < numEndpoints; ++e)
+				{
+					for (size_t k = 0; k < 3; ++k)
+					{
+						const uint32 v = (endpoints[e][k] << (8 - colorPrecision));
+						endpoints[e][k] = (v | (v >> colorPrecision));
+					}
+
+					if (alphaPrecision)
+					{
+						const uint32 v = (endpoints[e][3] << (8 - alphaPrecision));
+						endpoints[e][3] = (v | (v >> alphaPrecision));
+					}
+					else
+					{
+						endpoints[e][3] = 255;
+					}
+				}
+
+				uint32 indices[16] = {};
+				uint32 secondaryIndices[16] = {};
+
+				for (uint32 i = 0; i < 16; ++i)
+				{
+					indices[i] = reader.read(info.indexBits - (IsAnchor(info.numSubsets, partition, i) ? 1 : 0));
+				}
+
+				if (info.secondaryIndexBits)
+				{
+					for (uint32 i = 0; i < 16; ++i)
+					{
+						secondaryIndices[i] = reader.read(info.secondaryIndexBits - ((i == 0) ? 1 : 0));
+					}
+				}
+
+				const uint8* colorWeights = GetWeights(info.indexBits);
+				const uint8* alphaWeights = colorWeights;
+				const uint32* colorIndices = indices;
+				const uint32* alphaIndices = indices;
+
+				if (info.secondaryIndexBits)
+				{
+					if (indexSelection)
+					{
+						colorWeights = GetWeights(info.secondaryIndexBits);
+						colorIndices = secondaryIndices;
+					}
+					else
+					{
+						alphaWeights = GetWeights(info.secondaryIndexBits);
+						alphaIndices = secondaryIndices;
+					}
+				}
+
+				for (uint32 i = 0; i < 16; ++i)
+				{
+					const uint32 subset = GetSubset(info.numSubsets, partition, i);
+					const uint32 (&e0)[4] = endpoints[subset * 2];
+					const uint32 (&e1)[4] = endpoints[subset * 2 + 1];
+					const uint32 colorWeight = colorWeights[colorIndices[i]];
+					const uint32 alphaWeight = alphaWeights[alphaIndices[i]];
+
+					uint8 rgba[4] =
+					{
+						static_cast<uint8>(Interpolate(e0[0], e1[0], colorWeight)),
+						static_cast<uint8>(Interpolate(e0[1], e1[1], colorWeight)),
+						static_cast<uint8>(Interpolate(e0[2], e1[2], colorWeight)),
+						static_cast<uint8>(Interpolate(e0[3], e1[3], alphaWeight)),
+					};
+
+					if (rotation)
+					{
+						std::swap(rgba[3], rgba[rotation - 1]);
+					}
+
+					pixels[i] = Color{ rgba[0], rgba[1], rgba[2], rgba[3] };
+				}
+			}
+
+			[[nodiscard]]
+			static const uint8* AsUint8(const Byte* p) noexcept
+			{
+				return static_cast<const uint8*>(static_cast<const void*>(p));
+			}
+
+			[[nodiscard]]
+			static uint8* AsUint8(Byte* p) noexcept
+			{
+				return static_cast<uint8*>(static_cast<void*>(p));
+			}
+		}
+
+		void EncodeBlock(const Color* pixels, const TextureFormat format, Byte* dst)
+		{
+			uint8* const pDst = AsUint8(dst);
+			uint8 values[16];
+
+			switch (format.value())
+			{
+			case TexturePixelFormat::BC1_RGBA_Unorm:
+			case TexturePixelFormat::BC1_RGBA_Unorm_SRGB:
+				EncodeColorBlock(pixels, pDst, true, false);
+				break;
+			case TexturePixelFormat::BC3_RGBA_Unorm:
+			case TexturePixelFormat::BC3_RGBA_Unorm_SRGB:
+				for (size_t i = 0; i < 16; ++i)
+				{
+					values[i] = pixels[i].a;
+				}
+
+				EncodeSingleChannelBlock(values, pDst);
+				EncodeColorBlock(pixels, (pDst + 8), false, true);
+				break;
+			case TexturePixelFormat::BC4_R_Unorm:
+				for (size_t i = 0; i < 16; ++i)
+				{
+					values[i] = pixels[i].r;
+				}
+
+				EncodeSingleChannelBlock(values, pDst);
+				break;
+			case TexturePixelFormat::BC5_RG_Unorm:
+				for (size_t i = 0; i < 16; ++i)
+				{
+					values[i] = pixels[i].r;
+				}
+
+				EncodeSingleChannelBlock(values, pDst);
+
+				for (size_t i = 0; i < 16; ++i)
+				{
+					values[i] = pixels[i].g;
+				}
+
+				EncodeSingleChannelBlock(values, (pDst + 8));
+				break;
+			case TexturePixelFormat::BC7_RGBA_Unorm:
+			case TexturePixelFormat::BC7_RGBA_Unorm_SRGB:
+				EncodeBC7Block(pixels, pDst);
+				break;
+			default:
+				break;
+			}
+		}
+
+		void DecodeBlock(const Byte* src, const TextureFormat format, Color* pixels)
+		{
+			const uint8* const pSrc = AsUint8(src);
+			uint8 values[16];
+
+			switch (format.value())
+			{
+			case TexturePixelFormat::BC1_RGBA_Unorm:
+			case TexturePixelFormat::BC1_RGBA_Unorm_SRGB:
+				DecodeColorBlock(pSrc, pixels, false);
+				break;
+			case TexturePixelFormat::BC3_RGBA_Unorm:
+			case TexturePixelFormat::BC3_RGBA_Unorm_SRGB:
+				DecodeColorBlock((pSrc + 8), pixels, true);
+				DecodeSingleChannelBlock(pSrc, values);
+
+				for (size_t i = 0; i < 16; ++i)
+				{
+					pixels[i].a = values[i];
+				}
+
+				break;
+			case TexturePixelFormat::BC4_R_Unorm:
+				DecodeSingleChannelBlock(pSrc, values);
+
+				for (size_t i = 0; i < 16; ++i)
+				{
+					pixels[i] = Color{ values[i], 0, 0, 255 };
+				}
+
+				break;
+			case TexturePixelFormat::BC5_RG_Unorm:
+				DecodeSingleChannelBlock(pSrc, values);
+
+				for (size_t i = 0; i < 16; ++i)
+				{
+					pixels[i] = Color{ values[i], 0, 0, 255 };
+				}
+
+				DecodeSingleChannelBlock((pSrc + 8), values);
+
+				for (size_t i = 0; i < 16; ++i)
+				{
+					pixels[i].g = values[i];
+				}
+
+				break;
+			case TexturePixelFormat::BC7_RGBA_Unorm:
+			case TexturePixelFormat::BC7_RGBA_Unorm_SRGB:
+				DecodeBC7Block(pSrc, pixels);
+				break;
+			default:
+				for (size_t i = 0; i < 16; ++i)
+				{
+					pixels[i] = Color{ 0, 0, 0, 0 };
+				}
+
+				break;
+			}
+		}
+
+		Blob Encode(const Image& image, const TextureFormat format)
+		{
+			const size_t blockSize = format.blockSize();
+
+			if ((not image) || (blockSize == 0))
+			{
+				return{};
+			}
+
+			const size_t width = image.width();
+			const size_t height = image.height();
+			const size_t blocksX = ((width + 3) / 4);
+			const size_t blocksY = ((height + 3) / 4);
+
+			Blob blob(blocksX * blocksY * blockSize);
+			Byte* const pDst = blob.data();
+
+			Threading::ParallelFor(blocksY, [&](const size_t by)
+			{
+				Color pixels[16];
+
+				for (size_t bx = 0; bx < blocksX; ++bx)
+				{
+					// 画像の外は最も近いピクセルで埋める
+					for (size_t y = 0; y < 4; ++y)
+					{
+						const Color* pLine = image[Min((by * 4 + y), (height - 1))];
+
+						for (size_t x = 0; x < 4; ++x)
+						{
+							pixels[y * 4 + x] = pLine[Min((bx * 4 + x), (width - 1))];
+						}
+					}
+
+					EncodeBlock(pixels, format, (pDst + (by * blocksX + bx) * blockSize));
+				}
+			});
+
+			return blob;
+		}
+
+		Image Decode(const Byte* data, const Size& size, const TextureFormat format)
+		{
+			const size_t blockSize = format.blockSize();
+
+			if ((data == nullptr) || (blockSize == 0) || (size.x <= 0) || (size.y <= 0))
+			{
+				return{};
+			}
+
+			const size_t width = size.x;
+			const size_t height = size.y;
+			const size_t blocksX = ((width + 3) / 4);
+			const size_t blocksY = ((height + 3) / 4);
+
+			Image image{ size };
+
+			Threading::ParallelFor(blocksY, [&](const size_t by)
+			{
+				Color pixels[16];
+
+				for (size_t bx = 0; bx < blocksX; ++bx)
+				{
+					DecodeBlock((data + (by * blocksX + bx) * blockSize), format, pixels);
+
+					for (size_t y = 0; (y < 4) && ((by * 4 + y) < height); ++y)
+					{
+						Color* pLine = image[by * 4 + y];
+
+						for (size_t x = 0; (x < 4) && ((bx * 4 + x) < width); ++x)
+						{
+							pLine[bx * 4 + x] = pixels[y * 4 + x];
+						}
+					}
+				}
+			});
+
+			return image;
+		}
+
+		size_t CalculateDataSize(const Size& size, const TextureFormat format) noexcept
+		{
+			if ((size.x <= 0) || (size.y <= 0))
+			{
+				return 0;
+			}
+
+			return (((static_cast<size_t>(size.x) + 3) / 4) * ((static_cast<size_t>(size.y) + 3) / 4) * format.blockSize());
+		}
+	}
+}
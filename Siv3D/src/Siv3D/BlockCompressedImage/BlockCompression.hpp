@@ -0,0 +1,64 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Blob.hpp>
+# include <Siv3D/Color.hpp>
+# include <Siv3D/PointVector.hpp>
+# include <Siv3D/TextureFormat.hpp>
+
+namespace s3d
+{
+	class Image;
+
+	/// @brief 4x4 ピクセルのブロック単位の BC1 / BC3 / BC4 / BC5 / BC7 のエンコードとデコード
+	namespace BlockCompression
+	{
+		/// @brief 1 ブロック (16 ピクセル、左上から行順) をエンコードします。
+		/// @param pixels 16 ピクセル
+		/// @param format ブロック圧縮フォーマット
+		/// @param dst 書き込み先。`format.blockSize()` バイト必要です
+		/// @remark BC4 は R, BC5 は R と G を使います。BC7 はモード 6 のみを使います。
+		void EncodeBlock(const Color* pixels, TextureFormat format, Byte* dst);
+
+		/// @brief 1 ブロックをデコードします。
+		/// @param src ブロックのデータ。`format.blockSize()` バイト必要です
+		/// @param format ブロック圧縮フォーマット
+		/// @param pixels 16 ピクセルの書き込み先
+		/// @remark BC4 は (R, 0, 0, 255), BC5 は (R, G, 0, 255) になります。BC7 はすべてのモードに対応します。
+		void DecodeBlock(const Byte* src, TextureFormat format, Color* pixels);
+
+		/// @brief 画像をブロック圧縮します。
+		/// @param image 画像
+		/// @param format ブロック圧縮フォーマット
+		/// @return 圧縮されたデータ
+		/// @remark ブロックの行ごとに複数のスレッドで処理します。幅と高さが 4 の倍数でない場合、端のブロックの余白は最も近いピクセルで埋めます。
+		[[nodiscard]]
+		Blob Encode(const Image& image, TextureFormat format);
+
+		/// @brief ブロック圧縮されたデータを画像にデコードします。
+		/// @param data データ
+		/// @param size 画像の幅と高さ（ピクセル）
+		/// @param format ブロック圧縮フォーマット
+		/// @return デコードした画像
+		/// @remark データは `CalculateDataSize(size, format)` バイト必要です。
+		[[nodiscard]]
+		Image Decode(const Byte* data, const Size& size, TextureFormat format);
+
+		/// @brief ブロック圧縮されたデータのサイズ（バイト）を返します。
+		/// @param size 画像の幅と高さ（ピクセル）
+		/// @param format ブロック圧縮フォーマット
+		/// @return データのサイズ（バイト）
+		[[nodiscard]]
+		size_t CalculateDataSize(const Size& size, TextureFormat format) noexcept;
+	}
+}
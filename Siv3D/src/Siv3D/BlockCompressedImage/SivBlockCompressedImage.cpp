@@ -0,0 +1,848 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cstring>
+# include <Siv3D/BlockCompressedImage.hpp>
+# include <Siv3D/ImageProcessing.hpp>
+# include <Siv3D/MemoryViewReader.hpp>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/Hash.hpp>
+# include <Siv3D/FormatLiteral.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "BlockCompression.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// エンコード結果が変わる変更をしたら上げる（古いキャッシュは使われなくなる）
+		constexpr uint32 BlockCompressionEncoderVersion = 1;
+
+		constexpr TexturePixelFormat BlockCompressedFormats[] =
+		{
+			TexturePixelFormat::BC1_RGBA_Unorm,
+			TexturePixelFormat::BC1_RGBA_Unorm_SRGB,
+			TexturePixelFormat::BC3_RGBA_Unorm,
+			TexturePixelFormat::BC3_RGBA_Unorm_SRGB,
+			TexturePixelFormat::BC4_R_Unorm,
+			TexturePixelFormat::BC5_RG_Unorm,
+			TexturePixelFormat::BC7_RGBA_Unorm,
+			TexturePixelFormat::BC7_RGBA_Unorm_SRGB,
+		};
+
+		template <class Type>
+		static void AppendValue(Blob& blob, const Type& value)
+		{
+			blob.append(std::addressof(value), sizeof(Type));
+		}
+
+		template <class Type>
+		[[nodiscard]]
+		static bool ReadValue(const Blob& blob, const size_t offset, Type& value)
+		{
+			if ((blob.size() < offset) || ((blob.size() - offset) < sizeof(Type)))
+			{
+				return false;
+			}
+
+			std::memcpy(std::addressof(value), (blob.data() + offset), sizeof(Type));
+			return true;
+		}
+
+		static void AppendPadding(Blob& blob, const size_t alignment)
+		{
+			while (blob.size() % alignment)
+			{
+				AppendValue(blob, uint8{ 0 });
+			}
+		}
+
+		/// @brief 幅と高さから、ミップレベルの数の最大値を返します。
+		[[nodiscard]]
+		static size_t MaxMipLevels(const Size& size) noexcept
+		{
+			size_t levels = 1;
+
+			for (int32 length = Max(size.x, size.y); 1 < length; length /= 2)
+			{
+				++levels;
+			}
+
+			return levels;
+		}
+
+		/// @brief 各ミップレベルのデータを読み込みます。
+		[[nodiscard]]
+		static bool ReadMipmaps(const Blob& blob, BlockCompressedImage& image, const Array<std::pair<uint64, uint64>>& ranges)
+		{
+			for (size_t level = 0; level < ranges.size(); ++level)
+			{
+				const auto [offset, length] = ranges[level];
+				const size_t expected = BlockCompressedImage::CalculateDataSize(image.mipSize(level), image.format);
+
+				if ((length != expected) || (blob.size() < offset) || ((blob.size() - offset) < length))
+				{
+					return false;
+				}
+
+				image.mipmaps.emplace_back((blob.data() + offset), static_cast<size_t>(length));
+			}
+
+			return true;
+		}
+
+		////////////////////////////////////////////////
+		//
+		//	DDS
+		//
+		////////////////////////////////////////////////
+
+		[[nodiscard]]
+		constexpr uint32 MakeFourCC(const char a, const char b, const char c, const char d) noexcept
+		{
+			return (static_cast<uint32>(a) | (static_cast<uint32>(b) << 8) | (static_cast<uint32>(c) << 16) | (static_cast<uint32>(d) << 24));
+		}
+
+		constexpr uint32 DDSMagic = MakeFourCC('D', 'D', 'S', ' ');
+
+		struct DDSPixelFormat
+		{
+			uint32 size;
+			uint32 flags;
+			uint32 fourCC;
+			uint32 rgbBitCount;
+			uint32 rBitMask;
+			uint32 gBitMask;
+			uint32 bBitMask;
+			uint32 aBitMask;
+		};
+
+		struct DDSHeader
+		{
+			uint32 size;
+			uint32 flags;
+			uint32 height;
+			uint32 width;
+			uint32 pitchOrLinearSize;
+			uint32 depth;
+			uint32 mipMapCount;
+			uint32 reserved1[11];
+			DDSPixelFormat pixelFormat;
+			uint32 caps;
+			uint32 caps2;
+			uint32 caps3;
+			uint32 caps4;
+			uint32 reserved2;
+		};
+		static_assert(sizeof(DDSHeader) == 124);
+
+		struct DDSHeaderDX10
+		{
+			uint32 dxgiFormat;
+			uint32 resourceDimension;
+			uint32 miscFlag;
+			uint32 arraySize;
+			uint32 miscFlags2;
+		};
+		static_assert(sizeof(DDSHeaderDX10) == 20);
+
+		constexpr uint32 DDSD_CAPS			= 0x1;
+		constexpr uint32 DDSD_HEIGHT		= 0x2;
+		constexpr uint32 DDSD_WIDTH			= 0x4;
+		constexpr uint32 DDSD_PIXELFORMAT	= 0x1000;
+		constexpr uint32 DDSD_MIPMAPCOUNT	= 0x20000;
+		constexpr uint32 DDSD_LINEARSIZE	= 0x80000;
+		constexpr uint32 DDPF_FOURCC		= 0x4;
+		constexpr uint32 DDSCAPS_COMPLEX	= 0x8;
+		constexpr uint32 DDSCAPS_TEXTURE	= 0x1000;
+		constexpr uint32 DDSCAPS_MIPMAP		= 0x400000;
+		constexpr uint32 DDSCAPS2_CUBEMAP	= 0x200;
+		constexpr uint32 DDSCAPS2_VOLUME	= 0x200000;
+		constexpr uint32 D3D10_RESOURCE_DIMENSION_TEXTURE2D = 3;
+
+		/// @brief DX10 拡張ヘッダを使わずに表せる場合、その FourCC を返します。
+		[[nodiscard]]
+		static uint32 ToLegacyFourCC(const TextureFormat format) noexcept
+		{
+			switch (format.value())
+			{
+			case TexturePixelFormat::BC1_RGBA_Unorm:
+				return MakeFourCC('D', 'X', 'T', '1');
+			case TexturePixelFormat::BC3_RGBA_Unorm:
+				return MakeFourCC('D', 'X', 'T', '5');
+			case TexturePixelFormat::BC4_R_Unorm:
+				return MakeFourCC('A', 'T', 'I', '1');
+			case TexturePixelFormat::BC5_RG_Unorm:
+				return MakeFourCC('A', 'T', 'I', '2');
+			default:
+				return 0;
+			}
+		}
+
+		[[nodiscard]]
+		static TextureFormat FromLegacyFourCC(const uint32 fourCC) noexcept
+		{
+			if (fourCC == MakeFourCC('D', 'X', 'T', '1'))
+			{
+				return TextureFormat::BC1_RGBA_Unorm;
+			}
+			else if ((fourCC == MakeFourCC('D', 'X', 'T', '4')) || (fourCC == MakeFourCC('D', 'X', 'T', '5')))
+			{
+				return TextureFormat::BC3_RGBA_Unorm;
+			}
+			else if ((fourCC == MakeFourCC('A', 'T', 'I', '1')) || (fourCC == MakeFourCC('B', 'C', '4', 'U')))
+			{
+				return TextureFormat::BC4_R_Unorm;
+			}
+			else if ((fourCC == MakeFourCC('A', 'T', 'I', '2')) || (fourCC == MakeFourCC('B', 'C', '5', 'U')))
+			{
+				return TextureFormat::BC5_RG_Unorm;
+			}
+
+			return TextureFormat::Unknown;
+		}
+
+		[[nodiscard]]
+		static TextureFormat FromDXGIFormat(const uint32 dxgiFormat) noexcept
+		{
+			for (const auto format : BlockCompressedFormats)
+			{
+				if (static_cast<uint32>(TextureFormat{ format }.DXGIFormat()) == dxgiFormat)
+				{
+					return format;
+				}
+			}
+
+			return TextureFormat::Unknown;
+		}
+
+		[[nodiscard]]
+		static bool LoadDDS(const Blob& blob, BlockCompressedImage& image)
+		{
+			DDSHeader header;
+
+			if (not ReadValue(blob, sizeof(uint32), header))
+			{
+				LOG_FAIL(U"❌ BlockCompressedImage: DDS header is invalid");
+				return false;
+			}
+
+			if ((header.size != sizeof(DDSHeader)) || (header.pixelFormat.size != sizeof(DDSPixelFormat)))
+			{
+				LOG_FAIL(U"❌ BlockCompressedImage: DDS header is invalid");
+				return false;
+			}
+
+			if (header.caps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME))
+			{
+				LOG_FAIL(U"❌ BlockCompressedImage: Cube map and volume DDS are not supported");
+				return false;
+			}
+
+			size_t offset = (sizeof(uint32) + sizeof(DDSHeader));
+			TextureFormat format = TextureFormat::Unknown;
+
+			if (header.pixelFormat.flags & DDPF_FOURCC)
+			{
+				if (header.pixelFormat.fourCC == MakeFourCC('D', 'X', '1', '0'))
+				{
+					DDSHeaderDX10 headerDX10;
+
+					if (not ReadValue(blob, offset, headerDX10))
+					{
+						LOG_FAIL(U"❌ BlockCompressedImage: DDS header is invalid");
+						return false;
+					}
+
+					if ((headerDX10.resourceDimension != D3D10_RESOURCE_DIMENSION_TEXTURE2D) || (1 < headerDX10.arraySize))
+					{
+						LOG_FAIL(U"❌ BlockCompressedImage: Only a single 2D texture is supported in DDS");
+						return false;
+					}
+
+					offset += sizeof(DDSHeaderDX10);
+					format = FromDXGIFormat(headerDX10.dxgiFormat);
+				}
+				else
+				{
+					format = FromLegacyFourCC(header.pixelFormat.fourCC);
+				}
+			}
+
+			if (not format.isBlockCompressed())
+			{
+				LOG_FAIL(U"❌ BlockCompressedImage: DDS pixel format is not supported");
+				return false;
+			}
+
+			const Size size{ static_cast<int32>(header.width), static_cast<int32>(header.height) };
+
+			if ((size.x <= 0) || (size.y <= 0))
+			{
+				LOG_FAIL(U"❌ BlockCompressedImage: DDS image size is invalid");
+				return false;
+			}
+
+			image.format = format;
+			image.size = size;
+
+			const size_t mipLevels = Clamp<size_t>(header.mipMapCount, 1, MaxMipLevels(size));
+			Array<std::pair<uint64, uint64>> ranges(mipLevels);
+
+			for (size_t level = 0; level < mipLevels; ++level)
+			{
+				const size_t length = BlockCompressedImage::CalculateDataSize(image.mipSize(level), format);
+				ranges[level] = { offset, length };
+				offset += length;
+			}
+
+			if (not ReadMipmaps(blob, image, ranges))
+			{
+				LOG_FAIL(U"❌ BlockCompressedImage: DDS data is truncated");
+				return false;
+			}
+
+			return true;
+		}
+
+		[[nodiscard]]
+		static Blob EncodeDDS(const BlockCompressedImage& image)
+		{
+			const uint32 legacyFourCC = ToLegacyFourCC(image.format);
+			const uint32 mipLevels = static_cast<uint32>(image.mipLevels());
+
+			DDSHeader header{};
+			header.size = sizeof(DDSHeader);
+			header.flags = (DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_LINEARSIZE | ((1 < mipLevels) ? DDSD_MIPMAPCOUNT : 0));
+			header.height = static_cast<uint32>(image.size.y);
+			header.width = static_cast<uint32>(image.size.x);
+			header.pitchOrLinearSize = static_cast<uint32>(image.mipmaps.front().size());
+			header.mipMapCount = mipLevels;
+			header.pixelFormat.size = sizeof(DDSPixelFormat);
+			header.pixelFormat.flags = DDPF_FOURCC;
+			header.pixelFormat.fourCC = (legacyFourCC ? legacyFourCC : MakeFourCC('D', 'X', '1', '0'));
+			header.caps = (DDSCAPS_TEXTURE | ((1 < mipLevels) ? (DDSCAPS_COMPLEX | DDSCAPS_MIPMAP) : 0));
+
+			Blob blob{ Arg::reserve = (sizeof(uint32) + sizeof(DDSHeader) + sizeof(DDSHeaderDX10) + image.size_bytes()) };
+			AppendValue(blob, DDSMagic);
+			AppendValue(blob, header);
+
+			if (not legacyFourCC)
+			{
+				const DDSHeaderDX10 headerDX10{ static_cast<uint32>(image.format.DXGIFormat()), D3D10_RESOURCE_DIMENSION_TEXTURE2D, 0, 1, 0 };
+				AppendValue(blob, headerDX10);
+			}
+
+			for (const auto& mipmap : image.mipmaps)
+			{
+				blob.append(mipmap.data(), mipmap.size());
+			}
+
+			return blob;
+		}
+
+		////////////////////////////////////////////////
+		//
+		//	KTX2
+		//
+		////////////////////////////////////////////////
+
+		constexpr uint8 KTX2Identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+	# pragma pack (push, 1)
+
+		struct KTX2Header
+		{
+			uint32 vkFormat;
+			uint32 typeSize;
+			uint32 pixelWidth;
+			uint32 pixelHeight;
+			uint32 pixelDepth;
+			uint32 layerCount;
+			uint32 faceCount;
+			uint32 levelCount;
+			uint32 supercompressionScheme;
+			uint32 dfdByteOffset;
+			uint32 dfdByteLength;
+			uint32 kvdByteOffset;
+			uint32 kvdByteLength;
+			uint64 sgdByteOffset;
+			uint64 sgdByteLength;
+		};
+
+	# pragma pack (pop)
+
+		static_assert(sizeof(KTX2Header) == 68);
+
+		struct KTX2LevelIndex
+		{
+			uint64 byteOffset;
+			uint64 byteLength;
+			uint64 uncompressedByteLength;
+		};
+		static_assert(sizeof(KTX2LevelIndex) == 24);
+
+		struct KTX2Sample
+		{
+			uint16 bitOffset;
+
+			uint8 bitLength;
+
+			uint8 channelType;
+		};
+
+		struct KTX2FormatInfo
+		{
+			TexturePixelFormat format;
+
+			uint32 vkFormat;
+
+			// Khronos Data Format の colorModel
+			uint8 colorModel;
+
+			uint8 numSamples;
+
+			KTX2Sample samples[2];
+		};
+
+		// KHR_DF_CHANNEL_*
+		constexpr uint8 ChannelColor = 0;
+		constexpr uint8 ChannelGreen = 1;
+		constexpr uint8 ChannelBC1AlphaPresent = 1;
+		constexpr uint8 ChannelAlpha = 15;
+
+		// KHR_DF_SAMPLE_DATATYPE_LINEAR (sRGB のフォーマットのアルファ)
+		constexpr uint8 SampleLinear = 0x10;
+
+		constexpr KTX2FormatInfo KTX2Formats[] =
+		{
+			{ TexturePixelFormat::BC1_RGBA_Unorm, 133, 128, 1, { { 0, 64, ChannelBC1AlphaPresent } } },
+			{ TexturePixelFormat::BC1_RGBA_Unorm_SRGB, 134, 128, 1, { { 0, 64, ChannelBC1AlphaPresent } } },
+			{ TexturePixelFormat::BC3_RGBA_Unorm, 137, 130, 2, { { 0, 64, ChannelAlpha }, { 64, 64, ChannelColor } } },
+			{ TexturePixelFormat::BC3_RGBA_Unorm_SRGB, 138, 130, 2, { { 0, 64, (ChannelAlpha | SampleLinear) }, { 64, 64, ChannelColor } } },
+			{ TexturePixelFormat::BC4_R_Unorm, 139, 131, 1, { { 0, 64, ChannelColor } } },
+			{ TexturePixelFormat::BC5_RG_Unorm, 141, 132, 2, { { 0, 64, ChannelColor }, { 64, 64, ChannelGreen } } },
+			{ TexturePixelFormat::BC7_RGBA_Unorm, 145, 134, 1, { { 0, 128, ChannelColor } } },
+			{ TexturePixelFormat::BC7_RGBA_Unorm_SRGB, 146, 134, 1, { { 0, 128, ChannelColor } } },
+		};
+
+		// VK_FORMAT_BC1_RGB_UNORM_BLOCK, VK_FORMAT_BC1_RGB_SRGB_BLOCK
+		constexpr uint32 VK_FORMAT_BC1_RGB_UNORM = 131;
+		constexpr uint32 VK_FORMAT_BC1_RGB_SRGB = 132;
+
+		[[nodiscard]]
+		static const KTX2FormatInfo* GetKTX2FormatInfo(const TextureFormat format) noexcept
+		{
+			for (const auto& info : KTX2Formats)
+			{
+				if (info.format == format.value())
+				{
+					return &info;
+				}
+			}
+
+			return nullptr;
+		}
+
+		[[nodiscard]]
+		static TextureFormat FromVkFormat(const uint32 vkFormat) noexcept
+		{
+			if (vkFormat == VK_FORMAT_BC1_RGB_UNORM)
+			{
+				return TextureFormat::BC1_RGBA_Unorm;
+			}
+			else if (vkFormat == VK_FORMAT_BC1_RGB_SRGB)
+			{
+				return TextureFormat::BC1_RGBA_Unorm_SRGB;
+			}
+
+			for (const auto& info : KTX2Formats)
+			{
+				if (info.vkFormat == vkFormat)
+				{
+					return info.format;
+				}
+			}
+
+			return TextureFormat::Unknown;
+		}
+
+		/// @brief Khronos Data Format Descriptor (基本ブロックのみ) を作成します。
+		[[nodiscard]]
+		static Blob MakeDataFormatDescriptor(const KTX2FormatInfo& info, const TextureFormat format)
+		{
+			const uint16 descriptorBlockSize = static_cast<uint16>(24 + 16 * info.numSamples);
+
+			Blob dfd;
+			AppendValue(dfd, static_cast<uint32>(sizeof(uint32) + descriptorBlockSize)); // dfdTotalSize
+			AppendValue(dfd, uint32{ 0 }); // vendorId = KHR_DF_VENDORID_KHRONOS, descriptorType = KHR_DF_KHR_DESCRIPTORTYPE_BASICFORMAT
+			AppendValue(dfd, uint16{ 2 }); // versionNumber = KHR_DF_VERSIONNUMBER_1_3
+			AppendValue(dfd, descriptorBlockSize);
+			AppendValue(dfd, info.colorModel);
+			AppendValue(dfd, uint8{ 1 }); // colorPrimaries = KHR_DF_PRIMARIES_BT709
+			AppendValue(dfd, static_cast<uint8>(format.isSRGB() ? 2 : 1)); // transferFunction = KHR_DF_TRANSFER_SRGB / LINEAR
+			AppendValue(dfd, uint8{ 0 }); // flags = KHR_DF_FLAG_ALPHA_STRAIGHT
+
+			const uint8 texelBlockDimension[4] = { 3, 3, 0, 0 };
+			dfd.append(texelBlockDimension, sizeof(texelBlockDimension));
+
+			const uint8 bytesPlane[8] = { static_cast<uint8>(format.blockSize()), 0, 0, 0, 0, 0, 0, 0 };
+			dfd.append(bytesPlane, sizeof(bytesPlane));
+
+			for (uint8 i = 0; i < info.numSamples; ++i)
+			{
+				const KTX2Sample& sample = info.samples[i];
+				AppendValue(dfd, sample.bitOffset);
+				AppendValue(dfd, static_cast<uint8>(sample.bitLength - 1));
+				AppendValue(dfd, sample.channelType);
+				AppendValue(dfd, uint32{ 0 }); // samplePosition
+				AppendValue(dfd, uint32{ 0 }); // sampleLower
+				AppendValue(dfd, UINT32_MAX); // sampleUpper
+			}
+
+			return dfd;
+		}
+
+		[[nodiscard]]
+		static bool LoadKTX2(const Blob& blob, BlockCompressedImage& image)
+		{
+			KTX2Header header;
+
+			if (not ReadValue(blob, sizeof(KTX2Identifier), header))
+			{
+				LOG_FAIL(U"❌ BlockCompressedImage: KTX2 header is invalid");
+				return false;
+			}
+
+			if (header.supercompressionScheme != 0)
+			{
+				LOG_FAIL(U"❌ BlockCompressedImage: Supercompressed KTX2 is not supported");
+				return false;
+			}
+
+			if ((header.pixelDepth != 0) || (1 < header.layerCount) || (header.faceCount != 1))
+			{
+				LOG_FAIL(U"❌ BlockCompressedImage: Only a single 2D texture is supported in KTX2");
+				return false;
+			}
+
+			const TextureFormat format = FromVkFormat(header.vkFormat);
+
+			if (not format.isBlockCompressed())
+			{
+				LOG_FAIL(U"❌ BlockCompressedImage: KTX2 vkFormat {} is not supported"_fmt(header.vkFormat));
+				return false;
+			}
+
+			const Size size{ static_cast<int32>(header.pixelWidth), static_cast<int32>(header.pixelHeight) };
+
+			if ((size.x <= 0) || (size.y <= 0) || (MaxMipLevels(size) < header.levelCount))
+			{
+				LOG_FAIL(U"❌ BlockCompressedImage: KTX2 image size is invalid");
+				return false;
+			}
+
+			image.format = format;
+			image.size = size;
+
+			// levelCount が 0 の場合は、ミップマップの生成を求めるベースレベルのみのファイル
+			const size_t mipLevels = Max<size_t>(header.levelCount, 1);
+			Array<std::pair<uint64, uint64>> ranges(mipLevels);
+
+			for (size_t level = 0; level < mipLevels; ++level)
+			{
+				KTX2LevelIndex levelIndex;
+
+				if (not ReadValue(blob, (sizeof(KTX2Identifier) + sizeof(KTX2Header) + sizeof(KTX2LevelIndex) * level), levelIndex))
+				{
+					LOG_FAIL(U"❌ BlockCompressedImage: KTX2 level index is truncated");
+					return false;
+				}
+
+				ranges[level] = { levelIndex.byteOffset, levelIndex.byteLength };
+			}
+
+			if (not ReadMipmaps(blob, image, ranges))
+			{
+				LOG_FAIL(U"❌ BlockCompressedImage: KTX2 level data is invalid");
+				return false;
+			}
+
+			return true;
+		}
+
+		[[nodiscard]]
+		static Blob EncodeKTX2(const BlockCompressedImage& image)
+		{
+			const KTX2FormatInfo* pInfo = GetKTX2FormatInfo(image.format);
+
+			if (not pInfo)
+			{
+				return{};
+			}
+
+			const size_t mipLevels = image.mipLevels();
+			const Blob dfd = MakeDataFormatDescriptor(*pInfo, image.format);
+			const size_t dfdOffset = (sizeof(KTX2Identifier) + sizeof(KTX2Header) + sizeof(KTX2LevelIndex) * mipLevels);
+
+			// ミップマップは小さいものから順に、ブロックのサイズ（8 または 16 バイト）に揃えて並べる
+			const size_t alignment = image.format.blockSize();
+			Array<KTX2LevelIndex> levelIndices(mipLevels);
+			{
+				size_t offset = (dfdOffset + dfd.size());
+
+				for (size_t level = mipLevels; level--;)
+				{
+					offset = (((offset + alignment - 1) / alignment) * alignment);
+					const uint64 length = image.mipmaps[level].size();
+					levelIndices[level] = { offset, length, length };
+					offset += length;
+				}
+			}
+
+			KTX2Header header{};
+			header.vkFormat = pInfo->vkFormat;
+			header.typeSize = 1;
+			header.pixelWidth = static_cast<uint32>(image.size.x);
+			header.pixelHeight = static_cast<uint32>(image.size.y);
+			header.faceCount = 1;
+			header.levelCount = static_cast<uint32>(mipLevels);
+			header.dfdByteOffset = static_cast<uint32>(dfdOffset);
+			header.dfdByteLength = static_cast<uint32>(dfd.size());
+
+			Blob blob{ Arg::reserve = (dfdOffset + dfd.size() + image.size_bytes() + alignment * mipLevels) };
+			blob.append(KTX2Identifier, sizeof(KTX2Identifier));
+			AppendValue(blob, header);
+			blob.append(levelIndices.data(), (sizeof(KTX2LevelIndex) * mipLevels));
+			blob.append(dfd.data(), dfd.size());
+
+			for (size_t level = mipLevels; level--;)
+			{
+				AppendPadding(blob, alignment);
+				blob.append(image.mipmaps[level].data(), image.mipmaps[level].size());
+			}
+
+			return blob;
+		}
+
+		[[nodiscard]]
+		static BlockCompressedImage Load(const Blob& blob)
+		{
+			BlockCompressedImage image;
+			uint32 magic = 0;
+			bool result = false;
+
+			if (ReadValue(blob, 0, magic) && (magic == DDSMagic))
+			{
+				result = LoadDDS(blob, image);
+			}
+			else if ((sizeof(KTX2Identifier) <= blob.size()) && (std::memcmp(blob.data(), KTX2Identifier, sizeof(KTX2Identifier)) == 0))
+			{
+				result = LoadKTX2(blob, image);
+			}
+			else
+			{
+				LOG_FAIL(U"❌ BlockCompressedImage: Data is neither DDS nor KTX2");
+			}
+
+			return (result ? image : BlockCompressedImage{});
+		}
+
+		[[nodiscard]]
+		static uint64 MakeCacheKey(const Blob& source, const TextureFormat format, const HasMipMap hasMipMap)
+		{
+			struct
+			{
+				uint64 sourceHash;
+				uint32 encoderVersion;
+				uint32 format;
+				uint32 hasMipMap;
+				uint32 pad;
+			} key{ Hash::XXHash3(source.data(), source.size()), BlockCompressionEncoderVersion, FromEnum(format.value()), hasMipMap.getBool(), 0 };
+
+			return Hash::XXHash3(&key, sizeof(key));
+		}
+	}
+
+	BlockCompressedImage::BlockCompressedImage(const Image& image, const TextureFormat _format, const HasMipMap hasMipMap)
+	{
+		if ((not image) || (not _format.isBlockCompressed()))
+		{
+			return;
+		}
+
+		format = _format;
+		size = image.size();
+		mipmaps << BlockCompression::Encode(image, format);
+
+		if (hasMipMap)
+		{
+			for (const auto& mipmap : ImageProcessing::GenerateMips(image))
+			{
+				mipmaps << BlockCompression::Encode(mipmap, format);
+			}
+		}
+	}
+
+	BlockCompressedImage::BlockCompressedImage(const FilePathView path)
+		: BlockCompressedImage{ detail::Load(Blob{ path }) } {}
+
+	BlockCompressedImage::BlockCompressedImage(IReader&& reader)
+		: BlockCompressedImage{ detail::Load(Blob{ reader }) } {}
+
+	bool BlockCompressedImage::isEmpty() const noexcept
+	{
+		return mipmaps.isEmpty();
+	}
+
+	BlockCompressedImage::operator bool() const noexcept
+	{
+		return (not mipmaps.isEmpty());
+	}
+
+	int32 BlockCompressedImage::width() const noexcept
+	{
+		return size.x;
+	}
+
+	int32 BlockCompressedImage::height() const noexcept
+	{
+		return size.y;
+	}
+
+	size_t BlockCompressedImage::mipLevels() const noexcept
+	{
+		return mipmaps.size();
+	}
+
+	Size BlockCompressedImage::mipSize(const size_t level) const noexcept
+	{
+		return{ Max((size.x >> level), 1), Max((size.y >> level), 1) };
+	}
+
+	size_t BlockCompressedImage::size_bytes() const noexcept
+	{
+		size_t result = 0;
+
+		for (const auto& mipmap : mipmaps)
+		{
+			result += mipmap.size();
+		}
+
+		return result;
+	}
+
+	Image BlockCompressedImage::decode(const size_t level) const
+	{
+		if ((mipmaps.size() <= level)
+			|| (mipmaps[level].size() < CalculateDataSize(mipSize(level), format)))
+		{
+			return{};
+		}
+
+		return BlockCompression::Decode(mipmaps[level].data(), mipSize(level), format);
+	}
+
+	Blob BlockCompressedImage::encodeDDS() const
+	{
+		if (isEmpty())
+		{
+			return{};
+		}
+
+		return detail::EncodeDDS(*this);
+	}
+
+	bool BlockCompressedImage::saveDDS(const FilePathView path) const
+	{
+		if (isEmpty())
+		{
+			return false;
+		}
+
+		return encodeDDS().save(path);
+	}
+
+	Blob BlockCompressedImage::encodeKTX2() const
+	{
+		if (isEmpty())
+		{
+			return{};
+		}
+
+		return detail::EncodeKTX2(*this);
+	}
+
+	bool BlockCompressedImage::saveKTX2(const FilePathView path) const
+	{
+		if (isEmpty())
+		{
+			return false;
+		}
+
+		return encodeKTX2().save(path);
+	}
+
+	size_t BlockCompressedImage::CalculateDataSize(const Size& size, const TextureFormat format) noexcept
+	{
+		return BlockCompression::CalculateDataSize(size, format);
+	}
+
+	BlockCompressedImage BlockCompressedImage::LoadCached(const FilePathView path, const TextureFormat format, const HasMipMap hasMipMap, const FilePathView cacheDirectory)
+	{
+		if (not format.isBlockCompressed())
+		{
+			LOG_FAIL(U"BlockCompressedImage::LoadCached(): TextureFormat `{}` is not a block-compressed format"_fmt(format.name()));
+			return{};
+		}
+
+		const Blob source{ path };
+
+		if (not source)
+		{
+			LOG_FAIL(U"BlockCompressedImage::LoadCached(): Failed to load `{}`"_fmt(path));
+			return{};
+		}
+
+		const FilePath cachePath = FileSystem::PathAppend(cacheDirectory, U"{:016x}.ktx2"_fmt(detail::MakeCacheKey(source, format, hasMipMap)));
+
+		if (FileSystem::IsFile(cachePath))
+		{
+			BlockCompressedImage cached{ cachePath };
+
+			const size_t expectedMipLevels = (hasMipMap ? ImageProcessing::CalculateMipCount(cached.size.x, cached.size.y) : 1);
+
+			if (cached && (cached.format == format) && (cached.mipLevels() == expectedMipLevels))
+			{
+				LOG_TRACE(U"BlockCompressedImage::LoadCached(): Loaded `{}` from `{}`"_fmt(path, cachePath));
+				return cached;
+			}
+		}
+
+		const BlockCompressedImage image{ Image{ MemoryViewReader{ source.data(), source.size() } }, format, hasMipMap };
+
+		if (not image)
+		{
+			return{};
+		}
+
+		if (cacheDirectory && (not FileSystem::CreateDirectories(cacheDirectory)))
+		{
+			LOG_FAIL(U"BlockCompressedImage::LoadCached(): Failed to create `{}`"_fmt(cacheDirectory));
+		}
+		else if (not image.saveKTX2(cachePath))
+		{
+			LOG_FAIL(U"BlockCompressedImage::LoadCached(): Failed to save `{}`"_fmt(cachePath));
+		}
+
+		return image;
+	}
+}
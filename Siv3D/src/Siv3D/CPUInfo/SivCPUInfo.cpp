@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # include <cstring>
+# include <atomic>
 # include <Siv3D/CPUInfo.hpp>
 # include <Siv3D/Unicode.hpp>
 # include <ThirdParty/cpu_features/cpuinfo_x86.h>
@@ -18,6 +19,55 @@ namespace s3d
 {
 	namespace detail
 	{
+		[[nodiscard]]
+		static SIMDLevel DetectSIMDLevel() noexcept
+		{
+		# if defined(__aarch64__) || defined(_M_ARM64)
+
+			return SIMDLevel::NEON;
+
+		# else
+
+			const cpu_features::X86Features features = cpu_features::GetX86Info().features;
+
+			// cpu_features は OS が AVX / AVX-512 のレジスタを保存しない場合、対応する機能を無効として返す
+			if (features.avx512f && features.avx512bw && features.avx512dq && features.avx512vl)
+			{
+				return SIMDLevel::AVX512;
+			}
+			else if (features.avx2)
+			{
+				return SIMDLevel::AVX2;
+			}
+			else if (features.sse4_1)
+			{
+				return SIMDLevel::SSE4_1;
+			}
+			else if (features.sse2)
+			{
+				return SIMDLevel::SSE2;
+			}
+
+			return SIMDLevel::None;
+
+		# endif
+		}
+
+		// 他の翻訳単位の静的初期化（文字コード変換など）から呼ばれることがあるため、関数内の static 変数で初期化する
+		[[nodiscard]]
+		static SIMDLevel GetSupportedSIMDLevel() noexcept
+		{
+			static const SIMDLevel level = DetectSIMDLevel();
+			return level;
+		}
+
+		[[nodiscard]]
+		static std::atomic<SIMDLevel>& GetCurrentSIMDLevel() noexcept
+		{
+			static std::atomic<SIMDLevel> level{ GetSupportedSIMDLevel() };
+			return level;
+		}
+
 		[[nodiscard]]
 		static CPUInfo InitCPUInfo() noexcept
 		{
@@ -30,6 +80,7 @@ namespace s3d
 
 			CPUInfo result;
 			std::memcpy(&result.features, &x86Info.features, sizeof(s3d::X86Features));
+			result.simdLevel = GetSupportedSIMDLevel();
 			result.family	= x86Info.family;
 			result.model	= x86Info.model;
 			result.stepping	= x86Info.stepping;
@@ -46,4 +97,28 @@ namespace s3d
 	{
 		return g_CPUInfo;
 	}
+
+	SIMDLevel GetSIMDLevel() noexcept
+	{
+		return detail::GetCurrentSIMDLevel().load(std::memory_order_relaxed);
+	}
+
+	void SetMaxSIMDLevel(SIMDLevel level) noexcept
+	{
+		const SIMDLevel supported = detail::GetSupportedSIMDLevel();
+
+		if (supported == SIMDLevel::NEON)
+		{
+			if (level != SIMDLevel::None)
+			{
+				level = SIMDLevel::NEON;
+			}
+		}
+		else if ((level == SIMDLevel::NEON) || (supported < level))
+		{
+			level = supported;
+		}
+
+		detail::GetCurrentSIMDLevel().store(level, std::memory_order_relaxed);
+	}
 }
@@ -0,0 +1,66 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Platform.hpp>
+
+//////////////////////////////////////////////////
+//
+//	実行時 CPU ディスパッチ
+//
+//	x86-64 (Web 以外) では、SSE4.1 / AVX2 / AVX-512 の実装を関数単位のターゲット指定でコンパイルし、
+//	ライブラリ全体のビルドオプション（-msse4.1 など）とは無関係に使えるようにします。
+//	どの実装を使うかは GetSIMDLevel() の値で選びます。
+//
+//	SIV3D_TARGET_SSE4_1
+//	SIV3D_TARGET_AVX2
+//	SIV3D_TARGET_AVX512 (AVX-512 F / BW / DQ / VL)
+//
+//	- このヘッダは翻訳単位の最初でインクルードしてください。
+//	  SSE4.2 が無効なビルド (Linux) では Siv3D のヘッダが simde の別名 (_mm_loadu_epi64 など) を定義し、
+//	  その後に <immintrin.h> をインクルードすると宣言が衝突します。
+//	- MSVC はターゲット指定なしで全ての組み込み関数を使えるため、空になります。
+//	- AVX2 / AVX-512 の関数から、ターゲット指定の無い SSE の関数を呼ぶ前には
+//	  _mm256_zeroupper() を呼び、AVX-SSE 遷移のペナルティを避けてください。
+//
+//////////////////////////////////////////////////
+
+# if (defined(__x86_64__) || defined(_M_X64)) && !SIV3D_PLATFORM(WEB)
+
+	# include <immintrin.h>
+
+	# define SIV3D_CPU_DISPATCH_X64 1
+
+	# if defined(_MSC_VER) && !defined(__clang__)
+
+		# define SIV3D_TARGET_SSE4_1
+		# define SIV3D_TARGET_AVX2
+		# define SIV3D_TARGET_AVX512
+
+	# else
+
+		# define SIV3D_TARGET_SSE4_1 __attribute__((target("sse4.1")))
+		# define SIV3D_TARGET_AVX2 __attribute__((target("avx2")))
+		# define SIV3D_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl")))
+
+	# endif
+
+# else
+
+	# define SIV3D_CPU_DISPATCH_X64 0
+
+	# define SIV3D_TARGET_SSE4_1
+	# define SIV3D_TARGET_AVX2
+	# define SIV3D_TARGET_AVX512
+
+# endif
+
+# include <Siv3D/CPUInfo.hpp>
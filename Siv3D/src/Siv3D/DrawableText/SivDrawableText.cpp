@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # include <Siv3D/DrawableText.hpp>
+# include <Siv3D/ShapedText.hpp>
 # include <Siv3D/Math.hpp>
 # include <Siv3D/Char.hpp>
 # include <Siv3D/2DShapes.hpp>
@@ -24,7 +25,7 @@ namespace s3d
 		void RenderToImage(const size_t mode, const DrawableText& drawableText, Image& dst, const Vec2& pos, const Color& color)
 		{
 			const Font& font = drawableText.font;
-			const auto& clusters = drawableText.clusters;
+			const auto& clusters = drawableText.getClusters();
 			const auto& text = drawableText.text;
 
 			const double spaceWidth = font.spaceWidth();
@@ -105,12 +106,22 @@ namespace s3d
 	DrawableText::DrawableText(const Font& _font, const String& _text)
 		: font{ _font }
 		, text{ _text }
-		, clusters{ font.getGlyphClusters(text) } {}
+		, clusters{ SIV3D_ENGINE(Font)->getGlyphClusters(font.id(), text, true, Ligature::Yes) } {}
 
 	DrawableText::DrawableText(const Font& _font, String&& _text)
 		: font{ _font }
 		, text{ std::move(_text) }
-		, clusters{ font.getGlyphClusters(text) } {}
+		, clusters{ SIV3D_ENGINE(Font)->getGlyphClusters(font.id(), text, true, Ligature::Yes) } {}
+
+	DrawableText::DrawableText(const ShapedText& shapedText)
+		: DrawableText{ shapedText.drawable() } {}
+
+	const Array<GlyphCluster>& DrawableText::getClusters() const noexcept
+	{
+		static const Array<GlyphCluster> Empty;
+
+		return (clusters ? *clusters : Empty);
+	}
 
 	Array<double> DrawableText::getXAdvances() const
 	{
@@ -119,7 +130,7 @@ namespace s3d
 
 	Array<double> DrawableText::getXAdvances(const double size) const
 	{
-		return SIV3D_ENGINE(Font)->getXAdvances(font.id(), text, clusters, size);
+		return SIV3D_ENGINE(Font)->getXAdvances(font.id(), text, getClusters(), size);
 	}
 
 	RectF DrawableText::region(const double x, const double y) const
@@ -184,7 +195,7 @@ namespace s3d
 
 	RectF DrawableText::region(const double size, const Vec2 pos) const
 	{
-		return SIV3D_ENGINE(Font)->region(font.id(), text, clusters, pos, size, 1.0);
+		return SIV3D_ENGINE(Font)->region(font.id(), text, getClusters(), pos, size, 1.0);
 	}
 
 	RectF DrawableText::region(const double size, const Arg::topLeft_<Vec2> topLeft) const
@@ -268,7 +279,7 @@ namespace s3d
 
 	RectF DrawableText::regionBase(const double size, const Vec2 pos) const
 	{
-		return SIV3D_ENGINE(Font)->regionBase(font.id(), text, clusters, pos, size, 1.0);
+		return SIV3D_ENGINE(Font)->regionBase(font.id(), text, getClusters(), pos, size, 1.0);
 	}
 
 	RectF DrawableText::regionBase(const double size, const Arg::left_<Vec2> left) const
@@ -517,7 +528,7 @@ namespace s3d
 
 	RectF DrawableText::draw(const TextStyle& textStyle, const double size, const Vec2& pos, const ColorF& color) const
 	{
-		return SIV3D_ENGINE(Font)->draw(font.id(), text, clusters, pos, size, textStyle, color, 1.0);
+		return SIV3D_ENGINE(Font)->draw(font.id(), text, getClusters(), pos, size, textStyle, color, 1.0);
 	}
 
 	RectF DrawableText::draw(const TextStyle& textStyle, const double size, const Arg::topLeft_<Vec2> topLeft, const ColorF& color) const
@@ -571,7 +582,7 @@ namespace s3d
 
 	bool DrawableText::draw(const TextStyle& textStyle, const double size, const RectF& area, const ColorF& color) const
 	{
-		return SIV3D_ENGINE(Font)->draw(font.id(), text, clusters, area, size, textStyle, color, 1.0);
+		return SIV3D_ENGINE(Font)->draw(font.id(), text, getClusters(), area, size, textStyle, color, 1.0);
 	}
 
 	RectF DrawableText::drawBase(const double x, const double y, const ColorF& color) const
@@ -656,7 +667,7 @@ namespace s3d
 
 	RectF DrawableText::drawBase(const TextStyle& textStyle, const double size, const Vec2& pos, const ColorF& color) const
 	{
-		return SIV3D_ENGINE(Font)->drawBase(font.id(), text, clusters, pos, size, textStyle, color, 1.0);
+		return SIV3D_ENGINE(Font)->drawBase(font.id(), text, getClusters(), pos, size, textStyle, color, 1.0);
 	}
 
 	RectF DrawableText::drawBase(const TextStyle& textStyle, const double size, const Arg::left_<Vec2> left, const ColorF& color) const
@@ -34,5 +34,17 @@ namespace s3d
 			g_engineOptions.d3d11Driver = value;
 			return 0;
 		}
+
+		int SetEngineOption(const EngineOption::Vertex2DColor value) noexcept
+		{
+			g_engineOptions.vertex2DColor = value;
+			return 0;
+		}
+
+		int SetEngineOption(const EngineOption::Vertex2DIndex value) noexcept
+		{
+			g_engineOptions.vertex2DIndex = value;
+			return 0;
+		}
 	}
 }
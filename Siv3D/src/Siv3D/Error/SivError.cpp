@@ -71,4 +71,9 @@ namespace s3d
 	{
 		return StringView{ U"EngineError" };
 	}
+
+	StringView OperationCanceledError::type() const noexcept
+	{
+		return StringView{ U"OperationCanceledError" };
+	}
 }
@@ -258,7 +258,7 @@ namespace s3d
 		return m_fonts[handleID]->getGlyphIndex(ch);
 	}
 
-	Array<GlyphCluster> CFont::getGlyphClusters(const Font::IDType handleID, const StringView s, const bool recursive, const Ligature ligature)
+	ShapingCache::ClustersHandle CFont::getGlyphClusters(const Font::IDType handleID, const StringView s, const bool recursive, const Ligature ligature)
 	{
 		return m_fonts[handleID]->getGlyphClusters(s, recursive, ligature);
 	}
@@ -352,11 +352,33 @@ namespace s3d
 		return font->getGlyphCache().preload(*font, chars);
 	}
 
+	void CFont::preloadAsync(const Font::IDType handleID, const StringView chars)
+	{
+		const auto& font = m_fonts[handleID];
+
+		// ワーカースレッドがメインスレッドの描画と FT_Face を取り合わないよう、専用の FT_Face を用意する
+		font->createPreloadFace();
+
+		font->getGlyphCache().preloadAsync(*font, chars);
+	}
+
+	bool CFont::isPreloadReady(const Font::IDType handleID)
+	{
+		const auto& font = m_fonts[handleID];
+
+		return font->getGlyphCache().isPreloadReady(*font);
+	}
+
 	const Texture& CFont::getTexture(const Font::IDType handleID)
 	{
 		return m_fonts[handleID]->getGlyphCache().getTexture();
 	}
 
+	FontCacheStat CFont::getCacheStat(const Font::IDType handleID)
+	{
+		return m_fonts[handleID]->getCacheStat();
+	}
+
 	Glyph CFont::getGlyph(const Font::IDType handleID, const StringView ch)
 	{
 		if (not ch)
@@ -374,7 +396,8 @@ namespace s3d
 	Array<Glyph> CFont::getGlyphs(const Font::IDType handleID, const StringView s, const Ligature ligature)
 	{
 		const auto& font = m_fonts[handleID];
-		const Array<GlyphCluster> clusters = font->getGlyphClusters(s, false, ligature);
+		const auto pClusters = font->getGlyphClusters(s, false, ligature);
+		const Array<GlyphCluster>& clusters = *pClusters;
 
 		Array<Glyph> glyphs(Arg::reserve = clusters.size());
 		for (const auto& cluster : clusters)
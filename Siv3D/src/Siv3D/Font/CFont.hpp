@@ -75,7 +75,7 @@ namespace s3d
 
 		GlyphIndex getGlyphIndex(Font::IDType handleID, StringView ch) override;
 
-		Array<GlyphCluster> getGlyphClusters(Font::IDType handleID, StringView s, bool recursive, Ligature ligature) override;
+		ShapingCache::ClustersHandle getGlyphClusters(Font::IDType handleID, StringView s, bool recursive, Ligature ligature) override;
 
 		GlyphInfo getGlyphInfo(Font::IDType handleID, StringView ch) override;
 
@@ -107,8 +107,14 @@ namespace s3d
 	
 		bool preload(Font::IDType handleID, StringView chars) override;
 
+		void preloadAsync(Font::IDType handleID, StringView chars) override;
+
+		bool isPreloadReady(Font::IDType handleID) override;
+
 		const Texture& getTexture(Font::IDType handleID) override;
 
+		FontCacheStat getCacheStat(Font::IDType handleID) override;
+
 		Glyph getGlyph(Font::IDType handleID, StringView ch) override;
 
 		Array<Glyph> getGlyphs(Font::IDType handleID, StringView s, Ligature ligature) override;
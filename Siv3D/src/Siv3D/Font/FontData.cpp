@@ -85,6 +85,8 @@ namespace s3d
 
 		m_method = fontMethod;
 
+		m_faceSource = { library, FilePath{ path }, faceIndex, fontSize, style };
+
 		m_initialized = true;
 	}
 
@@ -115,6 +117,8 @@ namespace s3d
 
 	bool FontData::hasGlyph(const StringView ch)
 	{
+		std::lock_guard lock{ m_fontFaceMutex };
+
 		const HBGlyphInfo glyphInfo = m_fontFace.getHBGlyphInfo(ch, Ligature::Yes);
 
 		if (glyphInfo.count != 1)
@@ -129,6 +133,8 @@ namespace s3d
 
 	GlyphIndex FontData::getGlyphIndex(const StringView ch)
 	{
+		std::lock_guard lock{ m_fontFaceMutex };
+
 		const HBGlyphInfo glyphInfo = m_fontFace.getHBGlyphInfo(ch, Ligature::Yes);
 
 		if (glyphInfo.count != 1)
@@ -141,8 +147,30 @@ namespace s3d
 		return glyphIndex;
 	}
 
-	Array<GlyphCluster> FontData::getGlyphClusters(const StringView s, const bool recursive, const Ligature ligature) const
+	ShapingCache::ClustersHandle FontData::getGlyphClusters(const StringView s, const bool recursive, const Ligature ligature) const
+	{
+		// 破棄されたフォールバックフォントを参照する結果を返さないよう、キャッシュを使わない
+		if (recursive && m_fallbackFonts.any([](const auto& font) { return font.expired(); }))
+		{
+			return std::make_shared<const Array<GlyphCluster>>(shape(s, recursive, ligature));
+		}
+
+		if (auto clusters = m_shapingCache.find(s, recursive, ligature))
+		{
+			return clusters;
+		}
+
+		auto clusters = std::make_shared<const Array<GlyphCluster>>(shape(s, recursive, ligature));
+
+		m_shapingCache.insert(s, recursive, ligature, clusters);
+
+		return clusters;
+	}
+
+	Array<GlyphCluster> FontData::shape(const StringView s, const bool recursive, const Ligature ligature) const
 	{
+		std::lock_guard lock{ m_fontFaceMutex };
+
 		const HBGlyphInfo glyphInfo = m_fontFace.getHBGlyphInfo(s, ligature);
 
 		const size_t count = glyphInfo.count;
@@ -188,8 +216,8 @@ namespace s3d
 						continue;
 					}
 
-					const Array<GlyphCluster> clustersB = 
-						SIV3D_ENGINE(Font)->getGlyphClusters(fallbackFont.lock()->id(), s.substr(pos, fallbackStrSize), false, ligature);
+					const auto pClustersB = SIV3D_ENGINE(Font)->getGlyphClusters(fallbackFont.lock()->id(), s.substr(pos, fallbackStrSize), false, ligature);
+					const Array<GlyphCluster>& clustersB = *pClustersB;
 
 					if (clustersB.none([](const GlyphCluster& g) { return (g.glyphIndex == 0); }))
 					{
@@ -234,16 +262,22 @@ namespace s3d
 
 	GlyphInfo FontData::getGlyphInfoByGlyphIndex(const GlyphIndex glyphIndex) const
 	{
+		std::lock_guard lock{ m_fontFaceMutex };
+
 		return GetGlyphInfo(m_fontFace.getFT_Face(), glyphIndex, m_fontFace.getProperty(), m_method);
 	}
 
 	OutlineGlyph FontData::renderOutlineByGlyphIndex(const GlyphIndex glyphIndex, const CloseRing closeRing) const
 	{
+		std::lock_guard lock{ m_fontFaceMutex };
+
 		return RenderOutlineGlyph(m_fontFace.getFT_Face(), glyphIndex, closeRing, m_fontFace.getProperty());
 	}
 
 	Array<OutlineGlyph> FontData::renderOutlines(const StringView s, const CloseRing closeRing, const Ligature ligature) const
 	{
+		std::lock_guard lock{ m_fontFaceMutex };
+
 		const HBGlyphInfo glyphInfo = m_fontFace.getHBGlyphInfo(s, ligature);
 
 		Array<OutlineGlyph> results(Arg::reserve = glyphInfo.count);
@@ -260,6 +294,8 @@ namespace s3d
 
 	PolygonGlyph FontData::renderPolygonByGlyphIndex(const GlyphIndex glyphIndex) const
 	{
+		std::lock_guard lock{ m_fontFaceMutex };
+
 		const OutlineGlyph outlineGlyph = RenderOutlineGlyph(m_fontFace.getFT_Face(), glyphIndex, CloseRing::No, m_fontFace.getProperty());
 
 		PolygonGlyph polygonGlyph;
@@ -279,6 +315,8 @@ namespace s3d
 
 	Array<PolygonGlyph> FontData::renderPolygons(const StringView s, const Ligature ligature) const
 	{
+		std::lock_guard lock{ m_fontFaceMutex };
+
 		const HBGlyphInfo glyphInfo = m_fontFace.getHBGlyphInfo(s, ligature);
 
 		Array<PolygonGlyph> results(Arg::reserve = glyphInfo.count);
@@ -310,28 +348,117 @@ namespace s3d
 
 	BitmapGlyph FontData::renderBitmapByGlyphIndex(const GlyphIndex glyphIndex) const
 	{
+		std::lock_guard lock{ m_fontFaceMutex };
+
 		return RenderBitmapGlyph(m_fontFace.getFT_Face(), glyphIndex, m_fontFace.getProperty());
 	}
 
 	SDFGlyph FontData::renderSDFByGlyphIndex(const GlyphIndex glyphIndex, const int32 buffer) const
 	{
+		std::lock_guard lock{ m_fontFaceMutex };
+
 		return RenderSDFGlyph(m_fontFace.getFT_Face(), glyphIndex, buffer, m_fontFace.getProperty());
 	}
 
 	MSDFGlyph FontData::renderMSDFByGlyphIndex(const GlyphIndex glyphIndex, const int32 buffer) const
 	{
+		std::lock_guard lock{ m_fontFaceMutex };
+
 		return RenderMSDFGlyph(m_fontFace.getFT_Face(), glyphIndex, buffer, m_fontFace.getProperty());
 	}
 
+	void FontData::createPreloadFace()
+	{
+		// 実行中のプリロードのタスクが m_preloadFace を参照している可能性があるため、作成は一度だけ試みる
+		if (m_preloadFaceRequested || (not m_faceSource.library))
+		{
+			return;
+		}
+
+		m_preloadFaceRequested = true;
+
+		auto face = std::make_unique<FontFace>();
+		const auto& [library, path, faceIndex, fontSize, style] = m_faceSource;
+
+	# if SIV3D_PLATFORM(WINDOWS)
+
+		const bool loaded = (m_resource.data()
+			? face->load(library, m_resource.data(), m_resource.size(), faceIndex, fontSize, style, m_method)
+			: face->load(library, path, faceIndex, fontSize, style, m_method));
+
+	# else
+
+		const bool loaded = face->load(library, path, faceIndex, fontSize, style, m_method);
+
+	# endif
+
+		// 作成に失敗した場合、プリロードはメインスレッドと同じ FT_Face を排他して使う
+		if (not loaded)
+		{
+			LOG_FAIL(U"❌ FontData::createPreloadFace(): Failed to load `{}`"_fmt(path));
+			return;
+		}
+
+		m_preloadFace = std::move(face);
+	}
+
+	BitmapGlyph FontData::renderBitmapForPreload(const GlyphIndex glyphIndex) const
+	{
+		if (not m_preloadFace)
+		{
+			return renderBitmapByGlyphIndex(glyphIndex);
+		}
+
+		std::lock_guard lock{ m_preloadFaceMutex };
+
+		return RenderBitmapGlyph(m_preloadFace->getFT_Face(), glyphIndex, m_preloadFace->getProperty());
+	}
+
+	SDFGlyph FontData::renderSDFForPreload(const GlyphIndex glyphIndex, const int32 buffer) const
+	{
+		if (not m_preloadFace)
+		{
+			return renderSDFByGlyphIndex(glyphIndex, buffer);
+		}
+
+		std::lock_guard lock{ m_preloadFaceMutex };
+
+		return RenderSDFGlyph(m_preloadFace->getFT_Face(), glyphIndex, buffer, m_preloadFace->getProperty());
+	}
+
+	MSDFGlyph FontData::renderMSDFForPreload(const GlyphIndex glyphIndex, const int32 buffer) const
+	{
+		if (not m_preloadFace)
+		{
+			return renderMSDFByGlyphIndex(glyphIndex, buffer);
+		}
+
+		std::lock_guard lock{ m_preloadFaceMutex };
+
+		return RenderMSDFGlyph(m_preloadFace->getFT_Face(), glyphIndex, buffer, m_preloadFace->getProperty());
+	}
+
 	IGlyphCache& FontData::getGlyphCache() const
 	{
 		return *m_glyphCache;
 	}
 
+	FontCacheStat FontData::getCacheStat() const
+	{
+		FontCacheStat stat = m_glyphCache->getCacheStat();
+		stat.shapingCacheSize		= m_shapingCache.size();
+		stat.shapingCacheHitCount	= m_shapingCache.hitCount();
+		stat.shapingCacheMissCount	= m_shapingCache.missCount();
+		return stat;
+	}
+
 	bool FontData::addFallbackFont(const std::weak_ptr<AssetHandle<Font>::AssetIDWrapperType>& font)
 	{
 		m_fallbackFonts.push_back(font);
 
+		// フォールバックの結果が変わる
+		m_shapingCache.clear();
+
 		return true;
 	}
 
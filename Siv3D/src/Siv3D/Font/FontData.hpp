@@ -10,11 +10,13 @@
 //-----------------------------------------------
 
 # pragma once
+# include <mutex>
 # include <Siv3D/Common.hpp>
 # include <Siv3D/StringView.hpp>
 # include <Siv3D/Font.hpp>
 # include "FontResourceHolder.hpp"
 # include "FontFace.hpp"
+# include "ShapingCache.hpp"
 
 namespace s3d
 {
@@ -51,8 +53,9 @@ namespace s3d
 		[[nodiscard]]
 		GlyphIndex getGlyphIndex(StringView ch);
 
+		/// @remark シェーピング結果はキャッシュと共有されるため、複製せずに参照できます。
 		[[nodiscard]]
-		Array<GlyphCluster> getGlyphClusters(StringView s, bool recursive, Ligature ligature) const;
+		ShapingCache::ClustersHandle getGlyphClusters(StringView s, bool recursive, Ligature ligature) const;
 
 		[[nodiscard]]
 		GlyphInfo getGlyphInfoByGlyphIndex(GlyphIndex glyphIndex) const;
@@ -78,9 +81,28 @@ namespace s3d
 		[[nodiscard]]
 		MSDFGlyph renderMSDFByGlyphIndex(GlyphIndex glyphIndex, int32 buffer) const;
 
+		/// @brief `preloadAsync()` のワーカースレッドが使う、メインスレッドとは別の FT_Face を作成します。
+		/// @remark FT_Library を使うため、メインスレッドから呼ぶ必要があります。作成済みの場合は何もしません。
+		void createPreloadFace();
+
+		/// @remark `createPreloadFace()` で作成した FT_Face でラスタライズするため、メインスレッドの描画を待たせません。
+		[[nodiscard]]
+		BitmapGlyph renderBitmapForPreload(GlyphIndex glyphIndex) const;
+
+		/// @remark `createPreloadFace()` で作成した FT_Face でラスタライズするため、メインスレッドの描画を待たせません。
+		[[nodiscard]]
+		SDFGlyph renderSDFForPreload(GlyphIndex glyphIndex, int32 buffer) const;
+
+		/// @remark `createPreloadFace()` で作成した FT_Face でラスタライズするため、メインスレッドの描画を待たせません。
+		[[nodiscard]]
+		MSDFGlyph renderMSDFForPreload(GlyphIndex glyphIndex, int32 buffer) const;
+
 		[[nodiscard]]
 		IGlyphCache& getGlyphCache() const;
 
+		[[nodiscard]]
+		FontCacheStat getCacheStat() const;
+
 		[[nodiscard]]
 		bool addFallbackFont(const std::weak_ptr<AssetHandle<Font>::AssetIDWrapperType>& font);
 		
@@ -97,12 +119,43 @@ namespace s3d
 
 		FontFace m_fontFace;
 
+		// FT_Face と HarfBuzz のバッファへのアクセスを排他する
+		mutable std::mutex m_fontFaceMutex;
+
+		// m_preloadFace を作成するための情報
+		struct FaceSource
+		{
+			FT_Library library = nullptr;
+
+			FilePath path;
+
+			size_t faceIndex = 0;
+
+			int32 fontSize = 0;
+
+			FontStyle style = FontStyle::Default;
+		} m_faceSource;
+
+		// preloadAsync() のワーカースレッド用の FT_Face。メインスレッドの m_fontFaceMutex と競合しないよう別に持つ
+		// （m_glyphCache が実行中のプリロードの完了を待ってから破棄されるよう、m_glyphCache より前に宣言する）
+		std::unique_ptr<FontFace> m_preloadFace;
+
+		bool m_preloadFaceRequested = false;
+
+		// 複数のプリロードのタスクが同時に m_preloadFace を使わないよう排他する
+		mutable std::mutex m_preloadFaceMutex;
+
 		Array<std::weak_ptr<AssetHandle<Font>::AssetIDWrapperType>> m_fallbackFonts;
 
 		FontMethod m_method = FontMethod::Bitmap;
 
 		std::unique_ptr<IGlyphCache> m_glyphCache;
 
+		mutable ShapingCache m_shapingCache;
+
 		bool m_initialized = false;
+
+		[[nodiscard]]
+		Array<GlyphCluster> shape(StringView s, bool recursive, Ligature ligature) const;
 	};
 }
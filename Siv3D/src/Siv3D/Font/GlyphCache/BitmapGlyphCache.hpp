@@ -50,6 +50,11 @@ namespace s3d
 
 		bool preload(const FontData & font, StringView s) override;
 
+		void preloadAsync(const FontData& font, StringView s) override;
+
+		[[nodiscard]]
+		bool isPreloadReady(const FontData& font) override;
+
 		[[nodiscard]]
 		const Texture& getTexture() noexcept override;
 
@@ -59,19 +64,18 @@ namespace s3d
 		[[nodiscard]]
 		int32 getBufferThickness(GlyphIndex glyphIndex) override;
 
+		[[nodiscard]]
+		FontCacheStat getCacheStat() const override;
+
 	private:
 
 		HashTable<GlyphIndex, GlyphCache> m_glyphTable;
 
-		DynamicTexture m_texture;
-
-		bool m_hasDirty = false;
+		GlyphAtlas m_atlas;
 
-		BufferImage m_buffer = {};
+		GlyphPreloader m_preloader;
 
 		[[nodiscard]]
 		bool prerender(const FontData& font, const Array<GlyphCluster>& clusters, bool isMainFont);
-
-		void updateTexture();
 	};
 }
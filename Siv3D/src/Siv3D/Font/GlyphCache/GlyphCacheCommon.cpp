@@ -9,6 +9,10 @@
 //
 //-----------------------------------------------
 
+# include <Siv3D/Scene.hpp>
+# include <Siv3D/ScopeGuard.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/EngineLog.hpp>
 # include "GlyphCacheCommon.hpp"
 
 namespace s3d
@@ -53,58 +57,456 @@ namespace s3d
 		return true;
 	}
 
-	bool CacheGlyph(const FontData& font, const Image& image, const GlyphInfo& glyphInfo,
-		BufferImage& buffer, HashTable<GlyphIndex, GlyphCache>& glyphTable)
+	namespace detail
 	{
-		if (not buffer.image)
+		[[nodiscard]]
+		static Rect UnionRect(const Rect& a, const Rect& b) noexcept
 		{
-			const int32 fontSize = font.getProperty().fontPixelSize;
-			const int32 baseWidth =
-				fontSize <= 16 ? 512 :
-				fontSize <= 32 ? 768 :
-				fontSize <= 48 ? 1024 :
-				fontSize <= 64 ? 1536 :
-				fontSize <= 256 ? 2048 : 4096;
-			const int32 baseHeight = (fontSize <= 256 ? 256 : 512);
-			buffer.image.resize(baseWidth, baseHeight, buffer.backgroundColor);
+			if (a.isEmpty())
+			{
+				return b;
+			}
+
+			const int32 left	= Min(a.x, b.x);
+			const int32 top		= Min(a.y, b.y);
+			const int32 right	= Max((a.x + a.w), (b.x + b.w));
+			const int32 bottom	= Max((a.y + a.h), (b.y + b.h));
+			return{ left, top, (right - left), (bottom - top) };
+		}
+	}
+
+	GlyphAtlas::GlyphAtlas(const Color& backgroundColor) noexcept
+		: m_backgroundColor{ backgroundColor } {}
+
+	GlyphPreloader::~GlyphPreloader()
+	{
+		m_cancellation.cancel();
+
+		for (auto& task : m_tasks)
+		{
+			task.wait();
+		}
+	}
+
+	void GlyphPreloader::request(const Array<GlyphIndex>& glyphIndices, RenderFunction render)
+	{
+		Array<GlyphIndex> newGlyphIndices;
+		{
+			std::lock_guard lock{ m_mutex };
+
+			for (const auto glyphIndex : glyphIndices)
+			{
+				if (m_pending.insert(glyphIndex).second)
+				{
+					newGlyphIndices << glyphIndex;
+				}
+			}
+		}
+
+		// 完了したタスクを片付ける
+		m_tasks.remove_if([](const AsyncTask<void>& task) { return task.isReady(); });
+
+		if (not newGlyphIndices)
+		{
+			return;
+		}
+
+	# if SIV3D_PLATFORM(WEB) && !defined(__EMSCRIPTEN_PTHREADS__)
+
+		// ワーカースレッドが使えないため、その場でラスタライズする
+		for (const auto glyphIndex : newGlyphIndices)
+		{
+			renderGlyph(glyphIndex, render);
+		}
+
+	# else
+
+		m_tasks << Async([this, glyphIndices = std::move(newGlyphIndices), render = std::move(render), token = m_cancellation.getToken()]()
+		{
+			size_t i = 0;
+
+			// キャンセルされた場合も、残りのグリフが要求中のまま残らないようにする
+			ScopeGuard unregister = [&]()
+			{
+				std::lock_guard lock{ m_mutex };
+
+				for (; i < glyphIndices.size(); ++i)
+				{
+					m_pending.erase(glyphIndices[i]);
+				}
+			};
+
+			for (; i < glyphIndices.size(); ++i)
+			{
+				if (token.isCancellationRequested())
+				{
+					return;
+				}
+
+				renderGlyph(glyphIndices[i], render);
+			}
+		});
+
+	# endif
+	}
+
+	void GlyphPreloader::renderGlyph(const GlyphIndex glyphIndex, const RenderFunction& render)
+	{
+		Optional<RenderedGlyph> glyph;
+
+		try
+		{
+			glyph = render(glyphIndex);
+		}
+		catch (const std::exception& e)
+		{
+			LOG_FAIL(U"GlyphPreloader: failed to render a glyph ({})"_fmt(Unicode::Widen(e.what())));
+		}
+
+		std::lock_guard lock{ m_mutex };
+
+		// ラスタライズに失敗したグリフはアトラスに追加されないので、要求中の一覧から外す
+		if ((not glyph) || (glyph->info.glyphIndex != glyphIndex))
+		{
+			m_pending.erase(glyphIndex);
+			return;
 		}
 
-		buffer.penPos.x += buffer.padding;
+		m_completed << std::move(*glyph);
+		++m_completedCount;
+	}
 
-		const int32 bitmapWidth		= image.width();
-		const int32 bitmapHeight	= image.height();
+	void GlyphPreloader::flush(const FontData& font, GlyphAtlas& atlas, HashTable<GlyphIndex, GlyphCache>& glyphTable)
+	{
+		if (m_completedCount == 0)
+		{
+			return;
+		}
 
-		if (buffer.image.width() < (buffer.penPos.x + (bitmapWidth + buffer.padding)))
+		Array<RenderedGlyph> completed;
 		{
-			buffer.penPos.x = buffer.padding;
-			buffer.penPos.y += (buffer.currentMaxHeight + (buffer.padding * 2));
-			buffer.currentMaxHeight = 0;
+			std::lock_guard lock{ m_mutex };
+			completed.swap(m_completed);
+			m_completedCount = 0;
+
+			for (const auto& glyph : completed)
+			{
+				m_pending.erase(glyph.info.glyphIndex);
+			}
 		}
 
-		if (buffer.image.height() < (buffer.penPos.y + (bitmapHeight + buffer.padding)))
+		for (const auto& glyph : completed)
 		{
-			const int32 newHeight = ((buffer.penPos.y + (bitmapHeight + buffer.padding)) + 255) / 256 * 256;
+			if (glyphTable.contains(glyph.info.glyphIndex))
+			{
+				continue;
+			}
 
-			if (BufferImage::MaxImageHeight < newHeight)
+			if (not atlas.add(font, glyph.image, glyph.info, glyphTable))
+			{
+				LOG_FAIL(U"GlyphPreloader: failed to add a preloaded glyph to the atlas");
+				break;
+			}
+		}
+	}
+
+	bool GlyphPreloader::isReady() const
+	{
+		std::lock_guard lock{ m_mutex };
+		return m_pending.empty();
+	}
+
+	bool GlyphAtlas::add(const FontData& font, const Image& image, const GlyphInfo& glyphInfo, HashTable<GlyphIndex, GlyphCache>& glyphTable)
+	{
+		if (not m_pages)
+		{
+			addPage(font);
+		}
+
+		// 右と下に 1 ピクセルの余白を確保し、左上に余白を空けて書き込む
+		const Size reservedSize = (image.size() + Size{ Padding, Padding });
+
+		if ((m_pages.front().image.width() < reservedSize.x)
+			|| (MaxPageHeight < reservedSize.y))
+		{
+			return false;
+		}
+
+		for (;;)
+		{
+			for (size_t i = 0; i < m_pages.size(); ++i)
+			{
+				Page& page = m_pages[i];
+
+				if (const auto pos = insert(page, reservedSize))
+				{
+					const Point penPos = pos->movedBy(Padding, Padding);
+					image.overwrite(page.image, penPos);
+
+					page.dirtyRect = detail::UnionRect(page.dirtyRect, Rect{ penPos, image.size() });
+					page.usedArea += (static_cast<int64>(reservedSize.x) * reservedSize.y);
+					page.lastUsedFrame = Scene::FrameCount();
+
+					GlyphCache cache;
+					cache.info					= glyphInfo;
+					cache.textureRegionLeft		= static_cast<int16>(penPos.x);
+					cache.textureRegionTop		= static_cast<int16>(penPos.y);
+					cache.textureRegionWidth	= static_cast<int16>(image.width());
+					cache.textureRegionHeight	= static_cast<int16>(image.height());
+					cache.page					= static_cast<uint16>(i);
+					glyphTable.emplace(glyphInfo.glyphIndex, cache);
+
+					return true;
+				}
+			}
+
+			if (m_pages.size() < MaxPageCount)
+			{
+				addPage(font);
+			}
+			else if (not evictPage(glyphTable))
 			{
 				return false;
 			}
+		}
+	}
+
+	void GlyphAtlas::touch(const GlyphCache& cache) noexcept
+	{
+		m_pages[cache.page].lastUsedFrame = Scene::FrameCount();
+	}
+
+	bool GlyphAtlas::hasDirty() const noexcept
+	{
+		return m_pages.any([](const Page& page) { return (not page.dirtyRect.isEmpty()); });
+	}
 
-			buffer.image.resizeRows(newHeight, buffer.backgroundColor);
+	void GlyphAtlas::updateTexture()
+	{
+		for (auto& page : m_pages)
+		{
+			if (page.dirtyRect.isEmpty())
+			{
+				continue;
+			}
+
+			if (page.texture.size() == page.image.size())
+			{
+				page.texture.fillRegion(page.image, page.dirtyRect);
+			}
+			else
+			{
+				page.texture = DynamicTexture{ page.image };
+			}
+
+			page.dirtyRect = Rect::Empty();
+		}
+	}
+
+	const Texture& GlyphAtlas::getTexture() const noexcept
+	{
+		if (not m_pages)
+		{
+			return m_emptyTexture;
+		}
+
+		return m_pages.front().texture;
+	}
+
+	TextureRegion GlyphAtlas::getTextureRegion(const GlyphCache& cache) const
+	{
+		return m_pages[cache.page].texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+	}
+
+	FontCacheStat GlyphAtlas::getStat(const size_t glyphCount) const noexcept
+	{
+		int64 usedArea = 0;
+		int64 pageArea = 0;
+
+		for (const auto& page : m_pages)
+		{
+			usedArea += page.usedArea;
+			pageArea += page.image.num_pixels();
+		}
+
+		return{
+			.glyphCount			= glyphCount,
+			.pageCount			= m_pages.size(),
+			.maxPageCount		= MaxPageCount,
+			.occupancy			= (pageArea ? (static_cast<double>(usedArea) / pageArea) : 0.0),
+			.evictedGlyphCount	= m_evictedGlyphCount,
+			.evictedPageCount	= m_evictedPageCount,
+		};
+	}
+
+	Optional<Point> GlyphAtlas::insert(Page& page, const Size& size)
+	{
+		Array<SkylineNode>& skyline = page.skyline;
+		const int32 pageWidth = page.image.width();
+
+		// Bottom-Left: 配置後の下端が最も小さく、同じ場合は幅の狭いノードを選ぶ
+		size_t bestIndex = skyline.size();
+		int32 bestY = 0;
+		int32 bestBottom = (MaxPageHeight + 1);
+		int32 bestWidth = 0;
+
+		for (size_t i = 0; i < skyline.size(); ++i)
+		{
+			if (pageWidth < (skyline[i].x + size.x))
+			{
+				break;
+			}
+
+			int32 y = 0;
+			int32 remaining = size.x;
+
+			for (size_t k = i; 0 < remaining; ++k)
+			{
+				y = Max(y, skyline[k].y);
+				remaining -= skyline[k].width;
+			}
+
+			const int32 bottom = (y + size.y);
+
+			if ((bottom < bestBottom)
+				|| ((bottom == bestBottom) && (skyline[i].width < bestWidth)))
+			{
+				bestIndex	= i;
+				bestY		= y;
+				bestBottom	= bottom;
+				bestWidth	= skyline[i].width;
+			}
+		}
+
+		if (bestIndex == skyline.size())
+		{
+			return none;
+		}
+
+		if (page.image.height() < bestBottom)
+		{
+			const int32 newHeight = Min(((bestBottom + 255) / 256 * 256), MaxPageHeight);
+			page.image.resizeRows(newHeight, m_backgroundColor);
+
+			// テクスチャのサイズが変わるため作り直す
+			page.dirtyRect = Rect{ page.image.size() };
+		}
+
+		const Point pos{ skyline[bestIndex].x, bestY };
+		skyline.insert((skyline.begin() + bestIndex), SkylineNode{ pos.x, bestBottom, size.x });
+
+		// 新しいノードに覆われた部分を後続のノードから取り除く
+		for (size_t i = (bestIndex + 1); i < skyline.size();)
+		{
+			const int32 previousRight = (skyline[i - 1].x + skyline[i - 1].width);
+			SkylineNode& node = skyline[i];
+
+			if (previousRight <= node.x)
+			{
+				break;
+			}
+
+			const int32 shrink = (previousRight - node.x);
+
+			if (node.width <= shrink)
+			{
+				skyline.erase(skyline.begin() + i);
+				continue;
+			}
+
+			node.x += shrink;
+			node.width -= shrink;
+			break;
+		}
+
+		// 同じ高さの隣接ノードを統合する
+		for (size_t i = 0; (i + 1) < skyline.size();)
+		{
+			if (skyline[i].y == skyline[i + 1].y)
+			{
+				skyline[i].width += skyline[i + 1].width;
+				skyline.erase(skyline.begin() + (i + 1));
+			}
+			else
+			{
+				++i;
+			}
+		}
+
+		return pos;
+	}
+
+	void GlyphAtlas::addPage(const FontData& font)
+	{
+		const int32 fontSize = font.getProperty().fontPixelSize;
+		const int32 baseWidth =
+			fontSize <= 16 ? 512 :
+			fontSize <= 32 ? 768 :
+			fontSize <= 48 ? 1024 :
+			fontSize <= 64 ? 1536 :
+			fontSize <= 256 ? 2048 : 4096;
+		const int32 baseHeight = (fontSize <= 256 ? 256 : 512);
+
+		Page page;
+		page.image.resize(baseWidth, baseHeight, m_backgroundColor);
+		page.skyline << SkylineNode{ 0, 0, baseWidth };
+		page.dirtyRect = Rect{ page.image.size() };
+		page.lastUsedFrame = Scene::FrameCount();
+
+		m_pages << std::move(page);
+	}
+
+	bool GlyphAtlas::evictPage(HashTable<GlyphIndex, GlyphCache>& glyphTable)
+	{
+		const int32 frameCount = Scene::FrameCount();
+		size_t target = m_pages.size();
+
+		for (size_t i = 0; i < m_pages.size(); ++i)
+		{
+			// 現在のフレームで使われたグリフは描画中の可能性がある
+			if (m_pages[i].lastUsedFrame == frameCount)
+			{
+				continue;
+			}
+
+			if ((target == m_pages.size())
+				|| (m_pages[i].lastUsedFrame < m_pages[target].lastUsedFrame))
+			{
+				target = i;
+			}
+		}
+
+		if (target == m_pages.size())
+		{
+			return false;
+		}
+
+		size_t evictedGlyphCount = 0;
+
+		for (auto it = glyphTable.begin(); it != glyphTable.end();)
+		{
+			if (it->second.page == target)
+			{
+				it = glyphTable.erase(it);
+				++evictedGlyphCount;
+			}
+			else
+			{
+				++it;
+			}
 		}
 
-		image.overwrite(buffer.image, buffer.penPos);
+		Page& page = m_pages[target];
+		page.image.fill(m_backgroundColor);
+		page.skyline = { SkylineNode{ 0, 0, page.image.width() } };
+		page.dirtyRect = Rect{ page.image.size() };
+		page.lastUsedFrame = frameCount;
+		page.usedArea = 0;
 
-		GlyphCache cache;
-		cache.info					= glyphInfo;
-		cache.textureRegionLeft		= static_cast<int16>(buffer.penPos.x);
-		cache.textureRegionTop		= static_cast<int16>(buffer.penPos.y);
-		cache.textureRegionWidth	= static_cast<int16>(bitmapWidth);
-		cache.textureRegionHeight	= static_cast<int16>(bitmapHeight);
-		glyphTable.emplace(glyphInfo.glyphIndex, cache);
+		m_evictedGlyphCount += evictedGlyphCount;
+		++m_evictedPageCount;
 
-		buffer.currentMaxHeight = Max(buffer.currentMaxHeight, bitmapHeight);
-		buffer.penPos.x += (bitmapWidth + buffer.padding);
+		LOG_TRACE(U"GlyphAtlas: evicted page {} ({} glyphs)"_fmt(target, evictedGlyphCount));
 
 		return true;
 	}
@@ -10,11 +10,21 @@
 //-----------------------------------------------
 
 # pragma once
+# include <mutex>
+# include <atomic>
+# include <functional>
 # include <Siv3D/Common.hpp>
 # include <Siv3D/GlyphInfo.hpp>
 # include <Siv3D/Image.hpp>
 # include <Siv3D/HashTable.hpp>
+# include <Siv3D/HashSet.hpp>
+# include <Siv3D/AsyncTask.hpp>
+# include <Siv3D/CancellationToken.hpp>
 # include <Siv3D/Char.hpp>
+# include <Siv3D/Optional.hpp>
+# include <Siv3D/TextureRegion.hpp>
+# include <Siv3D/DynamicTexture.hpp>
+# include <Siv3D/FontCacheStat.hpp>
 # include "../FontData.hpp"
 
 namespace s3d
@@ -30,23 +40,155 @@ namespace s3d
 		int16 textureRegionWidth = 0;
 
 		int16 textureRegionHeight = 0;
+
+		/// @brief グリフが格納されているアトラスのページ
+		uint16 page = 0;
+	};
+
+	/// @brief グリフを詰め込む複数ページのアトラステクスチャ
+	/// @remark 各ページはスカイライン法で詰め込みます。すべてのページが埋まると、
+	/// 最も長く使われていないページを丸ごと追い出して再利用します（現在のフレームで使われたページは追い出しません）。
+	class GlyphAtlas
+	{
+	public:
+
+		static constexpr int32 MaxPageHeight = 4096;
+
+		static constexpr size_t MaxPageCount = 4;
+
+		GlyphAtlas() = default;
+
+		/// @param backgroundColor ページの背景色
+		explicit GlyphAtlas(const Color& backgroundColor) noexcept;
+
+		/// @brief グリフの画像をアトラスに追加し、`glyphTable` に登録します。
+		/// @remark ページを追い出した場合、そのページのグリフは `glyphTable` から削除されます。
+		/// @return 成功した場合 true, 追い出せるページが無い場合は false
+		[[nodiscard]]
+		bool add(const FontData& font, const Image& image, const GlyphInfo& glyphInfo, HashTable<GlyphIndex, GlyphCache>& glyphTable);
+
+		/// @brief グリフが現在のフレームで使われたことを記録します。
+		void touch(const GlyphCache& cache) noexcept;
+
+		[[nodiscard]]
+		bool hasDirty() const noexcept;
+
+		/// @brief 変更された領域をテクスチャに転送します。
+		void updateTexture();
+
+		/// @brief 最初のページのテクスチャを返します。
+		[[nodiscard]]
+		const Texture& getTexture() const noexcept;
+
+		[[nodiscard]]
+		TextureRegion getTextureRegion(const GlyphCache& cache) const;
+
+		[[nodiscard]]
+		FontCacheStat getStat(size_t glyphCount) const noexcept;
+
+	private:
+
+		struct SkylineNode
+		{
+			int32 x = 0;
+
+			int32 y = 0;
+
+			int32 width = 0;
+		};
+
+		struct Page
+		{
+			Image image;
+
+			DynamicTexture texture;
+
+			Array<SkylineNode> skyline;
+
+			/// @brief テクスチャに未転送の領域
+			Rect dirtyRect = Rect::Empty();
+
+			int32 lastUsedFrame = 0;
+
+			int64 usedArea = 0;
+		};
+
+		static constexpr int32 Padding = 1;
+
+		Color m_backgroundColor{ 255, 0 };
+
+		Array<Page> m_pages;
+
+		Texture m_emptyTexture;
+
+		uint64 m_evictedGlyphCount = 0;
+
+		uint64 m_evictedPageCount = 0;
+
+		[[nodiscard]]
+		Optional<Point> insert(Page& page, const Size& size);
+
+		void addPage(const FontData& font);
+
+		[[nodiscard]]
+		bool evictPage(HashTable<GlyphIndex, GlyphCache>& glyphTable);
 	};
 
-	struct BufferImage
+	/// @brief ワーカースレッドでグリフをラスタライズし、結果をメインスレッドでアトラスに追加するための受け渡し
+	class GlyphPreloader
 	{
-		static constexpr int32 MaxImageHeight = 4096;
+	public:
+
+		struct RenderedGlyph
+		{
+			GlyphInfo info;
+
+			Image image;
+		};
 
-		Image image;
+		/// @brief グリフをラスタライズする関数。ワーカースレッドで呼ばれます。
+		using RenderFunction = std::function<RenderedGlyph(GlyphIndex)>;
 
-		Color backgroundColor{ 255, 0 };
+		GlyphPreloader() = default;
 
-		int32 bufferWidth = 2;
+		GlyphPreloader(const GlyphPreloader&) = delete;
 
-		int32 padding = 1;
+		GlyphPreloader& operator =(const GlyphPreloader&) = delete;
 
-		Point penPos = { 0, padding };
+		/// @brief 実行中のラスタライズをキャンセルし、完了を待ちます。
+		~GlyphPreloader();
 
-		int32 currentMaxHeight = 0;
+		/// @brief グリフのラスタライズをワーカースレッドで開始します。
+		/// @param glyphIndices ラスタライズするグリフ。既に要求済みのものは無視されます。
+		/// @param render グリフをラスタライズする関数
+		void request(const Array<GlyphIndex>& glyphIndices, RenderFunction render);
+
+		/// @brief ラスタライズが完了したグリフをアトラスに追加します。メインスレッドから呼ぶ必要があります。
+		/// @remark 既に `glyphTable` にあるグリフは破棄されます。
+		void flush(const FontData& font, GlyphAtlas& atlas, HashTable<GlyphIndex, GlyphCache>& glyphTable);
+
+		/// @brief 要求されたすべてのグリフがアトラスに追加されたかを返します。
+		/// @return すべてのグリフが追加された場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isReady() const;
+
+	private:
+
+		mutable std::mutex m_mutex;
+
+		/// @brief 要求されてからアトラスに追加されるまでのグリフ
+		HashSet<GlyphIndex> m_pending;
+
+		Array<RenderedGlyph> m_completed;
+
+		std::atomic<size_t> m_completedCount = 0;
+
+		Array<AsyncTask<void>> m_tasks;
+
+		CancellationTokenSource m_cancellation;
+
+		// グリフをラスタライズして m_completed に追加する。失敗した場合は m_pending から外す
+		void renderGlyph(GlyphIndex glyphIndex, const RenderFunction& render);
 	};
 
 	[[nodiscard]]
@@ -54,8 +196,4 @@ namespace s3d
 
 	[[nodiscard]]
 	bool ProcessControlCharacter(char32 ch, Vec2& penPos, int32& line, const Vec2& basePos, double scale, double lineHeightScale, const FontFaceProperty& prop);
-
-	[[nodiscard]]
-	bool CacheGlyph(const FontData& font, const Image& image, const GlyphInfo& glyphInfo,
-		BufferImage& buffer, HashTable<GlyphIndex, GlyphCache>& glyphTable);
 }
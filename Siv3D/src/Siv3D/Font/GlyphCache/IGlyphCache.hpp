@@ -14,6 +14,7 @@
 # include <Siv3D/2DShapes.hpp>
 # include <Siv3D/Texture.hpp>
 # include <Siv3D/Font.hpp>
+# include <Siv3D/FontCacheStat.hpp>
 # include "../FontData.hpp"
 
 namespace s3d
@@ -48,6 +49,11 @@ namespace s3d
 
 		virtual bool preload(const FontData& font, StringView s) = 0;
 
+		virtual void preloadAsync(const FontData& font, StringView s) = 0;
+
+		[[nodiscard]]
+		virtual bool isPreloadReady(const FontData& font) = 0;
+
 		[[nodiscard]]
 		virtual const Texture& getTexture() noexcept = 0;
 
@@ -56,5 +62,8 @@ namespace s3d
 
 		[[nodiscard]]
 		virtual int32 getBufferThickness(GlyphIndex glyphIndex) = 0;
+
+		[[nodiscard]]
+		virtual FontCacheStat getCacheStat() const = 0;
 	};
 }
@@ -50,6 +50,11 @@ namespace s3d
 
 		bool preload(const FontData & font, StringView s) override;
 
+		void preloadAsync(const FontData& font, StringView s) override;
+
+		[[nodiscard]]
+		bool isPreloadReady(const FontData& font) override;
+
 		[[nodiscard]]
 		const Texture& getTexture() noexcept override;
 
@@ -59,21 +64,22 @@ namespace s3d
 		[[nodiscard]]
 		int32 getBufferThickness(GlyphIndex glyphIndex) override;
 
+		[[nodiscard]]
+		FontCacheStat getCacheStat() const override;
+
 	private:
 
 		static constexpr int32 DefaultBuffer = 2;
 
 		HashTable<GlyphIndex, GlyphCache> m_glyphTable;
 
-		DynamicTexture m_texture;
+		GlyphAtlas m_atlas{ Color{ 0, 0 } };
 
-		bool m_hasDirty = false;
+		int32 m_bufferWidth = DefaultBuffer;
 
-		BufferImage m_buffer = { .image = {}, .backgroundColor = Color{ 0, 0 } };
+		GlyphPreloader m_preloader;
 
 		[[nodiscard]]
 		bool prerender(const FontData& font, const Array<GlyphCluster>& clusters, bool isMainFont);
-
-		void updateTexture();
 	};
 }
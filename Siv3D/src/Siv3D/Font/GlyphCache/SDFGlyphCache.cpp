@@ -24,7 +24,7 @@ namespace s3d
 		{
 			return RectF::Empty();
 		}
-		updateTexture();
+		m_atlas.updateTexture();
 
 		const auto& prop = font.getProperty();
 		const double scale = (size / prop.fontPixelSize);
@@ -65,7 +65,7 @@ namespace s3d
 
 			const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
 			{
-				const TextureRegion textureRegion = m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+				const TextureRegion textureRegion = m_atlas.getTextureRegion(cache);
 				const Vec2 posOffset = usebasePos ? cache.info.getBase(scale) : cache.info.getOffset(scale);
 				const Vec2 drawPos = (penPos + posOffset);
 
@@ -98,12 +98,13 @@ namespace s3d
 		}
 
 		// 「.」のグリフ
-		const Array<GlyphCluster> dotGlyphCluster = font.getGlyphClusters(U".", false, Ligature::Yes);
+		const auto pDotGlyphCluster = font.getGlyphClusters(U".", false, Ligature::Yes);
+		const Array<GlyphCluster>& dotGlyphCluster = *pDotGlyphCluster;
 		if (not prerender(font, dotGlyphCluster, true))
 		{
 			// do tnohing
 		}
-		updateTexture();
+		m_atlas.updateTexture();
 
 		const double dotXAdvance = m_glyphTable.find(dotGlyphCluster[0].glyphIndex)->second.info.xAdvance;
 		const Vec2 areaBottomRight = area.br();
@@ -255,7 +256,7 @@ namespace s3d
 			{
 				const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
 				{
-					const TextureRegion textureRegion = m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+					const TextureRegion textureRegion = m_atlas.getTextureRegion(cache);
 					const Vec2 posOffset = cache.info.getOffset(scale);
 					const Vec2 drawPos = (newPenPositions[i] + posOffset);
 
@@ -283,7 +284,7 @@ namespace s3d
 		{
 			return RectF::Empty();
 		}
-		updateTexture();
+		m_atlas.updateTexture();
 
 		const auto& prop = font.getProperty();
 		const double scale = (size / prop.fontPixelSize);
@@ -296,7 +297,7 @@ namespace s3d
 		{
 			const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
 			{
-				const TextureRegion textureRegion = m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+				const TextureRegion textureRegion = m_atlas.getTextureRegion(cache);
 				const Vec2 posOffset = usebasePos ? cache.info.getBase(scale) : cache.info.getOffset(scale);
 				const Vec2 drawPos = (penPos + posOffset);
 				RectF rect;
@@ -471,24 +472,51 @@ namespace s3d
 
 	void SDFGlyphCache::setBufferWidth(const int32 width)
 	{
-		m_buffer.bufferWidth = Max(width, 0);
+		m_bufferWidth = Max(width, 0);
 	}
 
 	int32 SDFGlyphCache::getBufferWidth() const noexcept
 	{
-		return m_buffer.bufferWidth;
+		return m_bufferWidth;
 	}
 
 	bool SDFGlyphCache::preload(const FontData& font, const StringView s)
 	{
-		return prerender(font, font.getGlyphClusters(s, false, Ligature::Yes), true);
+		return prerender(font, *font.getGlyphClusters(s, false, Ligature::Yes), true);
+	}
+
+	void SDFGlyphCache::preloadAsync(const FontData& font, const StringView s)
+	{
+		Array<GlyphIndex> glyphIndices;
+		const auto clusters = font.getGlyphClusters(s, false, Ligature::Yes);
+
+		for (const auto& cluster : *clusters)
+		{
+			if (not m_glyphTable.contains(cluster.glyphIndex))
+			{
+				glyphIndices << cluster.glyphIndex;
+			}
+		}
+
+		m_preloader.request(glyphIndices, [&font, bufferWidth = m_bufferWidth](const GlyphIndex glyphIndex)
+		{
+			SDFGlyph glyph = font.renderSDFForPreload(glyphIndex, bufferWidth);
+			return GlyphPreloader::RenderedGlyph{ glyph, std::move(glyph.image) };
+		});
+	}
+
+	bool SDFGlyphCache::isPreloadReady(const FontData& font)
+	{
+		m_preloader.flush(font, m_atlas, m_glyphTable);
+
+		return m_preloader.isReady();
 	}
 
 	const Texture& SDFGlyphCache::getTexture() noexcept
 	{
-		updateTexture();
+		m_atlas.updateTexture();
 
-		return m_texture;
+		return m_atlas.getTexture();
 	}
 
 	TextureRegion SDFGlyphCache::getTextureRegion(const FontData& font, const GlyphIndex glyphIndex)
@@ -497,10 +525,10 @@ namespace s3d
 		{
 			return{};
 		}
-		updateTexture();
+		m_atlas.updateTexture();
 
 		const auto& cache = m_glyphTable.find(glyphIndex)->second;
-		return m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+		return m_atlas.getTextureRegion(cache);
 	}
 
 	int32 SDFGlyphCache::getBufferThickness(const GlyphIndex glyphIndex)
@@ -516,16 +544,16 @@ namespace s3d
 
 	bool SDFGlyphCache::prerender(const FontData& font, const Array<GlyphCluster>& clusters, const bool isMainFont)
 	{
+		m_preloader.flush(font, m_atlas, m_glyphTable);
+
 		if (m_glyphTable.empty())
 		{
-			const SDFGlyph glyph = font.renderSDFByGlyphIndex(0, m_buffer.bufferWidth);
+			const SDFGlyph glyph = font.renderSDFByGlyphIndex(0, m_bufferWidth);
 
-			if (not CacheGlyph(font, glyph.image, glyph, m_buffer, m_glyphTable))
+			if (not m_atlas.add(font, glyph.image, glyph, m_glyphTable))
 			{
 				return false;
 			}
-
-			m_hasDirty = true;
 		}
 
 		for (const auto& cluster : clusters)
@@ -535,51 +563,37 @@ namespace s3d
 				continue;
 			}
 
-			if (m_glyphTable.contains(cluster.glyphIndex))
+			if (const auto it = m_glyphTable.find(cluster.glyphIndex);
+				it != m_glyphTable.end())
 			{
+				m_atlas.touch(it->second);
 				continue;
 			}
 
-			const SDFGlyph glyph = font.renderSDFByGlyphIndex(cluster.glyphIndex, m_buffer.bufferWidth);
+			const SDFGlyph glyph = font.renderSDFByGlyphIndex(cluster.glyphIndex, m_bufferWidth);
 
 			if (m_glyphTable.contains(glyph.glyphIndex))
 			{
 				continue;
 			}
 
-			if (not CacheGlyph(font, glyph.image, glyph, m_buffer, m_glyphTable))
+			if (not m_atlas.add(font, glyph.image, glyph, m_glyphTable))
 			{
 				return false;
 			}
-
-			m_hasDirty = true;
 		}
 
 		// texture content can be updated in a different thread
 		if (System::GetRendererType() == EngineOption::Renderer::Direct3D11)
 		{
-			updateTexture();
+			m_atlas.updateTexture();
 		}
 
 		return true;
 	}
 
-	void SDFGlyphCache::updateTexture()
+	FontCacheStat SDFGlyphCache::getCacheStat() const
 	{
-		if (not m_hasDirty)
-		{
-			return;
-		}
-
-		if (m_texture.size() == m_buffer.image.size())
-		{
-			m_texture.fill(m_buffer.image);
-		}
-		else
-		{
-			m_texture = DynamicTexture{ m_buffer.image };
-		}
-
-		m_hasDirty = false;
+		return m_atlas.getStat(m_glyphTable.size());
 	}
 }
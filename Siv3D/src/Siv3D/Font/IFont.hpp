@@ -15,6 +15,7 @@
 # include <Siv3D/TextStyle.hpp>
 # include <Siv3D/Icon.hpp>
 # include "FontFaceProperty.hpp"
+# include "ShapingCache.hpp"
 
 namespace s3d
 {
@@ -52,7 +53,7 @@ namespace s3d
 
 		virtual GlyphIndex getGlyphIndex(Font::IDType handleID, StringView ch) = 0;
 
-		virtual Array<GlyphCluster> getGlyphClusters(Font::IDType handleID, StringView s, bool recursive, Ligature ligature) = 0;
+		virtual ShapingCache::ClustersHandle getGlyphClusters(Font::IDType handleID, StringView s, bool recursive, Ligature ligature) = 0;
 
 		virtual GlyphInfo getGlyphInfo(Font::IDType handleID, StringView ch) = 0;
 
@@ -84,8 +85,14 @@ namespace s3d
 
 		virtual bool preload(Font::IDType handleID, StringView chars) = 0;
 
+		virtual void preloadAsync(Font::IDType handleID, StringView chars) = 0;
+
+		virtual bool isPreloadReady(Font::IDType handleID) = 0;
+
 		virtual const Texture& getTexture(Font::IDType handleID) = 0;
 
+		virtual FontCacheStat getCacheStat(Font::IDType handleID) = 0;
+
 		virtual Glyph getGlyph(Font::IDType handleID, StringView ch) = 0;
 
 		virtual Array<Glyph> getGlyphs(Font::IDType handleID, StringView s, Ligature ligature) = 0;
@@ -0,0 +1,117 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Hash.hpp>
+# include "ShapingCache.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		[[nodiscard]]
+		static constexpr uint8 MakeOptions(const bool recursive, const Ligature ligature) noexcept
+		{
+			return static_cast<uint8>((recursive ? 0b01 : 0) | (ligature.getBool() ? 0b10 : 0));
+		}
+
+		[[nodiscard]]
+		static uint64 MakeKey(const StringView s, const uint8 options) noexcept
+		{
+			return (Hash::XXHash3(s.data(), s.size_bytes()) ^ options);
+		}
+	}
+
+	ShapingCache::ClustersHandle ShapingCache::find(const StringView s, const bool recursive, const Ligature ligature)
+	{
+		const uint8 options = detail::MakeOptions(recursive, ligature);
+		const uint64 key = detail::MakeKey(s, options);
+
+		std::lock_guard lock{ m_mutex };
+
+		if (auto it = m_current.find(key);
+			(it != m_current.end()) && (it->second.options == options) && (it->second.text == s))
+		{
+			++m_hitCount;
+			return it->second.clusters;
+		}
+
+		if (auto it = m_previous.find(key);
+			(it != m_previous.end()) && (it->second.options == options) && (it->second.text == s))
+		{
+			++m_hitCount;
+
+			Entry entry = std::move(it->second);
+			m_previous.erase(it);
+
+			if (GenerationCapacity <= m_current.size())
+			{
+				m_previous = std::move(m_current);
+				m_current.clear();
+			}
+
+			return m_current.insert_or_assign(key, std::move(entry)).first->second.clusters;
+		}
+
+		++m_missCount;
+		return nullptr;
+	}
+
+	void ShapingCache::insert(const StringView s, const bool recursive, const Ligature ligature, ClustersHandle clusters)
+	{
+		if ((MaxTextLength < s.size())
+			|| (not clusters))
+		{
+			return;
+		}
+
+		const uint8 options = detail::MakeOptions(recursive, ligature);
+		const uint64 key = detail::MakeKey(s, options);
+
+		std::lock_guard lock{ m_mutex };
+
+		if (GenerationCapacity <= m_current.size())
+		{
+			m_previous = std::move(m_current);
+			m_current.clear();
+		}
+
+		m_current.insert_or_assign(key, Entry{ String{ s }, options, std::move(clusters) });
+	}
+
+	void ShapingCache::clear()
+	{
+		std::lock_guard lock{ m_mutex };
+
+		m_current.clear();
+		m_previous.clear();
+	}
+
+	size_t ShapingCache::size() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return (m_current.size() + m_previous.size());
+	}
+
+	uint64 ShapingCache::hitCount() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_hitCount;
+	}
+
+	uint64 ShapingCache::missCount() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_missCount;
+	}
+}
@@ -0,0 +1,80 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <mutex>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/String.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/HashTable.hpp>
+# include <Siv3D/GlyphCluster.hpp>
+# include <Siv3D/PredefinedYesNo.hpp>
+
+namespace s3d
+{
+	/// @brief フォントごとのシェーピング結果のキャッシュ
+	/// @remark 2 世代のハッシュテーブルで LRU を近似します。現世代が上限に達すると旧世代を破棄し、
+	/// 旧世代でヒットしたエントリは現世代に昇格します。
+	/// @remark 複数のスレッドから同時に呼び出すことができます。
+	class ShapingCache
+	{
+	public:
+
+		/// @brief 共有されるシェーピング結果
+		using ClustersHandle = std::shared_ptr<const Array<GlyphCluster>>;
+
+		/// @brief 1 世代あたりのエントリ数の上限
+		static constexpr size_t GenerationCapacity = 256;
+
+		/// @brief キャッシュするテキストの最大の長さ
+		static constexpr size_t MaxTextLength = 1024;
+
+		/// @brief キャッシュされたシェーピング結果を探します。
+		/// @return 見つかった場合はシェーピング結果、それ以外の場合は nullptr
+		/// @remark 返されたシェーピング結果は、キャッシュから破棄された後も有効です。
+		[[nodiscard]]
+		ClustersHandle find(StringView s, bool recursive, Ligature ligature);
+
+		void insert(StringView s, bool recursive, Ligature ligature, ClustersHandle clusters);
+
+		void clear();
+
+		[[nodiscard]]
+		size_t size() const;
+
+		[[nodiscard]]
+		uint64 hitCount() const;
+
+		[[nodiscard]]
+		uint64 missCount() const;
+
+	private:
+
+		struct Entry
+		{
+			String text;
+
+			uint8 options = 0;
+
+			ClustersHandle clusters;
+		};
+
+		mutable std::mutex m_mutex;
+
+		HashTable<uint64, Entry> m_current;
+
+		HashTable<uint64, Entry> m_previous;
+
+		uint64 m_hitCount = 0;
+
+		uint64 m_missCount = 0;
+	};
+}
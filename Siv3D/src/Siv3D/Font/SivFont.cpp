@@ -262,7 +262,7 @@ namespace s3d
 
 	Array<GlyphCluster> Font::getGlyphClusters(const StringView s, const UseFallback useFallback, const Ligature ligature) const
 	{
-		return SIV3D_ENGINE(Font)->getGlyphClusters(m_handle->id(), s, useFallback.getBool(), ligature);
+		return *SIV3D_ENGINE(Font)->getGlyphClusters(m_handle->id(), s, useFallback.getBool(), ligature);
 	}
 
 	GlyphInfo Font::getGlyphInfo(const char32 ch) const
@@ -398,11 +398,26 @@ namespace s3d
 		return SIV3D_ENGINE(Font)->preload(m_handle->id(), chars);
 	}
 
+	void Font::preloadAsync(const StringView chars) const
+	{
+		SIV3D_ENGINE(Font)->preloadAsync(m_handle->id(), chars);
+	}
+
+	bool Font::isPreloadReady() const
+	{
+		return SIV3D_ENGINE(Font)->isPreloadReady(m_handle->id());
+	}
+
 	const Texture& Font::getTexture() const
 	{
 		return SIV3D_ENGINE(Font)->getTexture(m_handle->id());
 	}
 
+	FontCacheStat Font::getCacheStat() const
+	{
+		return SIV3D_ENGINE(Font)->getCacheStat(m_handle->id());
+	}
+
 	Glyph Font::getGlyph(const char32 ch) const
 	{
 		return SIV3D_ENGINE(Font)->getGlyph(m_handle->id(), StringView(&ch, 1));
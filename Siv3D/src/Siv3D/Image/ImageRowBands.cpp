@@ -0,0 +1,91 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ImageProcessing.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/Utility.hpp>
+# include "ImageRowBands.hpp"
+
+namespace s3d
+{
+	namespace ImageRowBands
+	{
+		namespace
+		{
+			// これより小さい画像は分割のオーバーヘッドのほうが大きい
+			constexpr int64 MinPixelsToSplit = (256 * 256);
+
+			// 帯の最小の高さ
+			constexpr int32 MinBandHeight = 16;
+		}
+
+		[[nodiscard]]
+		static size_t GetNumBands(const int32 width, const int32 height, const int32 radius)
+		{
+			if (not ImageProcessing::IsMultiThreadingEnabled())
+			{
+				return 1;
+			}
+
+			if ((static_cast<int64>(width) * height) < MinPixelsToSplit)
+			{
+				return 1;
+			}
+
+			// 余白の行の処理が帯の本体より多くならないようにする
+			const int32 minBandHeight = Max(MinBandHeight, (radius * 2));
+
+			return Clamp<size_t>(static_cast<size_t>(height / minBandHeight), 1, Threading::GetConcurrency());
+		}
+
+		void Apply(const cv::Mat& src, cv::Mat& dst, const int32 radius, const FilterFunction& filter)
+		{
+			const int32 height = src.rows;
+			const size_t numBands = GetNumBands(src.cols, height, radius);
+
+			if (numBands <= 1)
+			{
+				filter(src, dst);
+				return;
+			}
+
+			// 入力と出力が同じ場合は、ほかの帯の処理結果を読まないよう入力を複製する
+			const cv::Mat input = ((src.data == dst.data) ? src.clone() : src);
+
+			const auto applyBand = [&](const size_t i)
+			{
+				const int32 y0 = static_cast<int32>((height * i) / numBands);
+				const int32 y1 = static_cast<int32>((height * (i + 1)) / numBands);
+
+				const int32 s0 = Max((y0 - radius), 0);
+				const int32 s1 = Min((y1 + radius), height);
+
+				// 部分行列のままだと、OpenCV が範囲外の画素を参照したり別の実装を選んだりすることがあるため、独立した画像にする
+				const cv::Mat srcBand = input.rowRange(s0, s1).clone();
+				cv::Mat dstBand;
+
+				filter(srcBand, dstBand);
+
+				dstBand.rowRange((y0 - s0), (y1 - s0)).copyTo(dst.rowRange(y0, y1));
+			};
+
+			// 帯ごとの filter の中の OpenCV の処理は、入れ子の並列処理になるため OpenCV がそのスレッドで逐次実行する
+			// （プロセス全体の cv::setNumThreads() を変えないので、ほかのスレッドの OpenCV の処理には影響しない）
+			cv::parallel_for_(cv::Range{ 0, static_cast<int32>(numBands) }, [&](const cv::Range& range)
+			{
+				for (int32 i = range.start; i < range.end; ++i)
+				{
+					applyBand(static_cast<size_t>(i));
+				}
+			}, static_cast<double>(numBands));
+		}
+	}
+}
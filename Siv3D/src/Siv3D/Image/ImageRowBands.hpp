@@ -0,0 +1,34 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <functional>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/OpenCV_Bridge.hpp>
+
+namespace s3d
+{
+	/// @brief 近傍を参照するフィルタ処理を、行単位の帯に分割して複数のスレッドで実行する
+	namespace ImageRowBands
+	{
+		using FilterFunction = std::function<void(const cv::Mat& src, cv::Mat& dst)>;
+
+		/// @brief `src` にフィルタを適用し、結果を `dst` に書き込みます。
+		/// @param src 入力画像
+		/// @param dst 出力画像。`src` と同じサイズで確保されている必要があります。`src` と同じでもかまいません
+		/// @param radius フィルタが上下に参照する行数
+		/// @param filter フィルタ処理
+		/// @remark マルチスレッド実行が有効で画像が十分に大きい場合、画像を行単位の帯に分割して `cv::parallel_for_` で処理します。
+		/// @remark 帯ごとの `filter` の中の OpenCV の処理は、入れ子の並列処理として OpenCV がそのスレッドで逐次実行するため、スレッド数は CPU のコア数を超えません。
+		/// @remark 各帯は上下に `radius` 行の余白を付けた独立した画像として `filter` に渡されるため、結果は画像全体に `filter` を適用した場合と一致します。
+		void Apply(const cv::Mat& src, cv::Mat& dst, int32 radius, const FilterFunction& filter);
+	}
+}
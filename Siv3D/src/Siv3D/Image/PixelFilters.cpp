@@ -0,0 +1,842 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Common/CPUDispatch.hpp>
+# include <Siv3D/Utility.hpp>
+# include <Siv3D/SIMD.hpp>
+# include "PixelFilters.hpp"
+
+// SSE4.1 の実装は、x86-64 ではビルドオプションに関係なく関数単位のターゲット指定で、Web では SIMD.hpp 経由で使う
+# if SIV3D_INTRINSIC(SSE) || SIV3D_CPU_DISPATCH_X64
+#	define SIV3D_PIXEL_FILTERS_SSE4_1 1
+# else
+#	define SIV3D_PIXEL_FILTERS_SSE4_1 0
+# endif
+
+namespace s3d
+{
+	namespace PixelFilters
+	{
+		namespace
+		{
+			enum class Kernel : uint8
+			{
+				Reference,
+
+				SSE4_1,
+
+				AVX2,
+
+				AVX512,
+			};
+
+			[[nodiscard]]
+			Kernel SelectKernel() noexcept
+			{
+				switch (GetSIMDLevel())
+				{
+			# if SIV3D_CPU_DISPATCH_X64
+				case SIMDLevel::AVX512:
+					return Kernel::AVX512;
+				case SIMDLevel::AVX2:
+					return Kernel::AVX2;
+			# endif
+			# if SIV3D_PIXEL_FILTERS_SSE4_1
+				case SIMDLevel::SSE4_1:
+					return Kernel::SSE4_1;
+			# endif
+				default:
+					return Kernel::Reference;
+				}
+			}
+
+			// Color::grayscale0_255() と同じ係数
+			constexpr double GrayscaleWeights[3] = { 0.299, 0.587, 0.114 };
+
+			// セピア調の変換係数（R, G, B の各出力に対する重み）
+			constexpr double SepiaWeights[3][3] =
+			{
+				{ 0.393, 0.769, 0.189 },
+				{ 0.349, 0.686, 0.168 },
+				{ 0.272, 0.534, 0.131 },
+			};
+
+			constexpr uint32 RGBMask = 0x00FFFFFF;
+
+			constexpr uint32 AlphaMask = 0xFF000000;
+
+			[[nodiscard]]
+			inline uint32* AsUintPtr(Color* p) noexcept
+			{
+				return static_cast<uint32*>(static_cast<void*>(p));
+			}
+
+			[[nodiscard]]
+			inline uint8 Weighted(const Color& color, const double(&w)[3]) noexcept
+			{
+				return static_cast<uint8>(Min(((w[0] * color.r) + (w[1] * color.g) + (w[2] * color.b)), 255.0));
+			}
+
+			////////////////////////////////////////////////////////////////
+			//
+			//	Reference
+			//
+			////////////////////////////////////////////////////////////////
+
+			void Negate_Reference(Color* pixels, const size_t count) noexcept
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					pixels[i] = ~pixels[i];
+				}
+			}
+
+			void Grayscale_Reference(Color* pixels, const size_t count) noexcept
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					Color& pixel = pixels[i];
+					const uint8 gray = pixel.grayscale0_255();
+					pixel.r = gray;
+					pixel.g = gray;
+					pixel.b = gray;
+				}
+			}
+
+			void Sepia_Reference(Color* pixels, const size_t count) noexcept
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					Color& pixel = pixels[i];
+					const uint8 r = Weighted(pixel, SepiaWeights[0]);
+					const uint8 g = Weighted(pixel, SepiaWeights[1]);
+					const uint8 b = Weighted(pixel, SepiaWeights[2]);
+					pixel.r = r;
+					pixel.g = g;
+					pixel.b = b;
+				}
+			}
+
+			void Brighten_Reference(Color* pixels, const size_t count, const int32 level) noexcept
+			{
+				if (level < 0)
+				{
+					for (size_t i = 0; i < count; ++i)
+					{
+						Color& pixel = pixels[i];
+						pixel.r = static_cast<uint8>(Max(static_cast<int32>(pixel.r) + level, 0));
+						pixel.g = static_cast<uint8>(Max(static_cast<int32>(pixel.g) + level, 0));
+						pixel.b = static_cast<uint8>(Max(static_cast<int32>(pixel.b) + level, 0));
+					}
+				}
+				else if (level > 0)
+				{
+					for (size_t i = 0; i < count; ++i)
+					{
+						Color& pixel = pixels[i];
+						pixel.r = static_cast<uint8>(Min(static_cast<int32>(pixel.r) + level, 255));
+						pixel.g = static_cast<uint8>(Min(static_cast<int32>(pixel.g) + level, 255));
+						pixel.b = static_cast<uint8>(Min(static_cast<int32>(pixel.b) + level, 255));
+					}
+				}
+			}
+
+			void SwapRB_Reference(Color* pixels, const size_t count) noexcept
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					Color& pixel = pixels[i];
+					const uint8 t = pixel.r;
+					pixel.r = pixel.b;
+					pixel.b = t;
+				}
+			}
+
+			void CopyRToA_Reference(const Color* src, Color* dst, const size_t count) noexcept
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					dst[i].a = src[i].r;
+				}
+			}
+
+			void BGRToRGBA_Reference(const uint8* src, Color* dst, const size_t count) noexcept
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					dst[i] = Color{ src[i * 3 + 2], src[i * 3 + 1], src[i * 3 + 0], 255 };
+				}
+			}
+
+			////////////////////////////////////////////////////////////////
+			//
+			//	SSE4.1
+			//
+			////////////////////////////////////////////////////////////////
+
+		# if SIV3D_PIXEL_FILTERS_SSE4_1
+
+			// 4 ピクセルの RGB の加重和を、参照実装と同じ順序の倍精度演算で求めて切り捨てる
+			[[nodiscard]]
+			inline __m128i Weighted_SSE4_1(const __m128i r, const __m128i g, const __m128i b, const double(&w)[3]) noexcept
+			{
+				const __m128d wr = _mm_set1_pd(w[0]);
+				const __m128d wg = _mm_set1_pd(w[1]);
+				const __m128d wb = _mm_set1_pd(w[2]);
+				const __m128d c255 = _mm_set1_pd(255.0);
+
+				const __m128d lo = _mm_min_pd(_mm_add_pd(_mm_add_pd(
+					_mm_mul_pd(wr, _mm_cvtepi32_pd(r)),
+					_mm_mul_pd(wg, _mm_cvtepi32_pd(g))),
+					_mm_mul_pd(wb, _mm_cvtepi32_pd(b))), c255);
+
+				const __m128d hi = _mm_min_pd(_mm_add_pd(_mm_add_pd(
+					_mm_mul_pd(wr, _mm_cvtepi32_pd(_mm_unpackhi_epi64(r, r))),
+					_mm_mul_pd(wg, _mm_cvtepi32_pd(_mm_unpackhi_epi64(g, g)))),
+					_mm_mul_pd(wb, _mm_cvtepi32_pd(_mm_unpackhi_epi64(b, b)))), c255);
+
+				return _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi));
+			}
+
+			SIV3D_TARGET_SSE4_1
+			void Negate_SSE4_1(Color* pixels, const size_t count) noexcept
+			{
+				const __m128i mask = _mm_set1_epi32(RGBMask);
+				const size_t blocks = (count / 4);
+
+				for (size_t i = 0; i < blocks; ++i)
+				{
+					__m128i* p = reinterpret_cast<__m128i*>(pixels + (i * 4));
+					_mm_storeu_si128(p, _mm_xor_si128(_mm_loadu_si128(p), mask));
+				}
+
+				Negate_Reference((pixels + (blocks * 4)), (count % 4));
+			}
+
+			SIV3D_TARGET_SSE4_1
+			void Grayscale_SSE4_1(Color* pixels, const size_t count) noexcept
+			{
+				const __m128i channelMask = _mm_set1_epi32(0xFF);
+				const __m128i alphaMask = _mm_set1_epi32(AlphaMask);
+				const __m128i broadcast = _mm_set1_epi32(0x010101);
+				const size_t blocks = (count / 4);
+
+				for (size_t i = 0; i < blocks; ++i)
+				{
+					__m128i* p = reinterpret_cast<__m128i*>(pixels + (i * 4));
+					const __m128i px = _mm_loadu_si128(p);
+					const __m128i r = _mm_and_si128(px, channelMask);
+					const __m128i g = _mm_and_si128(_mm_srli_epi32(px, 8), channelMask);
+					const __m128i b = _mm_and_si128(_mm_srli_epi32(px, 16), channelMask);
+
+					const __m128i gray = Weighted_SSE4_1(r, g, b, GrayscaleWeights);
+
+					_mm_storeu_si128(p, _mm_or_si128(_mm_and_si128(px, alphaMask), _mm_mullo_epi32(gray, broadcast))); // SSE4.1
+				}
+
+				Grayscale_Reference((pixels + (blocks * 4)), (count % 4));
+			}
+
+			SIV3D_TARGET_SSE4_1
+			void Sepia_SSE4_1(Color* pixels, const size_t count) noexcept
+			{
+				const __m128i channelMask = _mm_set1_epi32(0xFF);
+				const __m128i alphaMask = _mm_set1_epi32(AlphaMask);
+				const size_t blocks = (count / 4);
+
+				for (size_t i = 0; i < blocks; ++i)
+				{
+					__m128i* p = reinterpret_cast<__m128i*>(pixels + (i * 4));
+					const __m128i px = _mm_loadu_si128(p);
+					const __m128i r = _mm_and_si128(px, channelMask);
+					const __m128i g = _mm_and_si128(_mm_srli_epi32(px, 8), channelMask);
+					const __m128i b = _mm_and_si128(_mm_srli_epi32(px, 16), channelMask);
+
+					const __m128i tr = Weighted_SSE4_1(r, g, b, SepiaWeights[0]);
+					const __m128i tg = Weighted_SSE4_1(r, g, b, SepiaWeights[1]);
+					const __m128i tb = Weighted_SSE4_1(r, g, b, SepiaWeights[2]);
+
+					const __m128i rgb = _mm_or_si128(_mm_or_si128(tr, _mm_slli_epi32(tg, 8)), _mm_slli_epi32(tb, 16));
+
+					_mm_storeu_si128(p, _mm_or_si128(_mm_and_si128(px, alphaMask), rgb));
+				}
+
+				Sepia_Reference((pixels + (blocks * 4)), (count % 4));
+			}
+
+			SIV3D_TARGET_SSE4_1
+			void Brighten_SSE4_1(Color* pixels, const size_t count, const int32 level) noexcept
+			{
+				if (level == 0)
+				{
+					return;
+				}
+
+				const int32 clamped = Clamp(level, -255, 255);
+				const uint32 amount = static_cast<uint32>((clamped < 0) ? -clamped : clamped);
+				const __m128i delta = _mm_set1_epi32(static_cast<int32>(amount * 0x010101));
+				const size_t blocks = (count / 4);
+
+				for (size_t i = 0; i < blocks; ++i)
+				{
+					__m128i* p = reinterpret_cast<__m128i*>(pixels + (i * 4));
+					const __m128i px = _mm_loadu_si128(p);
+
+					// A 成分の delta は 0 なので変化しない
+					_mm_storeu_si128(p, ((level < 0) ? _mm_subs_epu8(px, delta) : _mm_adds_epu8(px, delta)));
+				}
+
+				Brighten_Reference((pixels + (blocks * 4)), (count % 4), level);
+			}
+
+			SIV3D_TARGET_SSE4_1
+			void SwapRB_SSE4_1(Color* pixels, const size_t count) noexcept
+			{
+				const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+				const size_t blocks = (count / 4);
+
+				for (size_t i = 0; i < blocks; ++i)
+				{
+					__m128i* p = reinterpret_cast<__m128i*>(pixels + (i * 4));
+					_mm_storeu_si128(p, _mm_shuffle_epi8(_mm_loadu_si128(p), shuffle)); // SSSE3
+				}
+
+				SwapRB_Reference((pixels + (blocks * 4)), (count % 4));
+			}
+
+			SIV3D_TARGET_SSE4_1
+			void CopyRToA_SSE4_1(const Color* src, Color* dst, const size_t count) noexcept
+			{
+				const __m128i rgbMask = _mm_set1_epi32(RGBMask);
+				const size_t blocks = (count / 4);
+
+				for (size_t i = 0; i < blocks; ++i)
+				{
+					const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (i * 4)));
+					__m128i* d = reinterpret_cast<__m128i*>(dst + (i * 4));
+					_mm_storeu_si128(d, _mm_or_si128(_mm_and_si128(_mm_loadu_si128(d), rgbMask), _mm_slli_epi32(s, 24)));
+				}
+
+				CopyRToA_Reference((src + (blocks * 4)), (dst + (blocks * 4)), (count % 4));
+			}
+
+			SIV3D_TARGET_SSE4_1
+			void BGRToRGBA_SSE4_1(const uint8* src, Color* dst, const size_t count) noexcept
+			{
+				// 16 ピクセル (48 バイト) を 3 回で読み込み、4 ピクセルずつに並べ直す（入力の範囲外は読まない）
+				const __m128i shuffle = _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+				const __m128i alpha = _mm_set1_epi32(AlphaMask);
+				const size_t blocks = (count / 16);
+
+				for (size_t i = 0; i < blocks; ++i)
+				{
+					const __m128i* s = reinterpret_cast<const __m128i*>(src + (i * 48));
+					__m128i* d = reinterpret_cast<__m128i*>(dst + (i * 16));
+
+					const __m128i a = _mm_loadu_si128(s + 0);
+					const __m128i b = _mm_loadu_si128(s + 1);
+					const __m128i c = _mm_loadu_si128(s + 2);
+
+					_mm_storeu_si128((d + 0), _mm_or_si128(_mm_shuffle_epi8(a, shuffle), alpha)); // SSSE3
+					_mm_storeu_si128((d + 1), _mm_or_si128(_mm_shuffle_epi8(_mm_alignr_epi8(b, a, 12), shuffle), alpha));
+					_mm_storeu_si128((d + 2), _mm_or_si128(_mm_shuffle_epi8(_mm_alignr_epi8(c, b, 8), shuffle), alpha));
+					_mm_storeu_si128((d + 3), _mm_or_si128(_mm_shuffle_epi8(_mm_srli_si128(c, 4), shuffle), alpha));
+				}
+
+				BGRToRGBA_Reference((src + (blocks * 48)), (dst + (blocks * 16)), (count % 16));
+			}
+
+		# endif
+
+			////////////////////////////////////////////////////////////////
+			//
+			//	AVX2
+			//
+			////////////////////////////////////////////////////////////////
+
+		# if SIV3D_CPU_DISPATCH_X64
+
+			// 8 ピクセルの RGB の加重和を、参照実装と同じ順序の倍精度演算で求めて切り捨てる
+			// FMA を使うと丸め結果が変わるため、乗算と加算は分けて行う
+			[[nodiscard]]
+			SIV3D_TARGET_AVX2
+			inline __m256i Weighted_AVX2(const __m256i r, const __m256i g, const __m256i b, const double(&w)[3]) noexcept
+			{
+				const __m256d wr = _mm256_set1_pd(w[0]);
+				const __m256d wg = _mm256_set1_pd(w[1]);
+				const __m256d wb = _mm256_set1_pd(w[2]);
+				const __m256d c255 = _mm256_set1_pd(255.0);
+
+				const __m256d lo = _mm256_min_pd(_mm256_add_pd(_mm256_add_pd(
+					_mm256_mul_pd(wr, _mm256_cvtepi32_pd(_mm256_castsi256_si128(r))),
+					_mm256_mul_pd(wg, _mm256_cvtepi32_pd(_mm256_castsi256_si128(g)))),
+					_mm256_mul_pd(wb, _mm256_cvtepi32_pd(_mm256_castsi256_si128(b)))), c255);
+
+				const __m256d hi = _mm256_min_pd(_mm256_add_pd(_mm256_add_pd(
+					_mm256_mul_pd(wr, _mm256_cvtepi32_pd(_mm256_extracti128_si256(r, 1))),
+					_mm256_mul_pd(wg, _mm256_cvtepi32_pd(_mm256_extracti128_si256(g, 1)))),
+					_mm256_mul_pd(wb, _mm256_cvtepi32_pd(_mm256_extracti128_si256(b, 1)))), c255);
+
+				return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvttpd_epi32(lo)), _mm256_cvttpd_epi32(hi), 1);
+			}
+
+			SIV3D_TARGET_AVX2
+			void Negate_AVX2(Color* pixels, const size_t count) noexcept
+			{
+				const __m256i mask = _mm256_set1_epi32(RGBMask);
+				const size_t blocks = (count / 8);
+
+				for (size_t i = 0; i < blocks; ++i)
+				{
+					__m256i* p = reinterpret_cast<__m256i*>(pixels + (i * 8));
+					_mm256_storeu_si256(p, _mm256_xor_si256(_mm256_loadu_si256(p), mask));
+				}
+
+				Negate_Reference((pixels + (blocks * 8)), (count % 8));
+			}
+
+			SIV3D_TARGET_AVX2
+			void Grayscale_AVX2(Color* pixels, const size_t count) noexcept
+			{
+				const __m256i channelMask = _mm256_set1_epi32(0xFF);
+				const __m256i alphaMask = _mm256_set1_epi32(AlphaMask);
+				const __m256i broadcast = _mm256_set1_epi32(0x010101);
+				const size_t blocks = (count / 8);
+
+				for (size_t i = 0; i < blocks; ++i)
+				{
+					__m256i* p = reinterpret_cast<__m256i*>(pixels + (i * 8));
+					const __m256i px = _mm256_loadu_si256(p);
+					const __m256i r = _mm256_and_si256(px, channelMask);
+					const __m256i g = _mm256_and_si256(_mm256_srli_epi32(px, 8), channelMask);
+					const __m256i b = _mm256_and_si256(_mm256_srli_epi32(px, 16), channelMask);
+
+					const __m256i gray = Weighted_AVX2(r, g, b, GrayscaleWeights);
+
+					_mm256_storeu_si256(p, _mm256_or_si256(_mm256_and_si256(px, alphaMask), _mm256_mullo_epi32(gray, broadcast)));
+				}
+
+				Grayscale_Reference((pixels + (blocks * 8)), (count % 8));
+			}
+
+			SIV3D_TARGET_AVX2
+			void Sepia_AVX2(Color* pixels, const size_t count) noexcept
+			{
+				const __m256i channelMask = _mm256_set1_epi32(0xFF);
+				const __m256i alphaMask = _mm256_set1_epi32(AlphaMask);
+				const size_t blocks = (count / 8);
+
+				for (size_t i = 0; i < blocks; ++i)
+				{
+					__m256i* p = reinterpret_cast<__m256i*>(pixels + (i * 8));
+					const __m256i px = _mm256_loadu_si256(p);
+					const __m256i r = _mm256_and_si256(px, channelMask);
+					const __m256i g = _mm256_and_si256(_mm256_srli_epi32(px, 8), channelMask);
+					const __m256i b = _mm256_and_si256(_mm256_srli_epi32(px, 16), channelMask);
+
+					const __m256i tr = Weighted_AVX2(r, g, b, SepiaWeights[0]);
+					const __m256i tg = Weighted_AVX2(r, g, b, SepiaWeights[1]);
+					const __m256i tb = Weighted_AVX2(r, g, b, SepiaWeights[2]);
+
+					const __m256i rgb = _mm256_or_si256(_mm256_or_si256(tr, _mm256_slli_epi32(tg, 8)), _mm256_slli_epi32(tb, 16));
+
+					_mm256_storeu_si256(p, _mm256_or_si256(_mm256_and_si256(px, alphaMask), rgb));
+				}
+
+				Sepia_Reference((pixels + (blocks * 8)), (count % 8));
+			}
+
+			SIV3D_TARGET_AVX2
+			void Brighten_AVX2(Color* pixels, const size_t count, const int32 level) noexcept
+			{
+				if (level == 0)
+				{
+					return;
+				}
+
+				const int32 clamped = Clamp(level, -255, 255);
+				const uint32 amount = static_cast<uint32>((clamped < 0) ? -clamped : clamped);
+				const __m256i delta = _mm256_set1_epi32(static_cast<int32>(amount * 0x010101));
+				const size_t blocks = (count / 8);
+
+				for (size_t i = 0; i < blocks; ++i)
+				{
+					__m256i* p = reinterpret_cast<__m256i*>(pixels + (i * 8));
+					const __m256i px = _mm256_loadu_si256(p);
+
+					_mm256_storeu_si256(p, ((level < 0) ? _mm256_subs_epu8(px, delta) : _mm256_adds_epu8(px, delta)));
+				}
+
+				Brighten_Reference((pixels + (blocks * 8)), (count % 8), level);
+			}
+
+			SIV3D_TARGET_AVX2
+			void SwapRB_AVX2(Color* pixels, const size_t count) noexcept
+			{
+				const __m256i shuffle = _mm256_setr_epi8(
+					2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+					2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+				const size_t blocks = (count / 8);
+
+				for (size_t i = 0; i < blocks; ++i)
+				{
+					__m256i* p = reinterpret_cast<__m256i*>(pixels + (i * 8));
+					_mm256_storeu_si256(p, _mm256_shuffle_epi8(_mm256_loadu_si256(p), shuffle));
+				}
+
+				SwapRB_Reference((pixels + (blocks * 8)), (count % 8));
+			}
+
+			SIV3D_TARGET_AVX2
+			void CopyRToA_AVX2(const Color* src, Color* dst, const size_t count) noexcept
+			{
+				const __m256i rgbMask = _mm256_set1_epi32(RGBMask);
+				const size_t blocks = (count / 8);
+
+				for (size_t i = 0; i < blocks; ++i)
+				{
+					const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + (i * 8)));
+					__m256i* d = reinterpret_cast<__m256i*>(dst + (i * 8));
+					_mm256_storeu_si256(d, _mm256_or_si256(_mm256_and_si256(_mm256_loadu_si256(d), rgbMask), _mm256_slli_epi32(s, 24)));
+				}
+
+				CopyRToA_Reference((src + (blocks * 8)), (dst + (blocks * 8)), (count % 8));
+			}
+
+		# endif
+
+		# if SIV3D_CPU_DISPATCH_X64
+
+			////////////////////////////////////////////////////////////////
+			//
+			//	AVX-512
+			//
+			//	端数はマスク付きのロード・ストアで処理する
+			//
+			////////////////////////////////////////////////////////////////
+
+			[[nodiscard]]
+			SIV3D_TARGET_AVX512
+			inline __mmask16 TailMask_AVX512(const size_t count) noexcept
+			{
+				return static_cast<__mmask16>((1u << count) - 1);
+			}
+
+			// 16 ピクセルの RGB の加重和を、参照実装と同じ順序の倍精度演算で求めて切り捨てる
+			// AVX-512 は FMA を含むため、通常の乗算・加算ではコンパイラが FMA に融合して丸め結果が変わることがある。
+			// 丸めモードを明示した演算はそのまま出力されるので、それを使う
+			[[nodiscard]]
+			SIV3D_TARGET_AVX512
+			inline __m512d MulAdd3_AVX512(const __m512d a0, const __m512d b0, const __m512d a1, const __m512d b1, const __m512d a2, const __m512d b2) noexcept
+			{
+				constexpr int Rounding = (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+				return _mm512_add_round_pd(_mm512_add_round_pd(
+					_mm512_mul_round_pd(a0, b0, Rounding),
+					_mm512_mul_round_pd(a1, b1, Rounding), Rounding),
+					_mm512_mul_round_pd(a2, b2, Rounding), Rounding);
+			}
+
+			[[nodiscard]]
+			SIV3D_TARGET_AVX512
+			inline __m512i Weighted_AVX512(const __m512i r, const __m512i g, const __m512i b, const double(&w)[3]) noexcept
+			{
+				const __m512d wr = _mm512_set1_pd(w[0]);
+				const __m512d wg = _mm512_set1_pd(w[1]);
+				const __m512d wb = _mm512_set1_pd(w[2]);
+				const __m512d c255 = _mm512_set1_pd(255.0);
+
+				const __m512d lo = _mm512_min_pd(MulAdd3_AVX512(
+					wr, _mm512_cvtepi32_pd(_mm512_castsi512_si256(r)),
+					wg, _mm512_cvtepi32_pd(_mm512_castsi512_si256(g)),
+					wb, _mm512_cvtepi32_pd(_mm512_castsi512_si256(b))), c255);
+
+				const __m512d hi = _mm512_min_pd(MulAdd3_AVX512(
+					wr, _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(r, 1)),
+					wg, _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(g, 1)),
+					wb, _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(b, 1))), c255);
+
+				return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvttpd_epi32(lo)), _mm512_cvttpd_epi32(hi), 1);
+			}
+
+			// 16 ピクセルずつ `f` を適用する。端数はマスクで処理する
+			template <class Fty>
+			SIV3D_TARGET_AVX512
+			inline void ForEach16_AVX512(Color* pixels, const size_t count, Fty f) noexcept
+			{
+				const size_t blocks = (count / 16);
+
+				for (size_t i = 0; i < blocks; ++i)
+				{
+					void* p = (pixels + (i * 16));
+					_mm512_storeu_si512(p, f(_mm512_loadu_si512(p)));
+				}
+
+				if (const size_t rest = (count % 16))
+				{
+					void* p = (pixels + (blocks * 16));
+					const __mmask16 mask = TailMask_AVX512(rest);
+					_mm512_mask_storeu_epi32(p, mask, f(_mm512_maskz_loadu_epi32(mask, p)));
+				}
+			}
+
+			SIV3D_TARGET_AVX512
+			void Negate_AVX512(Color* pixels, const size_t count) noexcept
+			{
+				const __m512i mask = _mm512_set1_epi32(RGBMask);
+
+				ForEach16_AVX512(pixels, count, [=](const __m512i px) SIV3D_TARGET_AVX512 { return _mm512_xor_si512(px, mask); });
+			}
+
+			SIV3D_TARGET_AVX512
+			void Grayscale_AVX512(Color* pixels, const size_t count) noexcept
+			{
+				const __m512i channelMask = _mm512_set1_epi32(0xFF);
+				const __m512i alphaMask = _mm512_set1_epi32(AlphaMask);
+				const __m512i broadcast = _mm512_set1_epi32(0x010101);
+
+				ForEach16_AVX512(pixels, count, [=](const __m512i px) SIV3D_TARGET_AVX512
+				{
+					const __m512i r = _mm512_and_si512(px, channelMask);
+					const __m512i g = _mm512_and_si512(_mm512_srli_epi32(px, 8), channelMask);
+					const __m512i b = _mm512_and_si512(_mm512_srli_epi32(px, 16), channelMask);
+
+					const __m512i gray = Weighted_AVX512(r, g, b, GrayscaleWeights);
+
+					return _mm512_or_si512(_mm512_and_si512(px, alphaMask), _mm512_mullo_epi32(gray, broadcast));
+				});
+			}
+
+			SIV3D_TARGET_AVX512
+			void Sepia_AVX512(Color* pixels, const size_t count) noexcept
+			{
+				const __m512i channelMask = _mm512_set1_epi32(0xFF);
+				const __m512i alphaMask = _mm512_set1_epi32(AlphaMask);
+
+				ForEach16_AVX512(pixels, count, [=](const __m512i px) SIV3D_TARGET_AVX512
+				{
+					const __m512i r = _mm512_and_si512(px, channelMask);
+					const __m512i g = _mm512_and_si512(_mm512_srli_epi32(px, 8), channelMask);
+					const __m512i b = _mm512_and_si512(_mm512_srli_epi32(px, 16), channelMask);
+
+					const __m512i tr = Weighted_AVX512(r, g, b, SepiaWeights[0]);
+					const __m512i tg = Weighted_AVX512(r, g, b, SepiaWeights[1]);
+					const __m512i tb = Weighted_AVX512(r, g, b, SepiaWeights[2]);
+
+					const __m512i rgb = _mm512_or_si512(_mm512_or_si512(tr, _mm512_slli_epi32(tg, 8)), _mm512_slli_epi32(tb, 16));
+
+					return _mm512_or_si512(_mm512_and_si512(px, alphaMask), rgb);
+				});
+			}
+
+			SIV3D_TARGET_AVX512
+			void Brighten_AVX512(Color* pixels, const size_t count, const int32 level) noexcept
+			{
+				if (level == 0)
+				{
+					return;
+				}
+
+				const int32 clamped = Clamp(level, -255, 255);
+				const uint32 amount = static_cast<uint32>((clamped < 0) ? -clamped : clamped);
+				const __m512i delta = _mm512_set1_epi32(static_cast<int32>(amount * 0x010101));
+
+				if (level < 0)
+				{
+					ForEach16_AVX512(pixels, count, [=](const __m512i px) SIV3D_TARGET_AVX512 { return _mm512_subs_epu8(px, delta); });
+				}
+				else
+				{
+					ForEach16_AVX512(pixels, count, [=](const __m512i px) SIV3D_TARGET_AVX512 { return _mm512_adds_epu8(px, delta); });
+				}
+			}
+
+			SIV3D_TARGET_AVX512
+			void SwapRB_AVX512(Color* pixels, const size_t count) noexcept
+			{
+				const __m512i shuffle = _mm512_broadcast_i32x4(_mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15));
+
+				ForEach16_AVX512(pixels, count, [=](const __m512i px) SIV3D_TARGET_AVX512 { return _mm512_shuffle_epi8(px, shuffle); });
+			}
+
+			SIV3D_TARGET_AVX512
+			void CopyRToA_AVX512(const Color* src, Color* dst, const size_t count) noexcept
+			{
+				const __m512i rgbMask = _mm512_set1_epi32(RGBMask);
+				const size_t blocks = (count / 16);
+
+				for (size_t i = 0; i < blocks; ++i)
+				{
+					const __m512i s = _mm512_loadu_si512(src + (i * 16));
+					void* d = (dst + (i * 16));
+					_mm512_storeu_si512(d, _mm512_or_si512(_mm512_and_si512(_mm512_loadu_si512(d), rgbMask), _mm512_slli_epi32(s, 24)));
+				}
+
+				if (const size_t rest = (count % 16))
+				{
+					const __mmask16 mask = TailMask_AVX512(rest);
+					const __m512i s = _mm512_maskz_loadu_epi32(mask, (src + (blocks * 16)));
+					void* d = (dst + (blocks * 16));
+					_mm512_mask_storeu_epi32(d, mask, _mm512_or_si512(_mm512_and_si512(_mm512_maskz_loadu_epi32(mask, d), rgbMask), _mm512_slli_epi32(s, 24)));
+				}
+			}
+
+		# endif
+		}
+
+		void Negate(Color* pixels, const size_t count) noexcept
+		{
+			switch (SelectKernel())
+			{
+		# if SIV3D_CPU_DISPATCH_X64
+			case Kernel::AVX512:
+				return Negate_AVX512(pixels, count);
+			case Kernel::AVX2:
+				return Negate_AVX2(pixels, count);
+		# endif
+		# if SIV3D_PIXEL_FILTERS_SSE4_1
+			case Kernel::SSE4_1:
+				return Negate_SSE4_1(pixels, count);
+		# endif
+			default:
+				return Negate_Reference(pixels, count);
+			}
+		}
+
+		void Grayscale(Color* pixels, const size_t count) noexcept
+		{
+			switch (SelectKernel())
+			{
+		# if SIV3D_CPU_DISPATCH_X64
+			case Kernel::AVX512:
+				return Grayscale_AVX512(pixels, count);
+			case Kernel::AVX2:
+				return Grayscale_AVX2(pixels, count);
+		# endif
+		# if SIV3D_PIXEL_FILTERS_SSE4_1
+			case Kernel::SSE4_1:
+				return Grayscale_SSE4_1(pixels, count);
+		# endif
+			default:
+				return Grayscale_Reference(pixels, count);
+			}
+		}
+
+		void Sepia(Color* pixels, const size_t count) noexcept
+		{
+			switch (SelectKernel())
+			{
+		# if SIV3D_CPU_DISPATCH_X64
+			case Kernel::AVX512:
+				return Sepia_AVX512(pixels, count);
+			case Kernel::AVX2:
+				return Sepia_AVX2(pixels, count);
+		# endif
+		# if SIV3D_PIXEL_FILTERS_SSE4_1
+			case Kernel::SSE4_1:
+				return Sepia_SSE4_1(pixels, count);
+		# endif
+			default:
+				return Sepia_Reference(pixels, count);
+			}
+		}
+
+		void Brighten(Color* pixels, const size_t count, const int32 level) noexcept
+		{
+			switch (SelectKernel())
+			{
+		# if SIV3D_CPU_DISPATCH_X64
+			case Kernel::AVX512:
+				return Brighten_AVX512(pixels, count, level);
+			case Kernel::AVX2:
+				return Brighten_AVX2(pixels, count, level);
+		# endif
+		# if SIV3D_PIXEL_FILTERS_SSE4_1
+			case Kernel::SSE4_1:
+				return Brighten_SSE4_1(pixels, count, level);
+		# endif
+			default:
+				return Brighten_Reference(pixels, count, level);
+			}
+		}
+
+		void ApplyTable(Color* pixels, const size_t count, const uint8(&table)[256]) noexcept
+		{
+			// 256 要素の表引きは SSE / AVX2 では効率よくベクトル化できない（gather は逐次処理より遅い CPU が多い）ため、
+			// 1 ピクセルを 32 ビット単位で読み書きして、メモリアクセスの回数を減らす
+			uint32* p = AsUintPtr(pixels);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const uint32 c = p[i];
+
+				p[i] = (c & AlphaMask)
+					| (static_cast<uint32>(table[(c >> 16) & 0xFF]) << 16)
+					| (static_cast<uint32>(table[(c >> 8) & 0xFF]) << 8)
+					| static_cast<uint32>(table[c & 0xFF]);
+			}
+		}
+
+		void SwapRB(Color* pixels, const size_t count) noexcept
+		{
+			switch (SelectKernel())
+			{
+		# if SIV3D_CPU_DISPATCH_X64
+			case Kernel::AVX512:
+				return SwapRB_AVX512(pixels, count);
+			case Kernel::AVX2:
+				return SwapRB_AVX2(pixels, count);
+		# endif
+		# if SIV3D_PIXEL_FILTERS_SSE4_1
+			case Kernel::SSE4_1:
+				return SwapRB_SSE4_1(pixels, count);
+		# endif
+			default:
+				return SwapRB_Reference(pixels, count);
+			}
+		}
+
+		void CopyRToA(const Color* src, Color* dst, const size_t count) noexcept
+		{
+			switch (SelectKernel())
+			{
+		# if SIV3D_CPU_DISPATCH_X64
+			case Kernel::AVX512:
+				return CopyRToA_AVX512(src, dst, count);
+			case Kernel::AVX2:
+				return CopyRToA_AVX2(src, dst, count);
+		# endif
+		# if SIV3D_PIXEL_FILTERS_SSE4_1
+			case Kernel::SSE4_1:
+				return CopyRToA_SSE4_1(src, dst, count);
+		# endif
+			default:
+				return CopyRToA_Reference(src, dst, count);
+			}
+		}
+
+		void BGRToRGBA(const uint8* src, Color* dst, const size_t count) noexcept
+		{
+			switch (SelectKernel())
+			{
+		# if SIV3D_PIXEL_FILTERS_SSE4_1
+			// メモリ帯域で律速されるため、AVX2 / AVX-512 でも SSE4.1 の実装を使う
+			case Kernel::AVX512:
+			case Kernel::AVX2:
+			case Kernel::SSE4_1:
+				return BGRToRGBA_SSE4_1(src, dst, count);
+		# endif
+			default:
+				return BGRToRGBA_Reference(src, dst, count);
+			}
+		}
+	}
+}
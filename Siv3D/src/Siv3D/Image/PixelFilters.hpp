@@ -0,0 +1,45 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Image.hpp>
+
+namespace s3d
+{
+	/// @brief 連続したピクセル列に対する色変換処理
+	/// @remark 実行時の CPU に応じて AVX-512 / AVX2 / SSE4.1 / 参照実装を選択します。いずれの実装も同じ結果を返します。
+	namespace PixelFilters
+	{
+		/// @brief RGB 成分を反転します。
+		void Negate(Color* pixels, size_t count) noexcept;
+
+		/// @brief RGB 成分を `Color::grayscale0_255()` の値に置き換えます。
+		void Grayscale(Color* pixels, size_t count) noexcept;
+
+		/// @brief RGB 成分をセピア調に変換します。
+		void Sepia(Color* pixels, size_t count) noexcept;
+
+		/// @brief RGB 成分に `level` を加え、[0, 255] に飽和させます。
+		void Brighten(Color* pixels, size_t count, int32 level) noexcept;
+
+		/// @brief RGB 成分を変換テーブルで置き換えます。
+		void ApplyTable(Color* pixels, size_t count, const uint8(&table)[256]) noexcept;
+
+		/// @brief R 成分と B 成分を入れ替えます。
+		void SwapRB(Color* pixels, size_t count) noexcept;
+
+		/// @brief `src` の R 成分を `dst` の A 成分にコピーします。
+		void CopyRToA(const Color* src, Color* dst, size_t count) noexcept;
+
+		/// @brief BGR の 3 バイトのピクセル列を、A 成分が 255 の `Color` に変換します。
+		void BGRToRGBA(const uint8* src, Color* dst, size_t count) noexcept;
+	}
+}
@@ -28,6 +28,8 @@
 # include <Siv3D/ImageFormat/WebPEncoder.hpp>
 # include <Siv3D/OpenCV_Bridge.hpp>
 # include "ImagePainting.hpp"
+# include "PixelFilters.hpp"
+# include "ImageRowBands.hpp"
 
 namespace s3d
 {
@@ -56,17 +58,18 @@ namespace s3d
 			return (px * py * (c1 - c2 - c3 + c4) + px * (c2 - c1) + py * (c3 - c1) + c1);
 		}
 
+		// cv::bilateralFilter() が参照する近傍の半径
 		[[nodiscard]]
-		static Color MakeSepia(Color color) noexcept
+		static int32 GetBilateralFilterRadius(const int32 d, double sigmaSpace) noexcept
 		{
-			const double tr = Min(((0.393 * color.r) + (0.769 * color.g) + (0.189 * color.b)), 255.0);
-			const double tg = Min(((0.349 * color.r) + (0.686 * color.g) + (0.168 * color.b)), 255.0);
-			const double tb = Min(((0.272 * color.r) + (0.534 * color.g) + (0.131 * color.b)), 255.0);
+			if (sigmaSpace <= 0.0)
+			{
+				sigmaSpace = 1.0;
+			}
 
-			color.r = static_cast<uint8>(tr);
-			color.g = static_cast<uint8>(tg);
-			color.b = static_cast<uint8>(tb);
-			return color;
+			const int32 radius = ((d <= 0) ? static_cast<int32>(std::round(sigmaSpace * 1.5)) : (d / 2));
+
+			return Max(radius, 1);
 		}
 
 		static void InitPosterizeTable(const int32 level, uint8 table[256]) noexcept
@@ -812,16 +815,7 @@ namespace s3d
 
 	Image& Image::RGBAtoBGRA()
 	{
-		Color* p = m_data.data();
-		const Color* pEnd = (p + num_pixels());
-
-		while (p != pEnd)
-		{
-			const uint8 t = p->r;
-			p->r = p->b;
-			p->b = t;
-			++p;
-		}
+		PixelFilters::SwapRB(m_data.data(), num_pixels());
 
 		return *this;
 	}
@@ -851,13 +845,7 @@ namespace s3d
 
 		for (uint32 y = 0; y < h; ++y)
 		{
-			Color* pDstLine = pDst;
-			const Color* pSrcLine = pSrc;
-
-			for (uint32 x = 0; x < w; ++x)
-			{
-				(*pDstLine++).a = (*pSrcLine++).r;
-			}
+			PixelFilters::CopyRToA(pSrc, pDst, w);
 
 			pSrc += srcStep;
 			pDst += dstStep;
@@ -946,10 +934,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			for (auto& pixel : m_data)
-			{
-				pixel = ~pixel;
-			}
+			PixelFilters::Negate(m_data.data(), m_data.size());
 		}
 
 		return *this;
@@ -969,10 +954,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			for (auto& pixel : image)
-			{
-				pixel = ~pixel;
-			}
+			PixelFilters::Negate(image.data(), image.num_pixels());
 
 			return image;
 		}
@@ -995,13 +977,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			for (auto& pixel : m_data)
-			{
-				const uint8 gray = pixel.grayscale0_255();
-				pixel.r = gray;
-				pixel.g = gray;
-				pixel.b = gray;
-			}
+			PixelFilters::Grayscale(m_data.data(), m_data.size());
 		}
 
 		return *this;
@@ -1021,13 +997,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			for (auto& pixel : image)
-			{
-				const uint8 gray = pixel.grayscale0_255();
-				pixel.r = gray;
-				pixel.g = gray;
-				pixel.b = gray;
-			}
+			PixelFilters::Grayscale(image.data(), image.num_pixels());
 
 			return image;
 		}
@@ -1050,10 +1020,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			for (auto& pixel : m_data)
-			{
-				pixel = detail::MakeSepia(pixel);
-			}
+			PixelFilters::Sepia(m_data.data(), m_data.size());
 		}
 
 		return *this;
@@ -1073,10 +1040,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			for (auto& pixel : image)
-			{
-				pixel = detail::MakeSepia(pixel);
-			}
+			PixelFilters::Sepia(image.data(), image.num_pixels());
 
 			return image;
 		}
@@ -1102,12 +1066,7 @@ namespace s3d
 			uint8 colorTable[256];
 			detail::InitPosterizeTable(level, colorTable);
 
-			for (auto& pixel : m_data)
-			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+			PixelFilters::ApplyTable(m_data.data(), m_data.size(), colorTable);
 		}
 
 		return *this;
@@ -1130,12 +1089,7 @@ namespace s3d
 			uint8 colorTable[256];
 			detail::InitPosterizeTable(level, colorTable);
 
-			for (auto& pixel : image)
-			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+			PixelFilters::ApplyTable(image.data(), image.num_pixels(), colorTable);
 
 			return image;
 		}
@@ -1158,24 +1112,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			if (level < 0)
-			{
-				for (auto& pixel : m_data)
-				{
-					pixel.r = static_cast<uint8>(Max(static_cast<int32>(pixel.r) + level, 0));
-					pixel.g = static_cast<uint8>(Max(static_cast<int32>(pixel.g) + level, 0));
-					pixel.b = static_cast<uint8>(Max(static_cast<int32>(pixel.b) + level, 0));
-				}
-			}
-			else if (level > 0)
-			{
-				for (auto& pixel : m_data)
-				{
-					pixel.r = static_cast<uint8>(Min(static_cast<int32>(pixel.r) + level, 255));
-					pixel.g = static_cast<uint8>(Min(static_cast<int32>(pixel.g) + level, 255));
-					pixel.b = static_cast<uint8>(Min(static_cast<int32>(pixel.b) + level, 255));
-				}
-			}
+			PixelFilters::Brighten(m_data.data(), m_data.size(), level);
 		}
 
 		return *this;
@@ -1195,24 +1132,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			if (level < 0)
-			{
-				for (auto& pixel : image)
-				{
-					pixel.r = static_cast<uint8>(Max(static_cast<int32>(pixel.r) + level, 0));
-					pixel.g = static_cast<uint8>(Max(static_cast<int32>(pixel.g) + level, 0));
-					pixel.b = static_cast<uint8>(Max(static_cast<int32>(pixel.b) + level, 0));
-				}
-			}
-			else if (level > 0)
-			{
-				for (auto& pixel : image)
-				{
-					pixel.r = static_cast<uint8>(Min(static_cast<int32>(pixel.r) + level, 255));
-					pixel.g = static_cast<uint8>(Min(static_cast<int32>(pixel.g) + level, 255));
-					pixel.b = static_cast<uint8>(Min(static_cast<int32>(pixel.b) + level, 255));
-				}
-			}
+			PixelFilters::Brighten(image.data(), image.num_pixels(), level);
 
 			return image;
 		}
@@ -1590,12 +1510,7 @@ namespace s3d
 			uint8 colorTable[256];
 			detail::InitGammmaTable(gamma, colorTable);
 
-			for (auto& pixel : m_data)
-			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+			PixelFilters::ApplyTable(m_data.data(), m_data.size(), colorTable);
 		}
 
 		return *this;
@@ -1618,12 +1533,7 @@ namespace s3d
 			uint8 colorTable[256];
 			detail::InitGammmaTable(gamma, colorTable);
 
-			for (auto& pixel : image)
-			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+			PixelFilters::ApplyTable(image.data(), image.num_pixels(), colorTable);
 
 			return image;
 		}
@@ -2106,7 +2016,10 @@ namespace s3d
 		// 2. 処理
 		{
 			cv::Mat matSrc = OpenCV_Bridge::GetMatView(*this);
-			cv::blur(matSrc, matSrc, cv::Size(horizontal * 2 + 1, vertical * 2 + 1), cv::Point(-1, -1), OpenCV_Bridge::ConvertBorderType(borderType));
+			ImageRowBands::Apply(matSrc, matSrc, vertical, [=](const cv::Mat& src, cv::Mat& dst)
+				{
+					cv::blur(src, dst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1), cv::Point(-1, -1), OpenCV_Bridge::ConvertBorderType(borderType));
+				});
 		}
 
 		return *this;
@@ -2143,7 +2056,10 @@ namespace s3d
 			const cv::Mat matSrc(cv::Size(m_width, m_height), CV_8UC4, const_cast<uint8*>(dataAsUint8()), stride());
 			cv::Mat matDst = OpenCV_Bridge::GetMatView(image);
 
-			cv::blur(matSrc, matDst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1), cv::Point(-1, -1), OpenCV_Bridge::ConvertBorderType(borderType));
+			ImageRowBands::Apply(matSrc, matDst, vertical, [=](const cv::Mat& src, cv::Mat& dst)
+				{
+					cv::blur(src, dst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1), cv::Point(-1, -1), OpenCV_Bridge::ConvertBorderType(borderType));
+				});
 			return image;
 		}
 	}
@@ -2176,7 +2092,10 @@ namespace s3d
 		// 2. 処理
 		{
 			cv::Mat matSrc = OpenCV_Bridge::GetMatView(*this);
-			cv::medianBlur(matSrc, matSrc, apertureSize);
+			ImageRowBands::Apply(matSrc, matSrc, (apertureSize / 2), [=](const cv::Mat& src, cv::Mat& dst)
+				{
+					cv::medianBlur(src, dst, apertureSize);
+				});
 		}
 
 		return *this;
@@ -2208,7 +2127,10 @@ namespace s3d
 			const cv::Mat matSrc(cv::Size(m_width, m_height), CV_8UC4, const_cast<uint8*>(dataAsUint8()), stride());
 			cv::Mat matDst = OpenCV_Bridge::GetMatView(image);
 
-			cv::medianBlur(matSrc, matDst, apertureSize);
+			ImageRowBands::Apply(matSrc, matDst, (apertureSize / 2), [=](const cv::Mat& src, cv::Mat& dst)
+				{
+					cv::medianBlur(src, dst, apertureSize);
+				});
 			return image;
 		}
 	}
@@ -2241,7 +2163,10 @@ namespace s3d
 		// 2. 処理
 		{
 			cv::Mat matSrc = OpenCV_Bridge::GetMatView(*this);
-			cv::GaussianBlur(matSrc, matSrc, cv::Size(horizontal * 2 + 1, vertical * 2 + 1), 0.0, 0.0, OpenCV_Bridge::ConvertBorderType(borderType));
+			ImageRowBands::Apply(matSrc, matSrc, vertical, [=](const cv::Mat& src, cv::Mat& dst)
+				{
+					cv::GaussianBlur(src, dst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1), 0.0, 0.0, OpenCV_Bridge::ConvertBorderType(borderType));
+				});
 		}
 
 		return *this;
@@ -2278,7 +2203,10 @@ namespace s3d
 			const cv::Mat matSrc(cv::Size(m_width, m_height), CV_8UC4, const_cast<uint8*>(dataAsUint8()), stride());
 			cv::Mat matDst = OpenCV_Bridge::GetMatView(image);
 
-			cv::GaussianBlur(matSrc, matDst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1), 0.0, 0.0, OpenCV_Bridge::ConvertBorderType(borderType));
+			ImageRowBands::Apply(matSrc, matDst, vertical, [=](const cv::Mat& src, cv::Mat& dst)
+				{
+					cv::GaussianBlur(src, dst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1), 0.0, 0.0, OpenCV_Bridge::ConvertBorderType(borderType));
+				});
 			return image;
 		}
 	}
@@ -2302,7 +2230,10 @@ namespace s3d
 		{
 			cv::Mat_<cv::Vec3b> matSrc = OpenCV_Bridge::ToMatVec3bBGR(*this);
 			cv::Mat_<cv::Vec3b> matDst(m_height, m_width);
-			cv::bilateralFilter(matSrc, matDst, d, sigmaColor, sigmaSpace, OpenCV_Bridge::ConvertBorderType(borderType));
+			ImageRowBands::Apply(matSrc, matDst, detail::GetBilateralFilterRadius(d, sigmaSpace), [=](const cv::Mat& src, cv::Mat& dst)
+				{
+					cv::bilateralFilter(src, dst, d, sigmaColor, sigmaSpace, OpenCV_Bridge::ConvertBorderType(borderType));
+				});
 			OpenCV_Bridge::FromMatVec3b(matDst, *this, OverwriteAlpha::No);
 		}
 
@@ -2323,7 +2254,10 @@ namespace s3d
 		{
 			cv::Mat_<cv::Vec3b> matSrc = OpenCV_Bridge::ToMatVec3bBGR(*this);
 			cv::Mat_<cv::Vec3b> matDst(m_height, m_width);
-			cv::bilateralFilter(matSrc, matDst, d, sigmaColor, sigmaSpace, OpenCV_Bridge::ConvertBorderType(borderType));
+			ImageRowBands::Apply(matSrc, matDst, detail::GetBilateralFilterRadius(d, sigmaSpace), [=](const cv::Mat& src, cv::Mat& dst)
+				{
+					cv::bilateralFilter(src, dst, d, sigmaColor, sigmaSpace, OpenCV_Bridge::ConvertBorderType(borderType));
+				});
 		
 			Image image{ *this };
 			OpenCV_Bridge::FromMatVec3b(matDst, image, OverwriteAlpha::No);
@@ -3148,13 +3082,7 @@ namespace s3d
 
 		for (int32 y = 0; y < region.h; ++y)
 		{
-			Color* p = pLine;
-
-			for (int32 x = 0; x < region.w; ++x)
-			{
-				*p = detail::MakeSepia(*p);
-				++p;
-			}
+			PixelFilters::Sepia(pLine, region.w);
 
 			pLine += imageWidth;
 		}
@@ -3177,15 +3105,7 @@ namespace s3d
 
 		for (int32 y = 0; y < region.h; ++y)
 		{
-			Color* p = pLine;
-
-			for (int32 x = 0; x < region.w; ++x)
-			{
-				p->r = colorTable[p->r];
-				p->g = colorTable[p->g];
-				p->b = colorTable[p->b];
-				++p;
-			}
+			PixelFilters::ApplyTable(pLine, region.w, colorTable);
 
 			pLine += imageWidth;
 		}
@@ -3208,15 +3128,7 @@ namespace s3d
 
 		for (int32 y = 0; y < region.h; ++y)
 		{
-			Color* p = pLine;
-
-			for (int32 x = 0; x < region.w; ++x)
-			{
-				p->r = colorTable[p->r];
-				p->g = colorTable[p->g];
-				p->b = colorTable[p->b];
-				++p;
-			}
+			PixelFilters::ApplyTable(pLine, region.w, colorTable);
 
 			pLine += imageWidth;
 		}
@@ -9,13 +9,32 @@
 //
 //-----------------------------------------------
 
+# include <mutex>
 # include <Siv3D/ImageProcessing.hpp>
+# include <Siv3D/Threading.hpp>
 # include <Siv3D/OpenCV_Bridge.hpp>
 
 namespace s3d
 {
 	namespace detail
 	{
+		struct ImageProcessingThreading
+		{
+			std::mutex mutex;
+
+			std::atomic<bool> enabled{ false };
+
+			// マルチスレッド実行を有効にする前の OpenCV のスレッド数
+			int32 previousOpenCVNumThreads = 0;
+		};
+
+		[[nodiscard]]
+		static ImageProcessingThreading& GetImageProcessingThreading()
+		{
+			static ImageProcessingThreading threading;
+			return threading;
+		}
+
 		static Image GenerateMip(const Image& src)
 		{
 			if (not src)
@@ -405,5 +424,36 @@ namespace s3d
 				OpenCV_Bridge::FromMatVec3b(matDst, result, OverwriteAlpha::Yes);
 			}
 		}
+
+		void SetMultiThreadingEnabled(const bool enabled)
+		{
+			auto& threading = detail::GetImageProcessingThreading();
+
+			std::lock_guard lock{ threading.mutex };
+
+			if (threading.enabled == enabled)
+			{
+				return;
+			}
+
+			// 拡大縮小・変形は OpenCV 内部で出力の行ごとに分割して並列化されるため、そのスレッド数を設定する
+			// （ImageRowBands の帯の処理も同じ OpenCV のスレッドで実行される）
+			if (enabled)
+			{
+				threading.previousOpenCVNumThreads = cv::getNumThreads();
+				cv::setNumThreads(static_cast<int32>(Threading::GetConcurrency()));
+			}
+			else
+			{
+				cv::setNumThreads(threading.previousOpenCVNumThreads);
+			}
+
+			threading.enabled = enabled;
+		}
+
+		bool IsMultiThreadingEnabled() noexcept
+		{
+			return detail::GetImageProcessingThreading().enabled.load(std::memory_order_relaxed);
+		}
 	}
 }
@@ -12,6 +12,7 @@
 # include <Siv3D/ImageROI.hpp>
 # include <Siv3D/OpenCV_Bridge.hpp>
 # include <Siv3D/Image/ImagePainting.hpp>
+# include <Siv3D/Image/PixelFilters.hpp>
 
 namespace s3d
 {
@@ -88,13 +89,7 @@ namespace s3d
 
 		for (int32 y = 0; y < region.h; ++y)
 		{
-			Color* p = pLine;
-
-			for (int32 x = 0; x < region.w; ++x)
-			{
-				*p = ~*p;
-				++p;
-			}
+			PixelFilters::Negate(pLine, region.w);
 
 			pLine += imageWidth;
 		}
@@ -114,16 +109,7 @@ namespace s3d
 
 		for (int32 y = 0; y < region.h; ++y)
 		{
-			Color* p = pLine;
-
-			for (int32 x = 0; x < region.w; ++x)
-			{
-				const uint8 gray = p->grayscale0_255();
-				p->r = gray;
-				p->g = gray;
-				p->b = gray;
-				++p;
-			}
+			PixelFilters::Grayscale(pLine, region.w);
 
 			pLine += imageWidth;
 		}
@@ -141,39 +127,11 @@ namespace s3d
 		const size_t imageWidth = imageRef.width();
 		Color* pLine = &imageRef[region.y][region.x];
 
-		if (level < 0)
-		{
-			for (int32 y = 0; y < region.h; ++y)
-			{
-				Color* p = pLine;
-
-				for (int32 x = 0; x < region.w; ++x)
-				{
-					p->r = static_cast<uint8>(Max(static_cast<int32>(p->r) + level, 0));
-					p->g = static_cast<uint8>(Max(static_cast<int32>(p->g) + level, 0));
-					p->b = static_cast<uint8>(Max(static_cast<int32>(p->b) + level, 0));
-					++p;
-				}
-
-				pLine += imageWidth;
-			}
-		}
-		else if (level > 0)
+		for (int32 y = 0; y < region.h; ++y)
 		{
-			for (int32 y = 0; y < region.h; ++y)
-			{
-				Color* p = pLine;
+			PixelFilters::Brighten(pLine, region.w, level);
 
-				for (int32 x = 0; x < region.w; ++x)
-				{
-					p->r = static_cast<uint8>(Min(static_cast<int32>(p->r) + level, 255));
-					p->g = static_cast<uint8>(Min(static_cast<int32>(p->g) + level, 255));
-					p->b = static_cast<uint8>(Min(static_cast<int32>(p->b) + level, 255));
-					++p;
-				}
-
-				pLine += imageWidth;
-			}
+			pLine += imageWidth;
 		}
 
 		return *this;
@@ -0,0 +1,442 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "JSONReaderDetail.hpp"
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/FileSystem.hpp>
+# include <ThirdParty/nlohmann/json.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		// nlohmann::json の SAX イベントを IJSONReaderHandler に中継する
+		class JSONReaderSAX
+		{
+		public:
+
+			JSONReaderSAX(IJSONReaderHandler& handler, const size_t maxDepth) noexcept
+				: m_handler{ handler }
+				, m_maxDepth{ maxDepth } {}
+
+			bool null()
+			{
+				return check(m_handler.onNull());
+			}
+
+			bool boolean(const bool value)
+			{
+				return check(m_handler.onBool(value));
+			}
+
+			bool number_integer(const nlohmann::json::number_integer_t value)
+			{
+				return check(m_handler.onInteger(value));
+			}
+
+			bool number_unsigned(const nlohmann::json::number_unsigned_t value)
+			{
+				return check(m_handler.onUnsigned(value));
+			}
+
+			bool number_float(const nlohmann::json::number_float_t value, const nlohmann::json::string_t&)
+			{
+				return check(m_handler.onFloat(value));
+			}
+
+			bool string(nlohmann::json::string_t& value)
+			{
+				return check(m_handler.onString(value));
+			}
+
+			bool binary(nlohmann::json::binary_t&)
+			{
+				return true;
+			}
+
+			bool start_object(std::size_t)
+			{
+				if (not enter())
+				{
+					return false;
+				}
+
+				return check(m_handler.onBeginObject());
+			}
+
+			bool key(nlohmann::json::string_t& value)
+			{
+				return check(m_handler.onKey(value));
+			}
+
+			bool end_object()
+			{
+				--m_depth;
+				return check(m_handler.onEndObject());
+			}
+
+			bool start_array(std::size_t)
+			{
+				if (not enter())
+				{
+					return false;
+				}
+
+				return check(m_handler.onBeginArray());
+			}
+
+			bool end_array()
+			{
+				--m_depth;
+				return check(m_handler.onEndArray());
+			}
+
+			bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception&)
+			{
+				m_result = JSONReaderResult::ParseError;
+				return false;
+			}
+
+			[[nodiscard]]
+			JSONReaderResult result() const noexcept
+			{
+				return m_result;
+			}
+
+		private:
+
+			IJSONReaderHandler& m_handler;
+
+			size_t m_maxDepth = 0;
+
+			size_t m_depth = 0;
+
+			JSONReaderResult m_result = JSONReaderResult::Completed;
+
+			[[nodiscard]]
+			bool check(const bool result) noexcept
+			{
+				if (not result)
+				{
+					m_result = JSONReaderResult::Aborted;
+				}
+
+				return result;
+			}
+
+			[[nodiscard]]
+			bool enter() noexcept
+			{
+				if (m_maxDepth <= m_depth)
+				{
+					m_result = JSONReaderResult::DepthLimitExceeded;
+					return false;
+				}
+
+				++m_depth;
+				return true;
+			}
+		};
+
+		[[nodiscard]]
+		static constexpr bool IsBlank(const char ch) noexcept
+		{
+			return ((ch == ' ') || (ch == '\t') || (ch == '\r') || (ch == '\n'));
+		}
+	}
+
+	JSONReader::JSONReaderDetail::JSONReaderDetail()
+	{
+		// do nothing
+	}
+
+	JSONReader::JSONReaderDetail::~JSONReaderDetail()
+	{
+		close();
+	}
+
+	bool JSONReader::JSONReaderDetail::open(const FilePathView path, const size_t bufferSize)
+	{
+		if (m_isOpen)
+		{
+			close();
+		}
+
+		std::unique_ptr<IReader> tmpReader = std::make_unique<BinaryReader>(path);
+
+		if (not tmpReader->isOpen())
+		{
+			return false;
+		}
+
+		if (not open(std::move(tmpReader), bufferSize))
+		{
+			return false;
+		}
+
+		m_fullPath = FileSystem::FullPath(path);
+
+		return true;
+	}
+
+	bool JSONReader::JSONReaderDetail::open(std::unique_ptr<IReader>&& reader, const size_t bufferSize)
+	{
+		if (m_isOpen)
+		{
+			close();
+		}
+
+		if ((not reader) || (not reader->isOpen()))
+		{
+			return false;
+		}
+
+		m_reader = std::move(reader);
+		m_buffer.resize(Max<size_t>(bufferSize, 16));
+		m_isOpen = true;
+
+		skipBOM();
+
+		return true;
+	}
+
+	void JSONReader::JSONReaderDetail::close()
+	{
+		if (not m_isOpen)
+		{
+			return;
+		}
+
+		m_reader.reset();
+		m_fullPath.clear();
+		m_buffer.clear();
+		m_buffer.shrink_to_fit();
+		m_line.clear();
+		m_line.shrink_to_fit();
+		m_bufferPos = 0;
+		m_bufferSize = 0;
+		m_position = 0;
+		m_newlineCount = 0;
+		m_lineNumber = 0;
+		m_stopAtNewline = false;
+		m_isOpen = false;
+	}
+
+	bool JSONReader::JSONReaderDetail::isOpen() const noexcept
+	{
+		return m_isOpen;
+	}
+
+	void JSONReader::JSONReaderDetail::setMaxDepth(const size_t maxDepth) noexcept
+	{
+		m_maxDepth = maxDepth;
+	}
+
+	size_t JSONReader::JSONReaderDetail::getMaxDepth() const noexcept
+	{
+		return m_maxDepth;
+	}
+
+	JSONReaderResult JSONReader::JSONReaderDetail::read(IJSONReaderHandler& handler)
+	{
+		if (not m_isOpen)
+		{
+			return JSONReaderResult::NotOpen;
+		}
+
+		if (not skipBlankLines())
+		{
+			return JSONReaderResult::EndOfStream;
+		}
+
+		return parse(handler);
+	}
+
+	JSONReaderResult JSONReader::JSONReaderDetail::readLine(IJSONReaderHandler& handler)
+	{
+		if (not m_isOpen)
+		{
+			return JSONReaderResult::NotOpen;
+		}
+
+		if (not skipBlankLines())
+		{
+			return JSONReaderResult::EndOfStream;
+		}
+
+		m_lineNumber = (m_newlineCount + 1);
+
+		// 改行を終端として扱い、行をバッファに溜めずにパーサに渡す
+		m_stopAtNewline = true;
+		const JSONReaderResult result = parse(handler);
+		m_stopAtNewline = false;
+
+		// 中断や構文エラーで行の途中で止まった場合も、次の行の先頭に進める
+		skipLine();
+
+		return result;
+	}
+
+	JSONReaderResult JSONReader::JSONReaderDetail::readLine(JSON& json)
+	{
+		if (not m_isOpen)
+		{
+			return JSONReaderResult::NotOpen;
+		}
+
+		if (not skipBlankLines())
+		{
+			return JSONReaderResult::EndOfStream;
+		}
+
+		m_lineNumber = (m_newlineCount + 1);
+		m_line.clear();
+
+		while (fill())
+		{
+			const char* const begin = (m_buffer.data() + m_bufferPos);
+			const size_t available = (m_bufferSize - m_bufferPos);
+
+			if (const void* newline = std::memchr(begin, '\n', available))
+			{
+				const size_t length = (static_cast<const char*>(newline) - begin);
+				m_line.append(begin, length);
+				m_bufferPos += (length + 1);
+				m_position += static_cast<int64>(length + 1);
+				++m_newlineCount;
+				break;
+			}
+
+			m_line.append(begin, available);
+			m_bufferPos = m_bufferSize;
+			m_position += static_cast<int64>(available);
+		}
+
+		json = JSON::ParseUTF8(m_line);
+
+		return (json ? JSONReaderResult::Completed : JSONReaderResult::ParseError);
+	}
+
+	uint64 JSONReader::JSONReaderDetail::lineNumber() const noexcept
+	{
+		return m_lineNumber;
+	}
+
+	int64 JSONReader::JSONReaderDetail::position() const noexcept
+	{
+		return m_position;
+	}
+
+	const FilePath& JSONReader::JSONReaderDetail::path() const noexcept
+	{
+		return m_fullPath;
+	}
+
+	bool JSONReader::JSONReaderDetail::fill()
+	{
+		if (m_bufferPos < m_bufferSize)
+		{
+			return true;
+		}
+
+		const int64 readSize = m_reader->read(m_buffer.data(), static_cast<int64>(m_buffer.size()));
+
+		m_bufferPos = 0;
+		m_bufferSize = static_cast<size_t>(Max<int64>(readSize, 0));
+
+		return (m_bufferSize != 0);
+	}
+
+	bool JSONReader::JSONReaderDetail::atEnd()
+	{
+		if (not fill())
+		{
+			return true;
+		}
+
+		return (m_stopAtNewline && (m_buffer[m_bufferPos] == '\n'));
+	}
+
+	void JSONReader::JSONReaderDetail::advance() noexcept
+	{
+		++m_bufferPos;
+		++m_position;
+	}
+
+	bool JSONReader::JSONReaderDetail::skipBlankLines()
+	{
+		while (fill())
+		{
+			const char ch = m_buffer[m_bufferPos];
+
+			if (not detail::IsBlank(ch))
+			{
+				return true;
+			}
+
+			if (ch == '\n')
+			{
+				++m_newlineCount;
+			}
+
+			advance();
+		}
+
+		return false;
+	}
+
+	void JSONReader::JSONReaderDetail::skipLine()
+	{
+		while (fill())
+		{
+			const char* const begin = (m_buffer.data() + m_bufferPos);
+			const size_t available = (m_bufferSize - m_bufferPos);
+
+			if (const void* newline = std::memchr(begin, '\n', available))
+			{
+				const size_t length = (static_cast<const char*>(newline) - begin + 1);
+				m_bufferPos += length;
+				m_position += static_cast<int64>(length);
+				++m_newlineCount;
+				return;
+			}
+
+			m_bufferPos = m_bufferSize;
+			m_position += static_cast<int64>(available);
+		}
+	}
+
+	void JSONReader::JSONReaderDetail::skipBOM()
+	{
+		if (not fill())
+		{
+			return;
+		}
+
+		if ((3 <= m_bufferSize)
+			&& (static_cast<uint8>(m_buffer[0]) == 0xEF)
+			&& (static_cast<uint8>(m_buffer[1]) == 0xBB)
+			&& (static_cast<uint8>(m_buffer[2]) == 0xBF))
+		{
+			m_bufferPos = 3;
+			m_position = 3;
+		}
+	}
+
+	JSONReaderResult JSONReader::JSONReaderDetail::parse(IJSONReaderHandler& handler)
+	{
+		detail::JSONReaderSAX sax{ handler, m_maxDepth };
+
+		nlohmann::json::sax_parse(InputIterator{ this }, InputIterator{}, &sax);
+
+		return sax.result();
+	}
+}
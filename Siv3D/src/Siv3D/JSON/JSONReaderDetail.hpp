@@ -0,0 +1,166 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/JSONReader.hpp>
+
+namespace s3d
+{
+	class JSONReader::JSONReaderDetail
+	{
+	public:
+
+		JSONReaderDetail();
+
+		~JSONReaderDetail();
+
+		[[nodiscard]]
+		bool open(FilePathView path, size_t bufferSize);
+
+		[[nodiscard]]
+		bool open(std::unique_ptr<IReader>&& reader, size_t bufferSize);
+
+		void close();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		void setMaxDepth(size_t maxDepth) noexcept;
+
+		[[nodiscard]]
+		size_t getMaxDepth() const noexcept;
+
+		JSONReaderResult read(IJSONReaderHandler& handler);
+
+		JSONReaderResult readLine(IJSONReaderHandler& handler);
+
+		JSONReaderResult readLine(JSON& json);
+
+		[[nodiscard]]
+		uint64 lineNumber() const noexcept;
+
+		[[nodiscard]]
+		int64 position() const noexcept;
+
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+		// nlohmann::json のパーサにバッファの内容を 1 バイトずつ渡すイテレータ
+		class InputIterator
+		{
+		public:
+
+			using iterator_category	= std::input_iterator_tag;
+			using value_type		= char;
+			using difference_type	= std::ptrdiff_t;
+			using pointer			= const char*;
+			using reference			= const char&;
+
+			InputIterator() = default;
+
+			explicit InputIterator(JSONReaderDetail* detail) noexcept
+				: m_detail{ detail } {}
+
+			[[nodiscard]]
+			reference operator *() const noexcept
+			{
+				return m_detail->m_buffer[m_detail->m_bufferPos];
+			}
+
+			InputIterator& operator ++() noexcept
+			{
+				m_detail->advance();
+				return *this;
+			}
+
+			InputIterator operator ++(int) noexcept
+			{
+				InputIterator tmp = *this;
+				m_detail->advance();
+				return tmp;
+			}
+
+			[[nodiscard]]
+			bool operator ==(const InputIterator& other) const
+			{
+				return (isEnd() == other.isEnd());
+			}
+
+			[[nodiscard]]
+			bool operator !=(const InputIterator& other) const
+			{
+				return (isEnd() != other.isEnd());
+			}
+
+		private:
+
+			// nullptr の場合は終端
+			JSONReaderDetail* m_detail = nullptr;
+
+			[[nodiscard]]
+			bool isEnd() const
+			{
+				return ((not m_detail) || m_detail->atEnd());
+			}
+		};
+
+	private:
+
+		std::unique_ptr<IReader> m_reader;
+
+		FilePath m_fullPath;
+
+		Array<char> m_buffer;
+
+		// readLine(JSON&) で 1 行を格納するバッファ
+		std::string m_line;
+
+		size_t m_bufferPos = 0;
+
+		size_t m_bufferSize = 0;
+
+		// これまでに読み進めたバイト数
+		int64 m_position = 0;
+
+		// これまでに読み進めた改行の数
+		uint64 m_newlineCount = 0;
+
+		// 直前に readLine() で読み込んだ行の行番号
+		uint64 m_lineNumber = 0;
+
+		size_t m_maxDepth = DefaultMaxDepth;
+
+		// true の場合、改行を終端として扱う
+		bool m_stopAtNewline = false;
+
+		bool m_isOpen = false;
+
+		// バッファが空の場合に次のデータを読み込む
+		[[nodiscard]]
+		bool fill();
+
+		[[nodiscard]]
+		bool atEnd();
+
+		void advance() noexcept;
+
+		// 空白と空行を読み飛ばし、次の値があるかを返す
+		[[nodiscard]]
+		bool skipBlankLines();
+
+		// 次の改行の直後まで読み飛ばす
+		void skipLine();
+
+		void skipBOM();
+
+		JSONReaderResult parse(IJSONReaderHandler& handler);
+	};
+}
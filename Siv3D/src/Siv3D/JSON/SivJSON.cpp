@@ -14,7 +14,11 @@
 # include <Siv3D/JSONValidator.hpp>
 # include <Siv3D/TextReader.hpp>
 # include <Siv3D/TextWriter.hpp>
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
+# include <Siv3D/FileSystem.hpp>
 # include <Siv3D/Unicode.hpp>
+# include <Siv3D/Unicode/UnicodeUtility.hpp>
 # include <ThirdParty/nlohmann/json.hpp>
 # include <ThirdParty/nlohmann/json-schema.hpp>
 
@@ -843,9 +847,15 @@ namespace s3d
 			return JSON::Invalid();
 		}
 
-		if (contains(name))
+		auto& j = m_detail->get();
+
+		if (j.is_object())
 		{
-			return JSON(std::make_shared<detail::JSONDetail>(detail::JSONDetail::Ref(), m_detail->get()[Unicode::ToUTF8(name)]));
+			if (auto it = j.find(Unicode::ToUTF8(name));
+				it != j.end())
+			{
+				return JSON(std::make_shared<detail::JSONDetail>(detail::JSONDetail::Ref(), *it));
+			}
 		}
 
 		throw Error{ U"JSON::operator [](StringView) const: Key `{}` not found"_fmt(name) };
@@ -1053,6 +1063,16 @@ namespace s3d
 		return m_detail->get().size();
 	}
 
+	JSONView JSON::view() const
+	{
+		if (not m_isValid)
+		{
+			return{};
+		}
+
+		return JSONView{ static_cast<const void*>(&m_detail->get()) };
+	}
+
 	String JSON::format(const char32 space, const size_t spaceCount) const
 	{
 		return Unicode::FromUTF8(formatUTF8(space, spaceCount));
@@ -1153,9 +1173,79 @@ namespace s3d
 		return JSON(Invalid_{});
 	}
 
+	namespace detail
+	{
+		[[nodiscard]]
+		static String DecodeUTF16(const Byte* data, const size_t size, const bool bigEndian)
+		{
+			std::u16string s(size / 2, u'\0');
+
+			for (size_t i = 0; i < s.size(); ++i)
+			{
+				const uint8 b0 = static_cast<uint8>(data[i * 2]);
+				const uint8 b1 = static_cast<uint8>(data[i * 2 + 1]);
+				s[i] = static_cast<char16_t>(bigEndian ? ((b0 << 8) | b1) : ((b1 << 8) | b0));
+			}
+
+			return Unicode::FromUTF16(s);
+		}
+
+		// UTF-8 のデータは文字列に変換せずに直接パースする
+		[[nodiscard]]
+		static JSON ParseBytes(const Byte* data, size_t size, const AllowExceptions allowExceptions)
+		{
+			if ((3 <= size)
+				&& (data[0] == Byte{ 0xEF }) && (data[1] == Byte{ 0xBB }) && (data[2] == Byte{ 0xBF }))
+			{
+				data += 3;
+				size -= 3;
+			}
+			else if ((2 <= size)
+				&& (data[0] == Byte{ 0xFF }) && (data[1] == Byte{ 0xFE }))
+			{
+				return JSON::Parse(DecodeUTF16(data + 2, size - 2, false), allowExceptions);
+			}
+			else if ((2 <= size)
+				&& (data[0] == Byte{ 0xFE }) && (data[1] == Byte{ 0xFF }))
+			{
+				return JSON::Parse(DecodeUTF16(data + 2, size - 2, true), allowExceptions);
+			}
+
+			return JSON::ParseUTF8(std::string_view{ reinterpret_cast<const char*>(data), size }, allowExceptions);
+		}
+
+		[[nodiscard]]
+		static JSON LoadFromReader(IReader& reader, const AllowExceptions allowExceptions)
+		{
+			Array<Byte> buffer(static_cast<size_t>(reader.size()));
+
+			if ((not buffer.isEmpty()) && (reader.read(buffer.data(), static_cast<int64>(buffer.size())) != static_cast<int64>(buffer.size())))
+			{
+				if (allowExceptions)
+				{
+					throw Error{ U"JSON::load(): failed to read from IReader" };
+				}
+
+				return JSON::Invalid();
+			}
+
+			return ParseBytes(buffer.data(), buffer.size(), allowExceptions);
+		}
+	}
+
 	JSON JSON::Load(const FilePathView path, const AllowExceptions allowExceptions)
 	{
-		TextReader reader{ path };
+		if (not FileSystem::IsResourcePath(path))
+		{
+			// ファイル全体をメモリマップして、コピーせずにパースする
+			if (const MemoryMappedFileView file{ path };
+				file && file.data())
+			{
+				return detail::ParseBytes(file.data(), file.mappedSize(), allowExceptions);
+			}
+		}
+
+		BinaryReader reader{ path };
 
 		if (not reader)
 		{
@@ -1167,14 +1257,12 @@ namespace s3d
 			return JSON::Invalid();
 		}
 
-		return Parse(reader.readAll(), allowExceptions);
+		return detail::LoadFromReader(reader, allowExceptions);
 	}
 
 	JSON JSON::Load(std::unique_ptr<IReader>&& reader, const AllowExceptions allowExceptions)
 	{
-		TextReader textReader{ std::move(reader) };
-
-		if (not textReader)
+		if ((not reader) || (not reader->isOpen()))
 		{
 			if (allowExceptions)
 			{
@@ -1184,7 +1272,7 @@ namespace s3d
 			return JSON::Invalid();
 		}
 
-		return Parse(textReader.readAll(), allowExceptions);
+		return detail::LoadFromReader(*reader, allowExceptions);
 	}
 
 	JSON JSON::Parse(const StringView str, const AllowExceptions allowExceptions)
@@ -1209,6 +1297,28 @@ namespace s3d
 		return value;
 	}
 
+	JSON JSON::ParseUTF8(const std::string_view str, const AllowExceptions allowExceptions)
+	{
+		JSON value{ Invalid_{} };
+
+		try
+		{
+			value.m_detail = std::make_shared<detail::JSONDetail>(detail::JSONDetail::Value(), nlohmann::json::parse(str.begin(), str.end()));
+			value.m_isValid = true;
+		}
+		catch (const std::exception& e)
+		{
+			if (not allowExceptions)
+			{
+				return JSON::Invalid();
+			}
+
+			throw Error{ U"JSON::ParseUTF8(): " + Unicode::Widen(e.what()) };
+		}
+
+		return value;
+	}
+
 	JSON JSON::FromBSON(const Blob& bson, const AllowExceptions allowExceptions)
 	{
 		JSON value{ Invalid_{} };
@@ -1325,6 +1435,401 @@ namespace s3d
 		return m_detail->get().get<bool>();
 	}
 
+	//////////////////////////////////////////////////
+	//
+	//	JSONViewIterator
+	//
+	//////////////////////////////////////////////////
+
+	namespace detail
+	{
+		using JSONObjectElement = nlohmann::json::object_t::value_type;
+
+		[[nodiscard]]
+		static const nlohmann::json& AsNlohmann(const void* value) noexcept
+		{
+			return *static_cast<const nlohmann::json*>(value);
+		}
+
+		[[nodiscard]]
+		static const nlohmann::json::object_t& AsObject(const void* object) noexcept
+		{
+			return *static_cast<const nlohmann::json::object_t*>(object);
+		}
+
+		[[nodiscard]]
+		static const JSONObjectElement& AsObjectElement(const void* element) noexcept
+		{
+			return *static_cast<const JSONObjectElement*>(element);
+		}
+
+		[[nodiscard]]
+		static const void* ToObjectElement(const nlohmann::json::object_t& object, const nlohmann::json::object_t::const_iterator it) noexcept
+		{
+			return ((it == object.end()) ? nullptr : static_cast<const void*>(&(*it)));
+		}
+	}
+
+	JSONViewIterator& JSONViewIterator::operator ++()
+	{
+		if (m_kind == Kind::Array)
+		{
+			m_element = (static_cast<const nlohmann::json*>(m_element) + 1);
+		}
+		else if ((m_kind == Kind::Object) && m_element)
+		{
+			// キーはオブジェクト内で一意なので、現在のキーから次の要素を求める
+			const auto& object = detail::AsObject(m_object);
+			m_element = detail::ToObjectElement(object, std::next(object.find(detail::AsObjectElement(m_element).first)));
+		}
+
+		return *this;
+	}
+
+	JSONViewIterator JSONViewIterator::operator ++(int)
+	{
+		JSONViewIterator tmp = *this;
+		++(*this);
+		return tmp;
+	}
+
+	JSONView JSONViewIterator::operator *() const
+	{
+		return value();
+	}
+
+	std::string_view JSONViewIterator::key() const
+	{
+		if ((m_kind != Kind::Object) || (not m_element))
+		{
+			return{};
+		}
+
+		return detail::AsObjectElement(m_element).first;
+	}
+
+	JSONView JSONViewIterator::value() const
+	{
+		if (m_kind == Kind::Array)
+		{
+			return JSONView{ m_element };
+		}
+		else if ((m_kind == Kind::Object) && m_element)
+		{
+			return JSONView{ static_cast<const void*>(&detail::AsObjectElement(m_element).second) };
+		}
+
+		return{};
+	}
+
+	bool JSONViewIterator::operator ==(const JSONViewIterator& other) const noexcept
+	{
+		if (m_kind != other.m_kind)
+		{
+			return false;
+		}
+
+		return ((m_element == other.m_element)
+			&& (m_object == other.m_object));
+	}
+
+	bool JSONViewIterator::operator !=(const JSONViewIterator& other) const noexcept
+	{
+		return (not (*this == other));
+	}
+
+	//////////////////////////////////////////////////
+	//
+	//	JSONView
+	//
+	//////////////////////////////////////////////////
+
+	JSONView::JSONView(const JSON& json)
+		: JSONView{ json.view() } {}
+
+	JSONView::JSONView(const void* value) noexcept
+		: m_value{ value } {}
+
+	bool JSONView::isEmpty() const noexcept
+	{
+		return (m_value == nullptr);
+	}
+
+	JSONView::operator bool() const noexcept
+	{
+		return (m_value != nullptr);
+	}
+
+	bool JSONView::isNull() const noexcept
+	{
+		return (m_value && detail::AsNlohmann(m_value).is_null());
+	}
+
+	bool JSONView::isBool() const noexcept
+	{
+		return (m_value && detail::AsNlohmann(m_value).is_boolean());
+	}
+
+	bool JSONView::isNumber() const noexcept
+	{
+		return (m_value && detail::AsNlohmann(m_value).is_number());
+	}
+
+	bool JSONView::isInteger() const noexcept
+	{
+		return (m_value && detail::AsNlohmann(m_value).is_number_integer());
+	}
+
+	bool JSONView::isUnsigned() const noexcept
+	{
+		return (m_value && detail::AsNlohmann(m_value).is_number_unsigned());
+	}
+
+	bool JSONView::isFloat() const noexcept
+	{
+		return (m_value && detail::AsNlohmann(m_value).is_number_float());
+	}
+
+	bool JSONView::isString() const noexcept
+	{
+		return (m_value && detail::AsNlohmann(m_value).is_string());
+	}
+
+	bool JSONView::isArray() const noexcept
+	{
+		return (m_value && detail::AsNlohmann(m_value).is_array());
+	}
+
+	bool JSONView::isObject() const noexcept
+	{
+		return (m_value && detail::AsNlohmann(m_value).is_object());
+	}
+
+	JSONValueType JSONView::getType() const noexcept
+	{
+		if (not m_value)
+		{
+			return JSONValueType::Empty;
+		}
+
+		switch (detail::AsNlohmann(m_value).type())
+		{
+		case nlohmann::json::value_t::null:
+			return JSONValueType::Null;
+		case nlohmann::json::value_t::object:
+			return JSONValueType::Object;
+		case nlohmann::json::value_t::array:
+			return JSONValueType::Array;
+		case nlohmann::json::value_t::string:
+			return JSONValueType::String;
+		case nlohmann::json::value_t::boolean:
+			return JSONValueType::Bool;
+		case nlohmann::json::value_t::binary:
+			return JSONValueType::Binary;
+		case nlohmann::json::value_t::discarded:
+			return JSONValueType::Empty;
+		default:
+			return JSONValueType::Number;
+		}
+	}
+
+	size_t JSONView::size() const noexcept
+	{
+		if (not m_value)
+		{
+			return 0;
+		}
+
+		return detail::AsNlohmann(m_value).size();
+	}
+
+	bool JSONView::contains(const std::string_view key) const noexcept
+	{
+		return (not operator [](key).isEmpty());
+	}
+
+	bool JSONView::contains(const StringView key) const
+	{
+		return (not operator [](key).isEmpty());
+	}
+
+	bool JSONView::contains(const size_t index) const noexcept
+	{
+		return (isArray() && (index < detail::AsNlohmann(m_value).size()));
+	}
+
+	JSONView JSONView::operator [](const std::string_view key) const noexcept
+	{
+		if (not isObject())
+		{
+			return{};
+		}
+
+		const auto& object = *detail::AsNlohmann(m_value).get_ptr<const nlohmann::json::object_t*>();
+
+		// object_t の比較関数は std::less<> なので、std::string を作らずに検索できる
+		if (const auto it = object.find(key);
+			it != object.end())
+		{
+			return JSONView{ static_cast<const void*>(&it->second) };
+		}
+
+		return{};
+	}
+
+	JSONView JSONView::operator [](const StringView key) const
+	{
+		if (not isObject())
+		{
+			return{};
+		}
+
+		constexpr size_t BufferSize = 256;
+
+		if (detail::UTF8_Length(key) <= BufferSize)
+		{
+			char buffer[BufferSize];
+			char* p = buffer;
+
+			for (const char32 ch : key)
+			{
+				detail::UTF8_Encode(&p, ch);
+			}
+
+			return operator [](std::string_view{ buffer, static_cast<size_t>(p - buffer) });
+		}
+
+		return operator [](std::string_view{ Unicode::ToUTF8(key) });
+	}
+
+	JSONView JSONView::operator [](const size_t index) const noexcept
+	{
+		if (not contains(index))
+		{
+			return{};
+		}
+
+		return JSONView{ static_cast<const void*>(&detail::AsNlohmann(m_value)[index]) };
+	}
+
+	String JSONView::getString() const
+	{
+		if (not isString())
+		{
+			throw Error{ U"JSONView::getString(): Value is not a String type" };
+		}
+
+		return Unicode::FromUTF8(getUTF8String());
+	}
+
+	std::string_view JSONView::getUTF8String() const noexcept
+	{
+		if (not isString())
+		{
+			return{};
+		}
+
+		return *detail::AsNlohmann(m_value).get_ptr<const nlohmann::json::string_t*>();
+	}
+
+	JSONViewIterator JSONView::begin() const
+	{
+		JSONViewIterator it;
+
+		if (isArray())
+		{
+			const auto& array = *detail::AsNlohmann(m_value).get_ptr<const nlohmann::json::array_t*>();
+			it.m_kind = JSONViewIterator::Kind::Array;
+			it.m_element = array.data();
+		}
+		else if (isObject())
+		{
+			const auto& object = *detail::AsNlohmann(m_value).get_ptr<const nlohmann::json::object_t*>();
+			it.m_kind = JSONViewIterator::Kind::Object;
+			it.m_object = &object;
+			it.m_element = detail::ToObjectElement(object, object.begin());
+		}
+
+		return it;
+	}
+
+	JSONViewIterator JSONView::end() const
+	{
+		JSONViewIterator it;
+
+		if (isArray())
+		{
+			const auto& array = *detail::AsNlohmann(m_value).get_ptr<const nlohmann::json::array_t*>();
+			it.m_kind = JSONViewIterator::Kind::Array;
+			it.m_element = (array.data() + array.size());
+		}
+		else if (isObject())
+		{
+			const auto& object = *detail::AsNlohmann(m_value).get_ptr<const nlohmann::json::object_t*>();
+			it.m_kind = JSONViewIterator::Kind::Object;
+			it.m_object = &object;
+		}
+
+		return it;
+	}
+
+	JSON JSONView::toJSON() const
+	{
+		if (not m_value)
+		{
+			return JSON::Invalid();
+		}
+
+		nlohmann::json tmp = detail::AsNlohmann(m_value);
+
+		return JSON(std::make_shared<detail::JSONDetail>(detail::JSONDetail::Value{}, std::move(tmp)));
+	}
+
+	void Formatter(FormatData& formatData, const JSONView& value)
+	{
+		Formatter(formatData, value.toJSON());
+	}
+
+	Optional<String> JSONView::getOptString() const
+	{
+		if (not isString())
+		{
+			return none;
+		}
+
+		return Unicode::FromUTF8(getUTF8String());
+	}
+
+	Optional<int64> JSONView::getOptInt64() const
+	{
+		if (not isNumber())
+		{
+			return none;
+		}
+
+		return detail::AsNlohmann(m_value).get<int64>();
+	}
+
+	Optional<double> JSONView::getOptDouble() const
+	{
+		if (not isNumber())
+		{
+			return none;
+		}
+
+		return detail::AsNlohmann(m_value).get<double>();
+	}
+
+	Optional<bool> JSONView::getOptBool() const
+	{
+		if (not isBool())
+		{
+			return none;
+		}
+
+		return detail::AsNlohmann(m_value).get<bool>();
+	}
+
 	//////////////////////////////////////////////////
 	//
 	//	JSONPointer
@@ -0,0 +1,99 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/JSONReader.hpp>
+# include <Siv3D/JSON/JSONReaderDetail.hpp>
+
+namespace s3d
+{
+	JSONReader::JSONReader()
+		: pImpl{ std::make_shared<JSONReaderDetail>() }
+	{
+
+	}
+
+	JSONReader::JSONReader(const FilePathView path, const size_t bufferSize)
+		: JSONReader{}
+	{
+		open(path, bufferSize);
+	}
+
+	JSONReader::JSONReader(std::unique_ptr<IReader>&& reader, const size_t bufferSize)
+		: JSONReader{}
+	{
+		open(std::move(reader), bufferSize);
+	}
+
+	bool JSONReader::open(const FilePathView path, const size_t bufferSize)
+	{
+		return pImpl->open(path, bufferSize);
+	}
+
+	bool JSONReader::open(std::unique_ptr<IReader>&& reader, const size_t bufferSize)
+	{
+		return pImpl->open(std::move(reader), bufferSize);
+	}
+
+	void JSONReader::close()
+	{
+		pImpl->close();
+	}
+
+	bool JSONReader::isOpen() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	JSONReader::operator bool() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	void JSONReader::setMaxDepth(const size_t maxDepth) noexcept
+	{
+		pImpl->setMaxDepth(maxDepth);
+	}
+
+	size_t JSONReader::getMaxDepth() const noexcept
+	{
+		return pImpl->getMaxDepth();
+	}
+
+	JSONReaderResult JSONReader::read(IJSONReaderHandler& handler)
+	{
+		return pImpl->read(handler);
+	}
+
+	JSONReaderResult JSONReader::readLine(IJSONReaderHandler& handler)
+	{
+		return pImpl->readLine(handler);
+	}
+
+	JSONReaderResult JSONReader::readLine(JSON& json)
+	{
+		return pImpl->readLine(json);
+	}
+
+	uint64 JSONReader::lineNumber() const noexcept
+	{
+		return pImpl->lineNumber();
+	}
+
+	int64 JSONReader::position() const noexcept
+	{
+		return pImpl->position();
+	}
+
+	const FilePath& JSONReader::path() const noexcept
+	{
+		return pImpl->path();
+	}
+}
@@ -16,6 +16,8 @@ namespace s3d
 {
 	enum class LogType : uint8;
 	class StringView;
+	struct LoggerAsyncConfig;
+	struct LoggerFileConfig;
 
 	class SIV3D_NOVTABLE ISiv3DLogger
 	{
@@ -28,5 +30,17 @@ namespace s3d
 		virtual void write(LogType type, StringView s) = 0;
 
 		virtual void setEnabled(bool enabled) = 0;
+
+		virtual void setAsync(const LoggerAsyncConfig& config) = 0;
+
+		virtual void setSync() = 0;
+
+		virtual bool isAsync() const = 0;
+
+		virtual void flush() = 0;
+
+		virtual bool openFile(const LoggerFileConfig& config) = 0;
+
+		virtual void closeFile() = 0;
 	};
 }
@@ -0,0 +1,490 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <array>
+# include <bit>
+# include <charconv>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/FormatLiteral.hpp>
+# include <Siv3D/FormatInt.hpp>
+# include <Siv3D/Time.hpp>
+# include <Siv3D/Utility.hpp>
+# include <Siv3D/Unicode/UnicodeUtility.hpp>
+# include "LoggerBackend.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		constexpr std::array<std::string_view, 7> LogTypeNames =
+		{
+			"[error]   ",
+			"[fail]    ",
+			"[warning] ",
+			"",
+			"[info]    ",
+			"[trace]   ",
+			"[verbose] ",
+		};
+
+		// ワーカースレッドが起こされなくても出力する間隔
+		constexpr std::chrono::milliseconds LoggerWorkerInterval{ 10 };
+
+		// 1 回にまとめて出力する最大のバイト数
+		constexpr size_t LoggerMaxBatchSize = (256 * 1024);
+
+		// ロガーの中では、ログを出力する可能性のある Siv3D のファイル API を使わない
+		[[nodiscard]]
+		static std::FILE* OpenLogFile(const FilePath& path, const bool append)
+		{
+		# if SIV3D_PLATFORM(WINDOWS)
+
+			std::FILE* fp = nullptr;
+			return ((::_wfopen_s(&fp, path.toWstr().c_str(), (append ? L"ab" : L"wb")) == 0) ? fp : nullptr);
+
+		# else
+
+			return std::fopen(path.toUTF8().c_str(), (append ? "ab" : "wb"));
+
+		# endif
+		}
+
+		static void RemoveLogFile(const FilePath& path)
+		{
+		# if SIV3D_PLATFORM(WINDOWS)
+
+			::_wremove(path.toWstr().c_str());
+
+		# else
+
+			std::remove(path.toUTF8().c_str());
+
+		# endif
+		}
+
+		static void RenameLogFile(const FilePath& from, const FilePath& to)
+		{
+		# if SIV3D_PLATFORM(WINDOWS)
+
+			::_wrename(from.toWstr().c_str(), to.toWstr().c_str());
+
+		# else
+
+			std::rename(from.toUTF8().c_str(), to.toUTF8().c_str());
+
+		# endif
+		}
+
+		[[nodiscard]]
+		static FilePath BackupLogFilePath(const FilePath& path, const size_t index)
+		{
+			return (path + U'.' + ToString(index));
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	RecordQueue
+	//
+	////////////////////////////////////////////////////////////////
+
+	LoggerBackend::RecordQueue::RecordQueue(const size_t capacity)
+	{
+		const uint64 size = std::bit_ceil(static_cast<uint64>(Max<size_t>(capacity, 2)));
+
+		m_cells = std::make_unique<Cell[]>(size);
+		m_mask = (size - 1);
+
+		for (uint64 i = 0; i < size; ++i)
+		{
+			m_cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	bool LoggerBackend::RecordQueue::tryPush(const uint64 timeStamp, const LogType type, const StringView text)
+	{
+		uint64 pos = m_enqueuePos.load(std::memory_order_relaxed);
+		Cell* cell;
+
+		for (;;)
+		{
+			cell = &m_cells[pos & m_mask];
+			const uint64 sequence = cell->sequence.load(std::memory_order_acquire);
+			const int64 diff = static_cast<int64>(sequence - pos);
+
+			if (diff == 0)
+			{
+				if (m_enqueuePos.compare_exchange_weak(pos, (pos + 1), std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (diff < 0)
+			{
+				// いっぱい
+				return false;
+			}
+			else
+			{
+				pos = m_enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+
+		cell->record.timeStamp = timeStamp;
+		cell->record.type = type;
+		cell->record.text.assign(text);
+		cell->sequence.store((pos + 1), std::memory_order_release);
+
+		return true;
+	}
+
+	bool LoggerBackend::RecordQueue::tryPop(Record& record)
+	{
+		Cell& cell = m_cells[m_dequeuePos & m_mask];
+
+		if (cell.sequence.load(std::memory_order_acquire) != (m_dequeuePos + 1))
+		{
+			// 空、または書き込み中
+			return false;
+		}
+
+		record.timeStamp = cell.record.timeStamp;
+		record.type = cell.record.type;
+		record.text.swap(cell.record.text);
+		cell.sequence.store((m_dequeuePos + m_mask + 1), std::memory_order_release);
+		++m_dequeuePos;
+
+		return true;
+	}
+
+	uint64 LoggerBackend::RecordQueue::num_pushed() const noexcept
+	{
+		return m_enqueuePos.load(std::memory_order_acquire);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	LoggerBackend
+	//
+	////////////////////////////////////////////////////////////////
+
+	LoggerBackend::LoggerBackend(const ConsoleSink consoleSink)
+		: m_consoleSink{ consoleSink } {}
+
+	LoggerBackend::~LoggerBackend()
+	{
+		m_async.store(false, std::memory_order_release);
+
+		if (m_worker.joinable())
+		{
+			{
+				std::lock_guard lock{ m_workerMutex };
+				m_stopRequested = true;
+			}
+
+			m_workerCV.notify_one();
+			m_spaceCV.notify_all();
+			m_worker.join();
+		}
+
+		closeFile();
+	}
+
+	void LoggerBackend::write(const LogType type, const StringView s)
+	{
+		const uint64 timeStamp = Time::GetMillisec();
+
+		if (m_async.load(std::memory_order_acquire))
+		{
+			if (m_queue->tryPush(timeStamp, type, s))
+			{
+				return;
+			}
+
+			if (m_overflowPolicy.load(std::memory_order_relaxed) == LogOverflowPolicy::Discard)
+			{
+				m_numDropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			// ワーカーがログを取り出して空きができるまで待つ
+			wakeWorker();
+
+			std::unique_lock lock{ m_workerMutex };
+			++m_numBlockedWriters;
+			m_spaceCV.wait(lock, [&]() { return (m_queue->tryPush(timeStamp, type, s) || m_stopRequested); });
+			--m_numBlockedWriters;
+
+			return;
+		}
+
+		std::lock_guard lock{ m_outputMutex };
+
+		m_syncBuffer.clear();
+		AppendRecord(m_syncBuffer, timeStamp, type, s);
+		output(m_syncBuffer);
+	}
+
+	void LoggerBackend::setAsync(const LoggerAsyncConfig& config)
+	{
+	# if !SIV3D_PLATFORM(WEB) || defined(__EMSCRIPTEN_PTHREADS__)
+
+		{
+			std::lock_guard lock{ m_outputMutex };
+
+			if (not m_queue)
+			{
+				m_queue = std::make_unique<RecordQueue>(config.capacity);
+				m_worker = std::thread{ [this]() { workerLoop(); } };
+			}
+		}
+
+		m_overflowPolicy.store(config.overflowPolicy, std::memory_order_relaxed);
+		m_async.store(true, std::memory_order_release);
+
+	# else
+
+		// スレッドを作成できないため、同期モードのままにする
+		(void)config;
+
+	# endif
+	}
+
+	void LoggerBackend::setSync()
+	{
+		m_async.store(false, std::memory_order_release);
+
+		flush();
+	}
+
+	bool LoggerBackend::isAsync() const noexcept
+	{
+		return m_async.load(std::memory_order_relaxed);
+	}
+
+	void LoggerBackend::flush()
+	{
+		const RecordQueue* queue = nullptr;
+		{
+			std::lock_guard lock{ m_outputMutex };
+			queue = m_queue.get();
+		}
+
+		if (not queue)
+		{
+			// 同期モードでは出力のたびに書き出している
+			return;
+		}
+
+		const uint64 target = queue->num_pushed();
+
+		std::unique_lock lock{ m_workerMutex };
+		m_wakeRequested = true;
+		m_workerCV.notify_one();
+		m_flushCV.wait(lock, [&]() { return ((target <= m_numWritten) || m_stopRequested); });
+	}
+
+	bool LoggerBackend::openFile(const LoggerFileConfig& config)
+	{
+		FileSystem::CreateParentDirectories(config.path);
+
+		const FilePath path = FileSystem::FullPath(config.path);
+
+		std::lock_guard lock{ m_outputMutex };
+
+		if (m_file.fp)
+		{
+			std::fclose(m_file.fp);
+			m_file.fp = nullptr;
+		}
+
+		std::FILE* fp = detail::OpenLogFile(path, true);
+
+		if (not fp)
+		{
+			return false;
+		}
+
+		std::fseek(fp, 0, SEEK_END);
+
+		m_file =
+		{
+			.fp				= fp,
+			.path			= path,
+			.size			= static_cast<int64>(std::ftell(fp)),
+			.maxFileSize	= Max<int64>(config.maxFileSize, 0),
+			.maxBackupFiles	= config.maxBackupFiles,
+		};
+
+		return true;
+	}
+
+	void LoggerBackend::closeFile()
+	{
+		std::lock_guard lock{ m_outputMutex };
+
+		if (m_file.fp)
+		{
+			std::fclose(m_file.fp);
+		}
+
+		m_file = {};
+	}
+
+	void LoggerBackend::wakeWorker()
+	{
+		{
+			std::lock_guard lock{ m_workerMutex };
+			m_wakeRequested = true;
+		}
+
+		m_workerCV.notify_one();
+	}
+
+	void LoggerBackend::notifyBlockedWriters()
+	{
+		std::lock_guard lock{ m_workerMutex };
+
+		if (m_numBlockedWriters)
+		{
+			m_spaceCV.notify_all();
+		}
+	}
+
+	void LoggerBackend::workerLoop()
+	{
+		std::string buffer;
+		Record record;
+
+		for (;;)
+		{
+			bool stop = false;
+			{
+				std::unique_lock lock{ m_workerMutex };
+				m_workerCV.wait_for(lock, detail::LoggerWorkerInterval, [this]() { return (m_stopRequested || m_wakeRequested); });
+				m_wakeRequested = false;
+				stop = m_stopRequested;
+			}
+
+			uint64 numPopped = 0;
+			buffer.clear();
+
+			while (m_queue->tryPop(record))
+			{
+				AppendRecord(buffer, record.timeStamp, record.type, record.text);
+				++numPopped;
+
+				if (detail::LoggerMaxBatchSize <= buffer.size())
+				{
+					notifyBlockedWriters();
+
+					std::lock_guard lock{ m_outputMutex };
+					output(buffer);
+					buffer.clear();
+				}
+			}
+
+			if (numPopped)
+			{
+				notifyBlockedWriters();
+			}
+
+			if (const uint64 numDropped = m_numDropped.exchange(0, std::memory_order_relaxed))
+			{
+				AppendRecord(buffer, Time::GetMillisec(), LogType::Warning, U"Logger: {} log records were discarded because the buffer was full"_fmt(numDropped));
+			}
+
+			if (not buffer.empty())
+			{
+				std::lock_guard lock{ m_outputMutex };
+				output(buffer);
+			}
+
+			{
+				std::lock_guard lock{ m_workerMutex };
+				m_numWritten += numPopped;
+			}
+
+			m_flushCV.notify_all();
+
+			if (stop)
+			{
+				break;
+			}
+		}
+	}
+
+	void LoggerBackend::output(const std::string_view text)
+	{
+		m_consoleSink(text);
+
+		if (not m_file.fp)
+		{
+			return;
+		}
+
+		std::fwrite(text.data(), 1, text.size(), m_file.fp);
+		std::fflush(m_file.fp);
+		m_file.size += static_cast<int64>(text.size());
+
+		if (m_file.maxFileSize && (m_file.maxFileSize <= m_file.size))
+		{
+			rotateFile();
+		}
+	}
+
+	void LoggerBackend::rotateFile()
+	{
+		std::fclose(m_file.fp);
+		m_file.fp = nullptr;
+
+		if (m_file.maxBackupFiles == 0)
+		{
+			detail::RemoveLogFile(m_file.path);
+		}
+		else
+		{
+			detail::RemoveLogFile(detail::BackupLogFilePath(m_file.path, m_file.maxBackupFiles));
+
+			for (size_t i = (m_file.maxBackupFiles - 1); 1 <= i; --i)
+			{
+				detail::RenameLogFile(detail::BackupLogFilePath(m_file.path, i), detail::BackupLogFilePath(m_file.path, (i + 1)));
+			}
+
+			detail::RenameLogFile(m_file.path, detail::BackupLogFilePath(m_file.path, 1));
+		}
+
+		m_file.fp = detail::OpenLogFile(m_file.path, false);
+		m_file.size = 0;
+	}
+
+	void LoggerBackend::AppendRecord(std::string& buffer, const uint64 timeStamp, const LogType type, const StringView text)
+	{
+		char digits[24];
+		const auto result = std::to_chars(std::begin(digits), std::end(digits), timeStamp);
+
+		buffer.append(digits, result.ptr);
+		buffer.append(": ");
+		buffer.append(detail::LogTypeNames[FromEnum(type)]);
+
+		const size_t offset = buffer.size();
+		buffer.resize(offset + detail::UTF8_Length(text));
+
+		char* p = (buffer.data() + offset);
+
+		for (const char32 ch : text)
+		{
+			detail::UTF8_Encode(&p, ch);
+		}
+
+		buffer.push_back('\n');
+	}
+}
@@ -0,0 +1,174 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <condition_variable>
+# include <cstdio>
+# include <memory>
+# include <mutex>
+# include <string>
+# include <thread>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/String.hpp>
+# include <Siv3D/Logger.hpp>
+# include <Siv3D/LogType.hpp>
+
+namespace s3d
+{
+	/// @brief 各プラットフォームの CLogger が共通で使う、ログの書式化と出力の実装
+	/// @remark 非同期モードでは、ログをロックフリーの MPSC リングバッファに積み、専用のスレッドがまとめて書式化・出力します。
+	class LoggerBackend
+	{
+	public:
+
+		/// @brief UTF-8 のテキストをコンソールやデバッガに出力する関数
+		using ConsoleSink = void(*)(std::string_view text);
+
+		explicit LoggerBackend(ConsoleSink consoleSink);
+
+		~LoggerBackend();
+
+		LoggerBackend(const LoggerBackend&) = delete;
+
+		LoggerBackend& operator =(const LoggerBackend&) = delete;
+
+		void write(LogType type, StringView s);
+
+		void setAsync(const LoggerAsyncConfig& config);
+
+		void setSync();
+
+		[[nodiscard]]
+		bool isAsync() const noexcept;
+
+		void flush();
+
+		bool openFile(const LoggerFileConfig& config);
+
+		void closeFile();
+
+	private:
+
+		struct Record
+		{
+			uint64 timeStamp = 0;
+
+			LogType type = LogType::App;
+
+			String text;
+		};
+
+		// 複数のスレッドから積み、1 つのスレッドが取り出す固定長のリングバッファ
+		class RecordQueue
+		{
+		public:
+
+			explicit RecordQueue(size_t capacity);
+
+			/// @brief ログを積みます。
+			/// @remark テキストはセルが持つ文字列にコピーするため、確保済みの容量が足りていればメモリを確保しません。
+			/// @return 積んだ場合 true, いっぱいの場合は false
+			[[nodiscard]]
+			bool tryPush(uint64 timeStamp, LogType type, StringView text);
+
+			/// @brief ログを取り出します。
+			/// @remark `record` とセルの文字列を交換するため、互いの確保済みの領域を再利用します。
+			/// @return 取り出した場合 true, 空の場合は false
+			[[nodiscard]]
+			bool tryPop(Record& record);
+
+			/// @brief これまでに積まれたログの数を返します。
+			[[nodiscard]]
+			uint64 num_pushed() const noexcept;
+
+		private:
+
+			struct alignas(64) Cell
+			{
+				std::atomic<uint64> sequence{ 0 };
+
+				Record record;
+			};
+
+			std::unique_ptr<Cell[]> m_cells;
+
+			uint64 m_mask = 0;
+
+			alignas(64) std::atomic<uint64> m_enqueuePos{ 0 };
+
+			// 取り出すのはワーカースレッドのみ
+			alignas(64) uint64 m_dequeuePos = 0;
+		};
+
+		ConsoleSink m_consoleSink = nullptr;
+
+		// 同期モードの出力とファイルを保護する
+		std::mutex m_outputMutex;
+
+		std::string m_syncBuffer;
+
+		std::atomic<bool> m_async{ false };
+
+		std::atomic<LogOverflowPolicy> m_overflowPolicy{ LogOverflowPolicy::Block };
+
+		std::atomic<uint64> m_numDropped{ 0 };
+
+		// 一度作成したら破棄しない（他のスレッドが参照している可能性があるため）
+		std::unique_ptr<RecordQueue> m_queue;
+
+		std::thread m_worker;
+
+		std::mutex m_workerMutex;
+
+		std::condition_variable m_workerCV;
+
+		std::condition_variable m_flushCV;
+
+		// Block ポリシーでリングバッファの空きを待っている書き込み側を起こす
+		std::condition_variable m_spaceCV;
+
+		// m_workerMutex で保護する。空きを待っている書き込み側の数
+		size_t m_numBlockedWriters = 0;
+
+		bool m_stopRequested = false;
+
+		bool m_wakeRequested = false;
+
+		// ワーカーが出力を終えたログの数
+		uint64 m_numWritten = 0;
+
+		struct File
+		{
+			std::FILE* fp = nullptr;
+
+			FilePath path;
+
+			int64 size = 0;
+
+			int64 maxFileSize = 0;
+
+			size_t maxBackupFiles = 0;
+		} m_file;
+
+		void wakeWorker();
+
+		void notifyBlockedWriters();
+
+		void workerLoop();
+
+		void output(std::string_view text);
+
+		void rotateFile();
+
+		static void AppendRecord(std::string& buffer, uint64 timeStamp, LogType type, StringView text);
+	};
+}
@@ -81,5 +81,38 @@ namespace s3d
 		{
 			SIV3D_ENGINE(Logger)->setEnabled(true);
 		}
+
+		void Logger_impl::setAsync(const LoggerAsyncConfig& config) const
+		{
+			SIV3D_ENGINE(Logger)->setAsync(config);
+		}
+
+		void Logger_impl::setSync() const
+		{
+			SIV3D_ENGINE(Logger)->setSync();
+		}
+
+		bool Logger_impl::isAsync() const
+		{
+			return SIV3D_ENGINE(Logger)->isAsync();
+		}
+
+		void Logger_impl::flush() const
+		{
+			if (Siv3DEngine::isActive())
+			{
+				SIV3D_ENGINE(Logger)->flush();
+			}
+		}
+
+		bool Logger_impl::openFile(const LoggerFileConfig& config) const
+		{
+			return SIV3D_ENGINE(Logger)->openFile(config);
+		}
+
+		void Logger_impl::closeFile() const
+		{
+			SIV3D_ENGINE(Logger)->closeFile();
+		}
 	}
 }
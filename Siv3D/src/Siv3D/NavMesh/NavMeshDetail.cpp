@@ -9,7 +9,9 @@
 //
 //-----------------------------------------------
 
+# include <Siv3D/Threading.hpp>
 # include "NavMeshDetail.hpp"
+# include "NavMeshTiles.hpp"
 
 namespace s3d
 {
@@ -105,6 +107,170 @@ namespace s3d
 
 			return cfg;
 		}
+
+		inline constexpr Float3 Extent2D{ 2.0f, 0.0f, 2.0f };
+
+		inline constexpr Float3 Extent3D{ 2.0f, 4.0f, 2.0f };
+
+		// 経路を再利用するとき、移動後の点が指定した点からこの距離（の二乗）以上離れていたら経路探索をやり直す
+		inline constexpr float ReuseToleranceSq = (0.01f * 0.01f);
+
+		static std::atomic<uint64> NavMeshIDCounter{ 0 };
+
+		[[nodiscard]]
+		inline constexpr Float3 ToNavMeshPoint(const Float2& pos) noexcept
+		{
+			return{ pos.x, 0.0f, pos.y };
+		}
+
+		[[nodiscard]]
+		inline constexpr Float3 ToNavMeshPoint(const Vec2& pos) noexcept
+		{
+			return{ static_cast<float>(pos.x), 0.0f, static_cast<float>(pos.y) };
+		}
+
+		[[nodiscard]]
+		inline constexpr Float3 ToNavMeshPoint(const Vec3& pos) noexcept
+		{
+			return{ pos };
+		}
+
+		[[nodiscard]]
+		static dtQueryFilter MakeQueryFilter(const Array<std::pair<int32, double>>& areaCosts)
+		{
+			dtQueryFilter filter;
+
+			for (const auto& areaCost : areaCosts)
+			{
+				if (areaCost.first <= RC_WALKABLE_AREA)
+				{
+					filter.setAreaCost(areaCost.first, static_cast<float>(areaCost.second));
+				}
+			}
+
+			return filter;
+		}
+
+		static void CopyPath(const Float3* pSrc, const int32 nvertices, Array<Vec2>& dst)
+		{
+			if (nvertices <= 0)
+			{
+				return;
+			}
+
+			dst.resize(nvertices);
+
+			const Float3* pSrcEnd = (pSrc + nvertices);
+			Vec2* pDst = dst.data();
+
+			while (pSrc != pSrcEnd)
+			{
+				pDst->set(pSrc->x, pSrc->z);
+				++pDst;
+				++pSrc;
+			}
+		}
+
+		static void CopyPath(const Float3* pSrc, const int32 nvertices, Array<Vec3>& dst)
+		{
+			if (nvertices <= 0)
+			{
+				return;
+			}
+
+			dst.resize(nvertices);
+
+			const Float3* pSrcEnd = (pSrc + nvertices);
+			Vec3* pDst = dst.data();
+
+			while (pSrc != pSrcEnd)
+			{
+				*pDst++ = *pSrc++;
+			}
+		}
+
+		// 出発地点の移動で通過したポリゴンを経路の先頭につなげる (dtMergeCorridorStartMoved() と同じ処理)
+		[[nodiscard]]
+		static bool MergeCorridorStartMoved(Array<dtPolyRef>& path, const dtPolyRef* visited, const int32 nvisited, const int32 maxPath)
+		{
+			int32 furthestPath = -1;
+			int32 furthestVisited = -1;
+
+			// 経路上で最も後ろにある共通のポリゴンを探す
+			for (int32 i = (static_cast<int32>(path.size()) - 1); 0 <= i; --i)
+			{
+				for (int32 j = (nvisited - 1); 0 <= j; --j)
+				{
+					if (path[i] == visited[j])
+					{
+						furthestPath = i;
+						furthestVisited = j;
+					}
+				}
+
+				if (furthestPath != -1)
+				{
+					break;
+				}
+			}
+
+			if (furthestPath == -1)
+			{
+				return false;
+			}
+
+			const size_t newSize = (path.size() - (furthestPath + 1) + (nvisited - furthestVisited));
+
+			if (static_cast<size_t>(maxPath) < newSize)
+			{
+				return false;
+			}
+
+			path.erase(path.begin(), (path.begin() + (furthestPath + 1)));
+			path.insert(path.begin(), std::make_reverse_iterator(visited + nvisited), std::make_reverse_iterator(visited + furthestVisited));
+
+			return true;
+		}
+
+		// 目的地の移動で通過したポリゴンを経路の末尾につなげる (dtMergeCorridorEndMoved() と同じ処理)
+		[[nodiscard]]
+		static bool MergeCorridorEndMoved(Array<dtPolyRef>& path, const dtPolyRef* visited, const int32 nvisited, const int32 maxPath)
+		{
+			int32 furthestPath = -1;
+			int32 furthestVisited = -1;
+
+			// 経路上で最も前にある共通のポリゴンを探す
+			for (int32 i = 0; i < static_cast<int32>(path.size()); ++i)
+			{
+				for (int32 j = (nvisited - 1); 0 <= j; --j)
+				{
+					if (path[i] == visited[j])
+					{
+						furthestPath = i;
+						furthestVisited = j;
+					}
+				}
+
+				if (furthestPath != -1)
+				{
+					break;
+				}
+			}
+
+			if (furthestPath == -1)
+			{
+				return false;
+			}
+
+			const int32 ppos = (furthestPath + 1);
+			const int32 vpos = (furthestVisited + 1);
+			const int32 count = Min((nvisited - vpos), (maxPath - ppos));
+
+			path.resize(ppos);
+			path.insert(path.end(), (visited + vpos), (visited + vpos + count));
+
+			return true;
+		}
 	}
 
 	NavMesh::NavMeshDetail::NavMeshDetail()
@@ -119,7 +285,7 @@ namespace s3d
 
 	bool NavMesh::NavMeshDetail::isValid() const noexcept
 	{
-		return m_built;
+		return static_cast<bool>(loadSnapshot());
 	}
 
 	bool NavMesh::NavMeshDetail::build(const Array<Float2>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs, const NavMeshConfig& config)
@@ -189,191 +355,141 @@ namespace s3d
 		return true;
 	}
 
-	void NavMesh::NavMeshDetail::query(const Float2& _start, const Float2& _end, const Array<std::pair<int32, double>>& areaCosts, Array<Vec2>& dst) const
+	void NavMesh::NavMeshDetail::query(const Float2& start, const Float2& end, const Array<std::pair<int32, double>>& areaCosts, Array<Vec2>& dst) const
 	{
 		dst.clear();
 
-		if (not m_built)
+		const auto snapshot = loadSnapshot();
+
+		if ((not snapshot) || (not bindQueryContext(m_query, *snapshot)))
 		{
 			return;
 		}
 
-		dtQueryFilter filter;
-		{
-			for (const auto& areaCost : areaCosts)
-			{
-				if (areaCost.first <= RC_WALKABLE_AREA)
-				{
-					filter.setAreaCost(areaCost.first, static_cast<float>(areaCost.second));
-				}
-			}
-		}
+		const int32 nvertices = findPath(m_query, detail::ToNavMeshPoint(start), detail::ToNavMeshPoint(end), detail::Extent2D, detail::MakeQueryFilter(areaCosts));
 
-		const Float3 start{ _start.x, 0.0f, _start.y }, end{ _end.x, 0.0f, _end.y };
-		constexpr Float3 extent{ 2.0f, 0.0f, 2.0f };
+		detail::CopyPath(m_query.buffer.data(), nvertices, dst);
+	}
 
-		dtPolyRef startpoly;
-		{
-			if (dtStatusFailed(m_data.navmeshQuery.findNearestPoly(&start.x, &extent.x, &filter, &startpoly, 0)))
-			{
-				return;
-			}
+	void NavMesh::NavMeshDetail::query(const Float3& start, const Float3& end, const Array<std::pair<int32, double>>& areaCosts, Array<Vec3>& dst) const
+	{
+		dst.clear();
 
-			if (startpoly == 0)
-			{
-				return;
-			}
-		}
+		const auto snapshot = loadSnapshot();
 
-		dtPolyRef endpoly;
+		if ((not snapshot) || (not bindQueryContext(m_query, *snapshot)))
 		{
-			if (dtStatusFailed(m_data.navmeshQuery.findNearestPoly(&end.x, &extent.x, &filter, &endpoly, 0)))
-			{
-				return;
-			}
-
-			if (endpoly == 0)
-			{
-				return;
-			}
+			return;
 		}
 
-		int32 npolys = 0;
-		{
-			if (dtStatusFailed(m_data.navmeshQuery.findPath(startpoly, endpoly, &start.x, &end.x, &filter, m_polygonBuffer.data(), &npolys, PolygonBufferSize)))
-			{
-				return;
-			}
+		const int32 nvertices = findPath(m_query, start, end, detail::Extent3D, detail::MakeQueryFilter(areaCosts));
 
-			if (npolys <= 0)
-			{
-				return;
-			}
-		}
+		detail::CopyPath(m_query.buffer.data(), nvertices, dst);
+	}
 
-		float end2[3] = { end.x, end.y, end.z };
+	void NavMesh::NavMeshDetail::query(const Float2& start, const Float2& end, const Array<std::pair<int32, double>>& areaCosts, detail::NavMeshCorridorState& corridor, Array<Vec2>& dst) const
+	{
+		dst.clear();
 
-		if (m_polygonBuffer[static_cast<size_t>(npolys) - 1] != endpoly)
-		{
-			bool posOverPoly;
-			m_data.navmeshQuery.closestPointOnPoly(m_polygonBuffer[static_cast<size_t>(npolys) - 1], &end.x, end2, &posOverPoly);
-		}
+		const auto snapshot = loadSnapshot();
 
+		if ((not snapshot) || (not bindQueryContext(m_query, *snapshot)))
 		{
-			int32 nvertices = 0;
-			m_data.navmeshQuery.findStraightPath(&start.x, end2, m_polygonBuffer.data(), npolys, &m_buffer[0].x, 0, 0, &nvertices, MaxVertices);
-
-			if (nvertices)
-			{
-				dst.resize(nvertices);
+			corridor.polygons.clear();
+			return;
+		}
 
-				const Float3* pSrc = m_buffer.data();
-				const Float3* pSrcEnd = (pSrc + nvertices);
-				Vec2* pDst = dst.data();
+		const int32 nvertices = findPath(m_query, corridor, detail::ToNavMeshPoint(start), detail::ToNavMeshPoint(end), detail::Extent2D, detail::MakeQueryFilter(areaCosts));
 
-				while (pSrc != pSrcEnd)
-				{
-					pDst->set(pSrc->x, pSrc->z);
-					++pDst;
-					++pSrc;
-				}
-			}
-		}
+		detail::CopyPath(m_query.buffer.data(), nvertices, dst);
 	}
 
-	void NavMesh::NavMeshDetail::query(const Float3& start, const Float3& end, const Array<std::pair<int32, double>>& areaCosts, Array<Vec3>& dst) const
+	void NavMesh::NavMeshDetail::query(const Float3& start, const Float3& end, const Array<std::pair<int32, double>>& areaCosts, detail::NavMeshCorridorState& corridor, Array<Vec3>& dst) const
 	{
 		dst.clear();
 
-		if (not m_built)
+		const auto snapshot = loadSnapshot();
+
+		if ((not snapshot) || (not bindQueryContext(m_query, *snapshot)))
 		{
+			corridor.polygons.clear();
 			return;
 		}
 
-		dtQueryFilter filter;
-		{
-			for (const auto& areaCost : areaCosts)
-			{
-				if (areaCost.first <= RC_WALKABLE_AREA)
-				{
-					filter.setAreaCost(areaCost.first, static_cast<float>(areaCost.second));
-				}
-			}
-		}
+		const int32 nvertices = findPath(m_query, corridor, start, end, detail::Extent3D, detail::MakeQueryFilter(areaCosts));
 
-		constexpr Float3 extent{ 2.0f, 4.0f, 2.0f };
+		detail::CopyPath(m_query.buffer.data(), nvertices, dst);
+	}
 
-		dtPolyRef startpoly;
-		{
-			if (dtStatusFailed(m_data.navmeshQuery.findNearestPoly(&start.x, &extent.x, &filter, &startpoly, 0)))
-			{
-				return;
-			}
+	void NavMesh::NavMeshDetail::queryBatch(const Array<std::pair<Vec2, Vec2>>& requests, const Array<std::pair<int32, double>>& areaCosts, detail::NavMeshCorridorState* const* corridors, Array<Array<Vec2>>& dst) const
+	{
+		queryBatchImpl(requests, areaCosts, corridors, dst);
+	}
 
-			if (startpoly == 0)
-			{
-				return;
-			}
-		}
+	void NavMesh::NavMeshDetail::queryBatch(const Array<std::pair<Vec3, Vec3>>& requests, const Array<std::pair<int32, double>>& areaCosts, detail::NavMeshCorridorState* const* corridors, Array<Array<Vec3>>& dst) const
+	{
+		queryBatchImpl(requests, areaCosts, corridors, dst);
+	}
 
-		dtPolyRef endpoly;
-		{
-			if (dtStatusFailed(m_data.navmeshQuery.findNearestPoly(&end.x, &extent.x, &filter, &endpoly, 0)))
-			{
-				return;
-			}
+	template <class VectorType>
+	void NavMesh::NavMeshDetail::queryBatchImpl(const Array<std::pair<VectorType, VectorType>>& requests, const Array<std::pair<int32, double>>& areaCosts, detail::NavMeshCorridorState* const* corridors, Array<Array<VectorType>>& dst) const
+	{
+		dst.resize(requests.size());
 
-			if (endpoly == 0)
-			{
-				return;
-			}
-		}
+		const auto snapshot = loadSnapshot();
 
-		int32 npolys = 0;
+		if (not snapshot)
 		{
-			if (dtStatusFailed(m_data.navmeshQuery.findPath(startpoly, endpoly, &start.x, &end.x, &filter, m_polygonBuffer.data(), &npolys, PolygonBufferSize)))
+			for (size_t i = 0; i < requests.size(); ++i)
 			{
-				return;
-			}
+				dst[i].clear();
 
-			if (npolys <= 0)
-			{
-				return;
+				if (corridors)
+				{
+					corridors[i]->polygons.clear();
+				}
 			}
+
+			return;
 		}
 
-		float end2[3] = { end.x, end.y, end.z };
+		const dtQueryFilter filter = detail::MakeQueryFilter(areaCosts);
+		const Float3 extent = (std::is_same_v<VectorType, Vec2> ? detail::Extent2D : detail::Extent3D);
 
-		if (m_polygonBuffer[static_cast<size_t>(npolys) - 1] != endpoly)
+		Threading::ParallelFor(requests.size(), [&](const size_t first, const size_t last)
 		{
-			bool posOverPoly;
-			m_data.navmeshQuery.closestPointOnPoly(m_polygonBuffer[static_cast<size_t>(npolys) - 1], &end.x, end2, &posOverPoly);
-		}
+			std::unique_ptr<QueryContext> context = acquireQueryContext();
 
-		{
-			int32 nvertices = 0;
-			m_data.navmeshQuery.findStraightPath(&start.x, end2, m_polygonBuffer.data(), npolys, &m_buffer[0].x, 0, 0, &nvertices, MaxVertices);
+			if (not bindQueryContext(*context, *snapshot))
+			{
+				throw std::bad_alloc{};
+			}
 
-			if (nvertices)
+			for (size_t i = first; i < last; ++i)
 			{
-				dst.resize(nvertices);
+				const Float3 start = detail::ToNavMeshPoint(requests[i].first);
+				const Float3 end = detail::ToNavMeshPoint(requests[i].second);
 
-				const Float3* pSrc = m_buffer.data();
-				const Float3* pSrcEnd = (pSrc + nvertices);
-				Vec3* pDst = dst.data();
+				const int32 nvertices = (corridors ? findPath(*context, *corridors[i], start, end, extent, filter)
+					: findPath(*context, start, end, extent, filter));
 
-				while (pSrc != pSrcEnd)
-				{
-					*pDst++ = *pSrc++;
-				}
+				dst[i].clear();
+				detail::CopyPath(context->buffer.data(), nvertices, dst[i]);
 			}
-		}
+
+			releaseQueryContext(std::move(context));
+		}, BatchGrainSize);
 	}
 
 	bool NavMesh::NavMeshDetail::build(const NavMeshConfig& config, const NavMeshAABB& aabb,
 		const Array<Float3>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs)
 	{
-		assert(not m_built);
+		assert(not isValid());
+
+		if (0 < config.tileSize)
+		{
+			return buildTiles(config, aabb, vertices, indices, areaIDs);
+		}
 
 		init();
 
@@ -466,22 +582,172 @@ namespace s3d
 			return false;
 		}
 
-		m_data.navmesh->init(m_navData, m_navDataSize, DT_TILE_FREE_DATA);
+		auto navmesh = std::shared_ptr<dtNavMesh>(dtAllocNavMesh(), dtFreeNavMesh);
 
-		if (dtStatusFailed(m_data.navmeshQuery.init(m_data.navmesh.get(), 2048)))
+		if (not navmesh)
 		{
+			dtFree(m_navData);
 			return false;
 		}
 
-		m_buffer.resize(MaxVertices);
+		if (dtStatusFailed(navmesh->init(m_navData, m_navDataSize, DT_TILE_FREE_DATA)))
+		{
+			dtFree(m_navData);
+			return false;
+		}
 
-		m_polygonBuffer.resize(PolygonBufferSize);
+		storeSnapshot(std::move(navmesh));
 
-		m_built = true;
+		return true;
+	}
+
+	bool NavMesh::NavMeshDetail::buildTiles(const NavMeshConfig& config, const NavMeshAABB& aabb,
+		const Array<Float3>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs)
+	{
+		auto tiles = std::make_shared<NavMeshTiles>(config, aabb);
+
+		if (not tiles->init())
+		{
+			return false;
+		}
+
+		// ID 0 の地形データとして登録する
+		if (not tiles->addGeometry(Array<Float3>(vertices), indices, areaIDs, false))
+		{
+			return false;
+		}
+
+		{
+			std::lock_guard lock{ m_mutex };
+
+			m_tiles = tiles;
+		}
+
+		const std::shared_ptr<NavMeshTileRebuildJob> job = tiles->beginRebuild();
+
+		if (not rebuildTiles(*job))
+		{
+			release();
+			return false;
+		}
 
 		return true;
 	}
 
+	bool NavMesh::NavMeshDetail::isTiled() const noexcept
+	{
+		return static_cast<bool>(loadTiles());
+	}
+
+	Optional<NavMeshGeometryID> NavMesh::NavMeshDetail::addGeometry(Array<Float3>&& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs, const bool isObstacle)
+	{
+		if (const auto tiles = loadTiles())
+		{
+			return tiles->addGeometry(std::move(vertices), indices, areaIDs, isObstacle);
+		}
+
+		return none;
+	}
+
+	bool NavMesh::NavMeshDetail::updateGeometry(const NavMeshGeometryID id, Array<Float3>&& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs, const bool isObstacle)
+	{
+		if (const auto tiles = loadTiles())
+		{
+			return tiles->updateGeometry(id, std::move(vertices), indices, areaIDs, isObstacle);
+		}
+
+		return false;
+	}
+
+	bool NavMesh::NavMeshDetail::removeGeometry(const NavMeshGeometryID id)
+	{
+		if (const auto tiles = loadTiles())
+		{
+			return tiles->removeGeometry(id);
+		}
+
+		return false;
+	}
+
+	size_t NavMesh::NavMeshDetail::num_dirtyTiles() const
+	{
+		if (const auto tiles = loadTiles())
+		{
+			return tiles->num_dirtyTiles();
+		}
+
+		return 0;
+	}
+
+	std::shared_ptr<NavMeshTileRebuildJob> NavMesh::NavMeshDetail::beginRebuildTiles()
+	{
+		if (const auto tiles = loadTiles())
+		{
+			return tiles->beginRebuild();
+		}
+
+		return nullptr;
+	}
+
+	bool NavMesh::NavMeshDetail::rebuildTiles(const NavMeshTileRebuildJob& job)
+	{
+		std::lock_guard rebuildLock{ m_rebuildMutex };
+
+		if (job.tilePositions.isEmpty() && isValid())
+		{
+			return true;
+		}
+
+		bool succeeded = true;
+
+		std::shared_ptr<dtNavMesh> navmesh = job.tiles->rebuild(job, succeeded);
+
+		if (not navmesh)
+		{
+			return false;
+		}
+
+		auto snapshot = std::make_shared<const Snapshot>(Snapshot{ std::move(navmesh), ++detail::NavMeshIDCounter });
+
+		{
+			// 確認と差し替えの間に build() や release() が割り込まないよう、同じロックの中で行う
+			std::lock_guard lock{ m_mutex };
+
+			// 再構築の間に build() や release() が呼ばれた
+			if (m_tiles != job.tiles)
+			{
+				return false;
+			}
+
+			m_snapshot = std::move(snapshot);
+		}
+
+		return succeeded;
+	}
+
+	std::shared_ptr<const NavMesh::NavMeshDetail::Snapshot> NavMesh::NavMeshDetail::loadSnapshot() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_snapshot;
+	}
+
+	void NavMesh::NavMeshDetail::storeSnapshot(std::shared_ptr<dtNavMesh> navmesh)
+	{
+		auto snapshot = std::make_shared<const Snapshot>(Snapshot{ std::move(navmesh), ++detail::NavMeshIDCounter });
+
+		std::lock_guard lock{ m_mutex };
+
+		m_snapshot = std::move(snapshot);
+	}
+
+	std::shared_ptr<NavMeshTiles> NavMesh::NavMeshDetail::loadTiles() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_tiles;
+	}
+
 	void NavMesh::NavMeshDetail::init()
 	{
 		try
@@ -515,8 +781,6 @@ namespace s3d
 			{
 				throw std::bad_alloc();
 			}
-
-			m_data.navmesh = std::shared_ptr<dtNavMesh>(dtAllocNavMesh(), dtFreeNavMesh);
 		}
 		catch (...)
 		{
@@ -526,14 +790,248 @@ namespace s3d
 		}
 	}
 
+	bool NavMesh::NavMeshDetail::bindQueryContext(QueryContext& context, const Snapshot& snapshot) const
+	{
+		if (context.navMeshID == snapshot.navMeshID)
+		{
+			return true;
+		}
+
+		if (dtStatusFailed(context.navmeshQuery.init(snapshot.navmesh.get(), MaxNodes)))
+		{
+			context.navMeshID = 0;
+			return false;
+		}
+
+		context.buffer.resize(MaxVertices);
+
+		context.polygonBuffer.resize(PolygonBufferSize);
+
+		context.navMeshID = snapshot.navMeshID;
+
+		return true;
+	}
+
+	std::unique_ptr<NavMesh::NavMeshDetail::QueryContext> NavMesh::NavMeshDetail::acquireQueryContext() const
+	{
+		{
+			std::lock_guard lock{ m_queryPoolMutex };
+
+			if (m_queryPool)
+			{
+				std::unique_ptr<QueryContext> context = std::move(m_queryPool.back());
+				m_queryPool.pop_back();
+				return context;
+			}
+		}
+
+		return std::make_unique<QueryContext>();
+	}
+
+	void NavMesh::NavMeshDetail::releaseQueryContext(std::unique_ptr<QueryContext>&& context) const
+	{
+		std::lock_guard lock{ m_queryPoolMutex };
+
+		m_queryPool.push_back(std::move(context));
+	}
+
+	int32 NavMesh::NavMeshDetail::findPath(QueryContext& context, const Float3& start, const Float3& end, const Float3& extent, const dtQueryFilter& filter) const
+	{
+		const dtNavMeshQuery& navmeshQuery = context.navmeshQuery;
+
+		dtPolyRef startpoly;
+		{
+			if (dtStatusFailed(navmeshQuery.findNearestPoly(&start.x, &extent.x, &filter, &startpoly, 0)))
+			{
+				return 0;
+			}
+
+			if (startpoly == 0)
+			{
+				return 0;
+			}
+		}
+
+		dtPolyRef endpoly;
+		{
+			if (dtStatusFailed(navmeshQuery.findNearestPoly(&end.x, &extent.x, &filter, &endpoly, 0)))
+			{
+				return 0;
+			}
+
+			if (endpoly == 0)
+			{
+				return 0;
+			}
+		}
+
+		int32 npolys = 0;
+		{
+			if (dtStatusFailed(navmeshQuery.findPath(startpoly, endpoly, &start.x, &end.x, &filter, context.polygonBuffer.data(), &npolys, PolygonBufferSize)))
+			{
+				return 0;
+			}
+
+			if (npolys <= 0)
+			{
+				return 0;
+			}
+		}
+
+		return findStraightPath(context, start, end, context.polygonBuffer.data(), npolys, endpoly);
+	}
+
+	int32 NavMesh::NavMeshDetail::findPath(QueryContext& context, detail::NavMeshCorridorState& corridor, const Float3& start, const Float3& end, const Float3& extent, const dtQueryFilter& filter) const
+	{
+		static_assert(std::is_same_v<dtPolyRef, uint32>);
+
+		if ((corridor.navMeshID == context.navMeshID)
+			&& corridor.polygons
+			&& moveCorridor(context, corridor, start, end, filter))
+		{
+			const dtPolyRef* polygons = corridor.polygons.data();
+			const int32 npolys = static_cast<int32>(corridor.polygons.size());
+
+			return findStraightPath(context, corridor.start, corridor.end, polygons, npolys, polygons[npolys - 1]);
+		}
+
+		// 経路探索を最初から行う
+		const dtNavMeshQuery& navmeshQuery = context.navmeshQuery;
+
+		corridor.polygons.clear();
+		corridor.navMeshID = context.navMeshID;
+		++corridor.searchCount;
+
+		dtPolyRef startpoly, endpoly;
+		Float3 nearestStart, nearestEnd;
+		{
+			if (dtStatusFailed(navmeshQuery.findNearestPoly(&start.x, &extent.x, &filter, &startpoly, &nearestStart.x))
+				|| (startpoly == 0))
+			{
+				return 0;
+			}
+
+			if (dtStatusFailed(navmeshQuery.findNearestPoly(&end.x, &extent.x, &filter, &endpoly, &nearestEnd.x))
+				|| (endpoly == 0))
+			{
+				return 0;
+			}
+		}
+
+		int32 npolys = 0;
+		{
+			if (dtStatusFailed(navmeshQuery.findPath(startpoly, endpoly, &nearestStart.x, &nearestEnd.x, &filter, context.polygonBuffer.data(), &npolys, PolygonBufferSize))
+				|| (npolys <= 0))
+			{
+				return 0;
+			}
+		}
+
+		const dtPolyRef lastpoly = context.polygonBuffer[static_cast<size_t>(npolys) - 1];
+
+		// 目的地に到達できない場合は、最も近い点を次回の目的地とする
+		if (lastpoly != endpoly)
+		{
+			bool posOverPoly;
+			navmeshQuery.closestPointOnPoly(lastpoly, &end.x, &nearestEnd.x, &posOverPoly);
+		}
+
+		corridor.polygons.assign(context.polygonBuffer.begin(), (context.polygonBuffer.begin() + npolys));
+		corridor.start = nearestStart;
+		corridor.end = nearestEnd;
+
+		return findStraightPath(context, nearestStart, nearestEnd, context.polygonBuffer.data(), npolys, lastpoly);
+	}
+
+	bool NavMesh::NavMeshDetail::moveCorridor(QueryContext& context, detail::NavMeshCorridorState& corridor, const Float3& start, const Float3& end, const dtQueryFilter& filter) const
+	{
+		const dtNavMeshQuery& navmeshQuery = context.navmeshQuery;
+		Array<dtPolyRef>& polygons = corridor.polygons;
+
+		for (const auto& polygon : polygons)
+		{
+			if (not navmeshQuery.isValidPolyRef(polygon, &filter))
+			{
+				return false;
+			}
+		}
+
+		dtPolyRef visited[MaxVisitedPolygons];
+		int32 nvisited = 0;
+
+		// 出発地点を移動し、通過したポリゴンを経路の先頭に加える
+		{
+			Float3 result;
+
+			if (dtStatusFailed(navmeshQuery.moveAlongSurface(polygons.front(), &corridor.start.x, &start.x, &filter, &result.x, visited, &nvisited, MaxVisitedPolygons))
+				|| (detail::ReuseToleranceSq < dtVdist2DSqr(&result.x, &start.x)))
+			{
+				// 壁に遮られたか、移動距離が大きすぎる
+				return false;
+			}
+
+			if (not detail::MergeCorridorStartMoved(polygons, visited, nvisited, PolygonBufferSize))
+			{
+				return false;
+			}
+
+			corridor.start = result;
+		}
+
+		// 目的地を移動し、通過したポリゴンを経路の末尾に加える
+		{
+			Float3 result;
+
+			if (dtStatusFailed(navmeshQuery.moveAlongSurface(polygons.back(), &corridor.end.x, &end.x, &filter, &result.x, visited, &nvisited, MaxVisitedPolygons))
+				|| (detail::ReuseToleranceSq < dtVdist2DSqr(&result.x, &end.x)))
+			{
+				return false;
+			}
+
+			if (not detail::MergeCorridorEndMoved(polygons, visited, nvisited, PolygonBufferSize))
+			{
+				return false;
+			}
+
+			corridor.end = result;
+		}
+
+		return true;
+	}
+
+	int32 NavMesh::NavMeshDetail::findStraightPath(QueryContext& context, const Float3& start, const Float3& end, const dtPolyRef* polygons, const int32 npolys, const dtPolyRef endpoly) const
+	{
+		float end2[3] = { end.x, end.y, end.z };
+
+		if (polygons[npolys - 1] != endpoly)
+		{
+			bool posOverPoly;
+			context.navmeshQuery.closestPointOnPoly(polygons[npolys - 1], &end.x, end2, &posOverPoly);
+		}
+
+		int32 nvertices = 0;
+		context.navmeshQuery.findStraightPath(&start.x, end2, polygons, npolys, &context.buffer[0].x, 0, 0, &nvertices, MaxVertices);
+
+		return nvertices;
+	}
+
 	void NavMesh::NavMeshDetail::release()
 	{
-		if (not m_built)
 		{
-			return;
+			std::lock_guard lock{ m_mutex };
+
+			m_snapshot.reset();
+
+			m_tiles.reset();
+		}
+
+		{
+			std::lock_guard lock{ m_queryPoolMutex };
+
+			m_queryPool.clear();
 		}
 
-		m_data.navmesh.reset();
+		m_query.navMeshID = 0;
 
 		if (m_data.dmesh)
 		{
@@ -564,7 +1062,5 @@ namespace s3d
 			rcFreeHeightField(m_data.hf);
 			m_data.hf = nullptr;
 		}
-
-		m_built = false;
 	}
 }
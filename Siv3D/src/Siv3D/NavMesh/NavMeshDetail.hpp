@@ -11,6 +11,7 @@
 
 # pragma once
 # include <cfloat>
+# include <mutex>
 # include <Siv3D/NavMesh.hpp>
 # include <RecastDetour/Recast.h>
 # include <RecastDetour/DetourCommon.h>
@@ -27,6 +28,16 @@ namespace s3d
 		float bmax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
 	};
 
+	class NavMeshTiles;
+
+	struct NavMeshTileRebuildJob;
+
+	namespace detail
+	{
+		[[nodiscard]]
+		rcConfig MakeConfig(const NavMeshConfig& config, const NavMeshAABB& aabb);
+	}
+
 	class NavMesh::NavMeshDetail
 	{
 	public:
@@ -45,12 +56,77 @@ namespace s3d
 
 		void query(const Float3& start, const Float3& end, const Array<std::pair<int32, double>>& areaCosts, Array<Vec3>& dst) const;
 
+		void query(const Float2& start, const Float2& end, const Array<std::pair<int32, double>>& areaCosts, detail::NavMeshCorridorState& corridor, Array<Vec2>& dst) const;
+
+		void query(const Float3& start, const Float3& end, const Array<std::pair<int32, double>>& areaCosts, detail::NavMeshCorridorState& corridor, Array<Vec3>& dst) const;
+
+		/// @brief 複数の経路をスレッドプールで並列に計算します。
+		/// @param corridors 各経路の前回の経路へのポインタの配列。使わない場合は nullptr
+		void queryBatch(const Array<std::pair<Vec2, Vec2>>& requests, const Array<std::pair<int32, double>>& areaCosts, detail::NavMeshCorridorState* const* corridors, Array<Array<Vec2>>& dst) const;
+
+		void queryBatch(const Array<std::pair<Vec3, Vec3>>& requests, const Array<std::pair<int32, double>>& areaCosts, detail::NavMeshCorridorState* const* corridors, Array<Array<Vec3>>& dst) const;
+
+		[[nodiscard]]
+		bool isTiled() const noexcept;
+
+		[[nodiscard]]
+		Optional<NavMeshGeometryID> addGeometry(Array<Float3>&& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs, bool isObstacle);
+
+		[[nodiscard]]
+		bool updateGeometry(NavMeshGeometryID id, Array<Float3>&& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs, bool isObstacle);
+
+		[[nodiscard]]
+		bool removeGeometry(NavMeshGeometryID id);
+
+		[[nodiscard]]
+		size_t num_dirtyTiles() const;
+
+		/// @brief 再構築が必要なタイルと、現在の地形データを取り出します。
+		/// @return 再構築の内容。タイルに分割されていない場合は nullptr
+		[[nodiscard]]
+		std::shared_ptr<NavMeshTileRebuildJob> beginRebuildTiles();
+
+		/// @brief タイルを再構築し、経路探索に使うナビメッシュを差し替えます。
+		/// @remark 任意のスレッドから呼び出せます。
+		[[nodiscard]]
+		bool rebuildTiles(const NavMeshTileRebuildJob& job);
+
 	private:
 
 		static constexpr int32 MaxVertices = 8192;
 
 		static constexpr int32 PolygonBufferSize = 8192;
 
+		static constexpr int32 MaxNodes = 2048;
+
+		// queryBatch() で 1 つのタスクが処理する経路の最小数
+		static constexpr size_t BatchGrainSize = 16;
+
+		// 経路を再利用するときに、1 回の移動で通過できるポリゴンの最大数
+		static constexpr int32 MaxVisitedPolygons = 16;
+
+		// 経路探索に使う構築済みのナビメッシュ。タイルの再構築後は新しいものに差し替えられる
+		struct Snapshot
+		{
+			std::shared_ptr<dtNavMesh> navmesh;
+
+			// 構築ごとに異なる値。NavMeshCorridor が古いナビメッシュの経路を再利用しないようにする
+			uint64 navMeshID = 0;
+		};
+
+		// 1 つのスレッドが経路探索に使うオブジェクト
+		struct QueryContext
+		{
+			dtNavMeshQuery navmeshQuery;
+
+			Array<Float3> buffer;
+
+			Array<dtPolyRef> polygonBuffer;
+
+			// navmeshQuery が参照しているナビメッシュの ID
+			uint64 navMeshID = 0;
+		};
+
 		struct Data
 		{
 			rcContext ctx;
@@ -65,25 +141,73 @@ namespace s3d
 
 			rcPolyMeshDetail* dmesh = nullptr;
 
-			std::shared_ptr<dtNavMesh> navmesh;
-
-			dtNavMeshQuery navmeshQuery;
-
 		} m_data;
 
 		unsigned char* m_navData = nullptr;
 
 		int32 m_navDataSize = 0;
 
-		bool m_built = false;
+		std::shared_ptr<const Snapshot> m_snapshot;
+
+		// タイルに分割しない場合は nullptr
+		std::shared_ptr<NavMeshTiles> m_tiles;
+
+		// m_snapshot と m_tiles を保護する
+		mutable std::mutex m_mutex;
 
-		mutable Array<Float3> m_buffer;
+		// タイルの再構築を 1 つずつ行う
+		std::mutex m_rebuildMutex;
 
-		mutable Array<dtPolyRef> m_polygonBuffer;
+		// query() 用
+		mutable QueryContext m_query;
+
+		// queryBatch() のワーカースレッド用
+		mutable Array<std::unique_ptr<QueryContext>> m_queryPool;
+
+		mutable std::mutex m_queryPoolMutex;
 
 		bool build(const NavMeshConfig& config, const NavMeshAABB& aabb,
 			const Array<Float3>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs);
 
+		bool buildTiles(const NavMeshConfig& config, const NavMeshAABB& aabb,
+			const Array<Float3>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs);
+
+		[[nodiscard]]
+		std::shared_ptr<const Snapshot> loadSnapshot() const;
+
+		void storeSnapshot(std::shared_ptr<dtNavMesh> navmesh);
+
+		[[nodiscard]]
+		std::shared_ptr<NavMeshTiles> loadTiles() const;
+
+		/// @brief 探索用オブジェクトが `snapshot` のナビメッシュを参照するようにします。
+		[[nodiscard]]
+		bool bindQueryContext(QueryContext& context, const Snapshot& snapshot) const;
+
+		[[nodiscard]]
+		std::unique_ptr<QueryContext> acquireQueryContext() const;
+
+		void releaseQueryContext(std::unique_ptr<QueryContext>&& context) const;
+
+		/// @brief 経路を計算し、経路上の頂点を `context.buffer` に格納します。
+		/// @return 経路上の頂点の数
+		[[nodiscard]]
+		int32 findPath(QueryContext& context, const Float3& start, const Float3& end, const Float3& extent, const dtQueryFilter& filter) const;
+
+		/// @brief 前回の経路を再利用して経路を計算し、経路上の頂点を `context.buffer` に格納します。
+		/// @return 経路上の頂点の数
+		[[nodiscard]]
+		int32 findPath(QueryContext& context, detail::NavMeshCorridorState& corridor, const Float3& start, const Float3& end, const Float3& extent, const dtQueryFilter& filter) const;
+
+		[[nodiscard]]
+		bool moveCorridor(QueryContext& context, detail::NavMeshCorridorState& corridor, const Float3& start, const Float3& end, const dtQueryFilter& filter) const;
+
+		[[nodiscard]]
+		int32 findStraightPath(QueryContext& context, const Float3& start, const Float3& end, const dtPolyRef* polygons, int32 npolys, dtPolyRef endpoly) const;
+
+		template <class VectorType>
+		void queryBatchImpl(const Array<std::pair<VectorType, VectorType>>& requests, const Array<std::pair<int32, double>>& areaCosts, detail::NavMeshCorridorState* const* corridors, Array<Array<VectorType>>& dst) const;
+
 		void init();
 
 		void release();
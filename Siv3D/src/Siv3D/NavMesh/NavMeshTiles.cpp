@@ -0,0 +1,569 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Threading.hpp>
+# include "NavMeshTiles.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// dtPolyRef (32-bit) のうち、タイルとポリゴンの番号に使えるビット数
+		inline constexpr uint32 TileAndPolygonBits = 22;
+
+		inline constexpr uint32 MaxTileBits = 14;
+
+		template <class Type, void(*Deleter)(Type*)>
+		struct RecastDeleter
+		{
+			void operator ()(Type* p) const noexcept
+			{
+				Deleter(p);
+			}
+		};
+
+		template <class Type, void(*Deleter)(Type*)>
+		using RecastPtr = std::unique_ptr<Type, RecastDeleter<Type, Deleter>>;
+	}
+
+	NavMeshTiles::NavMeshTiles(const NavMeshConfig& config, const NavMeshAABB& aabb)
+		: m_config{ detail::MakeConfig(config, aabb) }
+	{
+		m_config.tileSize	= config.tileSize;
+		m_config.borderSize	= (m_config.walkableRadius + 3);
+		m_config.width		= (m_config.tileSize + m_config.borderSize * 2);
+		m_config.height		= (m_config.tileSize + m_config.borderSize * 2);
+
+		m_tileWorldSize = (m_config.tileSize * m_config.cs);
+
+		if (0.0f < m_tileWorldSize)
+		{
+			m_tilesX = Max(static_cast<int32>(std::ceil((aabb.bmax[0] - aabb.bmin[0]) / m_tileWorldSize)), 1);
+			m_tilesY = Max(static_cast<int32>(std::ceil((aabb.bmax[2] - aabb.bmin[2]) / m_tileWorldSize)), 1);
+		}
+
+		std::memset(&m_params, 0, sizeof(m_params));
+		rcVcopy(m_params.orig, aabb.bmin);
+	}
+
+	bool NavMeshTiles::init()
+	{
+		if ((m_config.tileSize <= 0) || (not (0.0f < m_tileWorldSize)))
+		{
+			return false;
+		}
+
+		const uint32 tileCount = static_cast<uint32>(m_tilesX * m_tilesY);
+		const uint32 tileBits = dtIlog2(dtNextPow2(tileCount));
+
+		if (detail::MaxTileBits < tileBits)
+		{
+			return false;
+		}
+
+		const uint32 polygonBits = (detail::TileAndPolygonBits - tileBits);
+
+		m_params.tileWidth	= m_tileWorldSize;
+		m_params.tileHeight	= m_tileWorldSize;
+		m_params.maxTiles	= (1 << tileBits);
+		m_params.maxPolys	= (1 << polygonBits);
+
+		return true;
+	}
+
+	Optional<NavMeshGeometryID> NavMeshTiles::addGeometry(Array<Float3>&& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs, const bool isObstacle)
+	{
+		std::shared_ptr<NavMeshGeometry> geometry = makeGeometry(std::move(vertices), indices, areaIDs, isObstacle);
+
+		if (not geometry)
+		{
+			return none;
+		}
+
+		std::lock_guard lock{ m_mutex };
+
+		const NavMeshGeometryID id = m_nextGeometryID++;
+
+		markDirty(*geometry);
+
+		m_geometries.emplace(id, std::move(geometry));
+
+		return id;
+	}
+
+	bool NavMeshTiles::updateGeometry(const NavMeshGeometryID id, Array<Float3>&& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs, const bool isObstacle)
+	{
+		std::shared_ptr<NavMeshGeometry> geometry = makeGeometry(std::move(vertices), indices, areaIDs, isObstacle);
+
+		if (not geometry)
+		{
+			return false;
+		}
+
+		std::lock_guard lock{ m_mutex };
+
+		auto it = m_geometries.find(id);
+
+		if ((it == m_geometries.end())
+			|| (it->second->isObstacle != isObstacle))
+		{
+			return false;
+		}
+
+		// 以前の地形データと新しい地形データの両方と重なるタイルを再構築する
+		markDirty(*it->second);
+		markDirty(*geometry);
+
+		it->second = std::move(geometry);
+
+		return true;
+	}
+
+	bool NavMeshTiles::removeGeometry(const NavMeshGeometryID id)
+	{
+		std::lock_guard lock{ m_mutex };
+
+		auto it = m_geometries.find(id);
+
+		if (it == m_geometries.end())
+		{
+			return false;
+		}
+
+		markDirty(*it->second);
+
+		m_geometries.erase(it);
+
+		return true;
+	}
+
+	size_t NavMeshTiles::num_dirtyTiles() const
+	{
+		std::lock_guard lock{ m_mutex };
+
+		return m_dirtyTiles.size();
+	}
+
+	std::shared_ptr<NavMeshTileRebuildJob> NavMeshTiles::beginRebuild()
+	{
+		auto job = std::make_shared<NavMeshTileRebuildJob>();
+		job->tiles = shared_from_this();
+
+		std::lock_guard lock{ m_mutex };
+
+		job->tilePositions.reserve(m_dirtyTiles.size());
+
+		for (const auto& tilePos : m_dirtyTiles)
+		{
+			job->tilePositions << tilePos;
+		}
+
+		m_dirtyTiles.clear();
+
+		// 障害物が重なる場合の結果が変わらないよう、追加した順に処理する
+		Array<std::pair<NavMeshGeometryID, std::shared_ptr<const NavMeshGeometry>>> geometries(m_geometries.begin(), m_geometries.end());
+		std::sort(geometries.begin(), geometries.end(), [](const auto& a, const auto& b) { return (a.first < b.first); });
+
+		job->geometries.reserve(geometries.size());
+
+		for (auto& geometry : geometries)
+		{
+			job->geometries << std::move(geometry.second);
+		}
+
+		job->generation = ++m_generation;
+
+		return job;
+	}
+
+	std::shared_ptr<dtNavMesh> NavMeshTiles::rebuild(const NavMeshTileRebuildJob& job, bool& succeeded)
+	{
+		const size_t count = job.tilePositions.size();
+		Array<Array<uint8>> tileData(count);
+		Array<uint8> built(count, false);
+
+		Threading::ParallelFor(count, [&](const size_t i)
+		{
+			built[i] = buildTile(job.tilePositions[i], job.geometries, tileData[i]);
+		}, 1);
+
+		Array<Point> failedTiles;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (not built[i])
+			{
+				// 構築に失敗したタイルは以前のデータを残し、次の再構築で再び構築する
+				succeeded = false;
+				failedTiles << job.tilePositions[i];
+				continue;
+			}
+
+			Tile& tile = m_tiles[job.tilePositions[i]];
+
+			// 後から開始した再構築の結果を古い結果で上書きしない
+			if (tile.generation <= job.generation)
+			{
+				tile.data = std::move(tileData[i]);
+				tile.generation = job.generation;
+			}
+		}
+
+		if (failedTiles)
+		{
+			std::lock_guard lock{ m_mutex };
+
+			for (const auto& tilePos : failedTiles)
+			{
+				m_dirtyTiles.insert(tilePos);
+			}
+		}
+
+		// 探索中のナビメッシュには手を加えず、すべてのタイルを含む新しいナビメッシュを作る
+		auto navmesh = std::shared_ptr<dtNavMesh>(dtAllocNavMesh(), dtFreeNavMesh);
+
+		if ((not navmesh)
+			|| dtStatusFailed(navmesh->init(&m_params)))
+		{
+			return nullptr;
+		}
+
+		for (const auto& tile : m_tiles)
+		{
+			const Array<uint8>& data = tile.second.data;
+
+			if (not data)
+			{
+				continue;
+			}
+
+			// dtNavMesh::addTile() はデータを書き換えるため、複製を渡す
+			unsigned char* pData = static_cast<unsigned char*>(dtAlloc(static_cast<int32>(data.size()), DT_ALLOC_PERM));
+
+			if (not pData)
+			{
+				return nullptr;
+			}
+
+			std::memcpy(pData, data.data(), data.size());
+
+			if (dtStatusFailed(navmesh->addTile(pData, static_cast<int32>(data.size()), DT_TILE_FREE_DATA, 0, nullptr)))
+			{
+				dtFree(pData);
+				succeeded = false;
+			}
+		}
+
+		return navmesh;
+	}
+
+	std::shared_ptr<NavMeshGeometry> NavMeshTiles::makeGeometry(Array<Float3>&& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs, const bool isObstacle) const
+	{
+		if ((not vertices)
+			|| (not indices))
+		{
+			return nullptr;
+		}
+
+		if (areaIDs && (areaIDs.size() != indices.size()))
+		{
+			return nullptr;
+		}
+
+		if (not areaIDs.all([](uint8 id) { return (id <= RC_WALKABLE_AREA); }))
+		{
+			return nullptr;
+		}
+
+		const size_t num_vertices = vertices.size();
+
+		if (not indices.all([=](const TriangleIndex& t) { return ((t.i0 < num_vertices) && (t.i1 < num_vertices) && (t.i2 < num_vertices)); }))
+		{
+			return nullptr;
+		}
+
+		auto geometry = std::make_shared<NavMeshGeometry>();
+		geometry->vertices		= std::move(vertices);
+		geometry->indices		= indices;
+		geometry->areaIDs		= (areaIDs ? areaIDs : Array<uint8>(indices.size(), 1));
+		geometry->isObstacle	= isObstacle;
+
+		for (const auto& vertex : geometry->vertices)
+		{
+			geometry->aabb.bmin[0] = Min(geometry->aabb.bmin[0], vertex.x);
+			geometry->aabb.bmin[1] = Min(geometry->aabb.bmin[1], vertex.y);
+			geometry->aabb.bmin[2] = Min(geometry->aabb.bmin[2], vertex.z);
+
+			geometry->aabb.bmax[0] = Max(geometry->aabb.bmax[0], vertex.x);
+			geometry->aabb.bmax[1] = Max(geometry->aabb.bmax[1], vertex.y);
+			geometry->aabb.bmax[2] = Max(geometry->aabb.bmax[2], vertex.z);
+		}
+
+		// 境界領域を含めたタイルの範囲と重なる三角形を、タイルごとに振り分ける
+		const float border = (m_config.borderSize * m_config.cs);
+
+		for (uint32 i = 0; i < indices.size(); ++i)
+		{
+			const TriangleIndex& triangle = indices[i];
+			const Float3& p0 = geometry->vertices[triangle.i0];
+			const Float3& p1 = geometry->vertices[triangle.i1];
+			const Float3& p2 = geometry->vertices[triangle.i2];
+
+			const float minX = (Min(Min(p0.x, p1.x), p2.x) - border - m_params.orig[0]);
+			const float maxX = (Max(Max(p0.x, p1.x), p2.x) + border - m_params.orig[0]);
+			const float minZ = (Min(Min(p0.z, p1.z), p2.z) - border - m_params.orig[2]);
+			const float maxZ = (Max(Max(p0.z, p1.z), p2.z) + border - m_params.orig[2]);
+
+			const int32 tx0 = Max(static_cast<int32>(std::floor(minX / m_tileWorldSize)), 0);
+			const int32 tx1 = Min(static_cast<int32>(std::floor(maxX / m_tileWorldSize)), (m_tilesX - 1));
+			const int32 ty0 = Max(static_cast<int32>(std::floor(minZ / m_tileWorldSize)), 0);
+			const int32 ty1 = Min(static_cast<int32>(std::floor(maxZ / m_tileWorldSize)), (m_tilesY - 1));
+
+			for (int32 ty = ty0; ty <= ty1; ++ty)
+			{
+				for (int32 tx = tx0; tx <= tx1; ++tx)
+				{
+					geometry->trianglesByTile[Point{ tx, ty }] << i;
+				}
+			}
+		}
+
+		return geometry;
+	}
+
+	void NavMeshTiles::markDirty(const NavMeshGeometry& geometry)
+	{
+		for (const auto& tile : geometry.trianglesByTile)
+		{
+			m_dirtyTiles.insert(tile.first);
+		}
+	}
+
+	bool NavMeshTiles::buildTile(const Point& tilePos, const Array<std::shared_ptr<const NavMeshGeometry>>& geometries, Array<uint8>& dst) const
+	{
+		dst.clear();
+
+		rcConfig cfg = m_config;
+		cfg.bmin[0] = (m_params.orig[0] + tilePos.x * m_tileWorldSize);
+		cfg.bmin[1] = FLT_MAX;
+		cfg.bmin[2] = (m_params.orig[2] + tilePos.y * m_tileWorldSize);
+		cfg.bmax[0] = (cfg.bmin[0] + m_tileWorldSize);
+		cfg.bmax[1] = -FLT_MAX;
+		cfg.bmax[2] = (cfg.bmin[2] + m_tileWorldSize);
+
+		// タイルと重なる三角形を集める
+		Array<float> triangleVertices;
+		Array<uint8> triangleAreas;
+
+		for (const auto& geometry : geometries)
+		{
+			if (geometry->isObstacle)
+			{
+				continue;
+			}
+
+			const auto it = geometry->trianglesByTile.find(tilePos);
+
+			if (it == geometry->trianglesByTile.end())
+			{
+				continue;
+			}
+
+			cfg.bmin[1] = Min(cfg.bmin[1], geometry->aabb.bmin[1]);
+			cfg.bmax[1] = Max(cfg.bmax[1], geometry->aabb.bmax[1]);
+
+			for (const uint32 triangleIndex : it->second)
+			{
+				const TriangleIndex& triangle = geometry->indices[triangleIndex];
+
+				for (const auto index : { triangle.i0, triangle.i1, triangle.i2 })
+				{
+					const Float3& vertex = geometry->vertices[index];
+					triangleVertices << vertex.x << vertex.y << vertex.z;
+				}
+
+				triangleAreas << geometry->areaIDs[triangleIndex];
+			}
+		}
+
+		if (not triangleAreas)
+		{
+			// 歩行可能な地形が無いタイル
+			return true;
+		}
+
+		const float border = (cfg.borderSize * cfg.cs);
+		cfg.bmin[0] -= border;
+		cfg.bmin[2] -= border;
+		cfg.bmax[0] += border;
+		cfg.bmax[2] += border;
+
+		rcContext ctx{ false };
+
+		detail::RecastPtr<rcHeightfield, rcFreeHeightField> hf{ rcAllocHeightfield() };
+
+		if ((not hf)
+			|| (not rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch)))
+		{
+			return false;
+		}
+
+		const int32 flagMergeThreshold = 0;
+
+		if (not rcRasterizeTriangles(&ctx, triangleVertices.data(), triangleAreas.data(), static_cast<int32>(triangleAreas.size()), *hf, flagMergeThreshold))
+		{
+			return false;
+		}
+
+		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *hf);
+		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf);
+		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
+
+		detail::RecastPtr<rcCompactHeightfield, rcFreeCompactHeightfield> chf{ rcAllocCompactHeightfield() };
+
+		if ((not chf)
+			|| (not rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf)))
+		{
+			return false;
+		}
+
+		hf.reset();
+
+		// 障害物の範囲のエリア ID を書き換える。エージェントの半径の分だけ削られるよう、rcErodeWalkableArea() の前に行う
+		for (const auto& geometry : geometries)
+		{
+			if (not geometry->isObstacle)
+			{
+				continue;
+			}
+
+			const auto it = geometry->trianglesByTile.find(tilePos);
+
+			if (it == geometry->trianglesByTile.end())
+			{
+				continue;
+			}
+
+			for (const uint32 triangleIndex : it->second)
+			{
+				const TriangleIndex& triangle = geometry->indices[triangleIndex];
+				const Float3& p0 = geometry->vertices[triangle.i0];
+				const Float3& p1 = geometry->vertices[triangle.i1];
+				const Float3& p2 = geometry->vertices[triangle.i2];
+				const float vertices[9] = { p0.x, p0.y, p0.z, p1.x, p1.y, p1.z, p2.x, p2.y, p2.z };
+
+				rcMarkConvexPolyArea(&ctx, vertices, 3, (chf->bmin[1] - 1.0f), (chf->bmax[1] + 1.0f), geometry->areaIDs[triangleIndex], *chf);
+			}
+		}
+
+		if (not rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf))
+		{
+			return false;
+		}
+
+		if (not rcBuildDistanceField(&ctx, *chf))
+		{
+			return false;
+		}
+
+		if (not rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea))
+		{
+			return false;
+		}
+
+		detail::RecastPtr<rcContourSet, rcFreeContourSet> cset{ rcAllocContourSet() };
+
+		if ((not cset)
+			|| (not rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset)))
+		{
+			return false;
+		}
+
+		if (cset->nconts == 0)
+		{
+			return true;
+		}
+
+		detail::RecastPtr<rcPolyMesh, rcFreePolyMesh> mesh{ rcAllocPolyMesh() };
+
+		if ((not mesh)
+			|| (not rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *mesh)))
+		{
+			return false;
+		}
+
+		detail::RecastPtr<rcPolyMeshDetail, rcFreePolyMeshDetail> dmesh{ rcAllocPolyMeshDetail() };
+
+		if ((not dmesh)
+			|| (not rcBuildPolyMeshDetail(&ctx, *mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *dmesh)))
+		{
+			return false;
+		}
+
+		if ((mesh->nverts == 0) || (mesh->npolys == 0))
+		{
+			return true;
+		}
+
+		if (m_params.maxPolys < mesh->npolys)
+		{
+			return false;
+		}
+
+		for (int32 i = 0; i < mesh->npolys; ++i)
+		{
+			mesh->flags[i] = 1;
+		}
+
+		dtNavMeshCreateParams params;
+		std::memset(&params, 0, sizeof(params));
+
+		params.verts		= mesh->verts;
+		params.vertCount	= mesh->nverts;
+		params.polys		= mesh->polys;
+		params.polyAreas	= mesh->areas;
+		params.polyFlags	= mesh->flags;
+		params.polyCount	= mesh->npolys;
+		params.nvp			= mesh->nvp;
+
+		params.detailMeshes		= dmesh->meshes;
+		params.detailVerts		= dmesh->verts;
+		params.detailVertsCount	= dmesh->nverts;
+		params.detailTris		= dmesh->tris;
+		params.detailTriCount	= dmesh->ntris;
+
+		params.walkableHeight	= static_cast<float>(cfg.walkableHeight);
+		params.walkableRadius	= static_cast<float>(cfg.walkableRadius);
+		params.walkableClimb	= static_cast<float>(cfg.walkableClimb);
+		params.tileX			= tilePos.x;
+		params.tileY			= tilePos.y;
+		params.tileLayer		= 0;
+		rcVcopy(params.bmin, mesh->bmin);
+		rcVcopy(params.bmax, mesh->bmax);
+		params.cs = cfg.cs;
+		params.ch = cfg.ch;
+		params.buildBvTree = true;
+
+		unsigned char* navData = nullptr;
+		int32 navDataSize = 0;
+
+		if (not dtCreateNavMeshData(&params, &navData, &navDataSize))
+		{
+			return false;
+		}
+
+		dst.resize(navDataSize);
+		std::memcpy(dst.data(), navData, navDataSize);
+		dtFree(navData);
+
+		return true;
+	}
+}
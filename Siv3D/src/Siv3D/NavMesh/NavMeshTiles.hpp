@@ -0,0 +1,133 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/HashTable.hpp>
+# include <Siv3D/HashSet.hpp>
+# include <Siv3D/PointVector.hpp>
+# include "NavMeshDetail.hpp"
+
+namespace s3d
+{
+	/// @brief タイルに分割したナビメッシュに登録した地形データ
+	struct NavMeshGeometry
+	{
+		Array<Float3> vertices;
+
+		Array<TriangleIndex> indices;
+
+		Array<uint8> areaIDs;
+
+		NavMeshAABB aabb;
+
+		/// @brief 障害物の場合 true
+		/// @remark 障害物の三角形はラスタライズせず、XZ 平面上で重なる範囲のエリア ID を書き換えます。
+		bool isObstacle = false;
+
+		/// @brief 各タイルと（タイルの境界領域を含めて）重なる三角形の番号
+		HashTable<Point, Array<uint32>> trianglesByTile;
+	};
+
+	/// @brief タイルの再構築の内容
+	struct NavMeshTileRebuildJob
+	{
+		std::shared_ptr<NavMeshTiles> tiles;
+
+		/// @brief 再構築するタイル
+		Array<Point> tilePositions;
+
+		/// @brief 再構築を開始した時点の地形データ
+		Array<std::shared_ptr<const NavMeshGeometry>> geometries;
+
+		/// @brief 再構築を開始した順に大きくなる値
+		uint64 generation = 0;
+	};
+
+	/// @brief タイルに分割したナビメッシュの地形データと、構築済みのタイルを管理するクラス
+	/// @remark Recast のタイルキャッシュ (DetourTileCache) と同様に、地形データの変更の影響を受けるタイルだけを構築し直します。
+	class NavMeshTiles : public std::enable_shared_from_this<NavMeshTiles>
+	{
+	public:
+
+		/// @brief タイルの範囲は `aabb` で固定され、範囲外の地形データは無視されます。
+		NavMeshTiles(const NavMeshConfig& config, const NavMeshAABB& aabb);
+
+		[[nodiscard]]
+		bool init();
+
+		[[nodiscard]]
+		Optional<NavMeshGeometryID> addGeometry(Array<Float3>&& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs, bool isObstacle);
+
+		[[nodiscard]]
+		bool updateGeometry(NavMeshGeometryID id, Array<Float3>&& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs, bool isObstacle);
+
+		[[nodiscard]]
+		bool removeGeometry(NavMeshGeometryID id);
+
+		[[nodiscard]]
+		size_t num_dirtyTiles() const;
+
+		/// @brief 再構築が必要なタイルと現在の地形データを取り出し、再構築が必要なタイルの一覧を空にします。
+		[[nodiscard]]
+		std::shared_ptr<NavMeshTileRebuildJob> beginRebuild();
+
+		/// @brief タイルを並列に構築し、すべてのタイルを含む新しいナビメッシュを作成します。
+		/// @param job 再構築の内容
+		/// @param succeeded 構築に失敗したタイルがある場合 false が書き込まれます。構築に失敗したタイルは以前のデータを残し、再構築が必要なタイルに戻します。
+		/// @return 新しいナビメッシュ。作成に失敗した場合は nullptr
+		/// @remark 複数のスレッドから同時に呼び出すことはできません。
+		[[nodiscard]]
+		std::shared_ptr<dtNavMesh> rebuild(const NavMeshTileRebuildJob& job, bool& succeeded);
+
+	private:
+
+		struct Tile
+		{
+			// dtCreateNavMeshData() で作成したデータ。ポリゴンが無い場合は空
+			Array<uint8> data;
+
+			uint64 generation = 0;
+		};
+
+		rcConfig m_config;
+
+		dtNavMeshParams m_params;
+
+		// タイルの一辺の長さ
+		float m_tileWorldSize = 0.0f;
+
+		int32 m_tilesX = 0;
+
+		int32 m_tilesY = 0;
+
+		// m_geometries, m_nextGeometryID, m_dirtyTiles, m_generation を保護する
+		mutable std::mutex m_mutex;
+
+		HashTable<NavMeshGeometryID, std::shared_ptr<const NavMeshGeometry>> m_geometries;
+
+		NavMeshGeometryID m_nextGeometryID = 0;
+
+		HashSet<Point> m_dirtyTiles;
+
+		uint64 m_generation = 0;
+
+		// rebuild() からのみアクセスする
+		HashTable<Point, Tile> m_tiles;
+
+		[[nodiscard]]
+		std::shared_ptr<NavMeshGeometry> makeGeometry(Array<Float3>&& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs, bool isObstacle) const;
+
+		void markDirty(const NavMeshGeometry& geometry);
+
+		[[nodiscard]]
+		bool buildTile(const Point& tilePos, const Array<std::shared_ptr<const NavMeshGeometry>>& geometries, Array<uint8>& dst) const;
+	};
+}
@@ -11,9 +11,19 @@
 
 # include <Siv3D/NavMesh.hpp>
 # include "NavMeshDetail.hpp"
+# include "NavMeshTiles.hpp"
 
 namespace s3d
 {
+	namespace detail
+	{
+		[[nodiscard]]
+		static Array<Float3> ToNavMeshVertices(const Array<Float2>& vertices)
+		{
+			return vertices.map([](const Float2& v) { return Float3{ v.x, 0.0f, v.y }; });
+		}
+	}
+
 	NavMesh::NavMesh()
 		: pImpl{ std::make_shared<NavMeshDetail>() }
 	{
@@ -101,6 +111,77 @@ namespace s3d
 		return pImpl->build(vertices, indices, areaIDs, config);
 	}
 
+	bool NavMesh::isTiled() const noexcept
+	{
+		return pImpl->isTiled();
+	}
+
+	Optional<NavMeshGeometryID> NavMesh::addGeometry(const Polygon& polygon, const Array<uint8>& areaIDs)
+	{
+		return pImpl->addGeometry(detail::ToNavMeshVertices(polygon.vertices()), polygon.indices(), areaIDs, false);
+	}
+
+	Optional<NavMeshGeometryID> NavMesh::addGeometry(const Array<Float2>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs)
+	{
+		return pImpl->addGeometry(detail::ToNavMeshVertices(vertices), indices, areaIDs, false);
+	}
+
+	Optional<NavMeshGeometryID> NavMesh::addGeometry(const Array<Float3>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs)
+	{
+		return pImpl->addGeometry(Array<Float3>(vertices), indices, areaIDs, false);
+	}
+
+	Optional<NavMeshGeometryID> NavMesh::addObstacle(const Polygon& shape, const uint8 areaID)
+	{
+		return pImpl->addGeometry(detail::ToNavMeshVertices(shape.vertices()), shape.indices(), Array<uint8>(shape.indices().size(), areaID), true);
+	}
+
+	bool NavMesh::updateGeometry(const NavMeshGeometryID id, const Polygon& polygon, const Array<uint8>& areaIDs)
+	{
+		return pImpl->updateGeometry(id, detail::ToNavMeshVertices(polygon.vertices()), polygon.indices(), areaIDs, false);
+	}
+
+	bool NavMesh::updateGeometry(const NavMeshGeometryID id, const Array<Float2>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs)
+	{
+		return pImpl->updateGeometry(id, detail::ToNavMeshVertices(vertices), indices, areaIDs, false);
+	}
+
+	bool NavMesh::updateGeometry(const NavMeshGeometryID id, const Array<Float3>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs)
+	{
+		return pImpl->updateGeometry(id, Array<Float3>(vertices), indices, areaIDs, false);
+	}
+
+	bool NavMesh::updateObstacle(const NavMeshGeometryID id, const Polygon& shape, const uint8 areaID)
+	{
+		return pImpl->updateGeometry(id, detail::ToNavMeshVertices(shape.vertices()), shape.indices(), Array<uint8>(shape.indices().size(), areaID), true);
+	}
+
+	bool NavMesh::removeGeometry(const NavMeshGeometryID id)
+	{
+		return pImpl->removeGeometry(id);
+	}
+
+	size_t NavMesh::num_dirtyTiles() const
+	{
+		return pImpl->num_dirtyTiles();
+	}
+
+	bool NavMesh::rebuildTiles()
+	{
+		const std::shared_ptr<NavMeshTileRebuildJob> job = pImpl->beginRebuildTiles();
+
+		return (job && pImpl->rebuildTiles(*job));
+	}
+
+	AsyncTask<bool> NavMesh::rebuildTilesAsync()
+	{
+		// 呼び出した時点の地形データで再構築する
+		return Async([pImpl = pImpl, job = pImpl->beginRebuildTiles()]()
+		{
+			return (job && pImpl->rebuildTiles(*job));
+		});
+	}
+
 	Array<Vec2> NavMesh::query(const Vec2& start, const Vec2& end, const Array<std::pair<int32, double>>& areaCosts) const
 	{
 		Array<Vec2> dst;
@@ -128,4 +209,70 @@ namespace s3d
 	{
 		pImpl->query(start, end, areaCosts, dst);
 	}
+
+	void NavMesh::query(const Vec2& start, const Vec2& end, NavMeshCorridor& corridor, Array<Vec2>& dst, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		pImpl->query(start, end, areaCosts, corridor.m_state, dst);
+	}
+
+	void NavMesh::query(const Vec3& start, const Vec3& end, NavMeshCorridor& corridor, Array<Vec3>& dst, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		pImpl->query(start, end, areaCosts, corridor.m_state, dst);
+	}
+
+	Array<Array<Vec2>> NavMesh::queryBatch(const Array<std::pair<Vec2, Vec2>>& requests, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		Array<Array<Vec2>> dst;
+
+		pImpl->queryBatch(requests, areaCosts, nullptr, dst);
+
+		return dst;
+	}
+
+	void NavMesh::queryBatch(const Array<std::pair<Vec2, Vec2>>& requests, Array<Array<Vec2>>& dst, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		pImpl->queryBatch(requests, areaCosts, nullptr, dst);
+	}
+
+	void NavMesh::queryBatch(const Array<std::pair<Vec2, Vec2>>& requests, Array<NavMeshCorridor>& corridors, Array<Array<Vec2>>& dst, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		corridors.resize(requests.size());
+
+		Array<detail::NavMeshCorridorState*> states(corridors.size());
+
+		for (size_t i = 0; i < corridors.size(); ++i)
+		{
+			states[i] = &corridors[i].m_state;
+		}
+
+		pImpl->queryBatch(requests, areaCosts, states.data(), dst);
+	}
+
+	Array<Array<Vec3>> NavMesh::queryBatch(const Array<std::pair<Vec3, Vec3>>& requests, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		Array<Array<Vec3>> dst;
+
+		pImpl->queryBatch(requests, areaCosts, nullptr, dst);
+
+		return dst;
+	}
+
+	void NavMesh::queryBatch(const Array<std::pair<Vec3, Vec3>>& requests, Array<Array<Vec3>>& dst, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		pImpl->queryBatch(requests, areaCosts, nullptr, dst);
+	}
+
+	void NavMesh::queryBatch(const Array<std::pair<Vec3, Vec3>>& requests, Array<NavMeshCorridor>& corridors, Array<Array<Vec3>>& dst, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		corridors.resize(requests.size());
+
+		Array<detail::NavMeshCorridorState*> states(corridors.size());
+
+		for (size_t i = 0; i < corridors.size(); ++i)
+		{
+			states[i] = &corridors[i].m_state;
+		}
+
+		pImpl->queryBatch(requests, areaCosts, states.data(), dst);
+	}
 }
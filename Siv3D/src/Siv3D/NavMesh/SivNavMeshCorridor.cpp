@@ -0,0 +1,36 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/NavMeshCorridor.hpp>
+
+namespace s3d
+{
+	void NavMeshCorridor::clear() noexcept
+	{
+		m_state.polygons.clear();
+		m_state.navMeshID = 0;
+	}
+
+	bool NavMeshCorridor::isEmpty() const noexcept
+	{
+		return m_state.polygons.isEmpty();
+	}
+
+	size_t NavMeshCorridor::num_polygons() const noexcept
+	{
+		return m_state.polygons.size();
+	}
+
+	uint32 NavMeshCorridor::searchCount() const noexcept
+	{
+		return m_state.searchCount;
+	}
+}
@@ -18,7 +18,7 @@ namespace s3d
 		: m_listner{}
 		, m_socket{ std::make_unique<UdpListeningReceiveSocket>(IpEndpointName{ ipv4.getData()[0], ipv4.getData()[1], ipv4.getData()[2], ipv4.getData()[3], port }, &m_listner) }
 	{
-		m_task = Async(Run, this);
+		m_task = Async(AsyncLaunch::DedicatedThread, Run, this);
 	}
 
 	OSCReceiver::OSCReceiverDetail::~OSCReceiverDetail()
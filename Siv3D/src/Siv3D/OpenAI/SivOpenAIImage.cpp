@@ -210,17 +210,17 @@ namespace s3d
 
 			AsyncTask<s3d::Image> CreateAsync(const StringView apiKey, const RequestDALLE2& request)
 			{
-				return Async(detail::CreateDALLE2ImageImpl, String{ apiKey }, request);
+				return Async(AsyncLaunch::DedicatedThread, detail::CreateDALLE2ImageImpl, String{ apiKey }, request);
 			}
 
 			AsyncTask<Array<s3d::Image>> CreateAsync(const StringView apiKey, const RequestDALLE2& request, const int32 numImages)
 			{
-				return Async(detail::CreateDALLE2ImagesImpl, String{ apiKey }, request, numImages);
+				return Async(AsyncLaunch::DedicatedThread, detail::CreateDALLE2ImagesImpl, String{ apiKey }, request, numImages);
 			}
 
 			AsyncTask<s3d::Image> CreateAsync(const StringView apiKey, const RequestDALLE3& request)
 			{
-				return Async(detail::CreateDALLE3ImageImpl, String{ apiKey }, request);
+				return Async(AsyncLaunch::DedicatedThread, detail::CreateDALLE3ImageImpl, String{ apiKey }, request);
 			}
 		}
 	}
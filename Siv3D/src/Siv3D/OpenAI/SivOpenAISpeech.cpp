@@ -83,7 +83,7 @@ namespace s3d
 
 			AsyncTask<bool> CreateAsync(const StringView apiKey, const Request& request, const FilePathView path)
 			{
-				return Async(detail::CreateSpeechImpl, String{ apiKey }, request, FilePath{ path });
+				return Async(AsyncLaunch::DedicatedThread, detail::CreateSpeechImpl, String{ apiKey }, request, FilePath{ path });
 			}
 		}
 	}
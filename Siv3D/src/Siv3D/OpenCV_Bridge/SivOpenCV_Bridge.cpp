@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # include <Siv3D/OpenCV_Bridge.hpp>
+# include <Siv3D/Image/PixelFilters.hpp>
 
 namespace s3d
 {
@@ -244,36 +245,17 @@ namespace s3d
 
 				if (from.isContinuous())
 				{
-					const Color* pDstEnd = pDst + to.num_pixels();
-					const uint8* pSrc = from.data;
-
-					while (pDst != pDstEnd)
-					{
-						pDst->b = *pSrc++;
-						pDst->g = *pSrc++;
-						pDst->r = *pSrc++;
-						pDst->a = 255;
-						++pDst;
-					}
+					PixelFilters::BGRToRGBA(from.data, pDst, to.num_pixels());
 				}
 				else
 				{
-					uint8* pSrcLine = from.data;
+					const uint8* pSrcLine = from.data;
 					const size_t srcStepBytes = from.step.p[0];
 
 					for (int32 y = 0; y < height; ++y)
 					{
-						uint8* pSrc = pSrcLine;
-
-						for (int32 x = 0; x < width; ++x)
-						{
-							pDst->b = *pSrc++;
-							pDst->g = *pSrc++;
-							pDst->r = *pSrc++;
-							pDst->a = 255;
-							++pDst;
-						}
-
+						PixelFilters::BGRToRGBA(pSrcLine, pDst, width);
+						pDst += width;
 						pSrcLine += srcStepBytes;
 					}
 				}
@@ -0,0 +1,209 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/SIMD.hpp>
+# include <Siv3D/Threading.hpp>
+# include "Particle2DSoA.hpp"
+
+namespace s3d
+{
+	Particle2DSoAView Particle2DSoAView::subView(const size_t first, const size_t count) const noexcept
+	{
+		assert((first + count) <= size);
+
+		return{
+			.positionX			= (positionX + first),
+			.positionY			= (positionY + first),
+			.rotation			= (rotation + first),
+			.startSize			= (startSize + first),
+			.startLifeTime		= (startLifeTime + first),
+			.remainingLifeTime	= (remainingLifeTime + first),
+			.startColor			= (startColor + first),
+			.size				= count,
+		};
+	}
+
+	size_t Particle2DSoA::size() const noexcept
+	{
+		return m_positionX.size();
+	}
+
+	bool Particle2DSoA::isEmpty() const noexcept
+	{
+		return m_positionX.isEmpty();
+	}
+
+	void Particle2DSoA::clear() noexcept
+	{
+		m_positionX.clear();
+		m_positionY.clear();
+		m_velocityX.clear();
+		m_velocityY.clear();
+		m_rotation.clear();
+		m_angularVelocity.clear();
+		m_startSize.clear();
+		m_startLifeTime.clear();
+		m_remainingLifeTime.clear();
+		m_startColor.clear();
+	}
+
+	void Particle2DSoA::push_back(const Particle2D& particle)
+	{
+		m_positionX.push_back(particle.position.x);
+		m_positionY.push_back(particle.position.y);
+		m_velocityX.push_back(particle.velocity.x);
+		m_velocityY.push_back(particle.velocity.y);
+		m_rotation.push_back(particle.rotation);
+		m_angularVelocity.push_back(particle.startAngularVelocity);
+		m_startSize.push_back(particle.startSize);
+		m_startLifeTime.push_back(particle.startLifeTime);
+		m_remainingLifeTime.push_back(particle.remainingLifeTime);
+		m_startColor.push_back(particle.startColor);
+	}
+
+	Particle2D Particle2DSoA::operator [](const size_t index) const noexcept
+	{
+		Particle2D particle;
+		particle.position				= { m_positionX[index], m_positionY[index] };
+		particle.velocity				= { m_velocityX[index], m_velocityY[index] };
+		particle.startColor				= m_startColor[index];
+		particle.startSize				= m_startSize[index];
+		particle.rotation				= m_rotation[index];
+		particle.startAngularVelocity	= m_angularVelocity[index];
+		particle.startLifeTime			= m_startLifeTime[index];
+		particle.remainingLifeTime		= m_remainingLifeTime[index];
+		return particle;
+	}
+
+	void Particle2DSoA::update(const float deltaTime, const Float2& deltaVelocity, const bool parallel)
+	{
+		const size_t count = size();
+
+		if (parallel && (ParallelUpdateGrainSize < count))
+		{
+			Threading::ParallelFor(count, [&](const size_t first, const size_t last)
+			{
+				updateRange(first, last, deltaTime, deltaVelocity);
+			}, ParallelUpdateGrainSize);
+		}
+		else
+		{
+			updateRange(0, count, deltaTime, deltaVelocity);
+		}
+	}
+
+	void Particle2DSoA::removeDead()
+	{
+		size_t count = size();
+
+		for (size_t i = 0; i < count;)
+		{
+			if (m_remainingLifeTime[i] < 0.0f)
+			{
+				// 移動してきたパーティクルも判定するため i は進めない
+				moveParticle(--count, i);
+			}
+			else
+			{
+				++i;
+			}
+		}
+
+		resize(count);
+	}
+
+	Particle2DSoAView Particle2DSoA::view() const noexcept
+	{
+		return{
+			.positionX			= m_positionX.data(),
+			.positionY			= m_positionY.data(),
+			.rotation			= m_rotation.data(),
+			.startSize			= m_startSize.data(),
+			.startLifeTime		= m_startLifeTime.data(),
+			.remainingLifeTime	= m_remainingLifeTime.data(),
+			.startColor			= m_startColor.data(),
+			.size				= size(),
+		};
+	}
+
+	void Particle2DSoA::updateRange(const size_t first, const size_t last, const float deltaTime, const Float2& deltaVelocity) noexcept
+	{
+		float* const pPositionX = m_positionX.data();
+		float* const pPositionY = m_positionY.data();
+		float* const pVelocityX = m_velocityX.data();
+		float* const pVelocityY = m_velocityY.data();
+		float* const pRotation = m_rotation.data();
+		const float* const pAngularVelocity = m_angularVelocity.data();
+		float* const pRemainingLifeTime = m_remainingLifeTime.data();
+
+		size_t i = first;
+
+		{
+			const __m128 dt = _mm_set1_ps(deltaTime);
+			const __m128 dvx = _mm_set1_ps(deltaVelocity.x);
+			const __m128 dvy = _mm_set1_ps(deltaVelocity.y);
+
+			for (; (i + 4) <= last; i += 4)
+			{
+				_mm_storeu_ps((pRemainingLifeTime + i), _mm_sub_ps(_mm_loadu_ps(pRemainingLifeTime + i), dt));
+
+				const __m128 vx = _mm_add_ps(_mm_loadu_ps(pVelocityX + i), dvx);
+				const __m128 vy = _mm_add_ps(_mm_loadu_ps(pVelocityY + i), dvy);
+				_mm_storeu_ps((pVelocityX + i), vx);
+				_mm_storeu_ps((pVelocityY + i), vy);
+
+				_mm_storeu_ps((pPositionX + i), _mm_add_ps(_mm_loadu_ps(pPositionX + i), _mm_mul_ps(vx, dt)));
+				_mm_storeu_ps((pPositionY + i), _mm_add_ps(_mm_loadu_ps(pPositionY + i), _mm_mul_ps(vy, dt)));
+
+				_mm_storeu_ps((pRotation + i), _mm_add_ps(_mm_loadu_ps(pRotation + i), _mm_mul_ps(_mm_loadu_ps(pAngularVelocity + i), dt)));
+			}
+		}
+
+		// Particle2D::update() と同じ計算順
+		for (; i < last; ++i)
+		{
+			pRemainingLifeTime[i] -= deltaTime;
+			pVelocityX[i] += deltaVelocity.x;
+			pVelocityY[i] += deltaVelocity.y;
+			pPositionX[i] += (pVelocityX[i] * deltaTime);
+			pPositionY[i] += (pVelocityY[i] * deltaTime);
+			pRotation[i] += (pAngularVelocity[i] * deltaTime);
+		}
+	}
+
+	void Particle2DSoA::moveParticle(const size_t from, const size_t to) noexcept
+	{
+		m_positionX[to]			= m_positionX[from];
+		m_positionY[to]			= m_positionY[from];
+		m_velocityX[to]			= m_velocityX[from];
+		m_velocityY[to]			= m_velocityY[from];
+		m_rotation[to]			= m_rotation[from];
+		m_angularVelocity[to]	= m_angularVelocity[from];
+		m_startSize[to]			= m_startSize[from];
+		m_startLifeTime[to]		= m_startLifeTime[from];
+		m_remainingLifeTime[to]	= m_remainingLifeTime[from];
+		m_startColor[to]		= m_startColor[from];
+	}
+
+	void Particle2DSoA::resize(const size_t size)
+	{
+		m_positionX.resize(size);
+		m_positionY.resize(size);
+		m_velocityX.resize(size);
+		m_velocityY.resize(size);
+		m_rotation.resize(size);
+		m_angularVelocity.resize(size);
+		m_startSize.resize(size);
+		m_startLifeTime.resize(size);
+		m_remainingLifeTime.resize(size);
+		m_startColor.resize(size);
+	}
+}
@@ -0,0 +1,107 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Particle2D.hpp>
+
+namespace s3d
+{
+	/// @brief SoA 形式のパーティクル列のうち、描画に必要なメンバへの参照
+	struct Particle2DSoAView
+	{
+		const float* positionX = nullptr;
+
+		const float* positionY = nullptr;
+
+		const float* rotation = nullptr;
+
+		const float* startSize = nullptr;
+
+		const float* startLifeTime = nullptr;
+
+		const float* remainingLifeTime = nullptr;
+
+		const Float4* startColor = nullptr;
+
+		size_t size = 0;
+
+		[[nodiscard]]
+		Particle2DSoAView subView(size_t first, size_t count) const noexcept;
+	};
+
+	/// @brief パーティクルの各メンバを個別の配列で保持するパーティクル列 (Structure of Arrays)
+	/// @remark 消滅したパーティクルの位置には末尾のパーティクルを移動するため、パーティクルの順序は保存されません。
+	class Particle2DSoA
+	{
+	public:
+
+		/// @brief 1 回の描画で扱うパーティクルの最大数（16-bit の頂点インデックスで表現できる範囲）
+		static constexpr size_t MaxParticlesPerDraw = 8192;
+
+		/// @brief 並列に更新するときの 1 タスクあたりのパーティクル数
+		static constexpr size_t ParallelUpdateGrainSize = 16384;
+
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		void clear() noexcept;
+
+		void push_back(const Particle2D& particle);
+
+		[[nodiscard]]
+		Particle2D operator [](size_t index) const noexcept;
+
+		/// @brief すべてのパーティクルの位置・速度・回転・残り寿命を更新します。
+		/// @param deltaTime 経過時間（秒）
+		/// @param deltaVelocity 経過時間あたりの速度の変化
+		/// @param parallel パーティクルが多い場合にスレッドプールで並列に更新するか
+		void update(float deltaTime, const Float2& deltaVelocity, bool parallel);
+
+		/// @brief 消滅したパーティクルを、末尾のパーティクルと入れ替えて取り除きます。
+		void removeDead();
+
+		[[nodiscard]]
+		Particle2DSoAView view() const noexcept;
+
+	private:
+
+		Array<float> m_positionX;
+
+		Array<float> m_positionY;
+
+		Array<float> m_velocityX;
+
+		Array<float> m_velocityY;
+
+		Array<float> m_rotation;
+
+		Array<float> m_angularVelocity;
+
+		Array<float> m_startSize;
+
+		Array<float> m_startLifeTime;
+
+		Array<float> m_remainingLifeTime;
+
+		Array<Float4> m_startColor;
+
+		void updateRange(size_t first, size_t last, float deltaTime, const Float2& deltaVelocity) noexcept;
+
+		void moveParticle(size_t from, size_t to) noexcept;
+
+		void resize(size_t size);
+	};
+}
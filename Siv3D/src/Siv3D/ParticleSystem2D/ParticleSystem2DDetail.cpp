@@ -65,6 +65,26 @@ namespace s3d
 
 	void ParticleSystem2D::ParticleSystem2DDetail::setParameters(const ParticleSystem2DParameters& parameters)
 	{
+		// 既存のパーティクルを新しい形式に移す
+		if (parameters.structureOfArrays && (not m_parameters.structureOfArrays))
+		{
+			for (const auto& particle : m_particles)
+			{
+				m_particlesSoA.push_back(particle);
+			}
+
+			m_particles.clear();
+		}
+		else if ((not parameters.structureOfArrays) && m_parameters.structureOfArrays)
+		{
+			for (size_t i = 0; i < m_particlesSoA.size(); ++i)
+			{
+				m_particles << m_particlesSoA[i];
+			}
+
+			m_particlesSoA.clear();
+		}
+
 		m_parameters = parameters;
 	}
 
@@ -75,7 +95,7 @@ namespace s3d
 
 	size_t ParticleSystem2D::ParticleSystem2DDetail::num_particles() const noexcept
 	{
-		return m_particles.size();
+		return (m_parameters.structureOfArrays ? m_particlesSoA.size() : m_particles.size());
 	}
 
 	void ParticleSystem2D::ParticleSystem2DDetail::prewarm()
@@ -146,6 +166,13 @@ namespace s3d
 	{
 		const Float2 deltaVelocity = (m_force * deltaTime);
 
+		if (m_parameters.structureOfArrays)
+		{
+			m_particlesSoA.update(deltaTime, deltaVelocity, m_parameters.parallelUpdate);
+			m_particlesSoA.removeDead();
+			return;
+		}
+
 		for (auto& particle : m_particles)
 		{
 			particle.update(deltaTime, deltaVelocity);
@@ -157,6 +184,7 @@ namespace s3d
 	void ParticleSystem2D::ParticleSystem2DDetail::addParticles(const ParticleSystem2DParameters& params)
 	{
 		const double timePerParticle = (1.0 / params.rate);
+		const size_t maxParticles = static_cast<size_t>(params.maxParticles);
 
 		while (m_remainingTime > timePerParticle)
 		{
@@ -183,10 +211,21 @@ namespace s3d
 
 			const float perParticledeltaTime = (particle.startLifeTime - particle.remainingLifeTime);
 			particle.advance(perParticledeltaTime, m_force * perParticledeltaTime);
-			m_particles << particle;
+
+			if (params.structureOfArrays)
+			{
+				if (m_particlesSoA.size() < maxParticles)
+				{
+					m_particlesSoA.push_back(particle);
+				}
+			}
+			else
+			{
+				m_particles << particle;
+			}
 		}
 
-		if (const size_t maxParticles = static_cast<size_t>(params.maxParticles); m_particles.size() > maxParticles)
+		if (m_particles.size() > maxParticles)
 		{
 			m_particles.erase(m_particles.begin(), m_particles.begin() + (m_particles.size() - maxParticles));
 		}
@@ -199,7 +238,7 @@ namespace s3d
 		const ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc =
 			m_parameters.colorOverLifeTimeFunc ? m_parameters.colorOverLifeTimeFunc : detail::DefaultColorOverLifeTimeFunc;
 
-		for (const auto& particle : m_particles)
+		eachParticle([&](const Particle2D& particle)
 		{
 			const float size = sizeOverLifeTimeFunc(particle.startSize, particle.startLifeTime, particle.remainingLifeTime);
 			const Float4 color = colorOverLifeTimeFunc(particle.startColor, particle.startLifeTime, particle.remainingLifeTime);
@@ -207,7 +246,7 @@ namespace s3d
 			RectF{ Arg::center = particle.position, size }
 				.rotated(particle.rotation)
 				.draw(ColorF{ color });
-		}
+		});
 	}
 
 	void ParticleSystem2D::ParticleSystem2DDetail::drawTexturedParticle() const
@@ -217,7 +256,20 @@ namespace s3d
 		const ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc =
 			m_parameters.colorOverLifeTimeFunc ? m_parameters.colorOverLifeTimeFunc : detail::DefaultColorOverLifeTimeFunc;
 
-		SIV3D_ENGINE(Renderer2D)->addTexturedParticles(m_particleTexture, m_particles, sizeOverLifeTimeFunc, colorOverLifeTimeFunc);
+		if (m_parameters.structureOfArrays)
+		{
+			const Particle2DSoAView particles = m_particlesSoA.view();
+
+			for (size_t first = 0; first < particles.size; first += Particle2DSoA::MaxParticlesPerDraw)
+			{
+				const size_t count = Min((particles.size - first), Particle2DSoA::MaxParticlesPerDraw);
+				SIV3D_ENGINE(Renderer2D)->addTexturedParticles(m_particleTexture, particles.subView(first, count), sizeOverLifeTimeFunc, colorOverLifeTimeFunc);
+			}
+		}
+		else
+		{
+			SIV3D_ENGINE(Renderer2D)->addTexturedParticles(m_particleTexture, m_particles, sizeOverLifeTimeFunc, colorOverLifeTimeFunc);
+		}
 	}
 
 	void ParticleSystem2D::ParticleSystem2DDetail::drawDebugParticle() const
@@ -227,7 +279,7 @@ namespace s3d
 		const ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc =
 			m_parameters.colorOverLifeTimeFunc ? m_parameters.colorOverLifeTimeFunc : detail::DefaultColorOverLifeTimeFunc;
 
-		for (const auto& particle : m_particles)
+		eachParticle([&](const Particle2D& particle)
 		{
 			const float size = sizeOverLifeTimeFunc(particle.startSize, particle.startLifeTime, particle.remainingLifeTime);
 			const Float4 color = colorOverLifeTimeFunc(particle.startColor, particle.startLifeTime, particle.remainingLifeTime);
@@ -235,6 +287,25 @@ namespace s3d
 			RectF{ Arg::center = particle.position, size }
 				.rotated(particle.rotation)
 				.drawFrame(1, ColorF{ color });
+		});
+	}
+
+	template <class Fty>
+	void ParticleSystem2D::ParticleSystem2DDetail::eachParticle(Fty f) const
+	{
+		if (m_parameters.structureOfArrays)
+		{
+			for (size_t i = 0; i < m_particlesSoA.size(); ++i)
+			{
+				f(m_particlesSoA[i]);
+			}
+		}
+		else
+		{
+			for (const auto& particle : m_particles)
+			{
+				f(particle);
+			}
 		}
 	}
 }
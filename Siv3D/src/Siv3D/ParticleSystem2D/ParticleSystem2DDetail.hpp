@@ -12,6 +12,7 @@
 # pragma once
 # include <Siv3D/ParticleSystem2D.hpp>
 # include <Siv3D/Particle2D.hpp>
+# include "Particle2DSoA.hpp"
 
 namespace s3d
 {
@@ -51,6 +52,7 @@ namespace s3d
 	private:
 
 		Array<Particle2D> m_particles;
+		Particle2DSoA m_particlesSoA;
 		double m_remainingTime = 0.0;
 
 		Vec2 m_position = Vec2(0, 0);
@@ -69,5 +71,8 @@ namespace s3d
 		void drawTexturedParticle() const;
 
 		void drawDebugParticle() const;
+
+		template <class Fty>
+		void eachParticle(Fty f) const;
 	};
 }
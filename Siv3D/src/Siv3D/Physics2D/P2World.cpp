@@ -190,4 +190,57 @@ namespace s3d
 	{
 		return pImpl->getCollisions();
 	}
+
+	Array<P2BodyID> P2World::queryAABB(const RectF& rect) const
+	{
+		Array<P2BodyID> results;
+		pImpl->queryAABB(rect, results);
+		return results;
+	}
+
+	void P2World::queryAABB(const RectF& rect, Array<P2BodyID>& results) const
+	{
+		pImpl->queryAABB(rect, results);
+	}
+
+	Optional<P2RaycastHit> P2World::raycast(const Vec2& start, const Vec2& end) const
+	{
+		return pImpl->raycast(start, end);
+	}
+
+	Array<P2RaycastHit> P2World::raycastAll(const Vec2& start, const Vec2& end) const
+	{
+		Array<P2RaycastHit> results;
+		pImpl->raycastAll(start, end, results);
+		return results;
+	}
+
+	void P2World::raycastAll(const Vec2& start, const Vec2& end, Array<P2RaycastHit>& results) const
+	{
+		pImpl->raycastAll(start, end, results);
+	}
+
+	Array<P2BodyID> P2World::overlapCircle(const Circle& circle) const
+	{
+		Array<P2BodyID> results;
+		pImpl->overlapCircle(circle, results);
+		return results;
+	}
+
+	void P2World::overlapCircle(const Circle& circle, Array<P2BodyID>& results) const
+	{
+		pImpl->overlapCircle(circle, results);
+	}
+
+	Array<P2BodyID> P2World::overlapPolygon(const Polygon& polygon) const
+	{
+		Array<P2BodyID> results;
+		pImpl->overlapPolygon(polygon, results);
+		return results;
+	}
+
+	void P2World::overlapPolygon(const Polygon& polygon, Array<P2BodyID>& results) const
+	{
+		pImpl->overlapPolygon(polygon, results);
+	}
 }
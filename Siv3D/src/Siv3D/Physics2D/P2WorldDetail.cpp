@@ -10,11 +10,157 @@
 //-----------------------------------------------
 
 # include <Siv3D/Physics2D/P2Body.hpp>
+# include <Siv3D/Polygon.hpp>
 # include "P2WorldDetail.hpp"
+# include "P2BodyDetail.hpp"
 # include "P2Common.hpp"
 
 namespace s3d
 {
+	namespace detail
+	{
+		[[nodiscard]]
+		static b2AABB ToB2AABB(const RectF& rect) noexcept
+		{
+			b2AABB aabb;
+			aabb.lowerBound = ToB2Vec2(rect.tl());
+			aabb.upperBound = ToB2Vec2(rect.br());
+			return aabb;
+		}
+
+		// b2PolygonShape::Set() が凸形状を作れずに SetAsBox(1, 1) で代用してしまう三角形でないかを調べる
+		[[nodiscard]]
+		static bool IsValidB2Triangle(const b2Vec2 (&points)[3]) noexcept
+		{
+			// b2PolygonShape::Set() は距離が 0.5 * b2_linearSlop 未満の頂点を 1 つにまとめる
+			constexpr float WeldDistanceSq = ((0.5f * b2_linearSlop) * (0.5f * b2_linearSlop));
+
+			if ((b2DistanceSquared(points[0], points[1]) < WeldDistanceSq)
+				|| (b2DistanceSquared(points[1], points[2]) < WeldDistanceSq)
+				|| (b2DistanceSquared(points[2], points[0]) < WeldDistanceSq))
+			{
+				return false;
+			}
+
+			// 3 点がほぼ同一直線上にある場合は、凸包や重心を正しく求められない
+			const float area = (0.5f * b2Abs(b2Cross((points[1] - points[0]), (points[2] - points[0]))));
+
+			return ((b2_linearSlop * b2_linearSlop) <= area);
+		}
+
+		// 1 つの物体が複数の形状を持つ場合の重複を取り除く
+		static void SortAndRemoveDuplicates(Array<P2BodyID>& ids)
+		{
+			std::sort(ids.begin(), ids.end());
+			ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+		}
+
+		class P2AABBQueryCallback : public b2QueryCallback
+		{
+		public:
+
+			explicit P2AABBQueryCallback(Array<P2BodyID>& results)
+				: m_results{ results } {}
+
+			bool ReportFixture(b2Fixture* fixture) override
+			{
+				m_results.push_back(P2WorldDetail::GetBodyID(fixture));
+				return true;
+			}
+
+		private:
+
+			Array<P2BodyID>& m_results;
+		};
+
+		class P2OverlapQueryCallback : public b2QueryCallback
+		{
+		public:
+
+			P2OverlapQueryCallback(const b2Shape* const* shapes, const size_t num_shapes, Array<P2BodyID>& results)
+				: m_shapes{ shapes }
+				, m_num_shapes{ num_shapes }
+				, m_results{ results } {}
+
+			bool ReportFixture(b2Fixture* fixture) override
+			{
+				const P2BodyID id = P2WorldDetail::GetBodyID(fixture);
+
+				// 同じ物体の別の形状で既に重なりを検出している
+				if (m_results && (m_results.back() == id))
+				{
+					return true;
+				}
+
+				const b2Shape* shape = fixture->GetShape();
+				const b2Transform& transform = fixture->GetBody()->GetTransform();
+				const int32 childCount = shape->GetChildCount();
+
+				for (size_t i = 0; i < m_num_shapes; ++i)
+				{
+					for (int32 childIndex = 0; childIndex < childCount; ++childIndex)
+					{
+						if (b2TestOverlap(m_shapes[i], 0, shape, childIndex, m_identity, transform))
+						{
+							m_results.push_back(id);
+							return true;
+						}
+					}
+				}
+
+				return true;
+			}
+
+		private:
+
+			const b2Shape* const* m_shapes = nullptr;
+
+			size_t m_num_shapes = 0;
+
+			Array<P2BodyID>& m_results;
+
+			b2Transform m_identity{ b2Vec2_zero, b2Rot{ 0.0f } };
+		};
+
+		class P2RaycastCallback : public b2RayCastCallback
+		{
+		public:
+
+			/// @param results 交差点を格納する配列。nullptr の場合は最も近い交差点のみを記録します。
+			explicit P2RaycastCallback(Array<P2RaycastHit>* results)
+				: m_results{ results } {}
+
+			float ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, float fraction) override
+			{
+				const P2RaycastHit hit{ P2WorldDetail::GetBodyID(fixture), ToVec2(point), ToVec2(normal), fraction };
+
+				if (m_results)
+				{
+					m_results->push_back(hit);
+
+					// レイを短くせずに探索を続ける
+					return 1.0f;
+				}
+
+				// これ以降はより近い交差点のみが報告される
+				m_closest = hit;
+				return fraction;
+			}
+
+			[[nodiscard]]
+			const Optional<P2RaycastHit>& getClosest() const noexcept
+			{
+				return m_closest;
+			}
+
+		private:
+
+			Array<P2RaycastHit>* m_results = nullptr;
+
+			Optional<P2RaycastHit> m_closest;
+		};
+	}
+
 	detail::P2WorldDetail::P2WorldDetail(const Vec2 gravity)
 		: m_world{ detail::ToB2Vec2(gravity) }
 	{
@@ -144,6 +290,112 @@ namespace s3d
 		return m_contactListner.getCollisions();
 	}
 
+	void detail::P2WorldDetail::queryAABB(const RectF& rect, Array<P2BodyID>& results) const
+	{
+		results.clear();
+
+		P2AABBQueryCallback callback{ results };
+
+		m_world.QueryAABB(&callback, ToB2AABB(rect));
+
+		SortAndRemoveDuplicates(results);
+	}
+
+	Optional<P2RaycastHit> detail::P2WorldDetail::raycast(const Vec2& start, const Vec2& end) const
+	{
+		// Box2D は長さ 0 のレイを扱えない
+		if (start == end)
+		{
+			return none;
+		}
+
+		P2RaycastCallback callback{ nullptr };
+
+		m_world.RayCast(&callback, ToB2Vec2(start), ToB2Vec2(end));
+
+		return callback.getClosest();
+	}
+
+	void detail::P2WorldDetail::raycastAll(const Vec2& start, const Vec2& end, Array<P2RaycastHit>& results) const
+	{
+		results.clear();
+
+		// Box2D は長さ 0 のレイを扱えない
+		if (start == end)
+		{
+			return;
+		}
+
+		P2RaycastCallback callback{ &results };
+
+		m_world.RayCast(&callback, ToB2Vec2(start), ToB2Vec2(end));
+
+		std::sort(results.begin(), results.end(),
+			[](const P2RaycastHit& a, const P2RaycastHit& b) { return (a.fraction < b.fraction); });
+	}
+
+	void detail::P2WorldDetail::overlapCircle(const Circle& circle, Array<P2BodyID>& results) const
+	{
+		results.clear();
+
+		b2CircleShape shape;
+		shape.m_p = ToB2Vec2(circle.center);
+		shape.m_radius = static_cast<float>(circle.r);
+
+		const b2Shape* shapes[1] = { &shape };
+
+		P2OverlapQueryCallback callback{ shapes, 1, results };
+
+		m_world.QueryAABB(&callback, ToB2AABB(circle.boundingRect()));
+
+		SortAndRemoveDuplicates(results);
+	}
+
+	void detail::P2WorldDetail::overlapPolygon(const Polygon& polygon, Array<P2BodyID>& results) const
+	{
+		results.clear();
+
+		// 多角形を三角形に分割して、Box2D の凸形状として判定する
+		m_queryShapes.clear();
+
+		for (size_t i = 0; i < polygon.num_triangles(); ++i)
+		{
+			const Triangle triangle = polygon.triangle(i);
+			const b2Vec2 points[3] = { ToB2Vec2(triangle.p0), ToB2Vec2(triangle.p1), ToB2Vec2(triangle.p2) };
+
+			// 退化した三角形は b2PolygonShape::Set() で正しい凸形状にならない
+			if (not IsValidB2Triangle(points))
+			{
+				continue;
+			}
+
+			m_queryShapes.emplace_back().Set(points, 3);
+		}
+
+		if (not m_queryShapes)
+		{
+			return;
+		}
+
+		m_queryShapePointers.clear();
+
+		for (const auto& shape : m_queryShapes)
+		{
+			m_queryShapePointers.push_back(&shape);
+		}
+
+		P2OverlapQueryCallback callback{ m_queryShapePointers.data(), m_queryShapePointers.size(), results };
+
+		m_world.QueryAABB(&callback, ToB2AABB(polygon.boundingRect()));
+
+		SortAndRemoveDuplicates(results);
+	}
+
+	P2BodyID detail::P2WorldDetail::GetBodyID(b2Fixture* fixture) noexcept
+	{
+		return static_cast<const P2Body::P2BodyDetail*>(fixture->GetBody()->GetUserData().pBody)->id();
+	}
+
 	b2World& detail::P2WorldDetail::getData() noexcept
 	{
 		return m_world;
@@ -72,6 +72,17 @@ namespace s3d
 		[[nodiscard]]
 		const HashTable<P2ContactPair, P2Collision>& getCollisions() const noexcept;
 
+		void queryAABB(const RectF& rect, Array<P2BodyID>& results) const;
+
+		[[nodiscard]]
+		Optional<P2RaycastHit> raycast(const Vec2& start, const Vec2& end) const;
+
+		void raycastAll(const Vec2& start, const Vec2& end, Array<P2RaycastHit>& results) const;
+
+		void overlapCircle(const Circle& circle, Array<P2BodyID>& results) const;
+
+		void overlapPolygon(const Polygon& polygon, Array<P2BodyID>& results) const;
+
 		[[nodiscard]]
 		b2World& getData() noexcept;
 
@@ -81,6 +92,10 @@ namespace s3d
 		[[nodiscard]]
 		b2World* getWorldPtr() noexcept;
 
+		/// @brief 形状を持つ物体の ID を返します。
+		[[nodiscard]]
+		static P2BodyID GetBodyID(b2Fixture* fixture) noexcept;
+
 	private:
 
 		b2World m_world;
@@ -89,6 +104,11 @@ namespace s3d
 
 		std::atomic<P2BodyID> m_currentID = { 0 };
 
+		// overlapPolygon() で多角形を分割した凸形状
+		mutable Array<b2PolygonShape> m_queryShapes;
+
+		mutable Array<const b2Shape*> m_queryShapePointers;
+
 		[[nodiscard]]
 		P2BodyID generateNextID() noexcept;
 	};
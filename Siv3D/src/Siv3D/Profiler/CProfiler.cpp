@@ -57,6 +57,11 @@ namespace s3d
 				const auto stat = SIV3D_ENGINE(Renderer2D)->getStat();
 				m_stat.drawCalls = stat.drawCalls;
 				m_stat.triangleCount = stat.triangleCount;
+				m_stat.batchCount = stat.batchCount;
+				m_stat.vertexUploadBytes = stat.vertexUploadBytes;
+				m_stat.indexUploadBytes = stat.indexUploadBytes;
+				m_stat.fenceWaitCount = stat.fenceWaitCount;
+				m_stat.bufferOrphanCount = stat.bufferOrphanCount;
 			}
 
 			m_stat.textureCount	= static_cast<uint32>(SIV3D_ENGINE(Texture)->getTextureCount());
@@ -18,6 +18,11 @@ namespace s3d
 	{
 		Print << U"Draw calls\t\t\t" << drawCalls;
 		Print << U"Triangle count\t\t" << triangleCount;
+		Print << U"Batch count\t\t" << batchCount;
+		Print << U"Vertex upload\t\t" << vertexUploadBytes << U" bytes";
+		Print << U"Index upload\t\t" << indexUploadBytes << U" bytes";
+		Print << U"Fence waits\t\t" << fenceWaitCount;
+		Print << U"Buffer orphans\t\t" << bufferOrphanCount;
 		Print << U"Texture count\t\t" << textureCount;
 		Print << U"Font count\t\t\t" << fontCount;
 		Print << U"Audio count\t\t" << audioCount;
@@ -31,6 +31,7 @@
 # include <Siv3D/Mat3x2.hpp>
 # include <Siv3D/Particle2D.hpp>
 # include <Siv3D/ParticleSystem2DParameters.hpp>
+# include <Siv3D/ParticleSystem2D/Particle2DSoA.hpp>
 
 namespace s3d
 {
@@ -41,6 +42,18 @@ namespace s3d
 	{
 		uint32 drawCalls = 0;
 		uint32 triangleCount = 0;
+
+		uint32 batchCount = 0;
+
+		uint64 vertexUploadBytes = 0;
+
+		uint64 indexUploadBytes = 0;
+
+		// 送信先の GPU バッファが解放されるのを待った回数
+		uint32 fenceWaitCount = 0;
+
+		// GPU バッファを確保し直した (orphaning) 回数
+		uint32 bufferOrphanCount = 0;
 	};
 
 	class SIV3D_NOVTABLE ISiv3DRenderer2D
@@ -133,6 +146,10 @@ namespace s3d
 			ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
 			ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc) = 0;
 
+		virtual void addTexturedParticles(const Texture& texture, const Particle2DSoAView& particles,
+			ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
+			ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc) = 0;
+
 
 		virtual Float4 getColorMul() const = 0;
 
@@ -12,6 +12,8 @@
 # pragma once
 # include <Siv3D/Common.hpp>
 # include <Siv3D/Renderer2D/IRenderer2D.hpp>
+# include <Siv3D/Renderer2D/Vertex2DBuilder.hpp>
+# include <Siv3D/Renderer2D/Vertex2DBatchBuffer.hpp>
 
 namespace s3d
 {
@@ -105,6 +107,10 @@ namespace s3d
 			ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
 			ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc) override;
 
+		void addTexturedParticles(const Texture& texture, const Particle2DSoAView& particles,
+			ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
+			ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc) override;
+
 
 		Float4 getColorMul() const override;
 
@@ -182,6 +188,13 @@ namespace s3d
 
 		std::unique_ptr<Texture> m_emptyTexture;
 
+		// 描画は行わず、GPU 版のレンダラーと同じ頂点バッファの構築のみを行う
+		Vertex2DBatchBuffer m_batches;
+
+		BufferCreatorFunc m_bufferCreator;
+
+		Array<Float2> m_buffer;
+
 		Renderer2DStat m_stat;
 	};
 }
@@ -0,0 +1,243 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/EngineOptions.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "Vertex2DBatchBuffer.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		[[nodiscard]]
+		static size_t CalculateNewArraySize(const size_t current, const size_t target) noexcept
+		{
+			size_t newArraySize = current * 2;
+
+			while (newArraySize < target)
+			{
+				newArraySize *= 2;
+			}
+
+			return newArraySize;
+		}
+
+		[[nodiscard]]
+		static uint8 ToUNorm8(const float value) noexcept
+		{
+			if (not (0.0f < value)) // NaN を含む
+			{
+				return 0;
+			}
+			else if (1.0f <= value)
+			{
+				return 255;
+			}
+
+			return static_cast<uint8>(value * 255.0f + 0.5f);
+		}
+
+		static void PackVertices(const Vertex2D* pSrc, Vertex2DPacked* pDst, const size_t count) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				const Vertex2D& src = pSrc[i];
+				Vertex2DPacked& dst = pDst[i];
+				dst.pos = src.pos;
+				dst.tex = src.tex;
+				dst.color.r = ToUNorm8(src.color.x);
+				dst.color.g = ToUNorm8(src.color.y);
+				dst.color.b = ToUNorm8(src.color.z);
+				dst.color.a = ToUNorm8(src.color.w);
+			}
+		}
+
+		static void WidenIndices(const Vertex2D::IndexType* pSrc, uint32* pDst, const size_t count, const uint32 baseVertex) noexcept
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				pDst[i] = (pSrc[i] + baseVertex);
+			}
+		}
+	}
+
+	Vertex2DBatchFormat Vertex2DBatchFormat::FromEngineOptions() noexcept
+	{
+		return{
+			.packedVertex	= (g_engineOptions.vertex2DColor == EngineOption::Vertex2DColor::UNorm8),
+			.index32		= (g_engineOptions.vertex2DIndex == EngineOption::Vertex2DIndex::UInt32),
+		};
+	}
+
+	Vertex2DBatchBuffer::Vertex2DBatchBuffer()
+		: m_vertexArray(InitialVertexArraySize)
+		, m_indexArray(InitialIndexArraySize)
+	{
+		beginBatch();
+	}
+
+	void Vertex2DBatchBuffer::setFormat(const Vertex2DBatchFormat& format)
+	{
+		m_format = format;
+		reset();
+	}
+
+	const Vertex2DBatchFormat& Vertex2DBatchBuffer::getFormat() const noexcept
+	{
+		return m_format;
+	}
+
+	uint32 Vertex2DBatchBuffer::maxVertexCountPerBatch() const noexcept
+	{
+		return (m_format.index32 ? MaxVertexCountPerBatch32 : MaxVertexCountPerBatch16);
+	}
+
+	uint32 Vertex2DBatchBuffer::maxIndexCountPerBatch() const noexcept
+	{
+		return (m_format.index32 ? MaxIndexCountPerBatch32 : MaxIndexCountPerBatch16);
+	}
+
+	Vertex2DBufferPointer Vertex2DBatchBuffer::requestBuffer(const uint16 vertexSize, const uint32 indexSize)
+	{
+		// VB
+		if (const uint32 vertexArrayWritePosTarget = m_vertexArrayWritePos + vertexSize;
+			m_vertexArray.size() < vertexArrayWritePosTarget) SIV3D_UNLIKELY
+		{
+			if (MaxVertexArraySize < vertexArrayWritePosTarget) SIV3D_UNLIKELY
+			{
+				return{ nullptr, 0, 0 };
+			}
+
+			const size_t newVertexArraySize = detail::CalculateNewArraySize(m_vertexArray.size(), vertexArrayWritePosTarget);
+			LOG_TRACE(U"ℹ️ Resized Vertex2DBatchBuffer::m_vertexArray (size: {} -> {})"_fmt(m_vertexArray.size(), newVertexArraySize));
+			m_vertexArray.resize(newVertexArraySize);
+		}
+
+		// IB
+		if (const uint32 indexArrayWritePosTarget = m_indexArrayWritePos + indexSize;
+			m_indexArray.size() < indexArrayWritePosTarget) SIV3D_UNLIKELY
+		{
+			if (MaxIndexArraySize < indexArrayWritePosTarget) SIV3D_UNLIKELY
+			{
+				return{ nullptr, 0, 0 };
+			}
+
+			const size_t newIndexArraySize = detail::CalculateNewArraySize(m_indexArray.size(), indexArrayWritePosTarget);
+			LOG_TRACE(U"ℹ️ Resized Vertex2DBatchBuffer::m_indexArray (size: {} -> {})"_fmt(m_indexArray.size(), newIndexArraySize));
+			m_indexArray.resize(newIndexArraySize);
+		}
+
+		if (const auto& lastBatch = m_batches.back();
+			((maxVertexCountPerBatch() < (lastBatch.vertexCount + vertexSize))
+				|| (maxIndexCountPerBatch() < (lastBatch.indexCount + indexSize))))
+		{
+			beginBatch();
+		}
+		else if ((MaxVertexCountPerBatch16 < (lastBatch.vertexCount - m_segments.back().baseVertex + vertexSize)))
+		{
+			// 32-bit インデックスの場合のみ到達する。バッチはそのままに、16-bit インデックスの基準位置を進める
+			m_segments.push_back({ m_indexArrayWritePos, lastBatch.vertexCount });
+		}
+
+		auto& lastBatch = m_batches.back();
+		Vertex2D* const pVertex = (m_vertexArray.data() + m_vertexArrayWritePos);
+		Vertex2D::IndexType* const pIndex = (m_indexArray.data() + m_indexArrayWritePos);
+		const auto indexOffset = static_cast<Vertex2D::IndexType>(lastBatch.vertexCount - m_segments.back().baseVertex);
+
+		m_vertexArrayWritePos += vertexSize;
+		m_indexArrayWritePos += indexSize;
+		lastBatch.vertexCount += vertexSize;
+		lastBatch.indexCount += indexSize;
+
+		return{ pVertex, pIndex, indexOffset };
+	}
+
+	size_t Vertex2DBatchBuffer::num_batches() const noexcept
+	{
+		return m_batches.size();
+	}
+
+	Vertex2DBatchSize Vertex2DBatchBuffer::getBatchSize(const size_t batchIndex) const noexcept
+	{
+		assert(batchIndex < m_batches.size());
+
+		const auto& batch = m_batches[batchIndex];
+
+		return{ batch.vertexCount, batch.indexCount };
+	}
+
+	void Vertex2DBatchBuffer::writeBatch(const size_t batchIndex, void* const pVertexDst, void* const pIndexDst) const
+	{
+		assert(batchIndex < m_batches.size());
+
+		const auto& batch = m_batches[batchIndex];
+
+		// VB
+		if (batch.vertexCount)
+		{
+			const Vertex2D* pSrc = &m_vertexArray[batch.vertexArrayPos];
+
+			if (m_format.packedVertex)
+			{
+				detail::PackVertices(pSrc, static_cast<Vertex2DPacked*>(pVertexDst), batch.vertexCount);
+			}
+			else
+			{
+				std::memcpy(pVertexDst, pSrc, (sizeof(Vertex2D) * batch.vertexCount));
+			}
+		}
+
+		// IB
+		if (batch.indexCount)
+		{
+			const Vertex2D::IndexType* pSrc = &m_indexArray[batch.indexArrayPos];
+
+			if (m_format.index32)
+			{
+				const uint32 batchIndexEnd = (batch.indexArrayPos + batch.indexCount);
+				const size_t segmentEnd = ((batchIndex + 1) < m_batches.size()) ? m_batches[batchIndex + 1].segmentIndex : m_segments.size();
+				uint32* pDst = static_cast<uint32*>(pIndexDst);
+
+				for (size_t i = batch.segmentIndex; i < segmentEnd; ++i)
+				{
+					const auto& segment = m_segments[i];
+					const uint32 end = ((i + 1) < segmentEnd) ? m_segments[i + 1].indexArrayPos : batchIndexEnd;
+					const uint32 count = (end - segment.indexArrayPos);
+
+					detail::WidenIndices(pSrc, pDst, count, segment.baseVertex);
+					pSrc += count;
+					pDst += count;
+				}
+			}
+			else
+			{
+				std::memcpy(pIndexDst, pSrc, (sizeof(Vertex2D::IndexType) * batch.indexCount));
+			}
+		}
+	}
+
+	void Vertex2DBatchBuffer::reset()
+	{
+		m_batches.clear();
+		m_segments.clear();
+
+		m_vertexArrayWritePos = 0;
+		m_indexArrayWritePos = 0;
+
+		beginBatch();
+	}
+
+	void Vertex2DBatchBuffer::beginBatch()
+	{
+		m_batches.push_back({ m_vertexArrayWritePos, m_indexArrayWritePos, 0, 0, static_cast<uint32>(m_segments.size()) });
+		m_segments.push_back({ m_indexArrayWritePos, 0 });
+	}
+}
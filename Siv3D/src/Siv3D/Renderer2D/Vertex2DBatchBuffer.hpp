@@ -0,0 +1,152 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Vertex2D.hpp>
+# include <Siv3D/Color.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Renderer2D/Vertex2DBufferPointer.hpp>
+
+namespace s3d
+{
+	/// @brief 頂点色を UNORM8 に圧縮した 2D 頂点データ（GPU 送信用）
+	struct Vertex2DPacked
+	{
+		Float2 pos;
+
+		Float2 tex;
+
+		Color color;
+	};
+	static_assert(sizeof(Vertex2DPacked) == 20);
+
+	struct Vertex2DBatchFormat
+	{
+		bool packedVertex = false;
+
+		bool index32 = false;
+
+		[[nodiscard]]
+		constexpr uint32 vertexStride() const noexcept
+		{
+			return (packedVertex ? sizeof(Vertex2DPacked) : sizeof(Vertex2D));
+		}
+
+		[[nodiscard]]
+		constexpr uint32 indexStride() const noexcept
+		{
+			return (index32 ? sizeof(uint32) : sizeof(Vertex2D::IndexType));
+		}
+
+		/// @brief エンジンオプションで指定された形式を返します。
+		[[nodiscard]]
+		static Vertex2DBatchFormat FromEngineOptions() noexcept;
+	};
+
+	struct Vertex2DBatchSize
+	{
+		uint32 vertexCount = 0;
+
+		uint32 indexCount = 0;
+	};
+
+	/// @brief 2D 頂点データを GPU のバッチ単位に分割して CPU 側に蓄積するバッファ
+	/// @remark 32-bit インデックスの場合、`Vertex2DBuilder` が書き込む 16-bit インデックスは、
+	/// 65,535 頂点ごとのセグメントの先頭位置を加えて GPU 送信時に 32-bit に拡張されます。
+	class Vertex2DBatchBuffer
+	{
+	public:
+
+		static constexpr uint32 MaxVertexCountPerBatch16	= 65535;// 65,535
+		static constexpr uint32 MaxIndexCountPerBatch16		= ((MaxVertexCountPerBatch16 + 1) * 4); // 262,144
+
+		static constexpr uint32 MaxVertexCountPerBatch32	= (65536 * 4); // 262,144
+		static constexpr uint32 MaxIndexCountPerBatch32		= (MaxVertexCountPerBatch32 * 4); // 1,048,576
+
+		Vertex2DBatchBuffer();
+
+		void setFormat(const Vertex2DBatchFormat& format);
+
+		[[nodiscard]]
+		const Vertex2DBatchFormat& getFormat() const noexcept;
+
+		[[nodiscard]]
+		uint32 maxVertexCountPerBatch() const noexcept;
+
+		[[nodiscard]]
+		uint32 maxIndexCountPerBatch() const noexcept;
+
+		/// @brief 頂点とインデックスの書き込み先を確保します。
+		/// @param vertexSize 頂点数
+		/// @param indexSize インデックス数
+		/// @return 書き込み先。確保に失敗した場合は `pVertex` が nullptr
+		[[nodiscard]]
+		Vertex2DBufferPointer requestBuffer(uint16 vertexSize, uint32 indexSize);
+
+		[[nodiscard]]
+		size_t num_batches() const noexcept;
+
+		[[nodiscard]]
+		Vertex2DBatchSize getBatchSize(size_t batchIndex) const noexcept;
+
+		/// @brief バッチの頂点とインデックスを GPU 送信用の形式で書き出します。
+		/// @param batchIndex バッチのインデックス
+		/// @param pVertexDst 頂点の書き込み先（`getBatchSize().vertexCount * vertexStride()` バイト）
+		/// @param pIndexDst インデックスの書き込み先（`getBatchSize().indexCount * indexStride()` バイト）
+		void writeBatch(size_t batchIndex, void* pVertexDst, void* pIndexDst) const;
+
+		void reset();
+
+	private:
+
+		struct Batch
+		{
+			uint32 vertexArrayPos = 0;
+
+			uint32 indexArrayPos = 0;
+
+			uint32 vertexCount = 0;
+
+			uint32 indexCount = 0;
+
+			uint32 segmentIndex = 0;
+		};
+
+		// 16-bit インデックスで表現できる範囲
+		struct IndexSegment
+		{
+			uint32 indexArrayPos = 0;
+
+			uint32 baseVertex = 0;
+		};
+
+		Vertex2DBatchFormat m_format;
+
+		Array<Vertex2D> m_vertexArray;
+		uint32 m_vertexArrayWritePos = 0;
+
+		Array<Vertex2D::IndexType> m_indexArray;
+		uint32 m_indexArrayWritePos = 0;
+
+		Array<Batch> m_batches;
+
+		Array<IndexSegment> m_segments;
+
+		static constexpr uint32 InitialVertexArraySize	= 4096;
+		static constexpr uint32 InitialIndexArraySize	= (4096 * 8); // 32,768
+
+		static constexpr uint32 MaxVertexArraySize		= (65536 * 64); // 4,194,304
+		static constexpr uint32 MaxIndexArraySize		= (65536 * 64); // 4,194,304
+
+		void beginBatch();
+	};
+}
@@ -116,6 +116,32 @@ namespace s3d
 				: r <= 12.0f ? 8
 				: static_cast<Vertex2D::IndexType>(Min(64.0f, r * 0.2f + 6));
 		}
+
+		inline void SetParticleVertices(Vertex2D* pVertex, const float cx, const float cy, const float rotation, const float size, const Float4& color) noexcept
+		{
+			const float x = (size * 0.5f);
+			const auto [s, c] = FastMath::SinCos(rotation);
+			const float xc = x * c;
+			const float xs = x * s;
+
+			pVertex[0].set({ -xc + xs + cx, -xs - xc + cy }, 0.0f, 0.0f, color);
+			pVertex[1].set({ xc + xs + cx, xs - xc + cy }, 1.0f, 0.0f, color);
+			pVertex[2].set({ -xc - xs + cx, -xs + xc + cy }, 0.0f, 1.0f, color);
+			pVertex[3].set({ xc - xs + cx, xs + xc + cy }, 1.0f, 1.0f, color);
+		}
+
+		inline void SetParticleIndices(Vertex2D::IndexType* pIndex, Vertex2D::IndexType indexBase, const size_t particleCount) noexcept
+		{
+			for (size_t n = 0; n < particleCount; ++n)
+			{
+				for (Vertex2D::IndexType i = 0; i < 6; ++i)
+				{
+					*pIndex++ = (indexBase + RectIndexTable[i]);
+				}
+
+				indexBase += 4;
+			}
+		}
 	}
 
 	namespace Vertex2DBuilder
@@ -3529,36 +3555,42 @@ namespace s3d
 				const float size = sizeOverLifeTimeFunc(particle.startSize, particle.startLifeTime, particle.remainingLifeTime);
 				const Float4 color = colorOverLifeTimeFunc(particle.startColor, particle.startLifeTime, particle.remainingLifeTime);
 
-				const float size_half = (size * 0.5f);
-				const float cx = particle.position.x;
-				const float cy = particle.position.y;
-
-				const float x = size_half;
-				const auto [s, c] = FastMath::SinCos(particle.rotation);
-				const float xc = x * c;
-				const float xs = x * s;
-
-				pVertex[0].set({ -xc + xs + cx, -xs - xc + cy }, 0.0f, 0.0f, color);
-				pVertex[1].set({ xc + xs + cx, xs - xc + cy }, 1.0f, 0.0f, color);
-				pVertex[2].set({ -xc - xs + cx, -xs + xc + cy }, 0.0f, 1.0f, color);
-				pVertex[3].set({ xc - xs + cx, xs + xc + cy }, 1.0f, 1.0f, color);
+				detail::SetParticleVertices(pVertex, particle.position.x, particle.position.y, particle.rotation, size, color);
 				pVertex += 4;
 			}
 
+			detail::SetParticleIndices(pIndex, indexOffset, particles.size());
+
+			return indexSize;
+		}
+
+		Vertex2D::IndexType BuildTexturedParticles(const BufferCreatorFunc& bufferCreator, const Particle2DSoAView& particles,
+			const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc)
+		{
+			assert(particles.size <= Particle2DSoA::MaxParticlesPerDraw);
+
+			const Vertex2D::IndexType vertexSize = static_cast<Vertex2D::IndexType>(particles.size * 4);
+			const Vertex2D::IndexType indexSize = static_cast<Vertex2D::IndexType>(particles.size * 6);
+			auto [pVertex, pIndex, indexOffset] = bufferCreator(vertexSize, indexSize);
+
+			if (not pVertex)
 			{
-				Vertex2D::IndexType indexBase = indexOffset;
+				return 0;
+			}
 
-				for (Vertex2D::IndexType n = 0; n < particles.size(); ++n)
-				{
-					for (Vertex2D::IndexType i = 0; i < 6; ++i)
-					{
-						*pIndex++ = (indexBase + detail::RectIndexTable[i]);
-					}
+			for (size_t i = 0; i < particles.size; ++i)
+			{
+				const float startLifeTime = particles.startLifeTime[i];
+				const float remainingLifeTime = particles.remainingLifeTime[i];
+				const float size = sizeOverLifeTimeFunc(particles.startSize[i], startLifeTime, remainingLifeTime);
+				const Float4 color = colorOverLifeTimeFunc(particles.startColor[i], startLifeTime, remainingLifeTime);
 
-					indexBase += 4;
-				}
+				detail::SetParticleVertices(pVertex, particles.positionX[i], particles.positionY[i], particles.rotation[i], size, color);
+				pVertex += 4;
 			}
 
+			detail::SetParticleIndices(pIndex, indexOffset, particles.size);
+
 			return indexSize;
 		}
 	}
@@ -22,6 +22,7 @@
 # include <Siv3D/PredefinedYesNo.hpp>
 # include <Siv3D/Particle2D.hpp>
 # include <Siv3D/ParticleSystem2DParameters.hpp>
+# include <Siv3D/ParticleSystem2D/Particle2DSoA.hpp>
 # include "Vertex2DBufferPointer.hpp"
 
 namespace s3d
@@ -168,5 +169,9 @@ namespace s3d
 		[[nodiscard]]
 		Vertex2D::IndexType BuildTexturedParticles(const BufferCreatorFunc& bufferCreator, const Array<Particle2D>& particles,
 			const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc);
+
+		[[nodiscard]]
+		Vertex2D::IndexType BuildTexturedParticles(const BufferCreatorFunc& bufferCreator, const Particle2DSoAView& particles,
+			const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc);
 	}
 }
@@ -56,6 +56,8 @@ namespace s3d
 			r = engine->RegisterObjectMethod(TypeName, "int32 GLFormat() const", asMETHODPR(BindType, GLFormat, () const, int32), asCALL_THISCALL); assert(r >= 0);
 			r = engine->RegisterObjectMethod(TypeName, "int32 GLType() const", asMETHODPR(BindType, GLType, () const, int32), asCALL_THISCALL); assert(r >= 0);
 			r = engine->RegisterObjectMethod(TypeName, "uint32 pixelSize() const", asMETHODPR(BindType, pixelSize, () const, uint32), asCALL_THISCALL); assert(r >= 0);
+			r = engine->RegisterObjectMethod(TypeName, "uint32 blockSize() const", asMETHODPR(BindType, blockSize, () const, uint32), asCALL_THISCALL); assert(r >= 0);
+			r = engine->RegisterObjectMethod(TypeName, "bool isBlockCompressed() const", asMETHODPR(BindType, isBlockCompressed, () const, bool), asCALL_THISCALL); assert(r >= 0);
 			r = engine->RegisterObjectMethod(TypeName, "uint32 num_channels() const", asMETHODPR(BindType, num_channels, () const, uint32), asCALL_THISCALL); assert(r >= 0);
 			r = engine->RegisterObjectMethod(TypeName, "bool isSRGB() const", asMETHODPR(BindType, isSRGB, () const, bool), asCALL_THISCALL); assert(r >= 0);
 
@@ -76,6 +78,14 @@ namespace s3d
 				r = engine->RegisterGlobalProperty("const TexturePixelFormat R16G16B16A16_Float", (void*)&TextureFormat::R16G16B16A16_Float); assert(r >= 0);
 				r = engine->RegisterGlobalProperty("const TexturePixelFormat R32G32_Float", (void*)&TextureFormat::R32G32_Float); assert(r >= 0);
 				r = engine->RegisterGlobalProperty("const TexturePixelFormat R32G32B32A32_Float", (void*)&TextureFormat::R32G32B32A32_Float); assert(r >= 0);
+				r = engine->RegisterGlobalProperty("const TexturePixelFormat BC1_RGBA_Unorm", (void*)&TextureFormat::BC1_RGBA_Unorm); assert(r >= 0);
+				r = engine->RegisterGlobalProperty("const TexturePixelFormat BC1_RGBA_Unorm_SRGB", (void*)&TextureFormat::BC1_RGBA_Unorm_SRGB); assert(r >= 0);
+				r = engine->RegisterGlobalProperty("const TexturePixelFormat BC3_RGBA_Unorm", (void*)&TextureFormat::BC3_RGBA_Unorm); assert(r >= 0);
+				r = engine->RegisterGlobalProperty("const TexturePixelFormat BC3_RGBA_Unorm_SRGB", (void*)&TextureFormat::BC3_RGBA_Unorm_SRGB); assert(r >= 0);
+				r = engine->RegisterGlobalProperty("const TexturePixelFormat BC4_R_Unorm", (void*)&TextureFormat::BC4_R_Unorm); assert(r >= 0);
+				r = engine->RegisterGlobalProperty("const TexturePixelFormat BC5_RG_Unorm", (void*)&TextureFormat::BC5_RG_Unorm); assert(r >= 0);
+				r = engine->RegisterGlobalProperty("const TexturePixelFormat BC7_RGBA_Unorm", (void*)&TextureFormat::BC7_RGBA_Unorm); assert(r >= 0);
+				r = engine->RegisterGlobalProperty("const TexturePixelFormat BC7_RGBA_Unorm_SRGB", (void*)&TextureFormat::BC7_RGBA_Unorm_SRGB); assert(r >= 0);
 			}
 			r = engine->SetDefaultNamespace(""); assert(r >= 0);
 		}
@@ -32,6 +32,14 @@ namespace s3d
 			r = engine->RegisterEnumValue(TypeName, "R16G16B16A16_Float", static_cast<int32>(TexturePixelFormat::R16G16B16A16_Float)); assert(r >= 0);
 			r = engine->RegisterEnumValue(TypeName, "R32G32_Float", static_cast<int32>(TexturePixelFormat::R32G32_Float)); assert(r >= 0);
 			r = engine->RegisterEnumValue(TypeName, "R32G32B32A32_Float", static_cast<int32>(TexturePixelFormat::R32G32B32A32_Float)); assert(r >= 0);
+			r = engine->RegisterEnumValue(TypeName, "BC1_RGBA_Unorm", static_cast<int32>(TexturePixelFormat::BC1_RGBA_Unorm)); assert(r >= 0);
+			r = engine->RegisterEnumValue(TypeName, "BC1_RGBA_Unorm_SRGB", static_cast<int32>(TexturePixelFormat::BC1_RGBA_Unorm_SRGB)); assert(r >= 0);
+			r = engine->RegisterEnumValue(TypeName, "BC3_RGBA_Unorm", static_cast<int32>(TexturePixelFormat::BC3_RGBA_Unorm)); assert(r >= 0);
+			r = engine->RegisterEnumValue(TypeName, "BC3_RGBA_Unorm_SRGB", static_cast<int32>(TexturePixelFormat::BC3_RGBA_Unorm_SRGB)); assert(r >= 0);
+			r = engine->RegisterEnumValue(TypeName, "BC4_R_Unorm", static_cast<int32>(TexturePixelFormat::BC4_R_Unorm)); assert(r >= 0);
+			r = engine->RegisterEnumValue(TypeName, "BC5_RG_Unorm", static_cast<int32>(TexturePixelFormat::BC5_RG_Unorm)); assert(r >= 0);
+			r = engine->RegisterEnumValue(TypeName, "BC7_RGBA_Unorm", static_cast<int32>(TexturePixelFormat::BC7_RGBA_Unorm)); assert(r >= 0);
+			r = engine->RegisterEnumValue(TypeName, "BC7_RGBA_Unorm_SRGB", static_cast<int32>(TexturePixelFormat::BC7_RGBA_Unorm_SRGB)); assert(r >= 0);
 		}
 	}
 }
@@ -411,4 +411,44 @@ namespace s3d
 
 		return m_engine;
 	}
+
+	ScriptBytecodeCache& CScript::getBytecodeCache()
+	{
+		return m_bytecodeCache;
+	}
+
+	size_t CScript::precompile(const FilePathView directory, const ScriptCompileOption compileOption, const Recursive recursive)
+	{
+		if (not m_initialized)
+		{
+			init();
+		}
+
+		LOG_SCOPED_TRACE(U"CScript::precompile()");
+
+		size_t count = 0;
+
+		for (const auto& path : FileSystem::DirectoryContents(directory, recursive))
+		{
+			if (FileSystem::Extension(path) != U"as")
+			{
+				continue;
+			}
+
+			// キャッシュの作成が目的なので、モジュールはスコープを抜けるときに破棄される
+			const ScriptData script{ ScriptData::File{}, path, m_engine, (compileOption | ScriptCompileOption::UseBytecodeCache) };
+
+			if (not script.compileSucceeded())
+			{
+				LOG_FAIL(U"Script::Precompile(): Failed to compile `{}`"_fmt(path));
+				continue;
+			}
+
+			++count;
+		}
+
+		LOG_INFO(U"Script::Precompile(): {} scripts in `{}`"_fmt(count, directory));
+
+		return count;
+	}
 }
@@ -59,6 +59,10 @@ namespace s3d
 
 		AngelScript::asIScriptEngine* getEngine() override;
 
+		ScriptBytecodeCache& getBytecodeCache() override;
+
+		size_t precompile(FilePathView directory, ScriptCompileOption compileOption, Recursive recursive) override;
+
 	private:
 
 		AngelScript::asIScriptEngine* m_engine = nullptr;
@@ -68,5 +72,7 @@ namespace s3d
 		bool m_initialized = false;
 
 		Array<String> m_messages;
+
+		ScriptBytecodeCache m_bytecodeCache;
 	};
 }
@@ -0,0 +1,313 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cstring>
+# include <Siv3D/Blob.hpp>
+# include <Siv3D/Hash.hpp>
+# include <Siv3D/Version.hpp>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/FormatLiteral.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "ScriptBytecodeCache.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// キャッシュファイルの形式
+		//
+		// [Magic]
+		// [uint32] AngelScript のバージョン
+		// [uint32] Siv3D のバージョン
+		// [uint8] ポインタのサイズ
+		// [uint8] ラインキューの有無
+		// [uint32] ファイル数（スクリプト本体とインクルードしたファイル）
+		//     [uint32] パスの長さ [UTF-8] パス [uint64] 内容のハッシュ
+		// [uint64] バイトコードのサイズ
+		// [Byte...] バイトコード
+		constexpr char BytecodeCacheMagic[8] = { 'S', '3', 'D', 'A', 'S', 'B', 'C', '1' };
+
+		class BytecodeWriteStream final : public AngelScript::asIBinaryStream
+		{
+		public:
+
+			explicit BytecodeWriteStream(Blob& blob)
+				: m_blob{ blob } {}
+
+			int Read(void*, AngelScript::asUINT) override
+			{
+				return AngelScript::asNOT_SUPPORTED;
+			}
+
+			int Write(const void* ptr, const AngelScript::asUINT size) override
+			{
+				m_blob.append(ptr, size);
+				return 0;
+			}
+
+		private:
+
+			Blob& m_blob;
+		};
+
+		class BytecodeReadStream final : public AngelScript::asIBinaryStream
+		{
+		public:
+
+			BytecodeReadStream(const Byte* data, const size_t size)
+				: m_data{ data }
+				, m_size{ size } {}
+
+			int Read(void* ptr, const AngelScript::asUINT size) override
+			{
+				if ((m_size - m_pos) < size)
+				{
+					std::memset(ptr, 0, size);
+					m_pos = m_size;
+					return AngelScript::asERROR;
+				}
+
+				std::memcpy(ptr, (m_data + m_pos), size);
+				m_pos += size;
+				return 0;
+			}
+
+			int Write(const void*, AngelScript::asUINT) override
+			{
+				return AngelScript::asNOT_SUPPORTED;
+			}
+
+			bool read(void* ptr, const size_t size)
+			{
+				if ((m_size - m_pos) < size)
+				{
+					return false;
+				}
+
+				std::memcpy(ptr, (m_data + m_pos), size);
+				m_pos += size;
+				return true;
+			}
+
+			template <class Type>
+			bool read(Type& value)
+			{
+				return read(std::addressof(value), sizeof(Type));
+			}
+
+			[[nodiscard]]
+			size_t remaining() const noexcept
+			{
+				return (m_size - m_pos);
+			}
+
+		private:
+
+			const Byte* m_data = nullptr;
+
+			size_t m_size = 0;
+
+			size_t m_pos = 0;
+		};
+
+		template <class Type>
+		static void AppendValue(Blob& blob, const Type& value)
+		{
+			blob.append(std::addressof(value), sizeof(Type));
+		}
+
+		[[nodiscard]]
+		static Optional<uint64> HashFile(const FilePathView path)
+		{
+			const Blob blob{ path };
+
+			if (blob.isEmpty() && (not FileSystem::IsFile(path)))
+			{
+				return none;
+			}
+
+			return Hash::XXHash3(blob.data(), blob.size());
+		}
+	}
+
+	void ScriptBytecodeCache::setDirectory(const FilePathView directory)
+	{
+		m_directory = FilePath{ directory };
+	}
+
+	const FilePath& ScriptBytecodeCache::getDirectory() const noexcept
+	{
+		return m_directory;
+	}
+
+	bool ScriptBytecodeCache::load(AngelScript::asIScriptModule* module, const FilePathView fullpath, const bool withLineCues, Array<FilePath>& includedFiles) const
+	{
+		const FilePath cachePath = getCachePath(fullpath, withLineCues);
+
+		if (not FileSystem::IsFile(cachePath))
+		{
+			return false;
+		}
+
+		const Blob blob{ cachePath };
+		detail::BytecodeReadStream stream{ blob.data(), blob.size() };
+
+		// ヘッダ
+		{
+			char magic[8] = {};
+			uint32 angelScriptVersion = 0, siv3dVersion = 0;
+			uint8 pointerSize = 0, lineCues = 0;
+
+			if ((not stream.read(magic))
+				|| (std::memcmp(magic, detail::BytecodeCacheMagic, sizeof(magic)) != 0)
+				|| (not stream.read(angelScriptVersion))
+				|| (angelScriptVersion != ANGELSCRIPT_VERSION)
+				|| (not stream.read(siv3dVersion))
+				|| (siv3dVersion != SIV3D_VERSION)
+				|| (not stream.read(pointerSize))
+				|| (pointerSize != sizeof(void*))
+				|| (not stream.read(lineCues))
+				|| (lineCues != static_cast<uint8>(withLineCues)))
+			{
+				LOG_TRACE(U"ScriptBytecodeCache: `{}` was created by a different version"_fmt(cachePath));
+				return false;
+			}
+		}
+
+		// スクリプト本体とインクルードしたファイルが変更されていないか
+		Array<FilePath> files;
+		{
+			uint32 fileCount = 0;
+
+			if (not stream.read(fileCount))
+			{
+				return false;
+			}
+
+			for (uint32 i = 0; i < fileCount; ++i)
+			{
+				uint32 length = 0;
+				std::string path;
+				uint64 hash = 0;
+
+				if ((not stream.read(length))
+					|| (stream.remaining() < length))
+				{
+					return false;
+				}
+
+				path.resize(length);
+
+				if ((not stream.read(path.data(), length))
+					|| (not stream.read(hash)))
+				{
+					return false;
+				}
+
+				FilePath file = Unicode::FromUTF8(path);
+
+				if (detail::HashFile(file) != hash)
+				{
+					LOG_TRACE(U"ScriptBytecodeCache: `{}` has been modified"_fmt(file));
+					return false;
+				}
+
+				files << std::move(file);
+			}
+
+			if (files.isEmpty() || (files.front() != fullpath))
+			{
+				return false;
+			}
+		}
+
+		uint64 bytecodeSize = 0;
+
+		if ((not stream.read(bytecodeSize))
+			|| (stream.remaining() != bytecodeSize))
+		{
+			return false;
+		}
+
+		if (module->LoadByteCode(&stream) < 0)
+		{
+			LOG_FAIL(U"ScriptBytecodeCache: Failed to load the bytecode from `{}`"_fmt(cachePath));
+			return false;
+		}
+
+		includedFiles.assign((files.begin() + 1), files.end());
+
+		LOG_TRACE(U"ScriptBytecodeCache: Loaded `{}` from `{}`"_fmt(fullpath, cachePath));
+
+		return true;
+	}
+
+	bool ScriptBytecodeCache::save(const AngelScript::asIScriptModule* module, const FilePathView fullpath, const bool withLineCues, const Array<FilePath>& includedFiles) const
+	{
+		Blob blob;
+
+		blob.append(detail::BytecodeCacheMagic, sizeof(detail::BytecodeCacheMagic));
+		detail::AppendValue(blob, static_cast<uint32>(ANGELSCRIPT_VERSION));
+		detail::AppendValue(blob, static_cast<uint32>(SIV3D_VERSION));
+		detail::AppendValue(blob, static_cast<uint8>(sizeof(void*)));
+		detail::AppendValue(blob, static_cast<uint8>(withLineCues));
+		detail::AppendValue(blob, static_cast<uint32>(includedFiles.size() + 1));
+
+		for (size_t i = 0; i <= includedFiles.size(); ++i)
+		{
+			const FilePathView file = ((i == 0) ? fullpath : FilePathView{ includedFiles[i - 1] });
+			const Optional<uint64> hash = detail::HashFile(file);
+
+			if (not hash)
+			{
+				return false;
+			}
+
+			const std::string path = file.toUTF8();
+			detail::AppendValue(blob, static_cast<uint32>(path.size()));
+			blob.append(path.data(), path.size());
+			detail::AppendValue(blob, *hash);
+		}
+
+		// バイトコードのサイズは後で書き込む
+		const size_t bytecodeSizePos = blob.size();
+		detail::AppendValue(blob, uint64{ 0 });
+
+		detail::BytecodeWriteStream stream{ blob };
+
+		if (module->SaveByteCode(&stream) < 0)
+		{
+			LOG_FAIL(U"ScriptBytecodeCache: Failed to save the bytecode of `{}`"_fmt(fullpath));
+			return false;
+		}
+
+		const uint64 bytecodeSize = (blob.size() - bytecodeSizePos - sizeof(uint64));
+		std::memcpy((blob.data() + bytecodeSizePos), &bytecodeSize, sizeof(uint64));
+
+		const FilePath cachePath = getCachePath(fullpath, withLineCues);
+
+		if (m_directory && (not FileSystem::CreateDirectories(m_directory)))
+		{
+			return false;
+		}
+
+		return blob.save(cachePath);
+	}
+
+	FilePath ScriptBytecodeCache::getCachePath(const FilePathView fullpath, const bool withLineCues) const
+	{
+		const std::string path = fullpath.toUTF8();
+		const uint64 hash = Hash::XXHash3(path.data(), path.size());
+
+		return FileSystem::PathAppend(m_directory, U"{:016x}{}.asbc"_fmt(hash, (withLineCues ? U"_l" : U"")));
+	}
+}
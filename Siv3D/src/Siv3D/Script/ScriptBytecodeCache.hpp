@@ -0,0 +1,56 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/String.hpp>
+# include <Siv3D/ScriptModule.hpp>
+
+namespace s3d
+{
+	/// @brief コンパイルしたスクリプトのバイトコードをファイルに保存し、次回以降のコンパイルを省略するためのキャッシュ
+	/// @remark キャッシュはスクリプトファイルとラインキューの有無ごとに 1 つのファイルです。
+	/// @remark スクリプト本体とインクルードしたファイルの内容のハッシュ、AngelScript と Siv3D のバージョンがすべて一致する場合のみ使われます。
+	class ScriptBytecodeCache
+	{
+	public:
+
+		void setDirectory(FilePathView directory);
+
+		[[nodiscard]]
+		const FilePath& getDirectory() const noexcept;
+
+		/// @brief キャッシュからモジュールにバイトコードを読み込みます。
+		/// @param module 読み込み先のモジュール
+		/// @param fullpath スクリプトファイルのフルパス
+		/// @param withLineCues ラインキューを含むバイトコードである場合 true
+		/// @param includedFiles インクルードしているファイル一覧の格納先
+		/// @return 読み込みに成功した場合 true, キャッシュが無いか古い場合は false
+		[[nodiscard]]
+		bool load(AngelScript::asIScriptModule* module, FilePathView fullpath, bool withLineCues, Array<FilePath>& includedFiles) const;
+
+		/// @brief コンパイルしたモジュールのバイトコードをキャッシュに保存します。
+		/// @param module コンパイルしたモジュール
+		/// @param fullpath スクリプトファイルのフルパス
+		/// @param withLineCues ラインキューを含むバイトコードである場合 true
+		/// @param includedFiles インクルードしているファイル一覧
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		bool save(const AngelScript::asIScriptModule* module, FilePathView fullpath, bool withLineCues, const Array<FilePath>& includedFiles) const;
+
+	private:
+
+		FilePath m_directory = U"script_cache/";
+
+		[[nodiscard]]
+		FilePath getCachePath(FilePathView fullpath, bool withLineCues) const;
+	};
+}
@@ -71,6 +71,7 @@ namespace s3d
 		{
 			m_includedFiles.clear();
 			m_messages = SIV3D_ENGINE(Script)->retrieveMessages_internal();
+			discardUnbuiltModule();
 			return;
 		}
 
@@ -80,6 +81,7 @@ namespace s3d
 			(r < 0))
 		{
 			m_messages = SIV3D_ENGINE(Script)->retrieveMessages_internal();
+			discardUnbuiltModule();
 			return;
 		}
 
@@ -104,44 +106,7 @@ namespace s3d
 
 		m_initialized = true;
 
-		const bool withLineCues = static_cast<bool>(m_compileOption & ScriptCompileOption::BuildWithLineCues);
-		m_engine->SetEngineProperty(AngelScript::asEP_BUILD_WITHOUT_LINE_CUES, (not withLineCues));
-
-		AngelScript::CScriptBuilder builder;
-		int32 r = 0;
-		
-		if (builder.StartNewModule(m_engine, m_moduleName.c_str()); 
-			(r < 0))
-		{
-			LOG_FAIL(U"Unrecoverable error while starting a new module.");
-			return;
-		}
-
-		std::vector<std::string> includedFiles;
-
-		if (r = builder.AddSectionFromFile(m_fullpath, includedFiles);
-			(r < 0))
-		{
-			m_includedFiles.clear();
-			m_messages = SIV3D_ENGINE(Script)->retrieveMessages_internal();
-			return;
-		}
-
-		m_includedFiles = detail::ConvertIncludedFiles(includedFiles);
-
-		if (r = builder.BuildModule(); 
-			(r < 0))
-		{
-			m_messages = SIV3D_ENGINE(Script)->retrieveMessages_internal();
-			return;
-		}
-
-		m_module->module = m_engine->GetModule(m_moduleName.c_str());
-		m_moduleName = UUIDValue::Generate().to_string();
-		m_module->context = m_engine->CreateContext();
-		m_module->withLineCues = withLineCues;
-
-		m_complieSucceeded = true;
+		buildFromFile();
 	}
 
 	bool ScriptData::isInitialized() const noexcept
@@ -166,52 +131,21 @@ namespace s3d
 			return false;
 		}
 
+		// 以前のモジュールは、それを参照する ScriptFunction がすべて破棄された時点で ScriptModule のデストラクタが破棄する
 		m_module = std::make_shared<ScriptModule>();
 		m_functions.clear();
-		m_moduleName.clear();
+		m_moduleName = UUIDValue::Generate().to_string();
 		m_messages.clear();
 		m_complieSucceeded = false;
 		m_compileOption = compileOption;
 
-		const bool withLineCues = static_cast<bool>(m_compileOption & ScriptCompileOption::BuildWithLineCues);
-		m_engine->SetEngineProperty(AngelScript::asEP_BUILD_WITHOUT_LINE_CUES, (not withLineCues));
-
-		AngelScript::CScriptBuilder builder;
-		int32 r = 0;
-
-		if (builder.StartNewModule(m_engine, m_moduleName.c_str());
-			(r < 0))
-		{
-			LOG_FAIL(U"Unrecoverable error while starting a new module.");
-			return false;
-		}
-
-		std::vector<std::string> includedFiles;
-
-		if (r = builder.AddSectionFromFile(m_fullpath, includedFiles);
-			(r < 0))
-		{
-			m_includedFiles.clear();
-			m_messages = SIV3D_ENGINE(Script)->retrieveMessages_internal();
-			return false;
-		}
-
-		m_includedFiles = detail::ConvertIncludedFiles(includedFiles);
-
-		if (r = builder.BuildModule();
-			(r < 0))
+		if (not buildFromFile())
 		{
-			m_messages = SIV3D_ENGINE(Script)->retrieveMessages_internal();
 			return false;
 		}
 
-		m_module->module = m_engine->GetModule(m_moduleName.c_str());
-		m_module->context = m_engine->CreateContext();
-		m_module->withLineCues = withLineCues;
 		m_module->scriptID = scriptID;
 
-		m_complieSucceeded = true;
-
 		return true;
 	}
 
@@ -302,4 +236,84 @@ namespace s3d
 	{
 		return m_systemUpdateCallback;
 	}
+
+	bool ScriptData::buildFromFile()
+	{
+		const bool withLineCues = static_cast<bool>(m_compileOption & ScriptCompileOption::BuildWithLineCues);
+		const bool useBytecodeCache = static_cast<bool>(m_compileOption & ScriptCompileOption::UseBytecodeCache);
+		m_engine->SetEngineProperty(AngelScript::asEP_BUILD_WITHOUT_LINE_CUES, (not withLineCues));
+
+		if (useBytecodeCache)
+		{
+			AngelScript::asIScriptModule* module = m_engine->GetModule(m_moduleName.c_str(), AngelScript::asGM_ALWAYS_CREATE);
+
+			if (SIV3D_ENGINE(Script)->getBytecodeCache().load(module, m_fullpath, withLineCues, m_includedFiles))
+			{
+				m_module->module = module;
+				m_module->context = m_engine->CreateContext();
+				m_module->withLineCues = withLineCues;
+
+				m_complieSucceeded = true;
+
+				return true;
+			}
+
+			// キャッシュが使えない場合はコンパイルする。読み込みの失敗で出力されたメッセージは捨てる
+			module->Discard();
+			m_includedFiles.clear();
+			SIV3D_ENGINE(Script)->retrieveMessages_internal();
+		}
+
+		AngelScript::CScriptBuilder builder;
+		int32 r = 0;
+
+		if (builder.StartNewModule(m_engine, m_moduleName.c_str());
+			(r < 0))
+		{
+			LOG_FAIL(U"Unrecoverable error while starting a new module.");
+			return false;
+		}
+
+		std::vector<std::string> includedFiles;
+
+		if (r = builder.AddSectionFromFile(m_fullpath, includedFiles);
+			(r < 0))
+		{
+			m_includedFiles.clear();
+			m_messages = SIV3D_ENGINE(Script)->retrieveMessages_internal();
+			discardUnbuiltModule();
+			return false;
+		}
+
+		m_includedFiles = detail::ConvertIncludedFiles(includedFiles);
+
+		if (r = builder.BuildModule();
+			(r < 0))
+		{
+			m_messages = SIV3D_ENGINE(Script)->retrieveMessages_internal();
+			discardUnbuiltModule();
+			return false;
+		}
+
+		m_module->module = m_engine->GetModule(m_moduleName.c_str());
+		m_module->context = m_engine->CreateContext();
+		m_module->withLineCues = withLineCues;
+
+		m_complieSucceeded = true;
+
+		if (useBytecodeCache)
+		{
+			SIV3D_ENGINE(Script)->getBytecodeCache().save(m_module->module, m_fullpath, withLineCues, m_includedFiles);
+		}
+
+		return true;
+	}
+
+	void ScriptData::discardUnbuiltModule()
+	{
+		if (AngelScript::asIScriptModule* module = m_engine->GetModule(m_moduleName.c_str()))
+		{
+			module->Discard();
+		}
+	}
 }
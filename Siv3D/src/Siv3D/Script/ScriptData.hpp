@@ -89,5 +89,12 @@ namespace s3d
 		bool m_complieSucceeded = false;
 
 		bool m_initialized = false;
+
+		/// @brief `m_fullpath` のスクリプトをビルドします。`ScriptCompileOption::UseBytecodeCache` が指定されている場合はキャッシュを使います。
+		/// @return ビルドに成功した場合 true, それ以外の場合は false
+		bool buildFromFile();
+
+		/// @brief ビルドに失敗したモジュールをエンジンから取り除きます。
+		void discardUnbuiltModule();
 	};
 }
@@ -114,6 +114,21 @@ namespace s3d
 		return SIV3D_ENGINE(Script)->getEngine();
 	}
 
+	void Script::SetBytecodeCacheDirectory(const FilePathView directory)
+	{
+		SIV3D_ENGINE(Script)->getBytecodeCache().setDirectory(directory);
+	}
+
+	const FilePath& Script::GetBytecodeCacheDirectory()
+	{
+		return SIV3D_ENGINE(Script)->getBytecodeCache().getDirectory();
+	}
+
+	size_t Script::Precompile(const FilePathView directory, const ScriptCompileOption compileOption, const Recursive recursive)
+	{
+		return SIV3D_ENGINE(Script)->precompile(directory, compileOption, recursive);
+	}
+
 	const std::shared_ptr<ScriptModule>& Script::_getModule() const
 	{
 		return SIV3D_ENGINE(Script)->getModule(m_handle->id());
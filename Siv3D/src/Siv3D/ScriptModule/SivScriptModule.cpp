@@ -20,5 +20,12 @@ namespace s3d
 			context->Release();
 			context = nullptr;
 		}
+
+		// Script と ScriptFunction のどちらからも参照されなくなったモジュールをエンジンから取り除く
+		if (module)
+		{
+			module->Discard();
+			module = nullptr;
+		}
 	}
 }
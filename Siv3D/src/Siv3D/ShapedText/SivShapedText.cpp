@@ -0,0 +1,49 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ShapedText.hpp>
+# include <Siv3D/Font/IFont.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
+
+namespace s3d
+{
+	ShapedText::ShapedText(const Font& font, String text, const UseFallback useFallback, const Ligature ligature)
+	{
+		m_drawableText.font = font;
+		m_drawableText.text = std::move(text);
+		m_drawableText.clusters = SIV3D_ENGINE(Font)->getGlyphClusters(font.id(), m_drawableText.text, useFallback.getBool(), ligature);
+	}
+
+	const Font& ShapedText::font() const noexcept
+	{
+		return m_drawableText.font;
+	}
+
+	const String& ShapedText::text() const noexcept
+	{
+		return m_drawableText.text;
+	}
+
+	const Array<GlyphCluster>& ShapedText::clusters() const noexcept
+	{
+		return m_drawableText.getClusters();
+	}
+
+	bool ShapedText::isEmpty() const noexcept
+	{
+		return m_drawableText.text.isEmpty();
+	}
+
+	const DrawableText& ShapedText::drawable() const noexcept
+	{
+		return m_drawableText;
+	}
+}
@@ -24,6 +24,29 @@ namespace s3d
 {
 	namespace SystemLog
 	{
+		namespace detail
+		{
+			[[nodiscard]]
+			static StringView ToString(const SIMDLevel level) noexcept
+			{
+				switch (level)
+				{
+				case SIMDLevel::SSE2:
+					return U"SSE2";
+				case SIMDLevel::SSE4_1:
+					return U"SSE4.1";
+				case SIMDLevel::AVX2:
+					return U"AVX2";
+				case SIMDLevel::AVX512:
+					return U"AVX-512";
+				case SIMDLevel::NEON:
+					return U"NEON";
+				default:
+					return U"None";
+				}
+			}
+		}
+
 		void Initial()
 		{
 			LOG_INFO(U"ℹ️ {}"_fmt(DateTime::Now()));
@@ -56,6 +79,7 @@ namespace s3d
 				LOG_INFO(U"ℹ️ CPU: {} {} {}.{}.{} (CPU packages: {}, Physical CPUs: {}, Logical CPUs: {})"_fmt(
 					cpu.vendor, cpu.brand, cpu.family, cpu.model, cpu.stepping,
 					quantities.packages, quantities.physical, quantities.logical));
+				LOG_INFO(U"ℹ️ SIMD: {}"_fmt(detail::ToString(cpu.simdLevel)));
 			}
 
 			{
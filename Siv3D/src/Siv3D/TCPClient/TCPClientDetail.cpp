@@ -32,7 +32,7 @@ namespace s3d
 
 			m_work = std::make_unique<asio::io_service::work>(*m_io_service);
 
-			m_io_service_thread = Async([this] { m_io_service->run(); });
+			m_io_service_thread = Async(AsyncLaunch::DedicatedThread, [this] { m_io_service->run(); });
 		}
 
 		if (m_isConnected)
@@ -221,4 +221,44 @@ namespace s3d
 
 		return m_session->send(data, size);
 	}
+
+	TCPReceivedSpans TCPClient::TCPClientDetail::peek()
+	{
+		if (!m_session)
+		{
+			return{};
+		}
+
+		return m_session->peek();
+	}
+
+	bool TCPClient::TCPClientDetail::readMessage(Array<Byte>& message)
+	{
+		if (!m_session)
+		{
+			return false;
+		}
+
+		return m_session->readMessage(message);
+	}
+
+	bool TCPClient::TCPClientDetail::sendMessage(const void* data, const size_t size)
+	{
+		if (!m_session)
+		{
+			return false;
+		}
+
+		return m_session->sendMessage(data, size);
+	}
+
+	TCPSessionStats TCPClient::TCPClientDetail::getStats() const
+	{
+		if (!m_session)
+		{
+			return{};
+		}
+
+		return m_session->getStats();
+	}
 }
@@ -15,7 +15,10 @@
 namespace s3d
 {
 	TCPServer::TCPServer()
-		: pImpl{ std::make_shared<TCPServerDetail>() } {}
+		: pImpl{ std::make_shared<TCPServerDetail>(1) } {}
+
+	TCPServer::TCPServer(const size_t numIOThreads)
+		: pImpl{ std::make_shared<TCPServerDetail>(numIOThreads) } {}
 	
 	TCPServer::~TCPServer() {}
 
@@ -69,6 +72,11 @@ namespace s3d
 		return pImpl->port();
 	}
 
+	size_t TCPServer::num_IOThreads() const noexcept
+	{
+		return pImpl->num_IOThreads();
+	}
+
 	size_t TCPServer::available(const Optional<TCPSessionID>& id)
 	{
 		return pImpl->available(id);
@@ -93,4 +101,29 @@ namespace s3d
 	{
 		return pImpl->send(data, size, id);
 	}
+
+	TCPReceivedSpans TCPServer::peek(const Optional<TCPSessionID>& id)
+	{
+		return pImpl->peek(id);
+	}
+
+	bool TCPServer::readMessage(Array<Byte>& message, const Optional<TCPSessionID>& id)
+	{
+		return pImpl->readMessage(message, id);
+	}
+
+	bool TCPServer::readAnyMessage(TCPSessionID& id, Array<Byte>& message)
+	{
+		return pImpl->readAnyMessage(id, message);
+	}
+
+	bool TCPServer::sendMessage(const void* data, const size_t size, const Optional<TCPSessionID>& id)
+	{
+		return pImpl->sendMessage(data, size, id);
+	}
+
+	TCPSessionStats TCPServer::getStats(const Optional<TCPSessionID>& id) const
+	{
+		return pImpl->getStats(id);
+	}
 }
@@ -13,8 +13,9 @@
 
 namespace s3d
 {
-	TCPServer::TCPServerDetail::TCPServerDetail()
-		: m_io_service(std::make_shared<asio::io_service>())
+	TCPServer::TCPServerDetail::TCPServerDetail(const size_t numIOThreads)
+		: m_io_service(std::make_shared<asio::io_service>(static_cast<int>(Max<size_t>(numIOThreads, 1))))
+		, m_numIOThreads{ Max<size_t>(numIOThreads, 1) }
 	{
 
 	}
@@ -37,12 +38,7 @@ namespace s3d
 
 		m_port = port;
 
-		if (!m_work)
-		{
-			m_work = std::make_unique<asio::io_service::work>(*m_io_service);
-
-			m_io_service_thread = Async([this] { m_io_service->run(); });
-		}
+		startIOThreads();
 
 		m_acceptor = std::make_unique<asio::ip::tcp::acceptor>(*m_io_service, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), port));
 
@@ -65,12 +61,7 @@ namespace s3d
 
 		m_port = port;
 
-		if (!m_work)
-		{
-			m_work = std::make_unique<asio::io_service::work>(*m_io_service);
-
-			m_io_service_thread = Async([this] { m_io_service->run(); });
-		}
+		startIOThreads();
 
 		m_acceptor = std::make_unique<asio::ip::tcp::acceptor>(*m_io_service, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), port));
 
@@ -99,12 +90,16 @@ namespace s3d
 	{
 		cancelAccept();
 
-		for (auto& session : m_sessions)
 		{
-			session.second->close();
-		}
+			std::lock_guard lock{ m_mutexSessions };
 
-		m_sessions.clear();
+			for (auto& session : m_sessions)
+			{
+				session.second->close();
+			}
+
+			m_sessions.clear();
+		}
 
 		if (m_work)
 		{
@@ -112,7 +107,12 @@ namespace s3d
 
 			m_io_service->stop();
 
-			m_io_service_thread.wait();
+			for (auto& thread : m_io_service_threads)
+			{
+				thread.wait();
+			}
+
+			m_io_service_threads.clear();
 
 			m_io_service->restart();
 		}
@@ -120,6 +120,8 @@ namespace s3d
 
 	bool TCPServer::TCPServerDetail::hasSession()
 	{
+		std::lock_guard lock{ m_mutexSessions };
+
 		updateSession();
 
 		return m_sessions.any([](const auto& session) { return session.second->isActive(); });
@@ -127,6 +129,8 @@ namespace s3d
 
 	bool TCPServer::TCPServerDetail::hasSession(const TCPSessionID id)
 	{
+		std::lock_guard lock{ m_mutexSessions };
+
 		updateSession();
 
 		return m_sessions.contains_if([=](const auto& session) { return session.first == id; });
@@ -134,6 +138,8 @@ namespace s3d
 
 	size_t TCPServer::TCPServerDetail::num_sessions()
 	{
+		std::lock_guard lock{ m_mutexSessions };
+
 		updateSession();
 
 		return m_sessions.count_if([](const auto& session) { return session.second->isActive(); });
@@ -141,6 +147,8 @@ namespace s3d
 
 	Array<TCPSessionID> TCPServer::TCPServerDetail::getSessionIDs()
 	{
+		std::lock_guard lock{ m_mutexSessions };
+
 		updateSession();
 
 		return m_sessions.map([](const auto& session) { return session.first; });
@@ -151,110 +159,128 @@ namespace s3d
 		return m_port;
 	}
 
+	size_t TCPServer::TCPServerDetail::num_IOThreads() const noexcept
+	{
+		return m_numIOThreads;
+	}
+
 	size_t TCPServer::TCPServerDetail::available(const Optional<TCPSessionID>& id)
 	{
-		if (m_sessions.isEmpty())
+		if (const auto session = findSession(id))
 		{
-			return 0;
+			return session->available();
 		}
 
-		const TCPSessionID sessionID = id.value_or(m_sessions.front().first);
+		return 0;
+	}
 
-		for (auto& session : m_sessions)
+	bool TCPServer::TCPServerDetail::skip(const size_t size, const Optional<TCPSessionID>& id)
+	{
+		if (const auto session = findSession(id))
 		{
-			if (session.first == sessionID)
-			{
-				return session.second->available();
-			}
+			return session->skip(size);
 		}
 
-		return 0;
+		return false;
 	}
 
-	bool TCPServer::TCPServerDetail::skip(const size_t size, const Optional<TCPSessionID>& id)
+	bool TCPServer::TCPServerDetail::lookahead(void* dst, const size_t size, const Optional<TCPSessionID>& id) const
 	{
-		if (m_sessions.isEmpty())
+		if (const auto session = findSession(id))
 		{
-			return false;
+			return session->lookahead(dst, size);
 		}
 
-		const TCPSessionID sessionID = id.value_or(m_sessions.front().first);
+		return false;
+	}
 
-		for (auto& session : m_sessions)
+	bool TCPServer::TCPServerDetail::read(void* dst, const size_t size, const Optional<TCPSessionID>& id)
+	{
+		if (const auto session = findSession(id))
 		{
-			if (session.first == sessionID)
-			{
-				return session.second->skip(size);
-			}
+			return session->read(dst, size);
 		}
 
 		return false;
 	}
 
-	bool TCPServer::TCPServerDetail::lookahead(void* dst, const size_t size, const Optional<TCPSessionID>& id) const
+	bool TCPServer::TCPServerDetail::send(const void* data, const size_t size, const Optional<TCPSessionID>& id)
 	{
-		if (m_sessions.isEmpty())
+		if (const auto session = findSession(id))
 		{
-			return false;
+			return session->send(data, size);
 		}
 
-		const TCPSessionID sessionID = id.value_or(m_sessions.front().first);
+		return false;
+	}
 
-		for (auto& session : m_sessions)
+	TCPReceivedSpans TCPServer::TCPServerDetail::peek(const Optional<TCPSessionID>& id)
+	{
+		if (const auto session = findSession(id))
 		{
-			if (session.first == sessionID)
-			{
-				return session.second->lookahead(dst, size);
-			}
+			return session->peek();
 		}
 
-		return false;
+		return{};
 	}
 
-	bool TCPServer::TCPServerDetail::read(void* dst, const size_t size, const Optional<TCPSessionID>& id)
+	bool TCPServer::TCPServerDetail::readMessage(Array<Byte>& message, const Optional<TCPSessionID>& id)
 	{
-		if (m_sessions.isEmpty())
+		if (const auto session = findSession(id))
 		{
-			return false;
+			return session->readMessage(message);
 		}
 
-		const TCPSessionID sessionID = id.value_or(m_sessions.front().first);
+		return false;
+	}
+
+	bool TCPServer::TCPServerDetail::readAnyMessage(TCPSessionID& id, Array<Byte>& message)
+	{
+		std::lock_guard lock{ m_mutexSessions };
+
+		const size_t num_sessions = m_sessions.size();
 
-		for (auto& session : m_sessions)
+		// 特定のセッションばかりが読まれないよう、前回メッセージを取り出したセッションの次から調べる
+		for (size_t i = 0; i < num_sessions; ++i)
 		{
-			if (session.first == sessionID)
+			const size_t index = ((m_messageCursor + i) % num_sessions);
+			const auto& session = m_sessions[index];
+
+			if (session.second->readMessage(message))
 			{
-				return session.second->read(dst, size);
+				id = session.first;
+
+				m_messageCursor = (index + 1);
+
+				return true;
 			}
 		}
 
 		return false;
 	}
 
-	bool TCPServer::TCPServerDetail::send(const void* data, const size_t size, const Optional<TCPSessionID>& id)
+	bool TCPServer::TCPServerDetail::sendMessage(const void* data, const size_t size, const Optional<TCPSessionID>& id)
 	{
-		if (m_sessions.isEmpty())
+		if (const auto session = findSession(id))
 		{
-			return false;
+			return session->sendMessage(data, size);
 		}
 
-		const TCPSessionID sessionID = id.value_or(m_sessions.front().first);
+		return false;
+	}
 
-		for (auto& session : m_sessions)
+	TCPSessionStats TCPServer::TCPServerDetail::getStats(const Optional<TCPSessionID>& id) const
+	{
+		if (const auto session = findSession(id))
 		{
-			if (session.first == sessionID)
-			{
-				return session.second->send(data, size);
-			}
+			return session->getStats();
 		}
 
-		return false;
+		return{};
 	}
 
 	void TCPServer::TCPServerDetail::onAccept(const asio::error_code& error, const std::shared_ptr<detail::ServerSession>& session)
 	{
-		updateSession();
-
 		if (!m_accepting)
 		{
 			return;
@@ -283,11 +309,17 @@ namespace s3d
 				socket.local_endpoint().port()));
 		}
 
-		m_sessions.push_back({ id, session });
+		{
+			std::lock_guard lock{ m_mutexSessions };
+
+			updateSession();
+
+			m_sessions.push_back({ id, session });
+		}
 
 		LOG_TRACE(U"TCPServer session [{}] created"_fmt(id));
 
-		m_sessions.back().second->startReceive();
+		session->startReceive();
 
 		if (m_allowMulti)
 		{
@@ -302,8 +334,45 @@ namespace s3d
 		}
 	}
 
+	void TCPServer::TCPServerDetail::startIOThreads()
+	{
+		if (m_work)
+		{
+			return;
+		}
+
+		m_work = std::make_unique<asio::io_service::work>(*m_io_service);
+
+		for (size_t i = 0; i < m_numIOThreads; ++i)
+		{
+			m_io_service_threads.push_back(Async(AsyncLaunch::DedicatedThread, [this] { m_io_service->run(); }));
+		}
+	}
+
 	void TCPServer::TCPServerDetail::updateSession()
 	{
 		m_sessions.remove_if([](const auto& session) { return !session.second->isActive(); });
 	}
+
+	std::shared_ptr<detail::ServerSession> TCPServer::TCPServerDetail::findSession(const Optional<TCPSessionID>& id) const
+	{
+		std::lock_guard lock{ m_mutexSessions };
+
+		if (m_sessions.isEmpty())
+		{
+			return nullptr;
+		}
+
+		const TCPSessionID sessionID = id.value_or(m_sessions.front().first);
+
+		for (const auto& session : m_sessions)
+		{
+			if (session.first == sessionID)
+			{
+				return session.second;
+			}
+		}
+
+		return nullptr;
+	}
 }
@@ -0,0 +1,660 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <bit>
+# include <Siv3D/Endian.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "TCPSession.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		/// @brief メッセージのサイズのヘッダ（リトルエンディアン）とホストのバイトオーダーを相互に変換します。
+		[[nodiscard]]
+		static uint32 MessageSizeHeader(const uint32 value) noexcept
+		{
+			if constexpr (std::endian::native == std::endian::big)
+			{
+				return SwapEndian(value);
+			}
+			else
+			{
+				return value;
+			}
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	TCPReceiveBuffer
+		//
+		////////////////////////////////////////////////////////////////
+
+		TCPReceiveBuffer::TCPReceiveBuffer()
+			: m_data(InitialCapacity) {}
+
+		std::span<Byte> TCPReceiveBuffer::writableSpan() noexcept
+		{
+			const uint64 writePos = m_writePos.load(std::memory_order_relaxed);
+			const uint64 readPos = m_readPos.load(std::memory_order_acquire);
+
+			const size_t capacity = m_data.size();
+			const size_t freeSize = (capacity - static_cast<size_t>(writePos - readPos));
+			const size_t offset = static_cast<size_t>(writePos & (capacity - 1));
+
+			return{ (m_data.data() + offset), Min(freeSize, (capacity - offset)) };
+		}
+
+		void TCPReceiveBuffer::commit(const size_t size) noexcept
+		{
+			m_writePos.store((m_writePos.load(std::memory_order_relaxed) + size), std::memory_order_release);
+		}
+
+		size_t TCPReceiveBuffer::size() const noexcept
+		{
+			return static_cast<size_t>(m_writePos.load(std::memory_order_acquire) - m_readPos.load(std::memory_order_relaxed));
+		}
+
+		size_t TCPReceiveBuffer::capacity() const noexcept
+		{
+			return m_data.size();
+		}
+
+		TCPReceivedSpans TCPReceiveBuffer::peek() const noexcept
+		{
+			const uint64 readPos = m_readPos.load(std::memory_order_relaxed);
+			const size_t size = static_cast<size_t>(m_writePos.load(std::memory_order_acquire) - readPos);
+
+			const size_t capacity = m_data.size();
+			const size_t offset = static_cast<size_t>(readPos & (capacity - 1));
+			const size_t firstSize = Min(size, (capacity - offset));
+
+			return{ { (m_data.data() + offset), firstSize }, { m_data.data(), (size - firstSize) } };
+		}
+
+		bool TCPReceiveBuffer::skip(const size_t size) noexcept
+		{
+			if (this->size() < size)
+			{
+				return false;
+			}
+
+			m_readPos.store((m_readPos.load(std::memory_order_relaxed) + size), std::memory_order_release);
+
+			return true;
+		}
+
+		bool TCPReceiveBuffer::lookahead(void* dst, const size_t size) const noexcept
+		{
+			if (this->size() < size)
+			{
+				return false;
+			}
+
+			copyTo(dst, m_readPos.load(std::memory_order_relaxed), size);
+
+			return true;
+		}
+
+		bool TCPReceiveBuffer::read(void* dst, const size_t size) noexcept
+		{
+			if (this->size() < size)
+			{
+				return false;
+			}
+
+			const uint64 readPos = m_readPos.load(std::memory_order_relaxed);
+
+			copyTo(dst, readPos, size);
+
+			m_readPos.store((readPos + size), std::memory_order_release);
+
+			return true;
+		}
+
+		bool TCPReceiveBuffer::grow()
+		{
+			const size_t capacity = m_data.size();
+
+			if (MaxCapacity <= capacity)
+			{
+				return false;
+			}
+
+			const size_t size = this->size();
+
+			Array<Byte> newData(capacity * 2);
+
+			copyTo(newData.data(), m_readPos.load(std::memory_order_relaxed), size);
+
+			m_data = std::move(newData);
+
+			m_readPos.store(0, std::memory_order_relaxed);
+
+			m_writePos.store(size, std::memory_order_release);
+
+			LOG_TRACE(U"ℹ️ Resized TCPReceiveBuffer (capacity: {} -> {})"_fmt(capacity, m_data.size()));
+
+			return true;
+		}
+
+		void TCPReceiveBuffer::copyTo(void* dst, const uint64 readPos, const size_t size) const noexcept
+		{
+			const size_t capacity = m_data.size();
+			const size_t offset = static_cast<size_t>(readPos & (capacity - 1));
+			const size_t firstSize = Min(size, (capacity - offset));
+
+			std::memcpy(dst, (m_data.data() + offset), firstSize);
+
+			if (firstSize < size)
+			{
+				std::memcpy((static_cast<Byte*>(dst) + firstSize), m_data.data(), (size - firstSize));
+			}
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	TCPSendBuffer
+		//
+		////////////////////////////////////////////////////////////////
+
+		void TCPSendBuffer::append(const void* data, const size_t size)
+		{
+			write(static_cast<const Byte*>(data), size);
+
+			endMessage();
+		}
+
+		void TCPSendBuffer::appendMessage(const void* data, const uint32 size)
+		{
+			const uint32 header = MessageSizeHeader(size);
+
+			write(reinterpret_cast<const Byte*>(&header), sizeof(header));
+
+			write(static_cast<const Byte*>(data), size);
+
+			endMessage();
+		}
+
+		void TCPSendBuffer::endMessage()
+		{
+			m_messageEnds.push_back(m_appended);
+			m_maxPendingMessages = Max(m_maxPendingMessages, m_messageEnds.size());
+		}
+
+		void TCPSendBuffer::gather(Array<asio::const_buffer>& buffers) const
+		{
+			buffers.clear();
+
+			const size_t num_blocks = Min(m_blocks.size(), MaxBlocksPerBatch);
+
+			for (size_t i = 0; i < num_blocks; ++i)
+			{
+				const Block& block = *m_blocks[i];
+				const size_t offset = ((i == 0) ? m_readOffset : 0);
+
+				if (offset < block.size)
+				{
+					buffers.emplace_back((block.data.get() + offset), (block.size - offset));
+				}
+			}
+		}
+
+		void TCPSendBuffer::consume(size_t size)
+		{
+			assert(size <= m_size);
+
+			m_size -= size;
+			m_consumed += size;
+
+			while ((not m_messageEnds.empty()) && (m_messageEnds.front() <= m_consumed))
+			{
+				m_messageEnds.pop_front();
+			}
+
+			while (size)
+			{
+				Block& block = *m_blocks.front();
+				const size_t consumeSize = Min(size, (block.size - m_readOffset));
+
+				m_readOffset += consumeSize;
+				size -= consumeSize;
+
+				if (m_readOffset < block.size)
+				{
+					continue;
+				}
+
+				m_readOffset = 0;
+
+				if (m_blocks.size() == 1)
+				{
+					// 末尾のブロックはそのまま再利用する
+					block.size = 0;
+				}
+				else
+				{
+					if (m_freeBlocks.size() < MaxFreeBlocks)
+					{
+						block.size = 0;
+						m_freeBlocks.push_back(std::move(m_blocks.front()));
+					}
+
+					m_blocks.pop_front();
+				}
+			}
+		}
+
+		void TCPSendBuffer::clear()
+		{
+			for (auto& block : m_blocks)
+			{
+				if (m_freeBlocks.size() < MaxFreeBlocks)
+				{
+					block->size = 0;
+					m_freeBlocks.push_back(std::move(block));
+				}
+			}
+
+			m_blocks.clear();
+			m_messageEnds.clear();
+
+			m_readOffset = 0;
+			m_size = 0;
+			m_consumed = m_appended;
+		}
+
+		bool TCPSendBuffer::isEmpty() const noexcept
+		{
+			return (m_size == 0);
+		}
+
+		size_t TCPSendBuffer::size() const noexcept
+		{
+			return m_size;
+		}
+
+		size_t TCPSendBuffer::num_pendingMessages() const noexcept
+		{
+			return m_messageEnds.size();
+		}
+
+		size_t TCPSendBuffer::maxPendingMessages() const noexcept
+		{
+			return m_maxPendingMessages;
+		}
+
+		void TCPSendBuffer::write(const Byte* pSrc, size_t size)
+		{
+			m_size += size;
+			m_appended += size;
+
+			while (size)
+			{
+				if (m_blocks.empty() || (m_blocks.back()->size == BlockSize))
+				{
+					m_blocks.push_back(newBlock());
+				}
+
+				Block& block = *m_blocks.back();
+				const size_t copySize = Min(size, (BlockSize - block.size));
+
+				std::memcpy((block.data.get() + block.size), pSrc, copySize);
+
+				block.size += copySize;
+				pSrc += copySize;
+				size -= copySize;
+			}
+		}
+
+		std::unique_ptr<TCPSendBuffer::Block> TCPSendBuffer::newBlock()
+		{
+			if (not m_freeBlocks.isEmpty())
+			{
+				std::unique_ptr<Block> block = std::move(m_freeBlocks.back());
+				m_freeBlocks.pop_back();
+				return block;
+			}
+
+			return std::make_unique<Block>();
+		}
+
+		////////////////////////////////////////////////////////////////
+		//
+		//	TCPSession
+		//
+		////////////////////////////////////////////////////////////////
+
+		TCPSession::TCPSession(asio::io_context& io_context)
+			: m_socket{ asio::make_strand(io_context) } {}
+
+		asio::ip::tcp::socket& TCPSession::socket()
+		{
+			return m_socket;
+		}
+
+		bool TCPSession::isActive() const
+		{
+			return m_isActive;
+		}
+
+		void TCPSession::startReceive()
+		{
+			std::span<Byte> buffer = m_receiveBuffer.writableSpan();
+
+			if (buffer.empty())
+			{
+				std::lock_guard lock{ m_mutexReceiveState };
+
+				// ロックを取る前にメインスレッドが読み進めている可能性がある
+				buffer = m_receiveBuffer.writableSpan();
+
+				if (buffer.empty())
+				{
+					// メインスレッドが読み進めるか、バッファを拡張するまで受信を停止する
+					m_receivePaused = true;
+
+					++m_numReceiveStalls;
+
+					return;
+				}
+			}
+
+			m_socket.async_read_some(asio::buffer(buffer.data(), buffer.size()),
+				std::bind(&TCPSession::onReceive, this, std::placeholders::_1, std::placeholders::_2, shared_from_this()));
+		}
+
+		size_t TCPSession::available()
+		{
+			resumeReceive();
+
+			return m_receiveBuffer.size();
+		}
+
+		TCPReceivedSpans TCPSession::peek()
+		{
+			if (not m_isActive)
+			{
+				return{};
+			}
+
+			resumeReceive();
+
+			return m_receiveBuffer.peek();
+		}
+
+		bool TCPSession::skip(const size_t size)
+		{
+			if (not m_isActive)
+			{
+				return false;
+			}
+
+			if (size == 0)
+			{
+				return true;
+			}
+
+			const bool result = m_receiveBuffer.skip(size);
+
+			resumeReceive();
+
+			return result;
+		}
+
+		bool TCPSession::lookahead(void* dst, const size_t size)
+		{
+			if (not m_isActive)
+			{
+				return false;
+			}
+
+			if (size == 0)
+			{
+				return true;
+			}
+
+			resumeReceive();
+
+			return m_receiveBuffer.lookahead(dst, size);
+		}
+
+		bool TCPSession::read(void* dst, const size_t size)
+		{
+			if (not m_isActive)
+			{
+				return false;
+			}
+
+			if (size == 0)
+			{
+				return true;
+			}
+
+			const bool result = m_receiveBuffer.read(dst, size);
+
+			resumeReceive();
+
+			return result;
+		}
+
+		bool TCPSession::send(const void* data, const size_t size)
+		{
+			if (not m_isActive)
+			{
+				return false;
+			}
+
+			if (size == 0)
+			{
+				return true;
+			}
+
+			{
+				std::lock_guard lock{ m_mutexSendingBuffer };
+
+				m_sendingBuffer.append(data, size);
+
+				// 送信中であれば、完了したときに溜まっている分をまとめて送信する
+				if (not m_isSending)
+				{
+					send_internal();
+				}
+			}
+
+			return true;
+		}
+
+		bool TCPSession::readMessage(Array<Byte>& message)
+		{
+			if (not m_isActive)
+			{
+				return false;
+			}
+
+			resumeReceive();
+
+			uint32 size = 0;
+
+			if (not m_receiveBuffer.lookahead(&size, sizeof(size)))
+			{
+				return false;
+			}
+
+			size = MessageSizeHeader(size);
+
+			if (MaxMessageSize < size)
+			{
+				onReceiveError(asio::error::message_size);
+
+				return false;
+			}
+
+			if (m_receiveBuffer.size() < (sizeof(size) + size))
+			{
+				return false;
+			}
+
+			m_receiveBuffer.skip(sizeof(size));
+
+			message.resize(size);
+
+			m_receiveBuffer.read(message.data(), size);
+
+			resumeReceive();
+
+			return true;
+		}
+
+		bool TCPSession::sendMessage(const void* data, const size_t size)
+		{
+			if (not m_isActive)
+			{
+				return false;
+			}
+
+			if (MaxMessageSize < size)
+			{
+				return false;
+			}
+
+			{
+				std::lock_guard lock{ m_mutexSendingBuffer };
+
+				m_sendingBuffer.appendMessage(data, static_cast<uint32>(size));
+
+				if (not m_isSending)
+				{
+					send_internal();
+				}
+			}
+
+			return true;
+		}
+
+		TCPSessionStats TCPSession::getStats() const
+		{
+			TCPSessionStats stats;
+			stats.bytesReceived			= m_bytesReceived.load(std::memory_order_relaxed);
+			stats.receiveQueueBytes		= m_receiveBuffer.size();
+			stats.receiveBufferCapacity	= m_receiveBuffer.capacity();
+			stats.numReceiveStalls		= m_numReceiveStalls.load(std::memory_order_relaxed);
+
+			{
+				std::lock_guard lock{ m_mutexSendingBuffer };
+				stats.bytesSent			= m_bytesSent;
+				stats.sendQueueBytes	= m_sendingBuffer.size();
+				stats.sendQueueDepth	= m_sendingBuffer.num_pendingMessages();
+				stats.maxSendQueueDepth	= m_sendingBuffer.maxPendingMessages();
+				stats.numSendBatches	= m_numSendBatches;
+			}
+
+			return stats;
+		}
+
+		void TCPSession::closeIO()
+		{
+			m_socket.close();
+
+			{
+				std::lock_guard lock{ m_mutexSendingBuffer };
+
+				// 送信中のデータは onSend() で破棄する
+				if (not m_isSending)
+				{
+					m_sendingBuffer.clear();
+				}
+			}
+
+			m_isActive = false;
+		}
+
+		void TCPSession::onReceive(const asio::error_code& error, const size_t size, const std::shared_ptr<TCPSession>&)
+		{
+			if (error)
+			{
+				onReceiveError(error);
+
+				return;
+			}
+
+			m_receiveBuffer.commit(size);
+
+			m_bytesReceived.fetch_add(size, std::memory_order_relaxed);
+
+			startReceive();
+		}
+
+		void TCPSession::resumeReceive()
+		{
+			std::lock_guard lock{ m_mutexReceiveState };
+
+			if ((not m_receivePaused) || (not m_isActive))
+			{
+				return;
+			}
+
+			// 読み進められていない場合はバッファを拡張する。最大容量に達している場合は読み進められるまで待つ
+			if (m_receiveBuffer.writableSpan().empty()
+				&& (not m_receiveBuffer.grow()))
+			{
+				return;
+			}
+
+			m_receivePaused = false;
+
+			asio::post(m_socket.get_executor(), std::bind(&TCPSession::startReceive, shared_from_this()));
+		}
+
+		void TCPSession::send_internal()
+		{
+			m_isSending = true;
+
+			m_sendingBuffer.gather(m_sendingBuffers);
+
+			++m_numSendBatches;
+
+			// 送信が完了するまで m_sendingBuffers は変更しないため、コピーせずに参照を渡す
+			asio::async_write(m_socket, std::span<const asio::const_buffer>{ m_sendingBuffers },
+				std::bind(&TCPSession::onSend, this, std::placeholders::_1, std::placeholders::_2, shared_from_this()));
+		}
+
+		void TCPSession::onSend(const asio::error_code& error, const size_t size, const std::shared_ptr<TCPSession>&)
+		{
+			{
+				std::lock_guard lock{ m_mutexSendingBuffer };
+
+				m_isSending = false;
+
+				m_bytesSent += size;
+
+				if (m_isActive && (not error))
+				{
+					m_sendingBuffer.consume(size);
+
+					if (not m_sendingBuffer.isEmpty())
+					{
+						send_internal();
+					}
+
+					return;
+				}
+
+				m_sendingBuffer.clear();
+			}
+
+			if (m_isActive)
+			{
+				onSendError(error);
+			}
+		}
+	}
+}
@@ -0,0 +1,277 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <deque>
+# include <mutex>
+# include <atomic>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Byte.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/TCPSessionStats.hpp>
+
+# define _WINSOCK_DEPRECATED_NO_WARNINGS
+# ifndef _WIN32_WINNT
+#	define	_WIN32_WINNT _WIN32_WINNT_WIN8
+# endif
+# ifndef NTDDI_VERSION
+#	define	NTDDI_VERSION NTDDI_WIN8
+# endif
+# define  ASIO_STANDALONE
+# include <asio/asio.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		/// @brief 受信データを蓄積するリングバッファ
+		/// @remark I/O スレッドが書き込み、メインスレッドが読み出す Single-Producer / Single-Consumer のバッファです。
+		/// @remark I/O スレッドは `writableSpan()` が返す領域にソケットから直接受信します。
+		/// @remark 容量の拡張は、I/O スレッドが受信を停止している間にメインスレッドからのみ行います。
+		class TCPReceiveBuffer
+		{
+		public:
+
+			static constexpr size_t InitialCapacity = (64 * 1024);
+
+			static constexpr size_t MaxCapacity = (32 * 1024 * 1024);
+
+			TCPReceiveBuffer();
+
+			/// @brief 次に受信データを書き込める連続した領域を返します。（I/O スレッド）
+			/// @return 書き込める領域。バッファが満杯の場合は空
+			[[nodiscard]]
+			std::span<Byte> writableSpan() noexcept;
+
+			/// @brief `writableSpan()` の領域に書き込んだデータを確定します。（I/O スレッド）
+			/// @param size 書き込んだバイト数
+			void commit(size_t size) noexcept;
+
+			[[nodiscard]]
+			size_t size() const noexcept;
+
+			[[nodiscard]]
+			size_t capacity() const noexcept;
+
+			[[nodiscard]]
+			TCPReceivedSpans peek() const noexcept;
+
+			bool skip(size_t size) noexcept;
+
+			bool lookahead(void* dst, size_t size) const noexcept;
+
+			bool read(void* dst, size_t size) noexcept;
+
+			/// @brief 容量を 2 倍にします。（メインスレッド、I/O スレッドが受信を停止している間のみ）
+			/// @return 拡張した場合 true, 最大容量に達している場合は false
+			bool grow();
+
+		private:
+
+			Array<Byte> m_data;
+
+			// 書き込んだ累計バイト数
+			std::atomic<uint64> m_writePos = 0;
+
+			// 読み出した累計バイト数
+			std::atomic<uint64> m_readPos = 0;
+
+			void copyTo(void* dst, uint64 readPos, size_t size) const noexcept;
+		};
+
+		/// @brief 送信待ちのデータを固定サイズのブロックに詰めて保持するキュー
+		/// @remark `send()` ごとのメモリ確保を避けるため、送信済みのブロックは再利用します。
+		/// @remark 送信中の領域を指すポインタは、ブロックが送信済みになるまで無効になりません。
+		class TCPSendBuffer
+		{
+		public:
+
+			static constexpr size_t BlockSize = (64 * 1024);
+
+			/// @brief 1 回の書き込みにまとめるブロックの最大数
+			static constexpr size_t MaxBlocksPerBatch = 64;
+
+			/// @brief データをキューの末尾に追加します。
+			/// @param data データ
+			/// @param size データのサイズ（バイト）
+			void append(const void* data, size_t size);
+
+			/// @brief データの前に 4 バイトのサイズを付けて、1 つのメッセージとしてキューの末尾に追加します。
+			/// @param data データ
+			/// @param size データのサイズ（バイト）
+			void appendMessage(const void* data, uint32 size);
+
+			/// @brief 送信するデータの領域を先頭から集めます。
+			/// @param buffers 領域の格納先
+			void gather(Array<asio::const_buffer>& buffers) const;
+
+			/// @brief 先頭から送信済みのデータを取り除きます。
+			/// @param size 送信済みのバイト数
+			void consume(size_t size);
+
+			void clear();
+
+			[[nodiscard]]
+			bool isEmpty() const noexcept;
+
+			[[nodiscard]]
+			size_t size() const noexcept;
+
+			[[nodiscard]]
+			size_t num_pendingMessages() const noexcept;
+
+			[[nodiscard]]
+			size_t maxPendingMessages() const noexcept;
+
+		private:
+
+			struct Block
+			{
+				std::unique_ptr<Byte[]> data = std::make_unique<Byte[]>(BlockSize);
+
+				size_t size = 0;
+			};
+
+			static constexpr size_t MaxFreeBlocks = 4;
+
+			std::deque<std::unique_ptr<Block>> m_blocks;
+
+			Array<std::unique_ptr<Block>> m_freeBlocks;
+
+			// 先頭ブロックの送信済みバイト数
+			size_t m_readOffset = 0;
+
+			size_t m_size = 0;
+
+			// 追加した累計バイト数
+			uint64 m_appended = 0;
+
+			// 送信した累計バイト数
+			uint64 m_consumed = 0;
+
+			// 送信が完了していない各 `append()` の末尾の位置（累計バイト数）
+			std::deque<uint64> m_messageEnds;
+
+			size_t m_maxPendingMessages = 0;
+
+			void write(const Byte* pSrc, size_t size);
+
+			void endMessage();
+
+			[[nodiscard]]
+			std::unique_ptr<Block> newBlock();
+		};
+
+		/// @brief TCPServer, TCPClient のセッションに共通する送受信の処理
+		/// @remark 受信はリングバッファへ直接行い、送信は溜まっているデータを scatter-gather で 1 回の書き込みにまとめます。
+		/// @remark ソケットは strand に結び付けるため、io_context を複数のスレッドで実行しても、同じセッションのハンドラは並行して呼ばれません。
+		class TCPSession : public std::enable_shared_from_this<TCPSession>
+		{
+		public:
+
+			/// @brief メッセージの最大サイズ（バイト）
+			static constexpr size_t MaxMessageSize = (TCPReceiveBuffer::MaxCapacity - sizeof(uint32));
+
+			static_assert(MaxMessageSize == TCPMaxMessageSize);
+
+			explicit TCPSession(asio::io_context& io_context);
+
+			virtual ~TCPSession() = default;
+
+			[[nodiscard]]
+			asio::ip::tcp::socket& socket();
+
+			[[nodiscard]]
+			bool isActive() const;
+
+			void startReceive();
+
+			[[nodiscard]]
+			size_t available();
+
+			[[nodiscard]]
+			TCPReceivedSpans peek();
+
+			bool skip(size_t size);
+
+			bool lookahead(void* dst, size_t size);
+
+			bool read(void* dst, size_t size);
+
+			bool send(const void* data, size_t size);
+
+			/// @brief 受信が完了しているメッセージを 1 つ取り出します。
+			/// @param message メッセージの格納先
+			/// @return メッセージを取り出した場合 true, それ以外の場合は false
+			bool readMessage(Array<Byte>& message);
+
+			/// @brief データにサイズを付けて、1 つのメッセージとして送信します。
+			/// @param data データ
+			/// @param size データのサイズ（バイト）
+			/// @return 送信キューに追加した場合 true, それ以外の場合は false
+			bool sendMessage(const void* data, size_t size);
+
+			[[nodiscard]]
+			TCPSessionStats getStats() const;
+
+		protected:
+
+			asio::ip::tcp::socket m_socket;
+
+			std::atomic<bool> m_isActive = false;
+
+			/// @brief セッションを閉じ、送受信を停止します。受信バッファは破棄しません。
+			void closeIO();
+
+			/// @brief 受信でエラーが発生したときに I/O スレッドから呼ばれます。サイズが不正なメッセージを受信した場合は `readMessage()` から呼ばれます。
+			virtual void onReceiveError(const asio::error_code& error) = 0;
+
+			/// @brief 送信でエラーが発生したときに I/O スレッドから呼ばれます。
+			virtual void onSendError(const asio::error_code& error) = 0;
+
+		private:
+
+			// 受信
+			TCPReceiveBuffer m_receiveBuffer;
+
+			std::mutex m_mutexReceiveState;
+
+			bool m_receivePaused = false;
+
+			std::atomic<uint64> m_bytesReceived = 0;
+
+			std::atomic<uint64> m_numReceiveStalls = 0;
+
+
+			// 送信
+			mutable std::mutex m_mutexSendingBuffer;
+
+			TCPSendBuffer m_sendingBuffer;
+
+			Array<asio::const_buffer> m_sendingBuffers;
+
+			bool m_isSending = false;
+
+			uint64 m_bytesSent = 0;
+
+			uint64 m_numSendBatches = 0;
+
+
+			void onReceive(const asio::error_code& error, size_t size, const std::shared_ptr<TCPSession>&);
+
+			void resumeReceive();
+
+			void send_internal();
+
+			void onSend(const asio::error_code& error, size_t size, const std::shared_ptr<TCPSession>&);
+		};
+	}
+}
@@ -31,6 +31,8 @@ namespace s3d
 
 		virtual Texture::IDType create(const Image& image, const Array<Image>& mips, TextureDesc desc) = 0;
 
+		virtual Texture::IDType create(const BlockCompressedImage& image) = 0;
+
 		virtual Texture::IDType createDynamic(const Size& size, const void* pData, uint32 stride, const TextureFormat& format, TextureDesc desc) = 0;
 
 		virtual Texture::IDType createDynamic(const Size& size, const ColorF& color, const TextureFormat& format, TextureDesc desc) = 0;
@@ -45,6 +45,11 @@ namespace s3d
 		return Texture::IDType::NullAsset();
 	}
 
+	Texture::IDType CTexture_Null::create(const BlockCompressedImage&)
+	{
+		return Texture::IDType::NullAsset();
+	}
+
 	Texture::IDType CTexture_Null::createDynamic(const Size&, const void*, uint32, const TextureFormat&, const TextureDesc)
 	{
 		return Texture::IDType::NullAsset();
@@ -72,6 +72,12 @@ namespace s3d
 		SIV3D_ENGINE(AssetMonitor)->created();
 	}
 
+	Texture::Texture(const BlockCompressedImage& image)
+		: AssetHandle{ (detail::CheckEngine(), std::make_shared<AssetIDWrapperType>(SIV3D_ENGINE(Texture)->create(image))) }
+	{
+		SIV3D_ENGINE(AssetMonitor)->created();
+	}
+
 	Texture::Texture(const FilePathView path, const TextureDesc desc)
 		: Texture{ (detail::CheckEngine(), Image{ path }), desc } {}
 
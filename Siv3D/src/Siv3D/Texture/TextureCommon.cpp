@@ -14,6 +14,7 @@
 # include <Siv3D/ColorHSV.hpp>
 # include <Siv3D/2DShapes.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/Texture/ITexture.hpp>
 
 namespace s3d
 {
@@ -564,4 +565,29 @@ namespace s3d
 			LOG_FAIL(U"DynamicTexture image fill for {0} is not yet implemented"_fmt(format.name()));
 		}
 	}
+
+	Texture::IDType CreateDecodedTexture(ISiv3DTexture& texture, const BlockCompressedImage& image)
+	{
+		if (not image)
+		{
+			return Texture::IDType::NullAsset();
+		}
+
+		const size_t mipLevels = image.mipLevels();
+		const TextureDesc desc = detail::MakeTextureDesc((1 < mipLevels), image.format.isSRGB());
+
+		if (mipLevels == 1)
+		{
+			return texture.create(image.decode(0), desc);
+		}
+
+		Array<Image> mips(Arg::reserve = (mipLevels - 1));
+
+		for (size_t level = 1; level < mipLevels; ++level)
+		{
+			mips << image.decode(level);
+		}
+
+		return texture.create(image.decode(0), mips, desc);
+	}
 }
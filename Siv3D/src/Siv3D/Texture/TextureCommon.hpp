@@ -16,9 +16,12 @@
 # include <Siv3D/PointVector.hpp>
 # include <Siv3D/ColorF.hpp>
 # include <Siv3D/TextureFormat.hpp>
+# include <Siv3D/Texture.hpp>
 
 namespace s3d
 {
+	class ISiv3DTexture;
+
 	[[nodiscard]]
 	Array<Byte> GenerateInitialColorBuffer(const Size& size, const ColorF& color, const TextureFormat& format);
 
@@ -29,4 +32,8 @@ namespace s3d
 	void FillByImage(void* const buffer, const Size& size, const uint32 dstStride, const void* pData, const uint32 srcStride, const TextureFormat& format);
 
 	void FillRegionByImage(void* const buffer, const Size& size, const uint32 dstStride, const void* pData, const uint32 srcStride, const Rect& rect, const TextureFormat& format);
+
+	// ブロック圧縮テクスチャを扱えない環境向けに、RGBA8 にデコードして通常のテクスチャを作成する
+	[[nodiscard]]
+	Texture::IDType CreateDecodedTexture(ISiv3DTexture& texture, const BlockCompressedImage& image);
 }
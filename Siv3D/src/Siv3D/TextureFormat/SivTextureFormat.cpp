@@ -161,6 +161,14 @@ enum GL_CONSTANTS
 	GL_RG32F = 0x8230,
 	GL_RGBA32F = 0x8814,
 	GL_RG16UI = 0x823A,
+	GL_COMPRESSED_RGBA_S3TC_DXT1_EXT = 0x83F1,
+	GL_COMPRESSED_RGBA_S3TC_DXT5_EXT = 0x83F3,
+	GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT = 0x8C4D,
+	GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT = 0x8C4F,
+	GL_COMPRESSED_RED_RGTC1 = 0x8DBB,
+	GL_COMPRESSED_RG_RGTC2 = 0x8DBD,
+	GL_COMPRESSED_RGBA_BPTC_UNORM = 0x8E8C,
+	GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM = 0x8E8D,
 };
 
 enum WGPU_CONSTANTS
@@ -202,9 +210,13 @@ namespace s3d
 			uint32 num_channels;
 
 			bool isSRGB;
+
+			// 4x4 ピクセルのブロック 1 つ当たりのサイズ（ブロック圧縮フォーマットでない場合は 0）
+			uint32 blockSize = 0;
 		};
 
-		static constexpr std::array<TextureFormatData, 11> TextureFormatPropertytable =
+		// ブロック圧縮フォーマットの WGPUFormat は 0 (WebGPU ではデコードしてから作成する)
+		static constexpr std::array<TextureFormatData, 19> TextureFormatPropertytable =
 		{ {
 			{ U"Unknown", DXGI_FORMAT_UNKNOWN, 0, 0, 0, 0, 0, 0, false },
 			{ U"R8G8B8A8_Unorm", DXGI_FORMAT_R8G8B8A8_UNORM, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, TextureFormat_RGBA8Unorm, 4, 4, false },
@@ -217,6 +229,14 @@ namespace s3d
 			{ U"R16G16B16A16_Float", DXGI_FORMAT_R16G16B16A16_FLOAT, GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT, TextureFormat_RGBA16Float, 8, 4, false },
 			{ U"R32G32_Float", DXGI_FORMAT_R32G32_FLOAT, GL_RG32F, GL_RG, GL_FLOAT, TextureFormat_RG32Float, 8, 2, false },
 			{ U"R32G32B32A32_Float", DXGI_FORMAT_R32G32B32A32_FLOAT, GL_RGBA32F, GL_RGBA, GL_FLOAT, TextureFormat_RGBA32Float, 16, 4, false },
+			{ U"BC1_RGBA_Unorm", DXGI_FORMAT_BC1_UNORM, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 0, 0, 0, 0, 4, false, 8 },
+			{ U"BC1_RGBA_Unorm_SRGB", DXGI_FORMAT_BC1_UNORM_SRGB, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT, 0, 0, 0, 0, 4, true, 8 },
+			{ U"BC3_RGBA_Unorm", DXGI_FORMAT_BC3_UNORM, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 0, 0, 0, 0, 4, false, 16 },
+			{ U"BC3_RGBA_Unorm_SRGB", DXGI_FORMAT_BC3_UNORM_SRGB, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, 0, 0, 0, 0, 4, true, 16 },
+			{ U"BC4_R_Unorm", DXGI_FORMAT_BC4_UNORM, GL_COMPRESSED_RED_RGTC1, 0, 0, 0, 0, 1, false, 8 },
+			{ U"BC5_RG_Unorm", DXGI_FORMAT_BC5_UNORM, GL_COMPRESSED_RG_RGTC2, 0, 0, 0, 0, 2, false, 16 },
+			{ U"BC7_RGBA_Unorm", DXGI_FORMAT_BC7_UNORM, GL_COMPRESSED_RGBA_BPTC_UNORM, 0, 0, 0, 0, 4, false, 16 },
+			{ U"BC7_RGBA_Unorm_SRGB", DXGI_FORMAT_BC7_UNORM_SRGB, GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM, 0, 0, 0, 0, 4, true, 16 },
 		} };
 	}
 
@@ -255,6 +275,16 @@ namespace s3d
 		return detail::TextureFormatPropertytable[FromEnum(m_value)].pixelSize;
 	}
 
+	uint32 TextureFormat::blockSize() const noexcept
+	{
+		return detail::TextureFormatPropertytable[FromEnum(m_value)].blockSize;
+	}
+
+	bool TextureFormat::isBlockCompressed() const noexcept
+	{
+		return (detail::TextureFormatPropertytable[FromEnum(m_value)].blockSize != 0);
+	}
+
 	uint32 TextureFormat::num_channels() const noexcept
 	{
 		return detail::TextureFormatPropertytable[FromEnum(m_value)].num_channels;
@@ -12,6 +12,7 @@
 # include <thread>
 # include <Siv3D/Threading.hpp>
 # include <Siv3D/Utility.hpp>
+# include "ThreadPool.hpp"
 
 namespace s3d
 {
@@ -22,5 +23,38 @@ namespace s3d
 			static const size_t n = Max<size_t>(1, std::thread::hardware_concurrency());
 			return n;
 		}
+
+		void SetWorkerCount(const size_t numWorkers)
+		{
+			ThreadPool::Get().setNumWorkers(numWorkers);
+		}
+
+		size_t GetWorkerCount() noexcept
+		{
+			return ThreadPool::Get().getNumWorkers();
+		}
+	}
+
+	namespace detail
+	{
+		void ThreadPoolSubmit(std::function<void()> task)
+		{
+			ThreadPool::Get().submit(std::move(task));
+		}
+
+		void ThreadPoolParallelFor(const size_t count, const size_t grainSize, void(*f)(void*, size_t, size_t), void* data)
+		{
+			ThreadPool::Get().parallelFor(count, grainSize, f, data);
+		}
+
+		bool ThreadPoolIsWorkerThread() noexcept
+		{
+			return ThreadPool::Get().isWorkerThread();
+		}
+
+		bool ThreadPoolRunPendingTask()
+		{
+			return ThreadPool::Get().runPendingTask();
+		}
 	}
 }
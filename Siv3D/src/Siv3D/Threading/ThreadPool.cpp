@@ -0,0 +1,423 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/Utility.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "ThreadPool.hpp"
+
+# if !SIV3D_PLATFORM(WEB) || defined(__EMSCRIPTEN_PTHREADS__)
+#	define SIV3D_THREAD_POOL_ENABLED 1
+# else
+#	define SIV3D_THREAD_POOL_ENABLED 0
+# endif
+
+namespace s3d
+{
+	namespace
+	{
+		// 現在のスレッドが所属するスレッドプールとワーカー番号
+		thread_local ThreadPool* tl_currentPool = nullptr;
+
+		thread_local size_t tl_workerIndex = 0;
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		std::lock_guard lock{ m_controlMutex };
+
+		stop();
+	}
+
+	bool ThreadPool::setNumWorkers(const size_t numWorkers)
+	{
+		// ワーカーが自分自身の終了を待つことになる
+		if (tl_currentPool == this)
+		{
+			LOG_FAIL(U"❌ ThreadPool::setNumWorkers(): Cannot be called from a worker thread");
+			return false;
+		}
+
+		std::lock_guard lock{ m_controlMutex };
+
+		stop();
+
+		m_numWorkers.store(((numWorkers == 0) ? DefaultNumWorkers() : numWorkers), std::memory_order_relaxed);
+
+		return true;
+	}
+
+	size_t ThreadPool::getNumWorkers() const noexcept
+	{
+		return m_numWorkers.load(std::memory_order_relaxed);
+	}
+
+	void ThreadPool::submit(Task task)
+	{
+	# if SIV3D_THREAD_POOL_ENABLED
+
+		ensureStarted();
+
+		push(std::move(task));
+
+	# else
+
+		task();
+
+	# endif
+	}
+
+	void ThreadPool::parallelFor(const size_t count, size_t grainSize, const RangeFunction f, void* data)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+	# if SIV3D_THREAD_POOL_ENABLED
+
+		ensureStarted();
+
+		const size_t numWorkers = getNumWorkers();
+
+		if (grainSize == 0)
+		{
+			// ワーカー間の負荷の偏りを吸収できるよう、スレッド数の数倍に分割する
+			grainSize = Max<size_t>(1, (count / ((numWorkers + 1) * 4)));
+		}
+
+		const size_t numChunks = ((count + (grainSize - 1)) / grainSize);
+
+		if ((numWorkers == 0) || (numChunks <= 1))
+		{
+			f(data, 0, count);
+			return;
+		}
+
+		auto job = std::make_shared<ParallelForJob>();
+		job->f = f;
+		job->data = data;
+		job->count = count;
+		job->chunkSize = grainSize;
+		job->numChunks = numChunks;
+
+		const size_t numHelpers = Min(numWorkers, (numChunks - 1));
+
+		for (size_t i = 0; i < numHelpers; ++i)
+		{
+			push([job]() { RunChunks(*job); });
+		}
+
+		// 呼び出し元のスレッドも処理に参加する
+		RunChunks(*job);
+
+		{
+			std::unique_lock lock{ job->mutex };
+
+			job->cv.wait(lock, [&job]() { return (job->completedChunks.load() == job->numChunks); });
+		}
+
+		if (job->exception)
+		{
+			std::rethrow_exception(job->exception);
+		}
+
+	# else
+
+		(void)grainSize;
+
+		f(data, 0, count);
+
+	# endif
+	}
+
+	bool ThreadPool::runPendingTask()
+	{
+		if (not isWorkerThread())
+		{
+			return false;
+		}
+
+		Task task;
+
+		if (not tryPop(tl_workerIndex, task))
+		{
+			return false;
+		}
+
+		task();
+
+		return true;
+	}
+
+	bool ThreadPool::isWorkerThread() const noexcept
+	{
+		return ((tl_currentPool == this) && (tl_workerIndex < m_localQueues.size()));
+	}
+
+	ThreadPool& ThreadPool::Get()
+	{
+		static ThreadPool threadPool;
+		return threadPool;
+	}
+
+	void ThreadPool::ensureStarted()
+	{
+		if (m_started.load(std::memory_order_acquire))
+		{
+			return;
+		}
+
+		std::lock_guard lock{ m_controlMutex };
+
+		if (not m_started.load(std::memory_order_relaxed))
+		{
+			start();
+		}
+	}
+
+	void ThreadPool::start()
+	{
+		const size_t numWorkers = getNumWorkers();
+
+		m_localQueues.clear();
+
+		for (size_t i = 0; i < numWorkers; ++i)
+		{
+			m_localQueues.push_back(std::make_unique<WorkQueue>());
+		}
+
+		for (size_t i = 0; i < numWorkers; ++i)
+		{
+			m_workers.emplace_back(&ThreadPool::workerLoop, this, i);
+		}
+
+		{
+			std::lock_guard lock{ m_sleepMutex };
+
+			m_accepting = true;
+		}
+
+		m_started.store(true, std::memory_order_release);
+	}
+
+	void ThreadPool::stop()
+	{
+		if (not m_started.load(std::memory_order_acquire))
+		{
+			return;
+		}
+
+		{
+			std::lock_guard lock{ m_sleepMutex };
+
+			// これ以降に投入されたタスクは push() がその場で実行する
+			m_stopRequested = true;
+			m_accepting = false;
+		}
+
+		m_sleepCV.notify_all();
+
+		// 各ワーカーはキューに残っているタスクを処理し終えてから終了する
+		for (auto& worker : m_workers)
+		{
+			if (worker.joinable())
+			{
+				worker.join();
+			}
+		}
+
+		m_workers.clear();
+
+		{
+			std::lock_guard lock{ m_sleepMutex };
+
+			m_stopRequested = false;
+		}
+
+		m_started.store(false, std::memory_order_release);
+	}
+
+	void ThreadPool::push(Task&& task)
+	{
+		bool queued = false;
+
+		{
+			// 停止の開始とタスクの追加が入れ違わないよう、m_sleepMutex を保持したままキューに積む
+			std::lock_guard sleepLock{ m_sleepMutex };
+
+			if (m_accepting)
+			{
+				if (isWorkerThread())
+				{
+					// ワーカーから投入されたタスクはそのワーカーのキューに積む
+					WorkQueue& queue = *m_localQueues[tl_workerIndex];
+
+					std::lock_guard lock{ queue.mutex };
+
+					queue.tasks.push_back(std::move(task));
+				}
+				else
+				{
+					std::lock_guard lock{ m_globalQueue.mutex };
+
+					m_globalQueue.tasks.push_back(std::move(task));
+				}
+
+				++m_numPendingTasks;
+				queued = true;
+			}
+		}
+
+		// 停止中または停止済みのため、タスクを処理するワーカーがいない。取り残さないよう、その場で実行する
+		if (not queued)
+		{
+			task();
+			return;
+		}
+
+		m_sleepCV.notify_one();
+	}
+
+	bool ThreadPool::tryPop(const size_t workerIndex, Task& task)
+	{
+		// 1. 自分のキューの末尾（最も新しいタスク）
+		{
+			WorkQueue& queue = *m_localQueues[workerIndex];
+
+			std::lock_guard lock{ queue.mutex };
+
+			if (not queue.tasks.empty())
+			{
+				task = std::move(queue.tasks.back());
+				queue.tasks.pop_back();
+				--m_numPendingTasks;
+				return true;
+			}
+		}
+
+		// 2. 共有キューの先頭
+		{
+			std::lock_guard lock{ m_globalQueue.mutex };
+
+			if (not m_globalQueue.tasks.empty())
+			{
+				task = std::move(m_globalQueue.tasks.front());
+				m_globalQueue.tasks.pop_front();
+				--m_numPendingTasks;
+				return true;
+			}
+		}
+
+		// 3. 他のワーカーのキューの先頭（最も古いタスク）を奪う
+		const size_t numQueues = m_localQueues.size();
+
+		for (size_t i = 1; i < numQueues; ++i)
+		{
+			WorkQueue& queue = *m_localQueues[(workerIndex + i) % numQueues];
+
+			std::lock_guard lock{ queue.mutex };
+
+			if (not queue.tasks.empty())
+			{
+				task = std::move(queue.tasks.front());
+				queue.tasks.pop_front();
+				--m_numPendingTasks;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void ThreadPool::workerLoop(const size_t workerIndex)
+	{
+		tl_currentPool = this;
+		tl_workerIndex = workerIndex;
+
+		for (;;)
+		{
+			Task task;
+
+			if (tryPop(workerIndex, task))
+			{
+				task();
+				continue;
+			}
+
+			std::unique_lock lock{ m_sleepMutex };
+
+			m_sleepCV.wait(lock, [this]() { return (m_stopRequested || (0 < m_numPendingTasks.load())); });
+
+			if (m_stopRequested && (m_numPendingTasks.load() <= 0))
+			{
+				break;
+			}
+		}
+
+		tl_currentPool = nullptr;
+	}
+
+	void ThreadPool::RunChunks(ParallelForJob& job)
+	{
+		for (;;)
+		{
+			const size_t chunkIndex = job.nextChunk.fetch_add(1, std::memory_order_relaxed);
+
+			if (job.numChunks <= chunkIndex)
+			{
+				return;
+			}
+
+			if (not job.failed.load(std::memory_order_relaxed))
+			{
+				const size_t begin = (chunkIndex * job.chunkSize);
+				const size_t end = Min((begin + job.chunkSize), job.count);
+
+				try
+				{
+					job.f(job.data, begin, end);
+				}
+				catch (...)
+				{
+					std::lock_guard lock{ job.mutex };
+
+					if (not job.exception)
+					{
+						job.exception = std::current_exception();
+					}
+
+					job.failed.store(true, std::memory_order_relaxed);
+				}
+			}
+
+			if ((job.completedChunks.fetch_add(1, std::memory_order_acq_rel) + 1) == job.numChunks)
+			{
+				std::lock_guard lock{ job.mutex };
+
+				job.cv.notify_all();
+			}
+		}
+	}
+
+	size_t ThreadPool::DefaultNumWorkers() noexcept
+	{
+	# if SIV3D_THREAD_POOL_ENABLED
+
+		return Max<size_t>(1, (Threading::GetConcurrency() - 1));
+
+	# else
+
+		return 0;
+
+	# endif
+	}
+}
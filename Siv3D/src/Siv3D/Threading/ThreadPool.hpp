@@ -0,0 +1,148 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <condition_variable>
+# include <deque>
+# include <functional>
+# include <memory>
+# include <mutex>
+# include <thread>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+
+namespace s3d
+{
+	/// @brief ワークスティーリング方式のスレッドプール
+	/// @remark ワーカーごとにタスクキューを持ち、自分のキューが空になったワーカーは他のワーカーのキューからタスクを奪います。
+	class ThreadPool
+	{
+	public:
+
+		using Task = std::function<void()>;
+
+		using RangeFunction = void(*)(void*, size_t, size_t);
+
+		ThreadPool() = default;
+
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+
+		ThreadPool& operator =(const ThreadPool&) = delete;
+
+		/// @brief ワーカー数を設定します。起動済みの場合は停止し、次回の使用時に再起動します。
+		/// @param numWorkers ワーカー数。0 の場合はデフォルト値
+		/// @return ワーカー数を設定した場合 true, ワーカースレッドから呼び出されたため設定できなかった場合は false
+		bool setNumWorkers(size_t numWorkers);
+
+		[[nodiscard]]
+		size_t getNumWorkers() const noexcept;
+
+		/// @brief タスクを投入します。
+		/// @remark 停止処理の最中に投入されたタスクは、呼び出し元のスレッドでその場で実行されます。
+		void submit(Task task);
+
+		void parallelFor(size_t count, size_t grainSize, RangeFunction f, void* data);
+
+		/// @brief 現在のスレッドがこのスレッドプールのワーカーである場合、キューに積まれているタスクを 1 つ実行します。
+		/// @return タスクを実行した場合 true, それ以外の場合は false
+		/// @remark ワーカーが他のタスクの完了を待つ間に呼び出すことで、待機中のタスクがキューに残ったままデッドロックすることを防ぎます。
+		bool runPendingTask();
+
+		/// @brief 現在のスレッドがこのスレッドプールのワーカーであるかを返します。
+		/// @return ワーカーである場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isWorkerThread() const noexcept;
+
+		[[nodiscard]]
+		static ThreadPool& Get();
+
+	private:
+
+		struct WorkQueue
+		{
+			std::mutex mutex;
+
+			std::deque<Task> tasks;
+		};
+
+		struct ParallelForJob
+		{
+			RangeFunction f = nullptr;
+
+			void* data = nullptr;
+
+			size_t count = 0;
+
+			size_t chunkSize = 0;
+
+			size_t numChunks = 0;
+
+			std::atomic<size_t> nextChunk{ 0 };
+
+			std::atomic<size_t> completedChunks{ 0 };
+
+			std::atomic<bool> failed{ false };
+
+			std::exception_ptr exception;
+
+			std::mutex mutex;
+
+			std::condition_variable cv;
+		};
+
+		// ワーカーの起動・停止と設定の変更を保護する
+		std::mutex m_controlMutex;
+
+		std::atomic<bool> m_started{ false };
+
+		std::atomic<size_t> m_numWorkers{ DefaultNumWorkers() };
+
+		Array<std::unique_ptr<WorkQueue>> m_localQueues;
+
+		WorkQueue m_globalQueue;
+
+		Array<std::thread> m_workers;
+
+		std::mutex m_sleepMutex;
+
+		std::condition_variable m_sleepCV;
+
+		// キューに積まれているタスクの数（一時的に負になることがある）
+		std::atomic<int64> m_numPendingTasks{ 0 };
+
+		// m_sleepMutex で保護する。true の間はキューにタスクを積まない
+		bool m_stopRequested = false;
+
+		// m_sleepMutex で保護する。ワーカーが起動していて、キューのタスクを処理できる状態か
+		bool m_accepting = false;
+
+		void ensureStarted();
+
+		void start();
+
+		void stop();
+
+		void push(Task&& task);
+
+		[[nodiscard]]
+		bool tryPop(size_t workerIndex, Task& task);
+
+		void workerLoop(size_t workerIndex);
+
+		static void RunChunks(ParallelForJob& job);
+
+		[[nodiscard]]
+		static size_t DefaultNumWorkers() noexcept;
+	};
+}
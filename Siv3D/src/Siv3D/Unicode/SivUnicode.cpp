@@ -12,53 +12,187 @@
 # include <ThirdParty/miniutf/miniutf.hpp>
 # include <Siv3D/String.hpp>
 # include <Siv3D/Unicode.hpp>
+# include <Siv3D/Utility.hpp>
 # include "UnicodeUtility.hpp"
+# include "UnicodeSIMD.hpp"
 
 namespace s3d
 {
-	namespace Unicode
+	namespace detail
 	{
-		String WidenAscii(const std::string_view asciiText)
+		/// @brief 正しい UTF-8 を UTF-32 または UTF-16 に変換します。
+		/// @return 不正なバイト列を含む場合、または変換後の長さが書き込み先の長さと一致しない場合 false
+		template <class Char>
+		[[nodiscard]]
+		static bool UTF8_DecodeValid(const std::string_view s, Char* pDst, Char* const pDstEnd) noexcept
 		{
-			return String(asciiText.begin(), asciiText.end());
+			const char8* pSrc = s.data();
+			const char8* const pSrcEnd = pSrc + s.size();
+
+			while (pSrc != pSrcEnd)
+			{
+				if (static_cast<uint8>(*pSrc) < 0x80)
+				{
+					// 連続する ASCII 文字はまとめて変換する（1 文字だけの場合は直接書き込む）
+					if (((pSrc + 1) == pSrcEnd) || (0x80 <= static_cast<uint8>(pSrc[1])))
+					{
+						if (pDst == pDstEnd)
+						{
+							return false;
+						}
+
+						*pDst++ = static_cast<Char>(*pSrc++);
+						continue;
+					}
+
+					const size_t length = UTF8_WidenASCII(pSrc, Min<size_t>((pSrcEnd - pSrc), (pDstEnd - pDst)), pDst);
+
+					if (length == 0)
+					{
+						return false;
+					}
+
+					pSrc += length;
+					pDst += length;
+					continue;
+				}
+
+				const offset_pt res = utf8_decode_check(pSrc, (pSrcEnd - pSrc));
+				const size_t length = ((sizeof(Char) == sizeof(char32)) ? 1 : UTF16_Length(res.codePoint));
+
+				if ((res.offset < 0)
+					|| (static_cast<size_t>(pDstEnd - pDst) < length))
+				{
+					return false;
+				}
+
+				if constexpr (sizeof(Char) == sizeof(char32))
+				{
+					*pDst++ = res.codePoint;
+				}
+				else
+				{
+					UTF16_Encode(&pDst, res.codePoint);
+				}
+
+				pSrc += res.offset;
+			}
+
+			return (pDst == pDstEnd);
 		}
 
-		String FromUTF8(const std::string_view s)
+		template <class StringType>
+		[[nodiscard]]
+		static StringType UTF8ToUTF32_Impl(const std::string_view s)
 		{
-			String result(detail::UTF32_Length(s), '0');
+			// 正しい UTF-8 であれば、SIMD で数えた長さの領域に 1 回の走査で変換できる
+			{
+				StringType result(UTF8_CountCodeUnits(s.data(), s.size()).utf32, U'\0');
+
+				if (UTF8_DecodeValid(s, result.data(), (result.data() + result.size())))
+				{
+					return result;
+				}
+			}
+
+			// 不正なバイト列を含む場合は U+FFFD に置き換える
+			StringType result(UTF32_Length(s), U'\0');
 
 			const char8* pSrc = s.data();
 			const char8* const pSrcEnd = pSrc + s.size();
-			char32* pDst = &result[0];
+			char32* pDst = result.data();
 
 			while (pSrc != pSrcEnd)
 			{
 				int32 offset;
-				*pDst++ = detail::utf8_decode(pSrc, pSrcEnd - pSrc, offset);
+				*pDst++ = utf8_decode(pSrc, pSrcEnd - pSrc, offset);
 				pSrc += offset;
 			}
 
 			return result;
 		}
 
-		String FromUTF16(const std::u16string_view s)
+		template <class StringType>
+		[[nodiscard]]
+		static StringType UTF16ToUTF32_Impl(const std::u16string_view s)
 		{
-			String result(detail::UTF32_Length(s), '0');
+			// 変換後の長さは UTF-16 の長さを超えない
+			StringType result(s.size(), U'\0');
 
 			const char16* pSrc = s.data();
 			const char16* const pSrcEnd = pSrc + s.size();
-			char32* pDst = &result[0];
+			char32* pDst = result.data();
 
 			while (pSrc != pSrcEnd)
 			{
-				int32 offset;
-				*pDst++ = detail::utf16_decode(pSrc, pSrcEnd - pSrc, offset);
-				pSrc += offset;
+				if (IsSurrogate(*pSrc))
+				{
+					int32 offset;
+					*pDst++ = utf16_decode(pSrc, pSrcEnd - pSrc, offset);
+					pSrc += offset;
+				}
+				else if (((pSrc + 1) == pSrcEnd) || IsSurrogate(pSrc[1]))
+				{
+					*pDst++ = *pSrc++;
+				}
+				else
+				{
+					// サロゲートを含まない部分はまとめて変換する
+					const size_t length = UTF16_WidenBMP(pSrc, (pSrcEnd - pSrc), pDst);
+					pSrc += length;
+					pDst += length;
+				}
 			}
 
+			result.resize(pDst - result.data());
+
 			return result;
 		}
 
+		[[nodiscard]]
+		static std::string UTF32ToUTF8_Impl(const char32* pSrc, const size_t length)
+		{
+			std::string result(UTF32_UTF8Length(pSrc, length), '\0');
+
+			const char32* const pSrcEnd = pSrc + length;
+			char8* pDst = result.data();
+
+			while (pSrc != pSrcEnd)
+			{
+				if (*pSrc < 0x80)
+				{
+					// 連続する ASCII 文字はまとめて変換する
+					const size_t asciiLength = UTF32_NarrowASCII(pSrc, (pSrcEnd - pSrc), pDst);
+					pSrc += asciiLength;
+					pDst += asciiLength;
+				}
+				else
+				{
+					UTF8_Encode(&pDst, *pSrc++);
+				}
+			}
+
+			return result;
+		}
+	}
+
+	namespace Unicode
+	{
+		String WidenAscii(const std::string_view asciiText)
+		{
+			return String(asciiText.begin(), asciiText.end());
+		}
+
+		String FromUTF8(const std::string_view s)
+		{
+			return detail::UTF8ToUTF32_Impl<String>(s);
+		}
+
+		String FromUTF16(const std::u16string_view s)
+		{
+			return detail::UTF16ToUTF32_Impl<String>(s);
+		}
+
 		String FromUTF32(const std::u32string_view s)
 		{
 			return String{ s };
@@ -82,18 +216,7 @@ namespace s3d
 
 		std::string ToUTF8(const StringView s)
 		{
-			std::string result(detail::UTF8_Length(s), '0');
-
-			const char32* pSrc = s.data();
-			const char32* const pSrcEnd = pSrc + s.size();
-			char8* pDst = &result[0];
-
-			while (pSrc != pSrcEnd)
-			{
-				detail::UTF8_Encode(&pDst, *pSrc++);
-			}
-
-			return result;
+			return detail::UTF32ToUTF8_Impl(s.data(), s.size());
 		}
 
 		std::u16string ToUTF16(const StringView s)
@@ -119,6 +242,15 @@ namespace s3d
 
 		std::u16string UTF8ToUTF16(const std::string_view s)
 		{
+			{
+				std::u16string result(detail::UTF8_CountCodeUnits(s.data(), s.size()).utf16, u'\0');
+
+				if (detail::UTF8_DecodeValid(s, result.data(), (result.data() + result.size())))
+				{
+					return result;
+				}
+			}
+
 			std::u16string result(detail::UTF16_Length(s), '0');
 
 			const char8* pSrc = s.data();
@@ -139,22 +271,7 @@ namespace s3d
 
 		std::u32string UTF8ToUTF32(const std::string_view s)
 		{
-			std::u32string result(detail::UTF32_Length(s), '0');
-
-			const char8* pSrc = s.data();
-			const char8* const pSrcEnd = pSrc + s.size();
-			char32* pDst = &result[0];
-
-			while (pSrc != pSrcEnd)
-			{
-				int32 offset;
-
-				*pDst++ = detail::utf8_decode(pSrc, pSrcEnd - pSrc, offset);
-
-				pSrc += offset;
-			}
-
-			return result;
+			return detail::UTF8ToUTF32_Impl<std::u32string>(s);
 		}
 
 		std::string UTF16ToUTF8(const std::u16string_view s)
@@ -179,38 +296,12 @@ namespace s3d
 
 		std::u32string UTF16ToUTF32(const std::u16string_view s)
 		{
-			std::u32string result(detail::UTF32_Length(s), '0');
-
-			const char16* pSrc = s.data();
-			const char16* const pSrcEnd = pSrc + s.size();
-			char32* pDst = &result[0];
-
-			while (pSrc != pSrcEnd)
-			{
-				int32 offset;
-
-				*pDst++ = detail::utf16_decode(pSrc, pSrcEnd - pSrc, offset);
-
-				pSrc += offset;
-			}
-
-			return result;
+			return detail::UTF16ToUTF32_Impl<std::u32string>(s);
 		}
 
 		std::string UTF32ToUTF8(const std::u32string_view s)
 		{
-			std::string result(detail::UTF8_Length(s), '0');
-
-			const char32* pSrc = s.data();
-			const char32* const pSrcEnd = pSrc + s.size();
-			char8* pDst = &result[0];
-
-			while (pSrc != pSrcEnd)
-			{
-				detail::UTF8_Encode(&pDst, *pSrc++);
-			}
-
-			return result;
+			return detail::UTF32ToUTF8_Impl(s.data(), s.size());
 		}
 
 		std::u16string UTF32ToUTF16(const std::u32string_view s)
@@ -0,0 +1,836 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Common/CPUDispatch.hpp>
+# include <Siv3D/Utility.hpp>
+# include "UnicodeSIMD.hpp"
+# include "UnicodeUtility.hpp"
+
+// ARM64 では NEON を、x86-64 では SSE2 (と AVX2) を、それ以外で SSE が使える場合は SSE2 を使う
+// AVX2 の実装は関数単位でターゲットを指定してコンパイルする（ライブラリ全体のビルドオプションは変更しない）
+// 端数を SSE2 の実装で処理する前に _mm256_zeroupper() を呼び、AVX-SSE 遷移のペナルティを避ける
+# if defined(__aarch64__) || defined(_M_ARM64)
+#	include <arm_neon.h>
+#	define SIV3D_UNICODE_NEON 1
+#	define SIV3D_UNICODE_SSE2 0
+#	define SIV3D_UNICODE_AVX2 0
+# elif SIV3D_CPU_DISPATCH_X64
+#	define SIV3D_UNICODE_NEON 0
+#	define SIV3D_UNICODE_SSE2 1
+#	define SIV3D_UNICODE_AVX2 1
+# elif SIV3D_INTRINSIC(SSE)
+#	include <Siv3D/SIMD.hpp>
+#	define SIV3D_UNICODE_NEON 0
+#	define SIV3D_UNICODE_SSE2 1
+#	define SIV3D_UNICODE_AVX2 0
+# else
+#	define SIV3D_UNICODE_NEON 0
+#	define SIV3D_UNICODE_SSE2 0
+#	define SIV3D_UNICODE_AVX2 0
+# endif
+
+namespace s3d
+{
+	namespace detail
+	{
+		namespace
+		{
+			enum class Kernel : uint8
+			{
+				Reference,
+
+				SSE2,
+
+				AVX2,
+
+				NEON,
+			};
+
+			[[nodiscard]]
+			Kernel SelectKernel() noexcept
+			{
+				const SIMDLevel level = GetSIMDLevel();
+
+			# if SIV3D_UNICODE_AVX2
+
+				if ((level == SIMDLevel::AVX512) || (level == SIMDLevel::AVX2))
+				{
+					return Kernel::AVX2;
+				}
+
+			# endif
+
+			# if SIV3D_UNICODE_SSE2
+
+				if (level != SIMDLevel::None)
+				{
+					return Kernel::SSE2;
+				}
+
+			# elif SIV3D_UNICODE_NEON
+
+				if (level == SIMDLevel::NEON)
+				{
+					return Kernel::NEON;
+				}
+
+			# endif
+
+				return Kernel::Reference;
+			}
+
+			//////////////////////////////////////////////////
+			//
+			//	Reference
+			//
+			//////////////////////////////////////////////////
+
+			[[nodiscard]]
+			UTF8CodeUnitCount UTF8_CountCodeUnits_Reference(const char8* pSrc, const size_t length) noexcept
+			{
+				size_t leads = 0, fourByteLeads = 0;
+
+				for (size_t i = 0; i < length; ++i)
+				{
+					const uint8 ch = static_cast<uint8>(pSrc[i]);
+					leads += ((ch & 0xC0) != 0x80);
+					fourByteLeads += (0xF0 <= ch);
+				}
+
+				return{ leads, (leads + fourByteLeads) };
+			}
+
+			template <class Char>
+			[[nodiscard]]
+			size_t UTF8_WidenASCII_Reference(const char8* pSrc, const size_t length, Char* pDst) noexcept
+			{
+				size_t i = 0;
+
+				for (; (i < length) && (static_cast<uint8>(pSrc[i]) < 0x80); ++i)
+				{
+					pDst[i] = static_cast<Char>(pSrc[i]);
+				}
+
+				return i;
+			}
+
+			[[nodiscard]]
+			size_t UTF32_NarrowASCII_Reference(const char32* pSrc, const size_t length, char8* pDst) noexcept
+			{
+				size_t i = 0;
+
+				for (; (i < length) && (pSrc[i] < 0x80); ++i)
+				{
+					pDst[i] = static_cast<char8>(pSrc[i]);
+				}
+
+				return i;
+			}
+
+			[[nodiscard]]
+			size_t UTF32_UTF8Length_Reference(const char32* pSrc, const size_t length) noexcept
+			{
+				size_t result = 0;
+
+				for (size_t i = 0; i < length; ++i)
+				{
+					result += UTF8_Length(pSrc[i]);
+				}
+
+				return result;
+			}
+
+			[[nodiscard]]
+			size_t UTF16_WidenBMP_Reference(const char16* pSrc, const size_t length, char32* pDst) noexcept
+			{
+				size_t i = 0;
+
+				for (; (i < length) && (not IsSurrogate(pSrc[i])); ++i)
+				{
+					pDst[i] = pSrc[i];
+				}
+
+				return i;
+			}
+
+			//////////////////////////////////////////////////
+			//
+			//	SSE2
+			//
+			//////////////////////////////////////////////////
+
+		# if SIV3D_UNICODE_SSE2
+
+			[[nodiscard]]
+			uint64 HorizontalSumU64(const __m128i v) noexcept
+			{
+				alignas(16) uint64 values[2];
+				_mm_store_si128(reinterpret_cast<__m128i*>(values), v);
+				return (values[0] + values[1]);
+			}
+
+			[[nodiscard]]
+			uint64 HorizontalSumU32(const __m128i v) noexcept
+			{
+				alignas(16) uint32 values[4];
+				_mm_store_si128(reinterpret_cast<__m128i*>(values), v);
+				return (uint64{ values[0] } + values[1] + values[2] + values[3]);
+			}
+
+			[[nodiscard]]
+			UTF8CodeUnitCount UTF8_CountCodeUnits_SSE2(const char8* pSrc, const size_t length) noexcept
+			{
+				const __m128i zero = _mm_setzero_si128();
+
+				// 符号付きで 0xBF (-65) より大きいバイトは継続バイト (0x80-0xBF) ではない
+				const __m128i continuationMax = _mm_set1_epi8(-65);
+				const __m128i fourByteLeadMin = _mm_set1_epi8(static_cast<char>(0xF0));
+
+				size_t leads = 0, fourByteLeads = 0;
+				size_t i = 0;
+
+				while ((i + 16) <= length)
+				{
+					// 8 ビットのカウンタがあふれないよう、255 ブロックごとに集計する
+					const size_t blocks = Min<size_t>(((length - i) / 16), 255);
+					__m128i leadCounts = zero, fourByteLeadCounts = zero;
+
+					for (size_t k = 0; k < blocks; ++k, i += 16)
+					{
+						const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i));
+						leadCounts = _mm_sub_epi8(leadCounts, _mm_cmpgt_epi8(v, continuationMax));
+						fourByteLeadCounts = _mm_sub_epi8(fourByteLeadCounts, _mm_cmpeq_epi8(_mm_max_epu8(v, fourByteLeadMin), v));
+					}
+
+					leads += HorizontalSumU64(_mm_sad_epu8(leadCounts, zero));
+					fourByteLeads += HorizontalSumU64(_mm_sad_epu8(fourByteLeadCounts, zero));
+				}
+
+				const UTF8CodeUnitCount tail = UTF8_CountCodeUnits_Reference((pSrc + i), (length - i));
+
+				return{ (leads + tail.utf32), (leads + fourByteLeads + tail.utf16) };
+			}
+
+			template <class Char>
+			[[nodiscard]]
+			size_t UTF8_WidenASCII_SSE2(const char8* pSrc, const size_t length, Char* pDst) noexcept
+			{
+				const __m128i zero = _mm_setzero_si128();
+
+				size_t i = 0;
+
+				for (; (i + 16) <= length; i += 16)
+				{
+					const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i));
+
+					if (_mm_movemask_epi8(v) != 0)
+					{
+						break;
+					}
+
+					const __m128i lo = _mm_unpacklo_epi8(v, zero);
+					const __m128i hi = _mm_unpackhi_epi8(v, zero);
+					__m128i* const p = reinterpret_cast<__m128i*>(pDst + i);
+
+					if constexpr (sizeof(Char) == sizeof(char32))
+					{
+						_mm_storeu_si128((p + 0), _mm_unpacklo_epi16(lo, zero));
+						_mm_storeu_si128((p + 1), _mm_unpackhi_epi16(lo, zero));
+						_mm_storeu_si128((p + 2), _mm_unpacklo_epi16(hi, zero));
+						_mm_storeu_si128((p + 3), _mm_unpackhi_epi16(hi, zero));
+					}
+					else
+					{
+						_mm_storeu_si128((p + 0), lo);
+						_mm_storeu_si128((p + 1), hi);
+					}
+				}
+
+				return (i + UTF8_WidenASCII_Reference((pSrc + i), (length - i), (pDst + i)));
+			}
+
+			[[nodiscard]]
+			size_t UTF32_NarrowASCII_SSE2(const char32* pSrc, const size_t length, char8* pDst) noexcept
+			{
+				const __m128i zero = _mm_setzero_si128();
+				const __m128i nonASCIIBits = _mm_set1_epi32(static_cast<int32>(0xFFFF'FF80));
+
+				size_t i = 0;
+
+				for (; (i + 16) <= length; i += 16)
+				{
+					const __m128i* const p = reinterpret_cast<const __m128i*>(pSrc + i);
+					const __m128i a = _mm_loadu_si128(p + 0);
+					const __m128i b = _mm_loadu_si128(p + 1);
+					const __m128i c = _mm_loadu_si128(p + 2);
+					const __m128i d = _mm_loadu_si128(p + 3);
+					const __m128i any = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), nonASCIIBits);
+
+					if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, zero)) != 0xFFFF)
+					{
+						break;
+					}
+
+					// 値はすべて 0x80 未満なので、飽和演算で値が変わることはない
+					const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i), packed);
+				}
+
+				return (i + UTF32_NarrowASCII_Reference((pSrc + i), (length - i), (pDst + i)));
+			}
+
+			[[nodiscard]]
+			size_t UTF32_UTF8Length_SSE2(const char32* pSrc, const size_t length) noexcept
+			{
+				// 符号なしの比較を、符号ビットを反転した符号付きの比較で行う
+				const __m128i signBit = _mm_set1_epi32(static_cast<int32>(0x8000'0000));
+				const __m128i max1 = _mm_set1_epi32(static_cast<int32>(0x8000'007F));
+				const __m128i max2 = _mm_set1_epi32(static_cast<int32>(0x8000'07FF));
+				const __m128i max3 = _mm_set1_epi32(static_cast<int32>(0x8000'FFFF));
+				const __m128i max4 = _mm_set1_epi32(static_cast<int32>(0x8010'FFFF));
+
+				// 1 + [0x80 <= c] + [0x800 <= c] + [0x10000 <= c] - [0x110000 <= c]
+				size_t result = 0;
+				size_t i = 0;
+
+				while ((i + 4) <= length)
+				{
+					// 32 ビットのカウンタがあふれないよう、65536 ブロックごとに集計する
+					const size_t blocks = Min<size_t>(((length - i) / 4), 65536);
+					__m128i counts = _mm_setzero_si128();
+
+					for (size_t k = 0; k < blocks; ++k, i += 4)
+					{
+						const __m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i)), signBit);
+						counts = _mm_sub_epi32(counts, _mm_cmpgt_epi32(v, max1));
+						counts = _mm_sub_epi32(counts, _mm_cmpgt_epi32(v, max2));
+						counts = _mm_sub_epi32(counts, _mm_cmpgt_epi32(v, max3));
+						counts = _mm_add_epi32(counts, _mm_cmpgt_epi32(v, max4));
+					}
+
+					result += ((blocks * 4) + HorizontalSumU32(counts));
+				}
+
+				return (result + UTF32_UTF8Length_Reference((pSrc + i), (length - i)));
+			}
+
+			[[nodiscard]]
+			size_t UTF16_WidenBMP_SSE2(const char16* pSrc, const size_t length, char32* pDst) noexcept
+			{
+				const __m128i zero = _mm_setzero_si128();
+				const __m128i surrogateMask = _mm_set1_epi16(static_cast<int16>(0xF800));
+				const __m128i surrogateBits = _mm_set1_epi16(static_cast<int16>(0xD800));
+
+				size_t i = 0;
+
+				for (; (i + 8) <= length; i += 8)
+				{
+					const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i));
+
+					if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, surrogateMask), surrogateBits)) != 0)
+					{
+						break;
+					}
+
+					__m128i* const p = reinterpret_cast<__m128i*>(pDst + i);
+					_mm_storeu_si128((p + 0), _mm_unpacklo_epi16(v, zero));
+					_mm_storeu_si128((p + 1), _mm_unpackhi_epi16(v, zero));
+				}
+
+				return (i + UTF16_WidenBMP_Reference((pSrc + i), (length - i), (pDst + i)));
+			}
+
+		# endif
+
+			//////////////////////////////////////////////////
+			//
+			//	AVX2
+			//
+			//////////////////////////////////////////////////
+
+		# if SIV3D_UNICODE_AVX2
+
+			[[nodiscard]]
+			SIV3D_TARGET_AVX2
+			uint64 HorizontalSumU64_AVX2(const __m256i v) noexcept
+			{
+				alignas(32) uint64 values[4];
+				_mm256_store_si256(reinterpret_cast<__m256i*>(values), v);
+				return (values[0] + values[1] + values[2] + values[3]);
+			}
+
+			[[nodiscard]]
+			SIV3D_TARGET_AVX2
+			uint64 HorizontalSumU32_AVX2(const __m256i v) noexcept
+			{
+				alignas(32) uint32 values[8];
+				_mm256_store_si256(reinterpret_cast<__m256i*>(values), v);
+				return (uint64{ values[0] } + values[1] + values[2] + values[3] + values[4] + values[5] + values[6] + values[7]);
+			}
+
+			[[nodiscard]]
+			SIV3D_TARGET_AVX2
+			UTF8CodeUnitCount UTF8_CountCodeUnits_AVX2(const char8* pSrc, const size_t length) noexcept
+			{
+				const __m256i zero = _mm256_setzero_si256();
+				const __m256i continuationMax = _mm256_set1_epi8(-65);
+				const __m256i fourByteLeadMin = _mm256_set1_epi8(static_cast<char>(0xF0));
+
+				size_t leads = 0, fourByteLeads = 0;
+				size_t i = 0;
+
+				while ((i + 32) <= length)
+				{
+					const size_t blocks = Min<size_t>(((length - i) / 32), 255);
+					__m256i leadCounts = zero, fourByteLeadCounts = zero;
+
+					for (size_t k = 0; k < blocks; ++k, i += 32)
+					{
+						const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + i));
+						leadCounts = _mm256_sub_epi8(leadCounts, _mm256_cmpgt_epi8(v, continuationMax));
+						fourByteLeadCounts = _mm256_sub_epi8(fourByteLeadCounts, _mm256_cmpeq_epi8(_mm256_max_epu8(v, fourByteLeadMin), v));
+					}
+
+					leads += HorizontalSumU64_AVX2(_mm256_sad_epu8(leadCounts, zero));
+					fourByteLeads += HorizontalSumU64_AVX2(_mm256_sad_epu8(fourByteLeadCounts, zero));
+				}
+
+				_mm256_zeroupper();
+
+				const UTF8CodeUnitCount tail = UTF8_CountCodeUnits_SSE2((pSrc + i), (length - i));
+
+				return{ (leads + tail.utf32), (leads + fourByteLeads + tail.utf16) };
+			}
+
+			template <class Char>
+			[[nodiscard]]
+			SIV3D_TARGET_AVX2
+			size_t UTF8_WidenASCII_AVX2(const char8* pSrc, const size_t length, Char* pDst) noexcept
+			{
+				size_t i = 0;
+
+				for (; (i + 32) <= length; i += 32)
+				{
+					const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + i));
+
+					if (_mm256_movemask_epi8(v) != 0)
+					{
+						break;
+					}
+
+					__m256i* const p = reinterpret_cast<__m256i*>(pDst + i);
+
+					if constexpr (sizeof(Char) == sizeof(char32))
+					{
+						const __m128i lo = _mm256_castsi256_si128(v);
+						const __m128i hi = _mm256_extracti128_si256(v, 1);
+						_mm256_storeu_si256((p + 0), _mm256_cvtepu8_epi32(lo));
+						_mm256_storeu_si256((p + 1), _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+						_mm256_storeu_si256((p + 2), _mm256_cvtepu8_epi32(hi));
+						_mm256_storeu_si256((p + 3), _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+					}
+					else
+					{
+						_mm256_storeu_si256((p + 0), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+						_mm256_storeu_si256((p + 1), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+					}
+				}
+
+				_mm256_zeroupper();
+
+				return (i + UTF8_WidenASCII_SSE2((pSrc + i), (length - i), (pDst + i)));
+			}
+
+			[[nodiscard]]
+			SIV3D_TARGET_AVX2
+			size_t UTF32_NarrowASCII_AVX2(const char32* pSrc, const size_t length, char8* pDst) noexcept
+			{
+				const __m256i nonASCIIBits = _mm256_set1_epi32(static_cast<int32>(0xFFFF'FF80));
+
+				// packs / packus は 128 ビットのレーンごとに行われるため、最後に 32 ビット単位で並べ替える
+				const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+				size_t i = 0;
+
+				for (; (i + 32) <= length; i += 32)
+				{
+					const __m256i* const p = reinterpret_cast<const __m256i*>(pSrc + i);
+					const __m256i a = _mm256_loadu_si256(p + 0);
+					const __m256i b = _mm256_loadu_si256(p + 1);
+					const __m256i c = _mm256_loadu_si256(p + 2);
+					const __m256i d = _mm256_loadu_si256(p + 3);
+
+					if (not _mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d)), nonASCIIBits))
+					{
+						break;
+					}
+
+					const __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + i), _mm256_permutevar8x32_epi32(packed, order));
+				}
+
+				_mm256_zeroupper();
+
+				return (i + UTF32_NarrowASCII_SSE2((pSrc + i), (length - i), (pDst + i)));
+			}
+
+			[[nodiscard]]
+			SIV3D_TARGET_AVX2
+			size_t UTF32_UTF8Length_AVX2(const char32* pSrc, const size_t length) noexcept
+			{
+				const __m256i signBit = _mm256_set1_epi32(static_cast<int32>(0x8000'0000));
+				const __m256i max1 = _mm256_set1_epi32(static_cast<int32>(0x8000'007F));
+				const __m256i max2 = _mm256_set1_epi32(static_cast<int32>(0x8000'07FF));
+				const __m256i max3 = _mm256_set1_epi32(static_cast<int32>(0x8000'FFFF));
+				const __m256i max4 = _mm256_set1_epi32(static_cast<int32>(0x8010'FFFF));
+
+				size_t result = 0;
+				size_t i = 0;
+
+				while ((i + 8) <= length)
+				{
+					const size_t blocks = Min<size_t>(((length - i) / 8), 65536);
+					__m256i counts = _mm256_setzero_si256();
+
+					for (size_t k = 0; k < blocks; ++k, i += 8)
+					{
+						const __m256i v = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + i)), signBit);
+						counts = _mm256_sub_epi32(counts, _mm256_cmpgt_epi32(v, max1));
+						counts = _mm256_sub_epi32(counts, _mm256_cmpgt_epi32(v, max2));
+						counts = _mm256_sub_epi32(counts, _mm256_cmpgt_epi32(v, max3));
+						counts = _mm256_add_epi32(counts, _mm256_cmpgt_epi32(v, max4));
+					}
+
+					result += ((blocks * 8) + HorizontalSumU32_AVX2(counts));
+				}
+
+				_mm256_zeroupper();
+
+				return (result + UTF32_UTF8Length_SSE2((pSrc + i), (length - i)));
+			}
+
+			[[nodiscard]]
+			SIV3D_TARGET_AVX2
+			size_t UTF16_WidenBMP_AVX2(const char16* pSrc, const size_t length, char32* pDst) noexcept
+			{
+				const __m256i surrogateMask = _mm256_set1_epi16(static_cast<int16>(0xF800));
+				const __m256i surrogateBits = _mm256_set1_epi16(static_cast<int16>(0xD800));
+
+				size_t i = 0;
+
+				for (; (i + 16) <= length; i += 16)
+				{
+					const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + i));
+
+					if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(v, surrogateMask), surrogateBits)) != 0)
+					{
+						break;
+					}
+
+					__m256i* const p = reinterpret_cast<__m256i*>(pDst + i);
+					_mm256_storeu_si256((p + 0), _mm256_cvtepu16_epi32(_mm256_castsi256_si128(v)));
+					_mm256_storeu_si256((p + 1), _mm256_cvtepu16_epi32(_mm256_extracti128_si256(v, 1)));
+				}
+
+				_mm256_zeroupper();
+
+				return (i + UTF16_WidenBMP_SSE2((pSrc + i), (length - i), (pDst + i)));
+			}
+
+		# endif
+
+			//////////////////////////////////////////////////
+			//
+			//	NEON
+			//
+			//////////////////////////////////////////////////
+
+		# if SIV3D_UNICODE_NEON
+
+			[[nodiscard]]
+			UTF8CodeUnitCount UTF8_CountCodeUnits_NEON(const char8* pSrc, const size_t length) noexcept
+			{
+				const int8x16_t continuationMax = vdupq_n_s8(-65);
+				const uint8x16_t fourByteLeadMin = vdupq_n_u8(0xF0);
+
+				size_t leads = 0, fourByteLeads = 0;
+				size_t i = 0;
+
+				while ((i + 16) <= length)
+				{
+					const size_t blocks = Min<size_t>(((length - i) / 16), 255);
+					uint8x16_t leadCounts = vdupq_n_u8(0), fourByteLeadCounts = vdupq_n_u8(0);
+
+					for (size_t k = 0; k < blocks; ++k, i += 16)
+					{
+						const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8*>(pSrc + i));
+						leadCounts = vsubq_u8(leadCounts, vcgtq_s8(vreinterpretq_s8_u8(v), continuationMax));
+						fourByteLeadCounts = vsubq_u8(fourByteLeadCounts, vcgeq_u8(v, fourByteLeadMin));
+					}
+
+					leads += vaddlvq_u8(leadCounts);
+					fourByteLeads += vaddlvq_u8(fourByteLeadCounts);
+				}
+
+				const UTF8CodeUnitCount tail = UTF8_CountCodeUnits_Reference((pSrc + i), (length - i));
+
+				return{ (leads + tail.utf32), (leads + fourByteLeads + tail.utf16) };
+			}
+
+			template <class Char>
+			[[nodiscard]]
+			size_t UTF8_WidenASCII_NEON(const char8* pSrc, const size_t length, Char* pDst) noexcept
+			{
+				size_t i = 0;
+
+				for (; (i + 16) <= length; i += 16)
+				{
+					const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8*>(pSrc + i));
+
+					if (0x80 <= vmaxvq_u8(v))
+					{
+						break;
+					}
+
+					const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+					const uint16x8_t hi = vmovl_high_u8(v);
+
+					if constexpr (sizeof(Char) == sizeof(char32))
+					{
+						uint32* const p = reinterpret_cast<uint32*>(pDst + i);
+						vst1q_u32((p + 0), vmovl_u16(vget_low_u16(lo)));
+						vst1q_u32((p + 4), vmovl_high_u16(lo));
+						vst1q_u32((p + 8), vmovl_u16(vget_low_u16(hi)));
+						vst1q_u32((p + 12), vmovl_high_u16(hi));
+					}
+					else
+					{
+						uint16* const p = reinterpret_cast<uint16*>(pDst + i);
+						vst1q_u16((p + 0), lo);
+						vst1q_u16((p + 8), hi);
+					}
+				}
+
+				return (i + UTF8_WidenASCII_Reference((pSrc + i), (length - i), (pDst + i)));
+			}
+
+			[[nodiscard]]
+			size_t UTF32_NarrowASCII_NEON(const char32* pSrc, const size_t length, char8* pDst) noexcept
+			{
+				size_t i = 0;
+
+				for (; (i + 16) <= length; i += 16)
+				{
+					const uint32* const p = reinterpret_cast<const uint32*>(pSrc + i);
+					const uint32x4_t a = vld1q_u32(p + 0);
+					const uint32x4_t b = vld1q_u32(p + 4);
+					const uint32x4_t c = vld1q_u32(p + 8);
+					const uint32x4_t d = vld1q_u32(p + 12);
+
+					if (0x80 <= vmaxvq_u32(vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d))))
+					{
+						break;
+					}
+
+					const uint16x8_t ab = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+					const uint16x8_t cd = vcombine_u16(vmovn_u32(c), vmovn_u32(d));
+					vst1q_u8(reinterpret_cast<uint8*>(pDst + i), vcombine_u8(vmovn_u16(ab), vmovn_u16(cd)));
+				}
+
+				return (i + UTF32_NarrowASCII_Reference((pSrc + i), (length - i), (pDst + i)));
+			}
+
+			[[nodiscard]]
+			size_t UTF32_UTF8Length_NEON(const char32* pSrc, const size_t length) noexcept
+			{
+				const uint32x4_t min2 = vdupq_n_u32(0x80);
+				const uint32x4_t min3 = vdupq_n_u32(0x800);
+				const uint32x4_t min4 = vdupq_n_u32(0x10000);
+				const uint32x4_t invalidMin = vdupq_n_u32(0x110000);
+
+				size_t result = 0;
+				size_t i = 0;
+
+				while ((i + 4) <= length)
+				{
+					const size_t blocks = Min<size_t>(((length - i) / 4), 65536);
+					uint32x4_t counts = vdupq_n_u32(0);
+
+					for (size_t k = 0; k < blocks; ++k, i += 4)
+					{
+						const uint32x4_t v = vld1q_u32(reinterpret_cast<const uint32*>(pSrc + i));
+						counts = vsubq_u32(counts, vcgeq_u32(v, min2));
+						counts = vsubq_u32(counts, vcgeq_u32(v, min3));
+						counts = vsubq_u32(counts, vcgeq_u32(v, min4));
+						counts = vaddq_u32(counts, vcgeq_u32(v, invalidMin));
+					}
+
+					result += ((blocks * 4) + vaddlvq_u32(counts));
+				}
+
+				return (result + UTF32_UTF8Length_Reference((pSrc + i), (length - i)));
+			}
+
+			[[nodiscard]]
+			size_t UTF16_WidenBMP_NEON(const char16* pSrc, const size_t length, char32* pDst) noexcept
+			{
+				const uint16x8_t surrogateMask = vdupq_n_u16(0xF800);
+				const uint16x8_t surrogateBits = vdupq_n_u16(0xD800);
+
+				size_t i = 0;
+
+				for (; (i + 8) <= length; i += 8)
+				{
+					const uint16x8_t v = vld1q_u16(reinterpret_cast<const uint16*>(pSrc + i));
+
+					if (vmaxvq_u16(vceqq_u16(vandq_u16(v, surrogateMask), surrogateBits)) != 0)
+					{
+						break;
+					}
+
+					uint32* const p = reinterpret_cast<uint32*>(pDst + i);
+					vst1q_u32((p + 0), vmovl_u16(vget_low_u16(v)));
+					vst1q_u32((p + 4), vmovl_high_u16(v));
+				}
+
+				return (i + UTF16_WidenBMP_Reference((pSrc + i), (length - i), (pDst + i)));
+			}
+
+		# endif
+		}
+
+		UTF8CodeUnitCount UTF8_CountCodeUnits(const char8* pSrc, const size_t length) noexcept
+		{
+			switch (SelectKernel())
+			{
+		# if SIV3D_UNICODE_AVX2
+			case Kernel::AVX2:
+				return UTF8_CountCodeUnits_AVX2(pSrc, length);
+		# endif
+		# if SIV3D_UNICODE_SSE2
+			case Kernel::SSE2:
+				return UTF8_CountCodeUnits_SSE2(pSrc, length);
+		# endif
+		# if SIV3D_UNICODE_NEON
+			case Kernel::NEON:
+				return UTF8_CountCodeUnits_NEON(pSrc, length);
+		# endif
+			default:
+				return UTF8_CountCodeUnits_Reference(pSrc, length);
+			}
+		}
+
+		size_t UTF8_WidenASCII(const char8* pSrc, const size_t length, char32* pDst) noexcept
+		{
+			switch (SelectKernel())
+			{
+		# if SIV3D_UNICODE_AVX2
+			case Kernel::AVX2:
+				return UTF8_WidenASCII_AVX2(pSrc, length, pDst);
+		# endif
+		# if SIV3D_UNICODE_SSE2
+			case Kernel::SSE2:
+				return UTF8_WidenASCII_SSE2(pSrc, length, pDst);
+		# endif
+		# if SIV3D_UNICODE_NEON
+			case Kernel::NEON:
+				return UTF8_WidenASCII_NEON(pSrc, length, pDst);
+		# endif
+			default:
+				return UTF8_WidenASCII_Reference(pSrc, length, pDst);
+			}
+		}
+
+		size_t UTF8_WidenASCII(const char8* pSrc, const size_t length, char16* pDst) noexcept
+		{
+			switch (SelectKernel())
+			{
+		# if SIV3D_UNICODE_AVX2
+			case Kernel::AVX2:
+				return UTF8_WidenASCII_AVX2(pSrc, length, pDst);
+		# endif
+		# if SIV3D_UNICODE_SSE2
+			case Kernel::SSE2:
+				return UTF8_WidenASCII_SSE2(pSrc, length, pDst);
+		# endif
+		# if SIV3D_UNICODE_NEON
+			case Kernel::NEON:
+				return UTF8_WidenASCII_NEON(pSrc, length, pDst);
+		# endif
+			default:
+				return UTF8_WidenASCII_Reference(pSrc, length, pDst);
+			}
+		}
+
+		size_t UTF32_NarrowASCII(const char32* pSrc, const size_t length, char8* pDst) noexcept
+		{
+			switch (SelectKernel())
+			{
+		# if SIV3D_UNICODE_AVX2
+			case Kernel::AVX2:
+				return UTF32_NarrowASCII_AVX2(pSrc, length, pDst);
+		# endif
+		# if SIV3D_UNICODE_SSE2
+			case Kernel::SSE2:
+				return UTF32_NarrowASCII_SSE2(pSrc, length, pDst);
+		# endif
+		# if SIV3D_UNICODE_NEON
+			case Kernel::NEON:
+				return UTF32_NarrowASCII_NEON(pSrc, length, pDst);
+		# endif
+			default:
+				return UTF32_NarrowASCII_Reference(pSrc, length, pDst);
+			}
+		}
+
+		size_t UTF32_UTF8Length(const char32* pSrc, const size_t length) noexcept
+		{
+			switch (SelectKernel())
+			{
+		# if SIV3D_UNICODE_AVX2
+			case Kernel::AVX2:
+				return UTF32_UTF8Length_AVX2(pSrc, length);
+		# endif
+		# if SIV3D_UNICODE_SSE2
+			case Kernel::SSE2:
+				return UTF32_UTF8Length_SSE2(pSrc, length);
+		# endif
+		# if SIV3D_UNICODE_NEON
+			case Kernel::NEON:
+				return UTF32_UTF8Length_NEON(pSrc, length);
+		# endif
+			default:
+				return UTF32_UTF8Length_Reference(pSrc, length);
+			}
+		}
+
+		size_t UTF16_WidenBMP(const char16* pSrc, const size_t length, char32* pDst) noexcept
+		{
+			switch (SelectKernel())
+			{
+		# if SIV3D_UNICODE_AVX2
+			case Kernel::AVX2:
+				return UTF16_WidenBMP_AVX2(pSrc, length, pDst);
+		# endif
+		# if SIV3D_UNICODE_SSE2
+			case Kernel::SSE2:
+				return UTF16_WidenBMP_SSE2(pSrc, length, pDst);
+		# endif
+		# if SIV3D_UNICODE_NEON
+			case Kernel::NEON:
+				return UTF16_WidenBMP_NEON(pSrc, length, pDst);
+		# endif
+			default:
+				return UTF16_WidenBMP_Reference(pSrc, length, pDst);
+			}
+		}
+	}
+}
@@ -0,0 +1,84 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		// SIMD (SSE2 / AVX2 / NEON) による文字コード変換の部品
+		// 実行時に CPU が対応する命令セットを 1 度だけ判定して使い分けます。
+
+		/// @brief UTF-16 のコードユニットがサロゲート (0xD800-0xDFFF) であるかを返します。
+		[[nodiscard]]
+		constexpr bool IsSurrogate(const char16 ch) noexcept
+		{
+			return ((ch & 0xF800) == 0xD800);
+		}
+
+		struct UTF8CodeUnitCount
+		{
+			/// @brief UTF-32 に変換したときの長さ
+			size_t utf32 = 0;
+
+			/// @brief UTF-16 に変換したときの長さ
+			size_t utf16 = 0;
+		};
+
+		/// @brief 正しい UTF-8 であると仮定して、UTF-32 および UTF-16 に変換したときの長さを数えます。
+		/// @param pSrc UTF-8 文字列
+		/// @param length 文字列の長さ（バイト）
+		/// @return 変換後の長さ。不正なバイト列を含む場合、結果は実際の変換結果と一致しません。
+		[[nodiscard]]
+		UTF8CodeUnitCount UTF8_CountCodeUnits(const char8* pSrc, size_t length) noexcept;
+
+		/// @brief UTF-8 文字列の先頭から続く ASCII 文字を UTF-32 に変換します。
+		/// @param pSrc UTF-8 文字列
+		/// @param length 変換する最大の長さ
+		/// @param pDst 書き込み先。`length` 要素分の領域が必要です。
+		/// @return 変換した文字数。最初の非 ASCII 文字の位置で終了します。
+		[[nodiscard]]
+		size_t UTF8_WidenASCII(const char8* pSrc, size_t length, char32* pDst) noexcept;
+
+		/// @brief UTF-8 文字列の先頭から続く ASCII 文字を UTF-16 に変換します。
+		/// @param pSrc UTF-8 文字列
+		/// @param length 変換する最大の長さ
+		/// @param pDst 書き込み先。`length` 要素分の領域が必要です。
+		/// @return 変換した文字数。最初の非 ASCII 文字の位置で終了します。
+		[[nodiscard]]
+		size_t UTF8_WidenASCII(const char8* pSrc, size_t length, char16* pDst) noexcept;
+
+		/// @brief UTF-32 文字列の先頭から続く ASCII 文字を UTF-8 に変換します。
+		/// @param pSrc UTF-32 文字列
+		/// @param length 変換する最大の長さ
+		/// @param pDst 書き込み先。`length` バイト分の領域が必要です。
+		/// @return 変換した文字数。最初の非 ASCII 文字の位置で終了します。
+		[[nodiscard]]
+		size_t UTF32_NarrowASCII(const char32* pSrc, size_t length, char8* pDst) noexcept;
+
+		/// @brief UTF-32 文字列を UTF-8 に変換したときの長さを返します。
+		/// @param pSrc UTF-32 文字列
+		/// @param length 文字列の長さ
+		/// @return UTF-8 に変換したときの長さ（バイト）。不正なコードポイントは U+FFFD (3 バイト) として数えます。
+		[[nodiscard]]
+		size_t UTF32_UTF8Length(const char32* pSrc, size_t length) noexcept;
+
+		/// @brief UTF-16 文字列の先頭から続く、サロゲートを含まない文字を UTF-32 に変換します。
+		/// @param pSrc UTF-16 文字列
+		/// @param length 変換する最大の長さ
+		/// @param pDst 書き込み先。`length` 要素分の領域が必要です。
+		/// @return 変換した文字数。最初のサロゲートの位置で終了します。
+		[[nodiscard]]
+		size_t UTF16_WidenBMP(const char16* pSrc, size_t length, char32* pDst) noexcept;
+	}
+}
@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # include "UnicodeUtility.hpp"
+# include "UnicodeSIMD.hpp"
 # include <ThirdParty/miniutf/miniutf.hpp>
 
 namespace s3d
@@ -68,17 +69,7 @@ namespace s3d
 
 		size_t UTF8_Length(const StringView s) noexcept
 		{
-			size_t result = 0;
-
-			const char32* pSrc = s.data();
-			const char32* const pSrcEnd = pSrc + s.size();
-
-			while (pSrc != pSrcEnd)
-			{
-				result += UTF8_Length(*pSrc++);
-			}
-
-			return result;
+			return UTF32_UTF8Length(s.data(), s.size());
 		}
 
 		void UTF8_Encode(char8** s, const char32 codePoint) noexcept
@@ -17,15 +17,15 @@ namespace s3d
 	VideoReader::VideoReader()
 		: pImpl{ std::make_shared<VideoReaderDetail>() } {}
 
-	VideoReader::VideoReader(const FilePathView path)
+	VideoReader::VideoReader(const FilePathView path, const size_t lookaheadFrames)
 		: VideoReader{}
 	{
-		open(path);
+		open(path, lookaheadFrames);
 	}
 
-	bool VideoReader::open(const FilePathView path)
+	bool VideoReader::open(const FilePathView path, const size_t lookaheadFrames)
 	{
-		return pImpl->open(path);
+		return pImpl->open(path, lookaheadFrames);
 	}
 
 	void VideoReader::close()
@@ -48,6 +48,18 @@ namespace s3d
 		return pImpl->readFrame(image);
 	}
 
+	bool VideoReader::tryReadFrame(Image& image)
+	{
+		size_t frameIndex;
+
+		return pImpl->tryReadFrame(image, frameIndex);
+	}
+
+	bool VideoReader::tryReadFrame(Image& image, size_t& frameIndex)
+	{
+		return pImpl->tryReadFrame(image, frameIndex);
+	}
+
 	Size VideoReader::getSize() const noexcept
 	{
 		return pImpl->getSize();
@@ -102,4 +114,19 @@ namespace s3d
 	{
 		return pImpl->path();
 	}
+
+	size_t VideoReader::getLookaheadFrames() const noexcept
+	{
+		return pImpl->getLookaheadFrames();
+	}
+
+	VideoReaderStat VideoReader::getStat() const
+	{
+		return pImpl->getStat();
+	}
+
+	void VideoReader::resetStat()
+	{
+		pImpl->resetStat();
+	}
 }
@@ -22,23 +22,23 @@ namespace s3d
 		close();
 	}
 
-	bool VideoReader::VideoReaderDetail::open(const FilePathView path)
+	bool VideoReader::VideoReaderDetail::open(const FilePathView path, const size_t lookaheadFrames)
 	{
 		LOG_SCOPED_TRACE(U"VideoReaderDetail::open()");
 
 		close();
 
-		const bool result = m_shared.capture.open(path.narrow(), cv::CAP_ANY);
+		const bool result = m_capture.open(path.narrow(), cv::CAP_ANY);
 
 		if (not result)
 		{
 			return false;
 		}
 
-		const int32 videoWidth	= static_cast<int32>(m_shared.capture.get(cv::CAP_PROP_FRAME_WIDTH));
-		const int32 videoHeight	= static_cast<int32>(m_shared.capture.get(cv::CAP_PROP_FRAME_HEIGHT));
-		const int32 frameCount	= static_cast<int32>(m_shared.capture.get(cv::CAP_PROP_FRAME_COUNT));
-		const double videoFPS	= m_shared.capture.get(cv::CAP_PROP_FPS);
+		const int32 videoWidth	= static_cast<int32>(m_capture.get(cv::CAP_PROP_FRAME_WIDTH));
+		const int32 videoHeight	= static_cast<int32>(m_capture.get(cv::CAP_PROP_FRAME_HEIGHT));
+		const int32 frameCount	= static_cast<int32>(m_capture.get(cv::CAP_PROP_FRAME_COUNT));
+		const double videoFPS	= m_capture.get(cv::CAP_PROP_FPS);
 
 		m_info =
 		{
@@ -47,13 +47,14 @@ namespace s3d
 			.fps		= videoFPS,
 			.readPos	= 0,
 			.frameCount	= static_cast<size_t>(frameCount),
+			.lookaheadFrames = Max<size_t>(lookaheadFrames, 1),
 			.isOpen		= true,
 		};
 
-		LOG_INFO(U"ℹ️ VideoReader: file `{0}` opened (resolution: {1}, fps: {2}, frameCount: {3})"_fmt(
-			path, m_info.resolution, m_info.fps, m_info.frameCount));
+		LOG_INFO(U"ℹ️ VideoReader: file `{0}` opened (resolution: {1}, fps: {2}, frameCount: {3}, lookaheadFrames: {4})"_fmt(
+			path, m_info.resolution, m_info.fps, m_info.frameCount, m_info.lookaheadFrames));
 
-		m_task = Async(&VideoReaderDetail::run, this);
+		m_task = Async(AsyncLaunch::DedicatedThread, &VideoReaderDetail::run, this);
 
 		return true;
 	}
@@ -71,116 +72,269 @@ namespace s3d
 			}
 
 			// ブロック解除を通知
-			m_cv.notify_one();
+			m_cv.notify_all();
 
 			m_task.get();
 		}
 
-		m_shared.capture.release();
+		m_capture.release();
 		m_shared = {};
 		m_info = {};
 	}
 
 	void VideoReader::VideoReaderDetail::run()
 	{
+		cv::Mat mat;
+
+		// m_capture が次に返すフレームのインデックス
+		int32 capturePos = 0;
+
 		for (;;)
 		{
 			std::unique_lock ul(m_mutex);
 
-			if (not m_shared.reachedEnd)
+			m_cv.wait(ul, [this]()
 			{
-				if (m_shared.capture.grab())
+				return (m_shared.stop
+					|| m_shared.seekRequested
+					|| ((not m_shared.reachedEnd) && (m_shared.frames.size() < m_info.lookaheadFrames)));
+			});
+
+			// デコード処理のループを終了
+			if (m_shared.stop)
+			{
+				break;
+			}
+
+			m_shared.seekRequested = false;
+
+			const int32 index = m_shared.decodePos;
+			const uint64 generation = m_shared.generation;
+			Image image;
+
+			if (m_shared.freeImages)
+			{
+				image = std::move(m_shared.freeImages.back());
+				m_shared.freeImages.pop_back();
+			}
+
+			// デコードと変換はロックの外で行う
+			ul.unlock();
+
+			uint64 skippedFrames = 0;
+			bool seeked = false;
+
+			if (capturePos != index)
+			{
+				if ((capturePos < index) && ((index - capturePos) <= MaxSkipFrames))
 				{
-					m_shared.capture.retrieve(m_shared.frame.mat);
-					OpenCV_Bridge::FromMatVec3b(m_shared.frame.mat, m_shared.frame.image, OverwriteAlpha::Yes);
-					m_shared.frame.index = m_shared.readPos++;
-					//LOG_TEST(U"## info ## retrieved frame {} to buffer"_fmt(m_shared.frame.index));
+					while ((capturePos < index) && m_capture.grab())
+					{
+						++capturePos;
+						++skippedFrames;
+					}
 				}
-				else
+
+				if (capturePos != index)
 				{
-					m_shared.reachedEnd = true;
-					//LOG_TEST(U"## info ## m_shared.reachedEnd = true;");
+					m_capture.set(cv::CAP_PROP_POS_FRAMES, index);
+					capturePos = index;
+					seeked = true;
 				}
 			}
 
-			m_shared.ready = true;
-			//LOG_TEST(U"## info ## m_shared.ready = true;");
+			const bool decoded = m_capture.grab();
+
+			if (decoded)
+			{
+				m_capture.retrieve(mat);
+				OpenCV_Bridge::FromMatVec3b(mat, image, OverwriteAlpha::Yes);
+				++capturePos;
+			}
 
-			ul.unlock();
-			m_cv.notify_one();
 			ul.lock();
 
-			m_cv.wait(ul, [this]() { return (m_shared.stop) || (m_shared.ready == false); });
+			m_shared.stat.droppedFrames += skippedFrames;
+			m_shared.stat.seeks += seeked;
+			m_shared.stat.decodedFrames += decoded;
 
-			// デコード処理のループを終了
-			if (m_shared.stop)
+			// デコード中に新しいシークが要求された場合は結果を捨てる
+			if (generation != m_shared.generation)
 			{
-				//LOG_TEST(U"## info ## LOOP END");
-				break;
+				recycle(std::move(image));
+				continue;
 			}
 
-			//LOG_TEST(U"## info ## -----");
+			if (decoded)
+			{
+				// デコード中に読み込み位置が前方へ進んだ場合、decodePos は既に先へ進められている
+				m_shared.frames.push_back(VideoFrame{ index, std::move(image) });
+				m_shared.decodePos = Max(m_shared.decodePos, (index + 1));
+			}
+			else
+			{
+				m_shared.reachedEnd = true;
+				recycle(std::move(image));
+			}
+
+			ul.unlock();
+			m_cv.notify_all();
 		}
 	}
-	
-	bool VideoReader::VideoReaderDetail::isOpen() const noexcept
+
+	void VideoReader::VideoReaderDetail::recycle(Image&& image)
 	{
-		return m_info.isOpen;
+		if (image && (m_shared.freeImages.size() <= m_info.lookaheadFrames))
+		{
+			m_shared.freeImages.push_back(std::move(image));
+		}
 	}
 
-	bool VideoReader::VideoReaderDetail::readFrame(Image& image)
+	bool VideoReader::VideoReaderDetail::readFrame(Image& image, const bool wait, size_t& frameIndex)
 	{
-		//LOG_SCOPED_TRACE(U"VideoReaderDetail::getFrame()");
-
 		if (static_cast<int32>(m_info.frameCount) <= m_info.readPos)
 		{
 			return false;
 		}
 
+		const int32 target = m_info.readPos;
+
 		{
 			std::unique_lock ul(m_mutex);
 
-			m_cv.wait(ul, [this]() { return m_shared.ready; });
+			auto& frames = m_shared.frames;
 
-			if (m_shared.frame.index == m_info.readPos)
+			// 読み込み位置より前のフレームは使われないので捨てる
+			// keepLatest が true の場合は、遅れて届いた最後のフレームを 1 つだけ残す
+			const auto dropStaleFrames = [&](const bool keepLatest)
 			{
-				//LOG_TEST(U"## info ## getFrmae(): targetBufferIndex {} found in buffer"_fmt(m_info.readPos));
+				bool dropped = false;
+
+				while ((not frames.empty()) && (frames.front().index < target))
+				{
+					if (keepLatest && (frames.size() == 1))
+					{
+						break;
+					}
+
+					recycle(std::move(frames.front().image));
+					frames.pop_front();
+					++m_shared.stat.droppedFrames;
+					dropped = true;
+				}
+
+				// 空いた分のデコードを再開する
+				if (dropped)
+				{
+					m_cv.notify_all();
+				}
+			};
 
-				image.swap(m_shared.frame.image);
-				++m_info.readPos;
-				m_shared.ready = false;
-				//LOG_TEST(U"## info ## m_shared.ready = false;");
+			dropStaleFrames(not wait);
 
-				ul.unlock();
-				m_cv.notify_one();
-				return true;
+			// デコードが再生に間に合っていない場合、tryReadFrame() は読み込み位置の少し前のフレームを代わりに返す
+			if ((not frames.empty()) && (frames.front().index < target))
+			{
+				if ((target - frames.front().index) <= MaxSkipFrames)
+				{
+					m_shared.decodePos = Max(m_shared.decodePos, (target + 1));
+				}
+				else
+				{
+					recycle(std::move(frames.front().image));
+					frames.pop_front();
+					++m_shared.stat.droppedFrames;
+				}
 			}
-			else
+
+			if (frames.empty() || (target < frames.front().index))
 			{
-				//LOG_TEST(U"## info ## getFrmae(): targetBufferIndex {} not found in buffer"_fmt(m_info.readPos));
-
-				m_shared.readPos = m_info.readPos;
-				m_shared.capture.set(cv::CAP_PROP_POS_FRAMES, m_shared.readPos);
-				m_shared.reachedEnd = false;
-				m_shared.ready = false;
-				//LOG_TEST(U"## info ## m_shared.ready = false;");
-				//LOG_TEST(U"## info ## REQUESTING frame {}"_fmt(m_shared.readPos));
-
-				ul.unlock();
-				m_cv.notify_one();
-				ul.lock();
-				m_cv.wait(ul, [this]() { return m_shared.ready; });
-
-				//LOG_TEST(U"## info ## getFrmae(): targetBufferIndex {} found in buffer"_fmt(m_info.readPos));
-				image.swap(m_shared.frame.image);
-				++m_info.readPos;
-				m_shared.ready = false;
-
-				ul.unlock();
-				m_cv.notify_one();
-				return true;
+				// 読み込み位置がデコード位置の少し先である場合は、デコードを続けさせて古いフレームは届いた時点で捨てる
+				const bool skipForward = (frames.empty()
+					&& (m_shared.decodePos <= target)
+					&& ((target - m_shared.decodePos) <= MaxSkipFrames));
+
+				if (skipForward)
+				{
+					if (m_shared.reachedEnd)
+					{
+						return false;
+					}
+
+					if (m_shared.decodePos != target)
+					{
+						// 次のデコードから読み込み位置まで読み飛ばす
+						m_shared.decodePos = target;
+						m_cv.notify_all();
+					}
+				}
+				else
+				{
+					// 読み込み位置がデコード済みのフレームより前、またはデコード位置から大きく離れているので、シークを要求する
+					for (auto& frame : frames)
+					{
+						recycle(std::move(frame.image));
+					}
+
+					m_shared.stat.droppedFrames += frames.size();
+					frames.clear();
+					m_shared.seekRequested = true;
+					m_shared.decodePos = target;
+					++m_shared.generation;
+					m_shared.reachedEnd = false;
+					m_cv.notify_all();
+				}
+
+				++m_shared.stat.stalls;
+
+				if (not wait)
+				{
+					return false;
+				}
+
+				m_cv.wait(ul, [&]()
+				{
+					dropStaleFrames(false);
+					return ((not frames.empty()) || m_shared.reachedEnd);
+				});
+
+				if (frames.empty())
+				{
+					return false;
+				}
 			}
+
+			VideoFrame& frame = frames.front();
+			frameIndex = static_cast<size_t>(frame.index);
+			image.swap(frame.image);
+			recycle(std::move(frame.image));
+			frames.pop_front();
+			++m_shared.stat.presentedFrames;
 		}
+
+		// 空いた分のデコードを再開する
+		m_cv.notify_all();
+
+		++m_info.readPos;
+
+		return true;
+	}
+	
+	bool VideoReader::VideoReaderDetail::isOpen() const noexcept
+	{
+		return m_info.isOpen;
+	}
+
+	bool VideoReader::VideoReaderDetail::readFrame(Image& image)
+	{
+		size_t frameIndex;
+
+		return readFrame(image, true, frameIndex);
+	}
+
+	bool VideoReader::VideoReaderDetail::tryReadFrame(Image& image, size_t& frameIndex)
+	{
+		return readFrame(image, false, frameIndex);
 	}
 
 	const Size& VideoReader::VideoReaderDetail::getSize() const noexcept
@@ -237,4 +391,21 @@ namespace s3d
 	{
 		return m_info.fullPath;
 	}
+
+	size_t VideoReader::VideoReaderDetail::getLookaheadFrames() const noexcept
+	{
+		return m_info.lookaheadFrames;
+	}
+
+	VideoReaderStat VideoReader::VideoReaderDetail::getStat()
+	{
+		std::lock_guard guard(m_mutex);
+		return m_shared.stat;
+	}
+
+	void VideoReader::VideoReaderDetail::resetStat()
+	{
+		std::lock_guard guard(m_mutex);
+		m_shared.stat = {};
+	}
 }
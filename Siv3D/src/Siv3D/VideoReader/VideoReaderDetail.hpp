@@ -10,18 +10,17 @@
 //-----------------------------------------------
 
 # pragma once
+# include <deque>
 # include <Siv3D/AsyncTask.hpp>
 # include <Siv3D/VideoReader.hpp>
 # include <Siv3D/OpenCV_Bridge.hpp>
 
 namespace s3d
 {
-	struct MatFrame
+	struct VideoFrame
 	{
 		int32 index = -1;
 
-		cv::Mat mat;
-
 		Image image;
 	};
 
@@ -39,22 +38,37 @@ namespace s3d
 		// m_mutex で管理するデータ
 		struct Shared
 		{
-			cv::VideoCapture capture;
+			// デコード済みのフレーム（index の昇順）
+			std::deque<VideoFrame> frames;
 
-			int32 readPos = 0;
+			// 再利用する画像バッファ
+			Array<Image> freeImages;
+
+			// 次にデコードを始めるフレームのインデックス
+			int32 decodePos = 0;
+
+			// decodePos へのシークを要求しているか
+			bool seekRequested = false;
+
+			// シークのたびに増え、シーク前にデコードを始めたフレームを区別する
+			uint64 generation = 0;
 
 			bool reachedEnd = false;
 
 			bool stop = false;
 
-			MatFrame frame;
-
-			bool ready = false;
+			VideoReaderStat stat;
 
 		} m_shared;
 		//
 		/////
 
+		// 前方へのシークがこのフレーム数以下の場合は、シークせずにフレームを読み飛ばす
+		static constexpr int32 MaxSkipFrames = static_cast<int32>(VideoReader::MaxLateFrames);
+
+		// デコードスレッドのみが使う
+		cv::VideoCapture m_capture;
+
 		struct Info
 		{
 			FilePath fullPath;
@@ -67,19 +81,25 @@ namespace s3d
 
 			size_t frameCount = 0;
 
+			size_t lookaheadFrames = 0;
+
 			bool isOpen = false;
 
 		} m_info;
 
 		void run();
 
+		void recycle(Image&& image);
+
+		bool readFrame(Image& image, bool wait, size_t& frameIndex);
+
 	public:
 
 		VideoReaderDetail();
 
 		~VideoReaderDetail();
 
-		bool open(FilePathView path);
+		bool open(FilePathView path, size_t lookaheadFrames);
 
 		void close();
 
@@ -89,6 +109,9 @@ namespace s3d
 		[[nodiscard]]
 		bool readFrame(Image& image);
 
+		[[nodiscard]]
+		bool tryReadFrame(Image& image, size_t& frameIndex);
+
 		[[nodiscard]]
 		const Size& getSize() const noexcept;
 
@@ -120,5 +143,13 @@ namespace s3d
 
 		[[nodiscard]]
 		const FilePath& path() const noexcept;
+
+		[[nodiscard]]
+		size_t getLookaheadFrames() const noexcept;
+
+		[[nodiscard]]
+		VideoReaderStat getStat();
+
+		void resetStat();
 	};
 }
@@ -130,10 +130,14 @@ namespace s3d
 			m_videoReader.setCurrentFrameIndex(targetFrameIndex);
 		}
 
-		m_videoReader.readFrame(m_frameImage);
-
 		if (skipIfBusy)
 		{
+			// デコードが間に合っていない場合は、今のフレームを表示したまま次の更新を待つ
+			if (not m_videoReader.tryReadFrame(m_frameImage))
+			{
+				return;
+			}
+
 			if (auto& texture = m_frameTextures[!m_latestTextureIndex];
 				texture)
 			{
@@ -154,6 +158,8 @@ namespace s3d
 		}
 		else
 		{
+			m_videoReader.readFrame(m_frameImage);
+
 			if (auto& texture = m_frameTextures[!m_latestTextureIndex];
 				texture)
 			{
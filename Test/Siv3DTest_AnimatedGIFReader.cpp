@@ -0,0 +1,69 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("AnimatedGIFReader")
+{
+	AnimatedGIFReader reader{ U"example/gif/test.gif" };
+
+	SECTION("Can read GIF file")
+	{
+		REQUIRE(reader.isOpen() == true);
+		REQUIRE(reader.getSize() == Size{ 120, 160 });
+		REQUIRE(reader.getFrameCount() == 30);
+		REQUIRE(reader.getDelaysMillisec().size() == 30);
+		REQUIRE(reader.getDurationMillisec() == reader.getDelaysMillisec().sum());
+		REQUIRE(reader.getCurrentFrameIndex() == 0);
+	}
+
+	SECTION("Streaming frames match read()")
+	{
+		Array<Image> images;
+		Array<int32> delaysMillisec;
+		REQUIRE(reader.read(images, delaysMillisec) == true);
+		REQUIRE(images.size() == reader.getFrameCount());
+
+		Image frame;
+		int32 delayMillisec = 0;
+
+		for (size_t i = 0; i < images.size(); ++i)
+		{
+			REQUIRE(reader.readFrame(frame, delayMillisec) == true);
+			REQUIRE(delayMillisec == delaysMillisec[i]);
+			REQUIRE_NOTHROW(AssertImagesAreEqual(images[i], frame));
+		}
+
+		REQUIRE(reader.readFrame(frame) == false);
+	}
+
+	SECTION("Random access through keyframes")
+	{
+		Array<Image> images;
+		Array<int32> delaysMillisec;
+		REQUIRE(reader.read(images, delaysMillisec) == true);
+
+		reader.setKeyframeInterval(4);
+		REQUIRE(reader.getKeyframeInterval() == 4);
+
+		Image frame;
+
+		for (const size_t index : { 17, 3, 29, 0, 12, 13, 8, 25 })
+		{
+			REQUIRE(reader.setCurrentFrameIndex(index) == true);
+			REQUIRE(reader.readFrame(frame) == true);
+			REQUIRE(reader.getCurrentFrameIndex() == (index + 1));
+			REQUIRE_NOTHROW(AssertImagesAreEqual(images[index], frame));
+		}
+
+		REQUIRE(reader.setCurrentFrameIndex(reader.getFrameCount()) == false);
+	}
+}
@@ -41,6 +41,99 @@ TEST_CASE("AsyncTask")
 		
 		REQUIRE(cout == "Hello");
 	}
+
+	SECTION("Dedicated thread")
+	{
+		AsyncTask task(AsyncLaunch::DedicatedThread, [](int32 n) { return (n * 2); }, 21);
+		REQUIRE(task.isValid() == true);
+		REQUIRE(task.get() == 42);
+	}
+
+	SECTION("Waiting on a task from a thread pool task")
+	{
+		// ワーカー数より多くのタスクが、それぞれ別のタスクの完了を待ってもデッドロックしない
+		Array<AsyncTask<int32>> tasks;
+
+		for (size_t i = 0; i < (Threading::GetWorkerCount() * 2 + 2); ++i)
+		{
+			tasks << Async([] { return Async([] { return 1; }).get(); });
+		}
+
+		int32 sum = 0;
+
+		for (auto& task : tasks)
+		{
+			sum += task.get();
+		}
+
+		REQUIRE(sum == static_cast<int32>(tasks.size()));
+	}
+
+	SECTION("then")
+	{
+		auto task = Async([] { return 10; })
+			.then([](int32 n) { return (n + 1); })
+			.then([](int32 n) { return Format(n); });
+
+		REQUIRE(task.get() == U"11");
+	}
+
+	SECTION("then (exception propagation)")
+	{
+		bool called = false;
+
+		auto task = Async([]() -> int32 { throw Error{ U"error" }; })
+			.then([&called](int32 n) { called = true; return n; });
+
+		REQUIRE_THROWS_AS(task.get(), Error);
+		REQUIRE(called == false);
+	}
+
+	SECTION("then (cancellation)")
+	{
+		CancellationTokenSource source;
+		source.cancel();
+
+		auto task = Async([] { return 10; })
+			.then([](int32 n) { return (n + 1); }, source.getToken());
+
+		REQUIRE_THROWS_AS(task.get(), OperationCanceledError);
+	}
+
+	SECTION("WhenAll")
+	{
+		Array<AsyncTask<int32>> tasks;
+
+		for (int32 i = 0; i < 100; ++i)
+		{
+			tasks << Async([i] { return (i * i); });
+		}
+
+		const Array<int32> results = WhenAll(std::move(tasks)).get();
+		REQUIRE(results.size() == 100);
+
+		for (int32 i = 0; i < 100; ++i)
+		{
+			REQUIRE(results[i] == (i * i));
+		}
+	}
+
+	SECTION("WhenAny")
+	{
+		std::promise<void> promise;
+		std::shared_future<void> blocker = promise.get_future().share();
+
+		Array<AsyncTask<int32>> tasks;
+		tasks << Async(AsyncLaunch::DedicatedThread, [blocker] { blocker.wait(); return 0; });
+		tasks << Async([] { return 1; });
+
+		auto [index, results] = WhenAny(std::move(tasks)).get();
+		REQUIRE(index == 1);
+		REQUIRE(results[1].get() == 1);
+
+		promise.set_value();
+		REQUIRE(results[0].get() == 0);
+	}
 # endif
 	
 }
@@ -0,0 +1,265 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	Image MakeGradientImage(const Size& size)
+	{
+		Image image{ size };
+
+		for (int32 y = 0; y < size.y; ++y)
+		{
+			for (int32 x = 0; x < size.x; ++x)
+			{
+				image[y][x] = Color{ static_cast<uint8>(x * 255 / Max(size.x - 1, 1)),
+					static_cast<uint8>(y * 255 / Max(size.y - 1, 1)), 128,
+					static_cast<uint8>(255 - (x + y) * 255 / Max(size.x + size.y - 2, 1)) };
+			}
+		}
+
+		return image;
+	}
+
+	// 各チャンネルの誤差の最大値
+	int32 MaxError(const Image& a, const Image& b, const bool rgb, const bool alpha)
+	{
+		int32 maxError = 0;
+
+		for (int32 y = 0; y < a.height(); ++y)
+		{
+			for (int32 x = 0; x < a.width(); ++x)
+			{
+				const Color c0 = a[y][x];
+				const Color c1 = b[y][x];
+
+				if (rgb)
+				{
+					maxError = Max({ maxError, std::abs(c0.r - c1.r), std::abs(c0.g - c1.g), std::abs(c0.b - c1.b) });
+				}
+
+				if (alpha)
+				{
+					maxError = Max(maxError, std::abs(c0.a - c1.a));
+				}
+			}
+		}
+
+		return maxError;
+	}
+
+	// 4x4 ピクセルの 1 ブロックだけの画像としてデコードする
+	Image DecodeBlock(const TextureFormat format, const std::initializer_list<uint8> block)
+	{
+		BlockCompressedImage bc;
+		bc.format = format;
+		bc.size = Size{ 4, 4 };
+		bc.mipmaps.push_back(Blob{ block.begin(), block.size() });
+		return bc.decode();
+	}
+
+	Image MakeBlockImage(const std::initializer_list<Color> pixels)
+	{
+		Image image{ 4, 4 };
+		std::copy(pixels.begin(), pixels.end(), image.begin());
+		return image;
+	}
+}
+
+TEST_CASE("BlockCompression")
+{
+	SECTION("TextureFormat")
+	{
+		REQUIRE(TextureFormat{ TextureFormat::BC1_RGBA_Unorm }.isBlockCompressed() == true);
+		REQUIRE(TextureFormat{ TextureFormat::BC1_RGBA_Unorm }.blockSize() == 8);
+		REQUIRE(TextureFormat{ TextureFormat::BC4_R_Unorm }.blockSize() == 8);
+		REQUIRE(TextureFormat{ TextureFormat::BC5_RG_Unorm }.blockSize() == 16);
+		REQUIRE(TextureFormat{ TextureFormat::BC7_RGBA_Unorm_SRGB }.blockSize() == 16);
+		REQUIRE(TextureFormat{ TextureFormat::BC7_RGBA_Unorm_SRGB }.isSRGB() == true);
+		REQUIRE(TextureFormat{ TextureFormat::R8G8B8A8_Unorm }.isBlockCompressed() == false);
+		REQUIRE(TextureFormat{ TextureFormat::R8G8B8A8_Unorm }.blockSize() == 0);
+
+		REQUIRE(BlockCompressedImage::CalculateDataSize(Size{ 16, 16 }, TextureFormat::BC1_RGBA_Unorm) == (16 * 8));
+		REQUIRE(BlockCompressedImage::CalculateDataSize(Size{ 17, 5 }, TextureFormat::BC7_RGBA_Unorm) == (5 * 2 * 16));
+		REQUIRE(BlockCompressedImage::CalculateDataSize(Size{ 16, 16 }, TextureFormat::R8G8B8A8_Unorm) == 0);
+	}
+
+	SECTION("Encode and decode")
+	{
+		const Image image = MakeGradientImage(Size{ 64, 64 });
+
+		// BC1 のアルファは 1 bit なので、不透明な画像で比較する
+		{
+			const Image opaque = MakeGradientImage(Size{ 64, 64 }).forEach([](Color& c) { c.a = 255; });
+			const BlockCompressedImage bc{ opaque, TextureFormat::BC1_RGBA_Unorm, HasMipMap::No };
+			REQUIRE(bc.mipLevels() == 1);
+			REQUIRE(bc.size_bytes() == (16 * 16 * 8));
+			REQUIRE(MaxError(opaque, bc.decode(), true, true) <= 12);
+		}
+
+		{
+			const BlockCompressedImage bc{ image, TextureFormat::BC3_RGBA_Unorm, HasMipMap::No };
+			REQUIRE(MaxError(image, bc.decode(), true, false) <= 12);
+			REQUIRE(MaxError(image, bc.decode(), false, true) <= 4);
+		}
+
+		{
+			const BlockCompressedImage bc{ image, TextureFormat::BC7_RGBA_Unorm, HasMipMap::No };
+			REQUIRE(MaxError(image, bc.decode(), true, true) <= 8);
+		}
+
+		{
+			const BlockCompressedImage bc{ image, TextureFormat::BC4_R_Unorm, HasMipMap::No };
+			const Image decoded = bc.decode();
+			REQUIRE(decoded[10][20] == Color{ decoded[10][20].r, 0, 0, 255 });
+			REQUIRE(std::abs(decoded[10][20].r - image[10][20].r) <= 4);
+		}
+
+		{
+			const BlockCompressedImage bc{ image, TextureFormat::BC5_RG_Unorm, HasMipMap::No };
+			const Image decoded = bc.decode();
+			REQUIRE(decoded[10][20].b == 0);
+			REQUIRE(std::abs(decoded[10][20].r - image[10][20].r) <= 4);
+			REQUIRE(std::abs(decoded[10][20].g - image[10][20].g) <= 4);
+		}
+	}
+
+	// 仕様に従って手で組み立てたブロックを、仕様から求めた値にデコードできるかを確認する
+	SECTION("Known-answer decode")
+	{
+		// BC1: color0 > color1 なので 4 色。インデックスは各行 0, 1, 2, 3
+		REQUIRE(DecodeBlock(TextureFormat::BC1_RGBA_Unorm, { 0x00, 0xF8, 0x1F, 0x00, 0xE4, 0xE4, 0xE4, 0xE4 })
+			== MakeBlockImage({
+				{ 255, 0, 0 }, { 0, 0, 255 }, { 170, 0, 85 }, { 85, 0, 170 },
+				{ 255, 0, 0 }, { 0, 0, 255 }, { 170, 0, 85 }, { 85, 0, 170 },
+				{ 255, 0, 0 }, { 0, 0, 255 }, { 170, 0, 85 }, { 85, 0, 170 },
+				{ 255, 0, 0 }, { 0, 0, 255 }, { 170, 0, 85 }, { 85, 0, 170 } }));
+
+		// BC1: color0 <= color1 なので 3 色と透明。インデックスは 1 行目から 0, 1, 2, 3
+		REQUIRE(DecodeBlock(TextureFormat::BC1_RGBA_Unorm, { 0x00, 0x00, 0x00, 0x80, 0x00, 0x55, 0xAA, 0xFF })
+			== MakeBlockImage({
+				{ 0, 0, 0, 255 }, { 0, 0, 0, 255 }, { 0, 0, 0, 255 }, { 0, 0, 0, 255 },
+				{ 132, 0, 0, 255 }, { 132, 0, 0, 255 }, { 132, 0, 0, 255 }, { 132, 0, 0, 255 },
+				{ 66, 0, 0, 255 }, { 66, 0, 0, 255 }, { 66, 0, 0, 255 }, { 66, 0, 0, 255 },
+				{ 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } }));
+
+		// BC4: r0 > r1 なので 8 値 (210, 0, 180, 150, 120, 90, 60, 30)。インデックスは 0, 1, ..., 7 の繰り返し
+		REQUIRE(DecodeBlock(TextureFormat::BC4_R_Unorm, { 0xD2, 0x00, 0x88, 0xC6, 0xFA, 0x88, 0xC6, 0xFA })
+			== MakeBlockImage({
+				{ 210, 0, 0 }, { 0, 0, 0 }, { 180, 0, 0 }, { 150, 0, 0 },
+				{ 120, 0, 0 }, { 90, 0, 0 }, { 60, 0, 0 }, { 30, 0, 0 },
+				{ 210, 0, 0 }, { 0, 0, 0 }, { 180, 0, 0 }, { 150, 0, 0 },
+				{ 120, 0, 0 }, { 90, 0, 0 }, { 60, 0, 0 }, { 30, 0, 0 } }));
+
+		// BC5: R は上の BC4 と同じ。G は r0 <= r1 なので 6 値と 0, 255 (40, 240, 80, 120, 160, 200, 0, 255)。インデックスは 0, 3, 6, 1, 4, 7, 2, 5 の繰り返し
+		REQUIRE(DecodeBlock(TextureFormat::BC5_RG_Unorm, { 0xD2, 0x00, 0x88, 0xC6, 0xFA, 0x88, 0xC6, 0xFA, 0x28, 0xF0, 0x98, 0xC3, 0xAB, 0x98, 0xC3, 0xAB })
+			== MakeBlockImage({
+				{ 210, 40, 0 }, { 0, 120, 0 }, { 180, 0, 0 }, { 150, 240, 0 },
+				{ 120, 160, 0 }, { 90, 255, 0 }, { 60, 80, 0 }, { 30, 200, 0 },
+				{ 210, 40, 0 }, { 0, 120, 0 }, { 180, 0, 0 }, { 150, 240, 0 },
+				{ 120, 160, 0 }, { 90, 255, 0 }, { 60, 80, 0 }, { 30, 200, 0 } }));
+
+		// BC3: アルファは上の BC5 の G と同じ。カラーは color0 <= color1 でも常に 4 色
+		REQUIRE(DecodeBlock(TextureFormat::BC3_RGBA_Unorm, { 0x28, 0xF0, 0x98, 0xC3, 0xAB, 0x98, 0xC3, 0xAB, 0x1F, 0x00, 0x00, 0xF8, 0xE4, 0xE4, 0xE4, 0xE4 })
+			== MakeBlockImage({
+				{ 0, 0, 255, 40 }, { 255, 0, 0, 120 }, { 85, 0, 170, 0 }, { 170, 0, 85, 240 },
+				{ 0, 0, 255, 160 }, { 255, 0, 0, 255 }, { 85, 0, 170, 80 }, { 170, 0, 85, 200 },
+				{ 0, 0, 255, 40 }, { 255, 0, 0, 120 }, { 85, 0, 170, 0 }, { 170, 0, 85, 240 },
+				{ 0, 0, 255, 160 }, { 255, 0, 0, 255 }, { 85, 0, 170, 80 }, { 170, 0, 85, 200 } }));
+
+		// BC7 モード 6: 端点は RGBA (0, 254, 64, 254), (255, 1, 65, 255)。インデックスは 0, 1, ..., 15
+		REQUIRE(DecodeBlock(TextureFormat::BC7_RGBA_Unorm, { 0x40, 0xC0, 0xFF, 0x0F, 0x00, 0x81, 0xFE, 0x7F, 0x11, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE })
+			== MakeBlockImage({
+				{ 0, 254, 64, 254 }, { 16, 238, 64, 254 }, { 36, 218, 64, 254 }, { 52, 203, 64, 254 },
+				{ 68, 187, 64, 254 }, { 84, 171, 64, 254 }, { 104, 151, 64, 254 }, { 120, 135, 64, 254 },
+				{ 135, 120, 65, 255 }, { 151, 104, 65, 255 }, { 171, 84, 65, 255 }, { 187, 68, 65, 255 },
+				{ 203, 52, 65, 255 }, { 219, 37, 65, 255 }, { 239, 17, 65, 255 }, { 255, 1, 65, 255 } }));
+
+		// BC7 モード 1, パーティション 0 (左 2 列がサブセット 0, 右 2 列がサブセット 1):
+		// 端点は RGB (0, 0, 0), (253, 0, 0) と (2, 2, 2), (2, 2, 255)。インデックスは 0, 1, ..., 7 の繰り返しで、アンカーの 15 番目のみ 3
+		REQUIRE(DecodeBlock(TextureFormat::BC7_RGBA_Unorm, { 0x02, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x12, 0x8D, 0xF5, 0x11, 0x8D, 0xF5 })
+			== MakeBlockImage({
+				{ 0, 0, 0 }, { 36, 0, 0 }, { 2, 2, 73 }, { 2, 2, 109 },
+				{ 146, 0, 0 }, { 182, 0, 0 }, { 2, 2, 219 }, { 2, 2, 255 },
+				{ 0, 0, 0 }, { 36, 0, 0 }, { 2, 2, 73 }, { 2, 2, 109 },
+				{ 146, 0, 0 }, { 182, 0, 0 }, { 2, 2, 219 }, { 2, 2, 109 } }));
+	}
+
+	SECTION("Uniform color")
+	{
+		const Image image{ 8, 8, Color{ 255, 0, 255, 255 } };
+
+		for (const auto format : { TextureFormat::BC1_RGBA_Unorm, TextureFormat::BC3_RGBA_Unorm })
+		{
+			const BlockCompressedImage bc{ image, format, HasMipMap::No };
+			REQUIRE_NOTHROW(AssertImagesAreEqual(image, bc.decode()));
+		}
+
+		// BC7 (モード 6) は RGBA で P ビットを共有するため、1 の誤差が出ることがある
+		{
+			const BlockCompressedImage bc{ image, TextureFormat::BC7_RGBA_Unorm, HasMipMap::No };
+			REQUIRE(MaxError(image, bc.decode(), true, true) <= 1);
+		}
+	}
+
+	SECTION("Sizes that are not a multiple of 4")
+	{
+		const Image image = MakeGradientImage(Size{ 17, 9 });
+		const BlockCompressedImage bc{ image, TextureFormat::BC7_RGBA_Unorm, HasMipMap::Yes };
+
+		REQUIRE(bc.size == Size{ 17, 9 });
+		REQUIRE(bc.mipLevels() == ImageProcessing::CalculateMipCount(17, 9));
+		REQUIRE(bc.mipSize(1) == Size{ 8, 4 });
+		REQUIRE(bc.mipmaps[0].size() == BlockCompressedImage::CalculateDataSize(Size{ 17, 9 }, TextureFormat::BC7_RGBA_Unorm));
+		REQUIRE(bc.decode().size() == Size{ 17, 9 });
+		REQUIRE(bc.decode(1).size() == Size{ 8, 4 });
+	}
+
+	SECTION("Invalid input")
+	{
+		REQUIRE(BlockCompressedImage{ Image{}, TextureFormat::BC1_RGBA_Unorm }.isEmpty());
+		REQUIRE(BlockCompressedImage{ Image{ 4, 4 }, TextureFormat::R8G8B8A8_Unorm }.isEmpty());
+
+		const std::array<Byte, 16> garbage{};
+		REQUIRE(BlockCompressedImage{ MemoryViewReader{ garbage.data(), garbage.size() } }.isEmpty());
+	}
+}
+
+TEST_CASE("BlockCompressedImage containers")
+{
+	const Image image = MakeGradientImage(Size{ 40, 24 });
+
+	for (const auto format : { TextureFormat::BC1_RGBA_Unorm, TextureFormat::BC3_RGBA_Unorm_SRGB, TextureFormat::BC4_R_Unorm,
+		TextureFormat::BC5_RG_Unorm, TextureFormat::BC7_RGBA_Unorm, TextureFormat::BC7_RGBA_Unorm_SRGB })
+	{
+		const BlockCompressedImage bc{ image, format, HasMipMap::Yes };
+		REQUIRE(bc.mipLevels() == ImageProcessing::CalculateMipCount(40, 24));
+
+		for (const Blob& blob : { bc.encodeDDS(), bc.encodeKTX2() })
+		{
+			const BlockCompressedImage loaded{ MemoryViewReader{ blob.data(), blob.size() } };
+
+			REQUIRE(loaded.format == format);
+			REQUIRE(loaded.size == bc.size);
+			REQUIRE(loaded.mipLevels() == bc.mipLevels());
+
+			for (size_t i = 0; i < bc.mipLevels(); ++i)
+			{
+				REQUIRE(loaded.mipmaps[i] == bc.mipmaps[i]);
+			}
+
+			// 途中で切れたファイルは読み込まない
+			const BlockCompressedImage truncated{ MemoryViewReader{ blob.data(), (blob.size() - 1) } };
+			REQUIRE(truncated.isEmpty());
+		}
+	}
+}
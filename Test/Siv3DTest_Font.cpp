@@ -0,0 +1,87 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("Font glyph cache stat")
+{
+	const Font font{ FontMethod::Bitmap, 32 };
+
+	{
+		const FontCacheStat stat = font.getCacheStat();
+		REQUIRE(stat.glyphCount == 0);
+		REQUIRE(stat.pageCount == 0);
+	}
+
+	String chars;
+
+	for (char32 ch = U'!'; ch <= U'~'; ++ch)
+	{
+		chars << ch;
+	}
+
+	REQUIRE(font.preload(chars));
+
+	{
+		const FontCacheStat stat = font.getCacheStat();
+		REQUIRE(stat.glyphCount >= chars.size());
+		REQUIRE(stat.pageCount == 1);
+		REQUIRE(stat.pageCount <= stat.maxPageCount);
+		REQUIRE(0.0 < stat.occupancy);
+		REQUIRE(stat.occupancy <= 1.0);
+		REQUIRE(stat.evictedGlyphCount == 0);
+		REQUIRE(stat.evictedPageCount == 0);
+	}
+}
+
+TEST_CASE("Font shaping cache")
+{
+	const auto ToGlyphIndices = [](const Array<GlyphCluster>& clusters)
+	{
+		return clusters.map([](const GlyphCluster& cluster) { return cluster.glyphIndex; });
+	};
+
+	const Font font{ 24 };
+	const FontCacheStat before = font.getCacheStat();
+
+	const Array<GlyphCluster> clusters = font.getGlyphClusters(U"Siv3D shaping cache");
+	REQUIRE(font.getCacheStat().shapingCacheMissCount == (before.shapingCacheMissCount + 1));
+
+	REQUIRE(ToGlyphIndices(font.getGlyphClusters(U"Siv3D shaping cache")) == ToGlyphIndices(clusters));
+	REQUIRE(font.getCacheStat().shapingCacheHitCount == (before.shapingCacheHitCount + 1));
+
+	// オプションが異なる場合は別のエントリ
+	[[maybe_unused]] const auto noLigature = font.getGlyphClusters(U"Siv3D shaping cache", UseFallback::Yes, Ligature::No);
+	REQUIRE(font.getCacheStat().shapingCacheMissCount == (before.shapingCacheMissCount + 2));
+
+	const ShapedText shapedText{ font, U"Siv3D shaping cache" };
+	REQUIRE(ToGlyphIndices(shapedText.clusters()) == ToGlyphIndices(clusters));
+	REQUIRE(ToGlyphIndices(DrawableText{ shapedText }.getClusters()) == ToGlyphIndices(clusters));
+
+	// 描画用のテキストはシェーピングキャッシュの結果を共有する
+	REQUIRE(font(U"Siv3D shaping cache").clusters == shapedText.drawable().clusters);
+}
+
+TEST_CASE("Font::preloadAsync")
+{
+	const Font font{ FontMethod::Bitmap, 20 };
+	const String chars = U"0123456789";
+
+	font.preloadAsync(chars);
+
+	for (int32 i = 0; (i < 5000) && (not font.isPreloadReady()); ++i)
+	{
+		System::Sleep(1);
+	}
+
+	REQUIRE(font.isPreloadReady());
+	REQUIRE(font.getCacheStat().glyphCount >= chars.size());
+}
@@ -201,3 +201,238 @@ TEST_CASE("Image")
 		}
 	}
 }
+
+TEST_CASE("Image pixel filters")
+{
+	// 全ての SIMD 命令セット向けの実装が同じ結果になることを確認する（CPU が対応していない命令セットは対応する最も高いものになる）
+	const SIMDLevel simdLevel = GENERATE(SIMDLevel::None, SIMDLevel::SSE2, SIMDLevel::SSE4_1, SIMDLevel::AVX2, SIMDLevel::AVX512, SIMDLevel::NEON);
+	SetMaxSIMDLevel(simdLevel);
+
+	// REQUIRE が失敗しても、後のテストに影響しないよう元に戻す
+	ScopeGuard guard = []() { SetMaxSIMDLevel(GetCPUInfo().simdLevel); };
+
+	// SIMD の端数処理も確認できるよう、幅を 16 の倍数にしない
+	Image image{ 67, 31 };
+
+	for (size_t i = 0; i < image.num_pixels(); ++i)
+	{
+		const uint32 v = static_cast<uint32>(i * 2654435761u);
+		image.data()[i] = Color{ static_cast<uint8>(v), static_cast<uint8>(v >> 8), static_cast<uint8>(v >> 16), static_cast<uint8>(v >> 24) };
+	}
+
+	SECTION("negated")
+	{
+		const Image result = image.negated();
+
+		for (size_t i = 0; i < image.num_pixels(); ++i)
+		{
+			REQUIRE(result.data()[i] == ~image.data()[i]);
+		}
+	}
+
+	SECTION("grayscaled")
+	{
+		const Image result = image.grayscaled();
+
+		for (size_t i = 0; i < image.num_pixels(); ++i)
+		{
+			const Color c = image.data()[i];
+			const uint8 gray = c.grayscale0_255();
+			REQUIRE(result.data()[i] == Color{ gray, gray, gray, c.a });
+		}
+	}
+
+	SECTION("sepiaed")
+	{
+		const Image result = image.sepiaed();
+
+		for (size_t i = 0; i < image.num_pixels(); ++i)
+		{
+			const Color c = image.data()[i];
+			const Color expected{
+				static_cast<uint8>(Min(((0.393 * c.r) + (0.769 * c.g) + (0.189 * c.b)), 255.0)),
+				static_cast<uint8>(Min(((0.349 * c.r) + (0.686 * c.g) + (0.168 * c.b)), 255.0)),
+				static_cast<uint8>(Min(((0.272 * c.r) + (0.534 * c.g) + (0.131 * c.b)), 255.0)),
+				c.a };
+			REQUIRE(result.data()[i] == expected);
+		}
+	}
+
+	SECTION("brightened")
+	{
+		for (const int32 level : { -300, -40, 0, 40, 300 })
+		{
+			const Image result = image.brightened(level);
+
+			for (size_t i = 0; i < image.num_pixels(); ++i)
+			{
+				const Color c = image.data()[i];
+				const Color expected{
+					static_cast<uint8>(Clamp((c.r + level), 0, 255)),
+					static_cast<uint8>(Clamp((c.g + level), 0, 255)),
+					static_cast<uint8>(Clamp((c.b + level), 0, 255)),
+					c.a };
+				REQUIRE(result.data()[i] == expected);
+			}
+		}
+	}
+
+	SECTION("RGBAtoBGRA")
+	{
+		Image result = image;
+		result.RGBAtoBGRA();
+
+		for (size_t i = 0; i < image.num_pixels(); ++i)
+		{
+			const Color c = image.data()[i];
+			REQUIRE(result.data()[i] == Color{ c.b, c.g, c.r, c.a });
+		}
+	}
+
+	SECTION("ImageROI")
+	{
+		Image result = image;
+		result(Rect{ 3, 2, 29, 5 }).grayscale();
+
+		for (int32 y = 0; y < image.height(); ++y)
+		{
+			for (int32 x = 0; x < image.width(); ++x)
+			{
+				const Color c = image[y][x];
+
+				if (InRange(x, 3, 31) && InRange(y, 2, 6))
+				{
+					const uint8 gray = c.grayscale0_255();
+					REQUIRE(result[y][x] == Color{ gray, gray, gray, c.a });
+				}
+				else
+				{
+					REQUIRE(result[y][x] == c);
+				}
+			}
+		}
+	}
+}
+
+TEST_CASE("Image multithreaded filters")
+{
+	Image image{ 517, 389 };
+
+	for (auto& pixel : image)
+	{
+		pixel = RandomColor();
+	}
+
+	const auto compare = [&](const auto& f)
+	{
+		ImageProcessing::SetMultiThreadingEnabled(false);
+		const Image expected = f(image);
+
+		ImageProcessing::SetMultiThreadingEnabled(true);
+		const Image result = f(image);
+
+		ImageProcessing::SetMultiThreadingEnabled(false);
+		return (result == expected);
+	};
+
+	REQUIRE(compare([](const Image& src) { return src.blurred(4, 9); }));
+	REQUIRE(compare([](const Image& src) { return src.blurred(3, 3, BorderType::Replicate); }));
+	REQUIRE(compare([](const Image& src) { return src.gaussianBlurred(5, 12); }));
+	REQUIRE(compare([](const Image& src) { return src.gaussianBlurred(2, 2, BorderType::Reflect); }));
+	REQUIRE(compare([](const Image& src) { return src.medianBlurred(3); }));
+	REQUIRE(compare([](const Image& src) { return src.medianBlurred(9); }));
+	REQUIRE(compare([](const Image& src) { return src.bilateralFiltered(7, 40.0, 20.0); }));
+	REQUIRE(compare([](const Image& src) { return src.bilateralFiltered(0, 30.0, 4.0); }));
+	REQUIRE(compare([](Image src) { return std::move(src.gaussianBlur(6)); }));
+	REQUIRE(compare([](const Image& src) { return src.scaled(1234, 777); }));
+	REQUIRE(compare([](const Image& src) { return src.scaled(0.3); }));
+	REQUIRE(compare([](const Image& src) { return src.rotated(0.4); }));
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Image pixel filters : benchmark")
+{
+	Image image{ 3840, 2160 };
+
+	for (auto& pixel : image)
+	{
+		pixel = RandomColor();
+	}
+
+	BENCHMARK("Image::negate() | 4K")
+	{
+		return image.negate().width();
+	};
+
+	BENCHMARK("Image::grayscale() | 4K")
+	{
+		return image.grayscale().width();
+	};
+
+	BENCHMARK("Image::sepia() | 4K")
+	{
+		return image.sepia().width();
+	};
+
+	BENCHMARK("Image::brighten() | 4K")
+	{
+		return image.brighten(1).width();
+	};
+
+	BENCHMARK("Image::posterize() | 4K")
+	{
+		return image.posterize(8).width();
+	};
+
+	BENCHMARK("Image::gammaCorrect() | 4K")
+	{
+		return image.gammaCorrect(1.2).width();
+	};
+
+	BENCHMARK("Image::RGBAtoBGRA() | 4K")
+	{
+		return image.RGBAtoBGRA().width();
+	};
+}
+
+TEST_CASE("Image multithreaded filters : benchmark")
+{
+	Image image{ 3840, 2160 };
+
+	for (auto& pixel : image)
+	{
+		pixel = RandomColor();
+	}
+
+	for (const bool multiThreading : { false, true })
+	{
+		ImageProcessing::SetMultiThreadingEnabled(multiThreading);
+
+		const String suffix = (multiThreading ? U" | 4K, multithreaded" : U" | 4K");
+
+		BENCHMARK((U"Image::gaussianBlurred()" + suffix).narrow())
+		{
+			return image.gaussianBlurred(8).width();
+		};
+
+		BENCHMARK((U"Image::medianBlurred()" + suffix).narrow())
+		{
+			return image.medianBlurred(7).width();
+		};
+
+		BENCHMARK((U"Image::bilateralFiltered()" + suffix).narrow())
+		{
+			return image.bilateralFiltered(9, 50.0, 20.0).width();
+		};
+
+		BENCHMARK((U"Image::scaled()" + suffix).narrow())
+		{
+			return image.scaled(0.5).width();
+		};
+	}
+
+	ImageProcessing::SetMultiThreadingEnabled(false);
+}
+
+# endif
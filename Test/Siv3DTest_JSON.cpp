@@ -0,0 +1,410 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	[[nodiscard]]
+	String MakeJSONTestText(const size_t count)
+	{
+		String text = U"{\"items\":[";
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (i)
+			{
+				text += U',';
+			}
+
+			text += U"{{\"id\":{},\"name\":\"item{}\",\"score\":{},\"tags\":[\"a\",\"b\"]}}"_fmt(i, i, (i * 0.5));
+		}
+
+		text += U"]}";
+		return text;
+	}
+
+	// "score" キーの値を合計するハンドラ
+	struct JSONScoreSumHandler : IJSONReaderHandler
+	{
+		double sum = 0.0;
+
+		size_t count = 0;
+
+		bool isScore = false;
+
+		bool onKey(const std::string_view key) override
+		{
+			isScore = (key == "score");
+			return true;
+		}
+
+		bool onUnsigned(const uint64 value) override
+		{
+			return onFloat(static_cast<double>(value));
+		}
+
+		bool onFloat(const double value) override
+		{
+			if (isScore)
+			{
+				sum += value;
+				++count;
+				isScore = false;
+			}
+
+			return true;
+		}
+	};
+
+	void WriteNDJSONTestFile(const FilePath& path, const size_t count)
+	{
+		TextWriter writer{ path, TextEncoding::UTF8_NO_BOM };
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			writer.writeln(U"{{\"id\":{},\"name\":\"item{}\",\"score\":{}}}"_fmt(i, i, (i * 0.5)));
+		}
+	}
+}
+
+TEST_CASE("JSON::Load()")
+{
+	const String text = U"{\"name\":\"Siv3D\",\"日本語\":\"テキスト\",\"values\":[1,2,3]}";
+
+	SECTION("UTF-8")
+	{
+		const FilePath path = FileSystem::FullPath(U"test/runtime/json/utf8.json");
+		{
+			TextWriter writer{ path, TextEncoding::UTF8_NO_BOM };
+			writer.write(text);
+		}
+
+		const JSON json = JSON::Load(path);
+		REQUIRE(json);
+		REQUIRE(json[U"name"].getString() == U"Siv3D");
+		REQUIRE(json[U"日本語"].getString() == U"テキスト");
+		REQUIRE(json[U"values"].size() == 3);
+	}
+
+	SECTION("UTF-8 with BOM")
+	{
+		const FilePath path = FileSystem::FullPath(U"test/runtime/json/utf8_with_bom.json");
+		{
+			TextWriter writer{ path, TextEncoding::UTF8_WITH_BOM };
+			writer.write(text);
+		}
+
+		const JSON json = JSON::Load(path);
+		REQUIRE(json);
+		REQUIRE(json[U"日本語"].getString() == U"テキスト");
+	}
+
+	SECTION("UTF-16")
+	{
+		for (const auto encoding : { TextEncoding::UTF16LE, TextEncoding::UTF16BE })
+		{
+			const FilePath path = FileSystem::FullPath(U"test/runtime/json/utf16.json");
+			{
+				TextWriter writer{ path, encoding };
+				writer.write(text);
+			}
+
+			const JSON json = JSON::Load(path);
+			REQUIRE(json);
+			REQUIRE(json[U"日本語"].getString() == U"テキスト");
+		}
+	}
+
+	SECTION("Invalid")
+	{
+		REQUIRE_FALSE(JSON::Load(U"test/runtime/json/not_found.json"));
+		REQUIRE_THROWS_AS(JSON::Load(U"test/runtime/json/not_found.json", AllowExceptions::Yes), Error);
+	}
+}
+
+TEST_CASE("JSONView")
+{
+	const JSON json = JSON::ParseUTF8(R"({"name":"Siv3D","version":6,"pi":3.14,"enabled":true,"none":null,"values":[10,20,30],"nested":{"a":{"b":"c"}}})");
+	REQUIRE(json);
+
+	const JSONView view = json.view();
+	REQUIRE(view.isObject());
+	REQUIRE(view.size() == 7);
+
+	SECTION("access")
+	{
+		REQUIRE(view["name"].getUTF8String() == "Siv3D");
+		REQUIRE(view[U"name"].getString() == U"Siv3D");
+		REQUIRE(view["version"].get<int32>() == 6);
+		REQUIRE(view["pi"].get<double>() == 3.14);
+		REQUIRE(view["enabled"].get<bool>());
+		REQUIRE(view["none"].isNull());
+		REQUIRE(view["values"][1].get<int32>() == 20);
+		REQUIRE(view["nested"]["a"]["b"].getUTF8String() == "c");
+		REQUIRE(view.contains("values"));
+		REQUIRE(view["values"].contains(2));
+	}
+
+	SECTION("missing")
+	{
+		REQUIRE(view["missing"].isEmpty());
+		REQUIRE(view["missing"]["deeper"].isEmpty());
+		REQUIRE(view["values"][3].isEmpty());
+		REQUIRE(view["name"][0].isEmpty());
+		REQUIRE(view["missing"].getType() == JSONValueType::Empty);
+		REQUIRE(view["missing"].getOr<int32>(-1) == -1);
+		REQUIRE_FALSE(view["name"].getOpt<int32>());
+		REQUIRE_THROWS_AS(view["missing"].get<int32>(), Error);
+		REQUIRE(JSON::Invalid().view().isEmpty());
+	}
+
+	SECTION("iteration")
+	{
+		int32 sum = 0;
+
+		for (const auto& value : view["values"])
+		{
+			sum += value.get<int32>();
+		}
+
+		REQUIRE(sum == 60);
+
+		Array<std::string_view> keys;
+
+		for (auto it = view.begin(); it != view.end(); ++it)
+		{
+			keys << it.key();
+		}
+
+		REQUIRE(keys.size() == 7);
+		REQUIRE(std::is_sorted(keys.begin(), keys.end()));
+	}
+
+	SECTION("iterator copy")
+	{
+		auto it = view.begin();
+		auto copied = it;
+		REQUIRE(copied == it);
+
+		++it;
+		REQUIRE(copied != it);
+		REQUIRE(copied.key() == "enabled");
+		REQUIRE(it.key() == "name");
+
+		copied = it;
+		REQUIRE(copied == it);
+		REQUIRE(copied.value().getUTF8String() == "Siv3D");
+
+		copied = view["nested"].begin();
+		REQUIRE(copied.key() == "a");
+		REQUIRE(++copied == view["nested"].end());
+		REQUIRE(copied.key().empty());
+		REQUIRE(copied != view.end());
+
+		REQUIRE(view["nested"]["a"]["b"].begin() == view["nested"]["a"]["b"].end());
+	}
+
+	SECTION("toJSON")
+	{
+		const JSON copied = view["nested"].toJSON();
+		REQUIRE(copied[U"a"][U"b"].getString() == U"c");
+	}
+}
+
+TEST_CASE("JSONReader")
+{
+	SECTION("read()")
+	{
+		const FilePath path = FileSystem::FullPath(U"test/runtime/json/reader.json");
+		{
+			TextWriter writer{ path, TextEncoding::UTF8_WITH_BOM };
+			writer.write(MakeJSONTestText(100));
+		}
+
+		JSONReader reader{ path, 64 };
+		REQUIRE(reader);
+
+		JSONScoreSumHandler handler;
+		REQUIRE(reader.read(handler) == JSONReaderResult::Completed);
+		REQUIRE(handler.count == 100);
+		REQUIRE(handler.sum == (99 * 100 / 2 * 0.5));
+		REQUIRE(reader.read(handler) == JSONReaderResult::EndOfStream);
+	}
+
+	SECTION("early termination")
+	{
+		struct StopHandler : IJSONReaderHandler
+		{
+			size_t count = 0;
+
+			bool onBeginObject() override
+			{
+				return (++count < 3);
+			}
+		};
+
+		JSONReader reader{ FileSystem::FullPath(U"test/runtime/json/reader.json") };
+		StopHandler handler;
+		REQUIRE(reader.read(handler) == JSONReaderResult::Aborted);
+		REQUIRE(handler.count == 3);
+	}
+
+	SECTION("depth limit")
+	{
+		const FilePath path = FileSystem::FullPath(U"test/runtime/json/reader_depth.json");
+		{
+			TextWriter writer{ path, TextEncoding::UTF8_NO_BOM };
+			writer.write(U"[[[[1]]]]");
+		}
+
+		JSONReader reader{ path };
+		reader.setMaxDepth(3);
+
+		IJSONReaderHandler handler;
+		REQUIRE(reader.read(handler) == JSONReaderResult::DepthLimitExceeded);
+	}
+
+	SECTION("readLine()")
+	{
+		const FilePath path = FileSystem::FullPath(U"test/runtime/json/reader.ndjson");
+		{
+			TextWriter writer{ path, TextEncoding::UTF8_NO_BOM };
+			writer.writeln(U"{\"score\":1}");
+			writer.writeln(U"");
+			writer.writeln(U"{\"score\":2, broken");
+			writer.writeln(U"{\"score\":3.5}");
+		}
+
+		JSONReader reader{ path, 16 };
+		JSONScoreSumHandler handler;
+
+		REQUIRE(reader.readLine(handler) == JSONReaderResult::Completed);
+		REQUIRE(reader.lineNumber() == 1);
+		REQUIRE(reader.readLine(handler) == JSONReaderResult::ParseError);
+		REQUIRE(reader.lineNumber() == 3);
+		REQUIRE(reader.readLine(handler) == JSONReaderResult::Completed);
+		REQUIRE(reader.lineNumber() == 4);
+		REQUIRE(reader.readLine(handler) == JSONReaderResult::EndOfStream);
+		REQUIRE(handler.sum == 6.5);
+
+		reader.open(path);
+		JSON json;
+		REQUIRE(reader.readLine(json) == JSONReaderResult::Completed);
+		REQUIRE(json[U"score"].get<int32>() == 1);
+		REQUIRE(reader.readLine(json) == JSONReaderResult::ParseError);
+		REQUIRE(reader.readLine(json) == JSONReaderResult::Completed);
+		REQUIRE(json[U"score"].get<double>() == 3.5);
+		REQUIRE(reader.readLine(json) == JSONReaderResult::EndOfStream);
+	}
+
+	SECTION("Invalid")
+	{
+		JSONReader reader{ U"test/runtime/json/not_found.ndjson" };
+		REQUIRE_FALSE(reader);
+
+		IJSONReaderHandler handler;
+		REQUIRE(reader.read(handler) == JSONReaderResult::NotOpen);
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("JSON::Load() : benchmark")
+{
+	const FilePath path = FileSystem::FullPath(U"test/runtime/json/benchmark.json");
+	{
+		TextWriter writer{ path, TextEncoding::UTF8_NO_BOM };
+		writer.write(MakeJSONTestText(50000));
+	}
+
+	BENCHMARK("JSON::Parse(TextReader::readAll())")
+	{
+		return JSON::Parse(TextReader{ path }.readAll()).size();
+	};
+
+	BENCHMARK("JSON::Load()")
+	{
+		return JSON::Load(path).size();
+	};
+
+	const JSON json = JSON::Load(path);
+
+	BENCHMARK("JSON::operator []")
+	{
+		double sum = 0.0;
+
+		for (const auto& item : json[U"items"].arrayView())
+		{
+			sum += item[U"score"].get<double>();
+		}
+
+		return sum;
+	};
+
+	BENCHMARK("JSONView::operator []")
+	{
+		double sum = 0.0;
+
+		for (const auto& item : json.view()["items"])
+		{
+			sum += item["score"].get<double>();
+		}
+
+		return sum;
+	};
+}
+
+TEST_CASE("JSONReader : benchmark")
+{
+	const FilePath path = FileSystem::FullPath(U"test/runtime/json/benchmark.ndjson");
+	WriteNDJSONTestFile(path, 200000);
+
+	BENCHMARK("TextReader::readLine() + JSON::Parse()")
+	{
+		TextReader reader{ path };
+		String line;
+		double sum = 0.0;
+
+		while (reader.readLine(line))
+		{
+			sum += JSON::Parse(line)[U"score"].get<double>();
+		}
+
+		return sum;
+	};
+
+	BENCHMARK("JSONReader::readLine(JSON&)")
+	{
+		JSONReader reader{ path };
+		JSON json;
+		double sum = 0.0;
+
+		while (reader.readLine(json) == JSONReaderResult::Completed)
+		{
+			sum += json.view()["score"].get<double>();
+		}
+
+		return sum;
+	};
+
+	BENCHMARK("JSONReader::readLine(IJSONReaderHandler&)")
+	{
+		JSONReader reader{ path };
+		JSONScoreSumHandler handler;
+
+		while (reader.readLine(handler) == JSONReaderResult::Completed) {}
+
+		return handler.sum;
+	};
+}
+
+# endif
@@ -0,0 +1,98 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("Logger : async")
+{
+	const FilePath path = FileSystem::FullPath(U"test/runtime/logger/async.log");
+	FileSystem::Remove(path);
+
+	REQUIRE(Logger.openFile({ .path = path, .maxFileSize = 0 }));
+
+	Logger.setAsync();
+
+# if !SIV3D_PLATFORM(WEB) || defined(__EMSCRIPTEN_PTHREADS__)
+	REQUIRE(Logger.isAsync());
+# else
+	// スレッドを使えないため同期モードのまま
+	REQUIRE_FALSE(Logger.isAsync());
+# endif
+
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		Logger << U"async log " << i;
+	}
+
+	Logger.flush();
+
+	{
+		const Array<String> lines = TextReader{ path }.readLines()
+			.filter([](const String& line) { return line.includes(U"async log "); });
+		REQUIRE(lines.size() == 1000);
+		REQUIRE(lines.front().ends_with(U"async log 0"));
+		REQUIRE(lines.back().ends_with(U"async log 999"));
+	}
+
+	Logger.setSync();
+	REQUIRE_FALSE(Logger.isAsync());
+	Logger.closeFile();
+}
+
+TEST_CASE("Logger : file rotation")
+{
+	const FilePath path = FileSystem::FullPath(U"test/runtime/logger/rotation.log");
+
+	for (const auto& p : { path, (path + U".1"), (path + U".2") })
+	{
+		FileSystem::Remove(p);
+	}
+
+	REQUIRE(Logger.openFile({ .path = path, .maxFileSize = 1024, .maxBackupFiles = 1 }));
+
+	for (int32 i = 0; i < 200; ++i)
+	{
+		Logger << U"rotation " << i;
+	}
+
+	Logger.closeFile();
+
+	REQUIRE(FileSystem::Exists(path + U".1"));
+	REQUIRE_FALSE(FileSystem::Exists(path + U".2"));
+	REQUIRE(FileSystem::FileSize(path + U".1") <= 2048);
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Logger : benchmark")
+{
+	BENCHMARK("Logger | sync | 10000")
+	{
+		for (int32 i = 0; i < 10000; ++i)
+		{
+			Logger.writeln(U"benchmark");
+		}
+	};
+
+	Logger.setAsync();
+
+	BENCHMARK("Logger | async | 10000")
+	{
+		for (int32 i = 0; i < 10000; ++i)
+		{
+			Logger.writeln(U"benchmark");
+		}
+	};
+
+	Logger.setSync();
+}
+
+# endif
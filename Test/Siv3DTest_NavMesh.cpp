@@ -0,0 +1,246 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	// 障害物が格子状に並んだ地形
+	[[nodiscard]]
+	Polygon MakeNavMeshTestMap(const int32 cells)
+	{
+		const double size = (cells * 20.0);
+		Array<Array<Vec2>> holes;
+
+		for (int32 y = 0; y < cells; ++y)
+		{
+			for (int32 x = 0; x < cells; ++x)
+			{
+				holes << RectF{ (x * 20.0 + 8.0), (y * 20.0 + 8.0), 6.0 }.asPolygon().outer().reversed();
+			}
+		}
+
+		return Polygon{ RectF{ -10, -10, (size + 20), (size + 20) }.asPolygon().outer(), holes };
+	}
+
+	[[nodiscard]]
+	Array<std::pair<Vec2, Vec2>> MakeNavMeshRequests(const size_t count, const double size)
+	{
+		Array<std::pair<Vec2, Vec2>> requests;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const double t = (static_cast<double>(i) / count);
+			requests.emplace_back(Vec2{ 2.0, (t * size + 2.0) }, Vec2{ (size - 2.0), ((1.0 - t) * size + 2.0) });
+		}
+
+		return requests;
+	}
+
+	// 経路の再利用では始点と終点がナビメッシュ上に射影されるため、誤差を許容して比較する
+	[[nodiscard]]
+	bool NavMeshPathsApproxEqual(const Array<Vec2>& a, const Array<Vec2>& b)
+	{
+		if (a.size() != b.size())
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < a.size(); ++i)
+		{
+			if (0.01 <= a[i].distanceFrom(b[i]))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+TEST_CASE("NavMesh::queryBatch()")
+{
+	const NavMesh navMesh{ MakeNavMeshTestMap(8) };
+	REQUIRE(navMesh.isValid());
+
+	const Array<std::pair<Vec2, Vec2>> requests = MakeNavMeshRequests(200, 160.0);
+	const Array<Array<Vec2>> paths = navMesh.queryBatch(requests);
+	REQUIRE(paths.size() == requests.size());
+
+	for (size_t i = 0; i < requests.size(); ++i)
+	{
+		REQUIRE(paths[i] == navMesh.query(requests[i].first, requests[i].second));
+	}
+
+	REQUIRE(NavMesh{}.queryBatch(requests).all([](const Array<Vec2>& path) { return path.isEmpty(); }));
+}
+
+TEST_CASE("NavMeshCorridor")
+{
+	const NavMesh navMesh{ MakeNavMeshTestMap(8) };
+	NavMeshCorridor corridor;
+	Array<Vec2> path;
+
+	// 目的地が少しずつ動く場合は経路探索を繰り返さない
+	for (int32 i = 0; i < 30; ++i)
+	{
+		const Vec2 start{ 2.0, 2.0 };
+		const Vec2 end{ 158.0, (150.0 - i * 0.2) };
+		navMesh.query(start, end, corridor, path);
+
+		REQUIRE(path.size() >= 2);
+		REQUIRE(path.back().distanceFrom(end) < 0.01);
+	}
+
+	REQUIRE(corridor.searchCount() == 1);
+
+	// ナビメッシュを構築し直した場合は経路探索を最初から行う
+	NavMesh other{ MakeNavMeshTestMap(8) };
+	other.query(Vec2{ 2.0, 2.0 }, Vec2{ 158.0, 140.0 }, corridor, path);
+	REQUIRE(corridor.searchCount() == 2);
+	REQUIRE(NavMeshPathsApproxEqual(path, other.query(Vec2{ 2.0, 2.0 }, Vec2{ 158.0, 140.0 })));
+
+	corridor.clear();
+	REQUIRE(corridor.isEmpty());
+
+	Array<NavMeshCorridor> corridors;
+	Array<Array<Vec2>> paths;
+	const Array<std::pair<Vec2, Vec2>> requests = MakeNavMeshRequests(100, 160.0);
+	navMesh.queryBatch(requests, corridors, paths);
+	REQUIRE(corridors.size() == requests.size());
+
+	const Array<Array<Vec2>> expected = navMesh.queryBatch(requests);
+
+	for (size_t i = 0; i < requests.size(); ++i)
+	{
+		REQUIRE(NavMeshPathsApproxEqual(paths[i], expected[i]));
+	}
+}
+
+TEST_CASE("NavMesh : tiled")
+{
+	NavMeshConfig config;
+	config.tileSize = 32;
+
+	NavMesh navMesh{ RectF{ 0, 0, 160, 160 }.asPolygon(), config };
+	REQUIRE(navMesh.isValid());
+	REQUIRE(navMesh.isTiled());
+	REQUIRE(not NavMesh{ RectF{ 0, 0, 160, 160 }.asPolygon() }.isTiled());
+
+	const Vec2 start{ 5.0, 80.0 };
+	const Vec2 end{ 155.0, 80.0 };
+	REQUIRE(navMesh.query(start, end).size() == 2);
+
+	// 下端から y = 150 までをふさぐ壁
+	const auto wall = navMesh.addObstacle(RectF{ 70, -10, 20, 160 }.asPolygon());
+	REQUIRE(wall);
+	REQUIRE(navMesh.num_dirtyTiles() > 0);
+	REQUIRE(navMesh.num_dirtyTiles() < 25);
+
+	// 再構築するまでは以前のナビメッシュが使われる
+	REQUIRE(navMesh.query(start, end).size() == 2);
+
+	REQUIRE(navMesh.rebuildTiles());
+	REQUIRE(navMesh.num_dirtyTiles() == 0);
+
+	const Array<Vec2> path = navMesh.query(start, end);
+	REQUIRE(path.size() > 2);
+	REQUIRE(path.any([](const Vec2& p) { return (p.y > 150.0); }));
+
+	REQUIRE(navMesh.removeGeometry(*wall));
+	REQUIRE(not navMesh.removeGeometry(*wall));
+
+	AsyncTask<bool> task = navMesh.rebuildTilesAsync();
+	REQUIRE(task.get());
+	REQUIRE(navMesh.query(start, end).size() == 2);
+
+	// 地形データと障害物の ID を取り違えた場合は失敗する
+	REQUIRE(not navMesh.updateObstacle(0, RectF{ 0, 0, 40, 40 }.asPolygon()));
+	REQUIRE(navMesh.updateGeometry(0, RectF{ 0, 0, 40, 40 }.asPolygon()));
+	REQUIRE(navMesh.rebuildTiles());
+	REQUIRE(navMesh.query(start, end).isEmpty());
+
+	// タイルに分割していない場合は変更できない
+	NavMesh other{ RectF{ 0, 0, 160, 160 }.asPolygon() };
+	REQUIRE(not other.addGeometry(RectF{ 0, 0, 40, 40 }.asPolygon()));
+	REQUIRE(not other.rebuildTiles());
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("NavMesh::queryBatch() : benchmark")
+{
+	const NavMesh navMesh{ MakeNavMeshTestMap(32) };
+	const Array<std::pair<Vec2, Vec2>> requests = MakeNavMeshRequests(2000, 640.0);
+	Array<Array<Vec2>> paths(requests.size());
+
+	BENCHMARK("NavMesh::query() | 2000")
+	{
+		for (size_t i = 0; i < requests.size(); ++i)
+		{
+			navMesh.query(requests[i].first, requests[i].second, paths[i]);
+		}
+
+		return paths.size();
+	};
+
+	BENCHMARK("NavMesh::queryBatch() | 2000")
+	{
+		navMesh.queryBatch(requests, paths);
+		return paths.size();
+	};
+
+	Array<NavMeshCorridor> corridors;
+	navMesh.queryBatch(requests, corridors, paths);
+
+	// 目的地がわずかに動いたときの再計算
+	Array<std::pair<Vec2, Vec2>> movedRequests = requests;
+
+	BENCHMARK("NavMesh::queryBatch() with NavMeshCorridor | 2000")
+	{
+		for (auto& request : movedRequests)
+		{
+			request.second.y += 0.01;
+		}
+
+		navMesh.queryBatch(movedRequests, corridors, paths);
+		return paths.size();
+	};
+}
+
+TEST_CASE("NavMesh : tiled : benchmark")
+{
+	const Polygon map = MakeNavMeshTestMap(32);
+	NavMeshConfig config;
+	config.tileSize = 64;
+
+	BENCHMARK("NavMesh::build()")
+	{
+		return NavMesh{ map }.isValid();
+	};
+
+	BENCHMARK("NavMesh::build() | tiled")
+	{
+		return NavMesh{ map, config }.isValid();
+	};
+
+	NavMesh navMesh{ map, config };
+	const NavMeshGeometryID obstacle = navMesh.addObstacle(RectF{ 300, 300, 4, 4 }.asPolygon()).value();
+
+	// 障害物を 1 つ動かしたときの再構築
+	BENCHMARK("NavMesh::rebuildTiles() | 1 obstacle")
+	{
+		navMesh.updateObstacle(obstacle, RectF{ 300, 300, 4, 4 }.asPolygon());
+		return navMesh.rebuildTiles();
+	};
+}
+
+# endif
@@ -0,0 +1,68 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	[[nodiscard]]
+	Array<size_t> SimulateParticleCounts(ParticleSystem2DParameters parameters, const bool structureOfArrays, const bool parallelUpdate)
+	{
+		parameters.structureOfArrays = structureOfArrays;
+		parameters.parallelUpdate = parallelUpdate;
+
+		ParticleSystem2D system{ Vec2{ 0, 0 }, Vec2{ 0, 100 }, CircleEmitter2D{}, parameters, Texture{} };
+		Array<size_t> counts;
+
+		for (int32 i = 0; i < 90; ++i)
+		{
+			system.update(1.0 / 60.0);
+			counts << system.num_particles();
+		}
+
+		return counts;
+	}
+}
+
+TEST_CASE("ParticleSystem2D structure of arrays")
+{
+	ParticleSystem2DParameters parameters;
+	parameters.rate = 2000;
+	parameters.maxParticles = 100000;
+	parameters.startLifeTime = 0.5;
+
+	const Array<size_t> expected = SimulateParticleCounts(parameters, false, false);
+	REQUIRE(expected.back() != 0);
+	REQUIRE(SimulateParticleCounts(parameters, true, false) == expected);
+
+	parameters.rate = 200000;
+	parameters.maxParticles = 1000000;
+	REQUIRE(SimulateParticleCounts(parameters, true, true) == SimulateParticleCounts(parameters, false, false));
+}
+
+TEST_CASE("ParticleSystem2D storage switch")
+{
+	ParticleSystem2DParameters parameters;
+	parameters.rate = 1000;
+
+	ParticleSystem2D system{ Vec2{ 0, 0 }, Vec2{ 0, 0 }, CircleEmitter2D{}, parameters, Texture{} };
+	system.update(0.25);
+	const size_t count = system.num_particles();
+	REQUIRE(count != 0);
+
+	parameters.structureOfArrays = true;
+	system.setParameters(parameters);
+	REQUIRE(system.num_particles() == count);
+
+	parameters.structureOfArrays = false;
+	system.setParameters(parameters);
+	REQUIRE(system.num_particles() == count);
+}
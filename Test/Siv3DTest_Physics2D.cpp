@@ -0,0 +1,71 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("P2World queries")
+{
+	P2World world;
+	const P2Body a = world.createCircle(P2Static, Vec2{ 0, 0 }, 10);
+	const P2Body b = world.createRect(P2Static, Vec2{ 100, 0 }, SizeF{ 20, 20 });
+	const P2Body c = world.createCircle(P2Static, Vec2{ 200, 0 }, 10);
+
+	// queryAABB
+	{
+		REQUIRE(world.queryAABB(RectF{ -20, -20, 140, 40 }) == Array<P2BodyID>{ a.id(), b.id() });
+		REQUIRE(world.queryAABB(RectF{ 0, 100, 10, 10 }).isEmpty());
+	}
+
+	// raycast
+	{
+		const auto hit = world.raycast(Vec2{ -100, 0 }, Vec2{ 300, 0 });
+		REQUIRE(hit.has_value());
+		REQUIRE(hit->id == a.id());
+		REQUIRE(hit->point.x == Approx(-10.0).margin(0.01));
+		REQUIRE(hit->normal.x == Approx(-1.0).margin(0.001));
+
+		REQUIRE(not world.raycast(Vec2{ -100, 50 }, Vec2{ 300, 50 }));
+		REQUIRE(not world.raycast(Vec2{ 0, 0 }, Vec2{ 0, 0 }));
+	}
+
+	// raycastAll
+	{
+		Array<P2RaycastHit> hits(10);
+		world.raycastAll(Vec2{ 300, 0 }, Vec2{ -100, 0 }, hits);
+		REQUIRE(hits.map([](const P2RaycastHit& hit) { return hit.id; }) == Array<P2BodyID>{ c.id(), b.id(), a.id() });
+		REQUIRE(std::is_sorted(hits.begin(), hits.end(), [](const P2RaycastHit& x, const P2RaycastHit& y) { return (x.fraction < y.fraction); }));
+	}
+
+	// overlapCircle
+	{
+		// AABB は重なるが、形状は重ならない
+		const Circle circle{ 120, 20, 12 };
+		REQUIRE(world.queryAABB(circle.boundingRect()) == Array<P2BodyID>{ b.id() });
+		REQUIRE(world.overlapCircle(circle).isEmpty());
+
+		REQUIRE(world.overlapCircle(Circle{ 160, 0, 45 }) == Array<P2BodyID>{ c.id() });
+	}
+
+	// overlapPolygon
+	{
+		const Polygon polygon{ Vec2{ -5, -5 }, Vec2{ 205, -5 }, Vec2{ 205, 5 }, Vec2{ 150, 0 }, Vec2{ -5, 5 } };
+		Array<P2BodyID> results;
+		world.overlapPolygon(polygon, results);
+		REQUIRE(results == Array<P2BodyID>{ a.id(), b.id(), c.id() });
+
+		world.overlapPolygon(Polygon{ Vec2{ 40, -5 }, Vec2{ 60, -5 }, Vec2{ 60, 5 }, Vec2{ 40, 5 } }, results);
+		REQUIRE(results.isEmpty());
+
+		// 2 頂点が b2_linearSlop より近い細い三角形。AABB は a と重なるが、形状は重ならない
+		world.overlapPolygon(Polygon{ Vec2{ 30, -20 }, Vec2{ 30.001, -20 }, Vec2{ -20, 60 } }, results);
+		REQUIRE(results.isEmpty());
+	}
+}
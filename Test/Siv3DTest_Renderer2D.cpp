@@ -0,0 +1,47 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+// バッチの統計は OpenGL 4.1 版と非グラフィックスモードのレンダラーが記録する
+# if SIV3D_PLATFORM(MACOS) || SIV3D_PLATFORM(LINUX)
+
+TEST_CASE("Renderer2D batch stat")
+{
+	System::Update();
+
+	// 20,000 個の長方形 (80,000 頂点, 120,000 インデックス)
+	for (int32 i = 0; i < 20000; ++i)
+	{
+		Rect{ (i % 200), (i / 200), 1 }.draw();
+	}
+
+	System::Update();
+
+	const ProfilerStat& stat = Profiler::GetStat();
+	const uint64 vertexStride = ((g_engineOptions.vertex2DColor == EngineOption::Vertex2DColor::UNorm8) ? 20 : sizeof(Vertex2D));
+	const uint64 indexStride = ((g_engineOptions.vertex2DIndex == EngineOption::Vertex2DIndex::UInt32) ? sizeof(uint32) : sizeof(Vertex2D::IndexType));
+
+	REQUIRE(stat.vertexUploadBytes >= (80000 * vertexStride));
+	REQUIRE(stat.indexUploadBytes >= (120000 * indexStride));
+
+	if (g_engineOptions.vertex2DIndex == EngineOption::Vertex2DIndex::UInt16)
+	{
+		// 16-bit インデックスでは 1 バッチあたり 65,535 頂点まで
+		REQUIRE(stat.batchCount >= 2);
+	}
+	else
+	{
+		REQUIRE(stat.batchCount >= 1);
+	}
+}
+
+# endif
@@ -0,0 +1,66 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("Script bytecode cache")
+{
+	const FilePath directory = FileSystem::FullPath(U"test/runtime/script/");
+	const FilePath cacheDirectory = (directory + U"cache/");
+	const FilePath path = (directory + U"value.as");
+
+	const auto writeScript = [&](const int32 value)
+	{
+		TextWriter writer{ path };
+		writer << U"int Value() { return {}; }"_fmt(value);
+	};
+
+	const auto loadValue = [&]()
+	{
+		const Script script{ path, ScriptCompileOption::UseBytecodeCache };
+		REQUIRE(script.compiled());
+		return script.getFunction<int32()>(U"Value")();
+	};
+
+	FileSystem::Remove(directory);
+	Script::SetBytecodeCacheDirectory(cacheDirectory);
+
+	// コンパイルしてキャッシュを作成する
+	writeScript(1);
+	REQUIRE(loadValue() == 1);
+
+	const Array<FilePath> caches = FileSystem::DirectoryContents(cacheDirectory);
+	REQUIRE(caches.size() == 1);
+
+	SECTION("Cache is used while the script is unchanged")
+	{
+		REQUIRE(loadValue() == 1);
+	}
+
+	SECTION("Cache with a stale hash is rejected")
+	{
+		writeScript(2);
+		REQUIRE(loadValue() == 2);
+	}
+
+	SECTION("Truncated cache falls back to compiling")
+	{
+		Blob blob{ caches.front() };
+		REQUIRE(blob.size() > 16);
+		blob.resize(blob.size() / 2);
+		REQUIRE(blob.save(caches.front()));
+
+		REQUIRE(loadValue() == 1);
+	}
+
+	Script::SetBytecodeCacheDirectory(U"script_cache/");
+	FileSystem::Remove(directory);
+}
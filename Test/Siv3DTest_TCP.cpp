@@ -0,0 +1,281 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace s3dTest
+{
+	template <class Predicate>
+	static bool WaitFor(Predicate predicate)
+	{
+		const Stopwatch stopwatch{ StartImmediately::Yes };
+
+		while (stopwatch < 5s)
+		{
+			if (predicate())
+			{
+				return true;
+			}
+
+			System::Sleep(1ms);
+		}
+
+		return false;
+	}
+
+	[[nodiscard]]
+	static Array<std::unique_ptr<TCPClient>> ConnectClients(TCPServer& server, const uint16 port, const size_t count)
+	{
+		Array<std::unique_ptr<TCPClient>> clients;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			auto& client = clients.emplace_back(std::make_unique<TCPClient>());
+			client->connect(IPv4Address::Localhost(), port);
+		}
+
+		WaitFor([&]() { return ((server.num_sessions() == count) && clients.all([](const auto& client) { return client->isConnected(); })); });
+
+		return clients;
+	}
+}
+
+TEST_CASE("TCPServer : peek and stats")
+{
+	constexpr uint16 Port = 50817;
+
+	TCPServer server;
+	server.startAccept(Port);
+
+	TCPClient client;
+	REQUIRE(client.connect(IPv4Address::Localhost(), Port));
+	REQUIRE(s3dTest::WaitFor([&]() { return (client.isConnected() && server.hasSession()); }));
+
+	// 受信バッファの初期容量 (64 KiB) を超え、リングバッファが折り返すまで送る
+	constexpr int32 MessageCount = 100000;
+
+	for (int32 i = 0; i < MessageCount; ++i)
+	{
+		REQUIRE(client.send(i));
+	}
+
+	int32 expected = 0;
+
+	REQUIRE(s3dTest::WaitFor([&]()
+	{
+		const TCPReceivedSpans spans = server.peek();
+		const size_t count = (spans.size() / sizeof(int32));
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			int32 value = 0;
+			const size_t offset = (i * sizeof(int32));
+
+			if ((offset + sizeof(int32)) <= spans.first.size())
+			{
+				std::memcpy(&value, (spans.first.data() + offset), sizeof(int32));
+			}
+			else
+			{
+				// 折り返しをまたぐ値は read() で取り出す
+				REQUIRE(server.skip(offset));
+				REQUIRE(server.read(value));
+				REQUIRE(value == expected++);
+				return false;
+			}
+
+			REQUIRE(value == expected++);
+		}
+
+		REQUIRE(server.skip(count * sizeof(int32)));
+
+		return (expected == MessageCount);
+	}));
+
+	REQUIRE(server.available() == 0);
+
+	const TCPSessionStats serverStats = server.getStats();
+	CHECK(serverStats.bytesReceived == (MessageCount * sizeof(int32)));
+	CHECK(serverStats.receiveQueueBytes == 0);
+
+	REQUIRE(s3dTest::WaitFor([&]() { return (client.getStats().sendQueueDepth == 0); }));
+
+	const TCPSessionStats clientStats = client.getStats();
+	CHECK(clientStats.bytesSent == (MessageCount * sizeof(int32)));
+	CHECK(clientStats.sendQueueBytes == 0);
+	CHECK(clientStats.maxSendQueueDepth >= 1);
+	CHECK(clientStats.numSendBatches <= static_cast<uint64>(MessageCount));
+
+	client.disconnect();
+	server.disconnect();
+}
+
+TEST_CASE("TCPServer : messages")
+{
+	constexpr uint16 Port = 50818;
+	constexpr size_t ClientCount = 8;
+
+	TCPServer server{ 2 };
+	REQUIRE(server.num_IOThreads() == 2);
+	server.startAcceptMulti(Port);
+
+	const Array<std::unique_ptr<TCPClient>> clients = s3dTest::ConnectClients(server, Port, ClientCount);
+	REQUIRE(server.num_sessions() == ClientCount);
+
+	// 受信バッファの初期容量 (64 KiB) より大きいメッセージを含める
+	const Array<size_t> sizes = { 0, 1, 5, 1000, 200000, 3 };
+
+	for (const auto& client : clients)
+	{
+		for (const size_t size : sizes)
+		{
+			const Array<Byte> message(size, Byte{ static_cast<uint8>(size) });
+			REQUIRE(client->sendMessage(message.data(), message.size()));
+		}
+	}
+
+	// サーバは受信したメッセージをそのまま送り返す
+	HashTable<TCPSessionID, size_t> receivedCounts;
+	size_t received = 0;
+	Array<Byte> message;
+
+	REQUIRE(s3dTest::WaitFor([&]()
+	{
+		TCPSessionID id;
+
+		while (server.readAnyMessage(id, message))
+		{
+			const size_t size = sizes[receivedCounts[id]++];
+			REQUIRE(message.size() == size);
+			REQUIRE(message.all([=](const Byte b) { return (b == Byte{ static_cast<uint8>(size) }); }));
+			REQUIRE(server.sendMessage(message.data(), message.size(), id));
+			++received;
+		}
+
+		return (received == (ClientCount * sizes.size()));
+	}));
+
+	for (const auto& client : clients)
+	{
+		size_t echoed = 0;
+
+		REQUIRE(s3dTest::WaitFor([&]()
+		{
+			while (client->readMessage(message))
+			{
+				REQUIRE(message.size() == sizes[echoed++]);
+			}
+
+			return (echoed == sizes.size());
+		}));
+	}
+
+	server.disconnect();
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("TCPServer : loopback benchmark")
+{
+	constexpr uint16 Port = 50819;
+
+	// 1 セッションあたり同時に送信するメッセージの数
+	constexpr size_t Window = 4;
+
+	// 計測するメッセージの総数
+	constexpr size_t TotalMessages = 200000;
+
+	for (const size_t numIOThreads : { 1, 4 })
+	{
+		for (const size_t sessionCount : { 1, 10, 100, 1000 })
+		{
+			TCPServer server{ numIOThreads };
+			server.startAcceptMulti(Port);
+
+			const Array<std::unique_ptr<TCPClient>> clients = s3dTest::ConnectClients(server, Port, sessionCount);
+
+			if (server.num_sessions() != sessionCount)
+			{
+				Console << U"TCPServer | {} threads | {} sessions | failed to connect"_fmt(numIOThreads, sessionCount);
+				continue;
+			}
+
+			const size_t messagesPerSession = Max<size_t>((TotalMessages / sessionCount), Window);
+
+			// メッセージには送信時刻を入れ、往復にかかった時間を計測する
+			std::array<uint64, 8> payload{};
+			Array<size_t> sentCounts(sessionCount, 0);
+			Array<uint64> latencies;
+			latencies.reserve(sessionCount * messagesPerSession);
+
+			const auto sendNext = [&](const size_t i)
+			{
+				payload[0] = Time::GetNanosec();
+				clients[i]->sendMessage(payload.data(), sizeof(payload));
+				++sentCounts[i];
+			};
+
+			const uint64 startTime = Time::GetNanosec();
+
+			for (size_t i = 0; i < sessionCount; ++i)
+			{
+				for (size_t k = 0; k < Window; ++k)
+				{
+					sendNext(i);
+				}
+			}
+
+			Array<Byte> message;
+			const size_t expected = (sessionCount * messagesPerSession);
+
+			while (latencies.size() < expected)
+			{
+				TCPSessionID id;
+
+				while (server.readAnyMessage(id, message))
+				{
+					server.sendMessage(message.data(), message.size(), id);
+				}
+
+				for (size_t i = 0; i < sessionCount; ++i)
+				{
+					while (clients[i]->readMessage(message))
+					{
+						uint64 sentTime;
+						std::memcpy(&sentTime, message.data(), sizeof(sentTime));
+						latencies << (Time::GetNanosec() - sentTime);
+
+						if (sentCounts[i] < messagesPerSession)
+						{
+							sendNext(i);
+						}
+					}
+				}
+
+				if ((Time::GetNanosec() - startTime) > 60'000'000'000)
+				{
+					break;
+				}
+			}
+
+			const double seconds = ((Time::GetNanosec() - startTime) / 1e9);
+			std::sort(latencies.begin(), latencies.end());
+			const uint64 p99 = (latencies ? latencies[(latencies.size() - 1) * 99 / 100] : 0);
+
+			Console << U"TCPServer | {} threads | {} sessions | {:.0f} messages/s | p99 {:.1f} us"_fmt(
+				numIOThreads, sessionCount, (latencies.size() / seconds), (p99 / 1e3));
+
+			server.disconnect();
+		}
+	}
+}
+
+# endif
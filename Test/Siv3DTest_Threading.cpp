@@ -0,0 +1,180 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("Threading::ParallelFor()")
+{
+	for (const size_t count : { 1, 7, 1024, 1024 * 1024 })
+	{
+		Array<uint8> visited(count, 0);
+
+		Threading::ParallelFor(count, [&](size_t first, size_t last)
+		{
+			for (size_t i = first; i < last; ++i)
+			{
+				++visited[i];
+			}
+		});
+
+		REQUIRE(visited.all([](uint8 n) { return (n == 1); }));
+	}
+
+	{
+		std::atomic<size_t> sum{ 0 };
+
+		Threading::ParallelFor(1000, [&](size_t i) { sum += i; }, 16);
+
+		REQUIRE(sum == 499500);
+	}
+
+	{
+		std::atomic<size_t> total{ 0 };
+
+		Threading::ParallelFor(16, [&](size_t)
+		{
+			Threading::ParallelFor(100, [&](size_t) { ++total; });
+		});
+
+		REQUIRE(total == 1600);
+	}
+
+	{
+		REQUIRE_THROWS_AS(Threading::ParallelFor(100, [](size_t i)
+		{
+			if (i == 50)
+			{
+				throw std::runtime_error{ "ParallelFor" };
+			}
+		}, 1), std::runtime_error);
+	}
+}
+
+TEST_CASE("Threading::Submit()")
+{
+	Array<std::future<int32>> futures;
+
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		futures << Threading::Submit([](int32 n) { return (n * 2); }, i);
+	}
+
+	int64 sum = 0;
+
+	for (auto& future : futures)
+	{
+		sum += future.get();
+	}
+
+	REQUIRE(sum == 999000);
+}
+
+TEST_CASE("Threading::SetWorkerCount()")
+{
+	const size_t defaultWorkerCount = Threading::GetWorkerCount();
+
+	Threading::SetWorkerCount(3);
+	REQUIRE(Threading::GetWorkerCount() == 3);
+	REQUIRE(Threading::Submit([] { return 42; }).get() == 42);
+
+	Threading::SetWorkerCount(0);
+	REQUIRE(Threading::GetWorkerCount() == defaultWorkerCount);
+
+	// ワーカースレッドから呼んだ場合は、自分自身の終了を待たないよう無視される
+	Threading::Submit([] { Threading::SetWorkerCount(1); }).get();
+	REQUIRE(Threading::GetWorkerCount() == defaultWorkerCount);
+}
+
+TEST_CASE("Threading::Submit() while changing the worker count")
+{
+	std::atomic<bool> done{ false };
+
+	std::thread resizer{ [&]()
+	{
+		for (size_t i = 0; i < 50; ++i)
+		{
+			Threading::SetWorkerCount(1 + (i % 3));
+		}
+
+		done = true;
+	} };
+
+	Array<std::future<size_t>> futures;
+
+	for (size_t i = 0; ((i < 1000) || (not done)); ++i)
+	{
+		futures << Threading::Submit([i]() { return i; });
+	}
+
+	resizer.join();
+
+	// 停止処理と入れ違いに投入されたタスクも、すべて実行される
+	for (size_t i = 0; i < futures.size(); ++i)
+	{
+		REQUIRE(futures[i].get() == i);
+	}
+
+	Threading::SetWorkerCount(0);
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Threading::ParallelFor() : benchmark")
+{
+	// 呼び出しごとにスレッドを作成する従来の方式
+	const auto countWithAsync = [](const Array<double>& v)
+	{
+		const size_t numThreads = Threading::GetConcurrency();
+		const size_t countPerThread = Max<size_t>(1, (v.size() + (numThreads - 1)) / numThreads);
+
+		Array<std::future<std::ptrdiff_t>> futures;
+
+		for (size_t i = 0; i < v.size(); i += countPerThread)
+		{
+			const auto first = v.begin() + i;
+			const auto last = v.begin() + Min(i + countPerThread, v.size());
+
+			futures.emplace_back(std::async(std::launch::async, [=]() { return std::count_if(first, last, [](double x) { return x < 0.5; }); }));
+		}
+
+		size_t result = 0;
+
+		for (auto& future : futures)
+		{
+			result += future.get();
+		}
+
+		return result;
+	};
+
+	for (const size_t size : { 8, 1024, 64 * 1024, 1024 * 1024 })
+	{
+		Array<double> v(size);
+		for (size_t i = 0; i < v.size(); ++i)
+		{
+			v[i] = Random();
+		}
+
+		const std::string suffix = (" | " + std::to_string(size));
+
+		BENCHMARK("std::async" + suffix)
+		{
+			return countWithAsync(v);
+		};
+
+		BENCHMARK("Array::parallel_count_if()" + suffix)
+		{
+			return v.parallel_count_if([](double x) { return x < 0.5; });
+		};
+	}
+}
+
+# endif
@@ -51,4 +51,94 @@ TEST_CASE("Unicode")
 		REQUIRE(Unicode::ToUTF32(U"OpenSiv3D") == U"OpenSiv3D");
 		REQUIRE(Unicode::ToUTF32(U"あいうえお") == U"あいうえお");
 	}
+
+	SECTION("Invalid sequences")
+	{
+		// 不正なバイト列は 1 バイトずつ U+FFFD に置き換える
+		REQUIRE(Unicode::FromUTF8("\xFF") == U"\uFFFD");
+		REQUIRE(Unicode::FromUTF8("abc\xE3\x81") == U"abc\uFFFD\uFFFD");
+		REQUIRE(Unicode::FromUTF8("\xC0\xAF") == U"\uFFFD\uFFFD");
+		REQUIRE(Unicode::FromUTF8("\xF4\x90\x80\x80") == U"\uFFFD\uFFFD\uFFFD\uFFFD");
+		REQUIRE(Unicode::UTF8ToUTF16("abc\xE3\x81") == u"abc\uFFFD\uFFFD");
+
+		const std::u16string unpaired{ u'a', char16(0xD800), u'b', char16(0xDC00) };
+		REQUIRE(Unicode::FromUTF16(unpaired) == U"a\uFFFDb\uFFFD");
+
+		REQUIRE(Unicode::ToUTF8(String(1, char32(0x110000))) == "\xEF\xBF\xBD");
+	}
+
+	SECTION("SIMD block boundaries")
+	{
+		// ASCII 文字の並びの途中に非 ASCII 文字を置き、SIMD のブロックの境界をまたぐ場合を確かめる
+		for (const char32 ch : { U'é', U'あ', U'😀' })
+		{
+			for (size_t length = 1; length <= 80; ++length)
+			{
+				for (size_t pos = 0; pos < length; ++pos)
+				{
+					String s(length, U'a');
+					s[pos] = ch;
+
+					const std::string utf8 = Unicode::ToUTF8(s);
+					REQUIRE(utf8.size() == (length - 1 + Unicode::ToUTF8(String(1, ch)).size()));
+					REQUIRE(Unicode::FromUTF8(utf8) == s);
+					REQUIRE(Unicode::UTF8ToUTF16(utf8) == Unicode::ToUTF16(s));
+					REQUIRE(Unicode::FromUTF16(Unicode::ToUTF16(s)) == s);
+				}
+			}
+		}
+	}
 }
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+namespace s3dTest
+{
+	[[nodiscard]]
+	static String RepeatText(const StringView s, const size_t count)
+	{
+		String result;
+		result.reserve(s.size() * count);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			result.append(s);
+		}
+
+		return result;
+	}
+}
+
+TEST_CASE("Unicode : benchmark")
+{
+	// 約 1M 文字の ASCII 主体、日本語主体、絵文字主体のテキスト
+	const std::array<std::pair<StringView, String>, 3> texts =
+	{{
+		{ U"ASCII-heavy", (s3dTest::RepeatText(U"The quick brown fox jumps over the lazy dog. ", 22000) + U"日本語") },
+		{ U"Japanese", s3dTest::RepeatText(U"吾輩は猫である。名前はまだ無い。どこで生れたかとんと見当がつかぬ。", 30000) },
+		{ U"Emoji", s3dTest::RepeatText(U"😀😃😄😁 🎉🎊 👍", 100000) },
+	}};
+
+	for (const auto& [name, text] : texts)
+	{
+		const std::string utf8 = Unicode::ToUTF8(text);
+		const std::u16string utf16 = Unicode::ToUTF16(text);
+
+		BENCHMARK(U"Unicode::FromUTF8() | {}"_fmt(name).narrow())
+		{
+			return Unicode::FromUTF8(utf8).size();
+		};
+
+		BENCHMARK(U"Unicode::FromUTF16() | {}"_fmt(name).narrow())
+		{
+			return Unicode::FromUTF16(utf16).size();
+		};
+
+		BENCHMARK(U"Unicode::ToUTF8() | {}"_fmt(name).narrow())
+		{
+			return Unicode::ToUTF8(text).size();
+		};
+	}
+}
+
+# endif
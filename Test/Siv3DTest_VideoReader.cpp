@@ -36,4 +36,80 @@ TEST_CASE("VideoReader")
 		REQUIRE(videoReader.getCurrentFrameIndex() == 1);
 		REQUIRE_NOTHROW(AssertImagesAreEqual(referenceFrame, frame));
 	}
+
+	SECTION("Lookahead queue keeps frames in order across seeks")
+	{
+		REQUIRE(videoReader.getLookaheadFrames() == VideoReader::DefaultLookaheadFrames);
+
+		Image frame;
+		Image referenceFrame{ U"test/video/river_frame1.png" };
+
+		for (size_t i = 0; i < 10; ++i)
+		{
+			REQUIRE(videoReader.readFrame(frame) == true);
+		}
+
+		REQUIRE(videoReader.getCurrentFrameIndex() == 10);
+
+		// 先読み済みのフレームの先にシークする
+		videoReader.setCurrentFrameIndex(40);
+		REQUIRE(videoReader.readFrame(frame) == true);
+		REQUIRE(videoReader.getCurrentFrameIndex() == 41);
+
+		// 先頭に戻る
+		videoReader.setCurrentFrameIndex(0);
+		REQUIRE(videoReader.readFrame(frame) == true);
+		REQUIRE_NOTHROW(AssertImagesAreEqual(referenceFrame, frame));
+
+		const VideoReaderStat stat = videoReader.getStat();
+		REQUIRE(stat.presentedFrames == 12);
+		REQUIRE(stat.decodedFrames >= stat.presentedFrames);
+		REQUIRE(stat.seeks >= 1);
+
+		videoReader.resetStat();
+		REQUIRE(videoReader.getStat().presentedFrames == 0);
+	}
+
+	SECTION("tryReadFrame presents frames in order and at most MaxLateFrames behind the read position")
+	{
+		Image frame;
+		Image referenceFrame{ U"test/video/river_frame1.png" };
+		Optional<size_t> lastFrameIndex;
+		uint64 presentedFrames = 0;
+		videoReader.resetStat();
+
+		// デコードの速さによらず成り立つ性質のみを確かめる
+		for (size_t index = 0; index < 120; index += 2)
+		{
+			videoReader.setCurrentFrameIndex(index);
+
+			size_t frameIndex = 0;
+
+			if (not videoReader.tryReadFrame(frame, frameIndex))
+			{
+				// 失敗した場合、読み込み位置は変わらない
+				REQUIRE(videoReader.getCurrentFrameIndex() == index);
+				continue;
+			}
+
+			REQUIRE(videoReader.getCurrentFrameIndex() == (index + 1));
+			REQUIRE(frameIndex <= index);
+			REQUIRE((index - frameIndex) <= VideoReader::MaxLateFrames);
+
+			if (lastFrameIndex)
+			{
+				REQUIRE(*lastFrameIndex < frameIndex);
+			}
+
+			if (frameIndex == 0)
+			{
+				REQUIRE_NOTHROW(AssertImagesAreEqual(referenceFrame, frame));
+			}
+
+			lastFrameIndex = frameIndex;
+			++presentedFrames;
+		}
+
+		REQUIRE(videoReader.getStat().presentedFrames == presentedFrames);
+	}
 }